@@ -0,0 +1,34 @@
+/**
+ * @file collections_config.hpp
+ * @brief Compile-time configuration shared by every container
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2025-01-28
+ * 
+ * @details Define the macros below before including any library
+ * header (or pass them with -D) to override the defaults.
+ */
+
+#ifndef COLLECTIONS_CONFIG_HPP
+#define COLLECTIONS_CONFIG_HPP
+
+/**
+ * @def COLLECTIONS_BOUNDS_CHECK
+ * @brief Enables bounds checking in operator[] of the array containers
+ * 
+ * @details When non-zero, operator[] of Vector, SmallVector, Stack and
+ * Deque throws std::out_of_range for an index past the end, exactly
+ * like at(). When zero, operator[] performs no check so tight loops
+ * can be fully optimized, and an out of range index is undefined
+ * behaviour. at() is always checked. Defaults to on, unless NDEBUG is
+ * defined.
+ */
+#ifndef COLLECTIONS_BOUNDS_CHECK
+# ifdef NDEBUG
+#  define COLLECTIONS_BOUNDS_CHECK 0
+# else
+#  define COLLECTIONS_BOUNDS_CHECK 1
+# endif
+#endif
+
+#endif
@@ -0,0 +1,67 @@
+/**
+ * @file backoff.hpp
+ * @brief Spin-then-yield waiting for the concurrent containers
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef BACKOFF_HPP
+#define BACKOFF_HPP
+
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+/**
+ * @class Backoff
+ * @brief Exponential spin-wait that falls back to yielding
+ * 
+ * @details Used by the blocking and retrying members of the concurrent
+ * containers. Each pause() spins twice as long as the previous one,
+ * using the processor's spin-wait hint, until the limit is reached;
+ * after that it yields the thread so a waiter does not starve the
+ * thread it is waiting for.
+ * 
+ * @ingroup concurrent_containers
+ */
+class Backoff {
+public:
+	/**
+	 * @brief Waits a little longer than the previous call
+	 */
+	void pause() noexcept {
+		if (spins_ <= spin_limit) {
+			for (unsigned i = 0; i < spins_; ++i)
+				relax();
+			spins_ *= 2;
+		}
+		else
+			std::this_thread::yield();
+	}
+
+	/**
+	 * @brief Starts again from the shortest wait
+	 */
+	void reset() noexcept { spins_ = 1; }
+
+private:
+	static constexpr unsigned spin_limit = 64;  ///< Longest spin before yielding
+
+	unsigned spins_ = 1;  ///< Length of the next spin
+
+	/**
+	 * @brief Tells the processor the thread is spin-waiting
+	 */
+	static void relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+		_mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+		asm volatile("yield");
+#endif
+	}
+};
+
+#endif
@@ -0,0 +1,112 @@
+/**
+ * @file concurrent_node_pool.hpp
+ * @brief Lock-free pool recycling fixed-size nodes between threads
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef CONCURRENT_NODE_POOL_HPP
+#define CONCURRENT_NODE_POOL_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+
+#include "../memory/cache_line.hpp"
+
+/**
+ * @class ConcurrentNodePool
+ * @brief Chunked storage for nodes with a lock-free free list
+ * 
+ * @details Hands out raw storage for Value objects to any number of
+ * threads. Storage comes from chunks that double in size, 64 nodes for
+ * the first one, so n nodes cost about log2(n) allocator calls; a new
+ * node is claimed from the chunks with a single fetch_add. Returned
+ * nodes go onto a Treiber free list and are handed out again before
+ * any new one is claimed. Nothing is given back to the allocator
+ * before the pool is destroyed.
+ * 
+ * Nodes are named by a 32-bit index, and the head of the free list
+ * packs the index of the first free node with a 32-bit tag that every
+ * pop increments. A pop that raced with other pops and pushes of the
+ * same node therefore fails its compare-and-swap instead of installing
+ * a stale successor (the ABA problem), using only a 64-bit atomic.
+ * 
+ * Containers that need the same protection for their own links can
+ * name nodes by index too, with index_of() and node_at().
+ * 
+ * The pool only manages storage: callers construct and destroy the
+ * Value objects themselves, and must have destroyed them all before
+ * the pool goes away.
+ * 
+ * @tparam Value Type the storage is meant for
+ * @tparam Allocator Allocator used to obtain the chunks
+ * 
+ * @ingroup concurrent_containers
+ */
+template<class Value, class Allocator = std::allocator<Value>>
+class ConcurrentNodePool {
+public:
+	using value_type		= Value;          ///< Type the storage is meant for
+	using allocator_type	= Allocator;      ///< Type of chunk allocator
+	using size_type			= unsigned long;  ///< Type for node counts
+	using pointer			= Value*;         ///< Pointer to node storage
+	using index_type		= std::uint32_t;  ///< Stable name of a node
+
+	explicit ConcurrentNodePool(const Allocator &alloc = Allocator());
+	ConcurrentNodePool(const ConcurrentNodePool &other) = delete;
+	ConcurrentNodePool &operator=(const ConcurrentNodePool &other) = delete;
+	~ConcurrentNodePool();
+
+	pointer allocate();
+	void deallocate(pointer node) noexcept;
+	void reserve(size_type count);
+	index_type index_of(pointer node) const noexcept;
+	pointer node_at(index_type index) const noexcept;
+
+	size_type capacity() const noexcept;
+	allocator_type get_allocator() const noexcept;
+
+private:
+	/**
+	 * @struct Cell
+	 * @brief Node storage together with its free list link
+	 */
+	struct Cell {
+		alignas(Value) unsigned char	storage[sizeof(Value)];  ///< Raw node storage, first so a node pointer is a cell pointer
+		std::atomic<std::uint32_t>		next_free;               ///< Index + 1 of the next free cell, 0 at the end
+		std::uint32_t					index;                   ///< Index of this cell
+
+		/**
+		 * @brief Returns the node storage
+		 * 
+		 * @return Pointer to the node slot
+		 */
+		pointer value() noexcept { return reinterpret_cast<pointer>(storage); }
+	};
+
+	using cell_allocator	= typename std::allocator_traits<Allocator>::template rebind_alloc<Cell>; ///< Allocator for the chunks
+	using cell_traits		= std::allocator_traits<cell_allocator>;                                   ///< Chunk allocator interface
+
+	static constexpr size_type	first_chunk_shift	= 6;                                ///< log2 of the first chunk size
+	static constexpr size_type	first_chunk			= size_type(1) << first_chunk_shift; ///< Cells in the first chunk
+	static constexpr size_type	max_chunks			= 32 - first_chunk_shift;           ///< Chunks addressable with 32-bit indices
+	static constexpr size_type	max_cells			= (first_chunk << max_chunks) - first_chunk; ///< Cells in all chunks together
+
+	alignas(cache_line_size) std::atomic<std::uint64_t>	free_;                 ///< Tag in the high half, first free index + 1 in the low half
+	alignas(cache_line_size) std::atomic<size_type>		claimed_;              ///< Number of cells ever claimed from the chunks
+	std::atomic<Cell *>									chunks_[max_chunks];   ///< Chunk k holds first_chunk << k cells
+	cell_allocator										alloc_;                ///< Allocator owning the chunks
+
+	Cell *cell(size_type index) const noexcept;
+	Cell *fresh_cell();
+	Cell *add_chunk(size_type chunk);
+	static size_type chunk_of(size_type index) noexcept;
+};
+
+#include "internal/concurrent_node_pool.tpp"
+
+#endif
@@ -0,0 +1,134 @@
+/**
+ * @file concurrent_skip_list.hpp
+ * @brief Lock-free ordered map shared between threads
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef CONCURRENT_SKIP_LIST_HPP
+#define CONCURRENT_SKIP_LIST_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <thread>
+#include <utility>
+
+#include "epoch_domain.hpp"
+#include "../memory/cache_line.hpp"
+
+/**
+ * @class ConcurrentSkipList
+ * @brief Lock-free skip list map for any number of reading and writing threads
+ * 
+ * @details The concurrent counterpart of SkipList, after the lock-free
+ * skip lists of Fraser and of Herlihy and Shavit. Every link word
+ * holds the successor pointer with a mark in its lowest bit. Erasing a
+ * key first marks the links of its node from the top level down, and
+ * the thread whose compare-and-swap marks level 0 owns the erasure;
+ * marked nodes are then unlinked with one compare-and-swap per level,
+ * by the eraser or by any writer that passes them. Inserting links the
+ * new node on level 0, which makes it visible, and then on the levels
+ * above.
+ * 
+ * find, contains and scan never write and never retry: they step over
+ * marked nodes instead of unlinking them. Unlinked nodes are freed
+ * through an EpochDomain, so a reader may keep following a node that
+ * was erased under it. A node is retired by whichever of its inserter
+ * and its eraser finishes last, as the inserter may still be linking
+ * upper levels when the eraser is done.
+ * 
+ * Keys are unique and a mapped value never changes once inserted, so
+ * readers copy values without further synchronisation. All members
+ * except the constructor and destructor may be called from any number
+ * of threads at once.
+ * 
+ * @tparam K Type of keys
+ * @tparam V Type of mapped values
+ * @tparam Compare Strict weak ordering on K
+ * @tparam Allocator Allocator used to obtain the nodes
+ * 
+ * @ingroup concurrent_containers
+ */
+template<class K, class V, class Compare = std::less<K>, class Allocator = std::allocator<std::pair<const K, V>>>
+class ConcurrentSkipList {
+public:
+	using key_type			= K;                      ///< Type of keys
+	using mapped_type		= V;                      ///< Type of mapped values
+	using value_type		= std::pair<const K, V>;  ///< Type of stored elements
+	using key_compare		= Compare;                ///< Key ordering
+	using allocator_type	= Allocator;              ///< Type of node allocator
+	using size_type			= unsigned long;          ///< Type for sizes
+
+	static constexpr size_type max_level = 16;  ///< Highest possible tower
+
+	explicit ConcurrentSkipList(const Compare &comp = Compare(), const Allocator &alloc = Allocator());
+	ConcurrentSkipList(const ConcurrentSkipList &other) = delete;
+	ConcurrentSkipList &operator=(const ConcurrentSkipList &other) = delete;
+	~ConcurrentSkipList();
+
+	bool insert(const key_type &key, const mapped_type &value);
+	bool erase(const key_type &key);
+	bool find(const key_type &key, mapped_type &out) const;
+	bool contains(const key_type &key) const;
+	template<class Function>
+	size_type scan(const key_type &first, const key_type &last, Function visit) const;
+
+	size_type size() const noexcept;
+	bool empty() const noexcept;
+	key_compare key_comp() const;
+	allocator_type get_allocator() const noexcept;
+
+private:
+	using Link = std::atomic<std::uintptr_t>;  ///< Successor pointer with the mark in bit 0
+
+	/**
+	 * @struct Node
+	 * @brief Element followed in memory by its tower of links
+	 * 
+	 * @details A node of height h is followed by h Link words;
+	 * tower()[i] holds the next node on level i.
+	 */
+	struct Node : EpochDomain::Retired {
+		value_type			value;   ///< Key and mapped value
+		size_type			height;  ///< Number of links in the tower
+		std::atomic<int>	owners;  ///< Inserter and eraser still working on the node
+
+		template<class... Args>
+		Node(size_type levels, Args&&... args);
+		Link *tower() noexcept;
+		const Link *tower() const noexcept;
+	};
+
+	using node_allocator	= typename std::allocator_traits<Allocator>::template rebind_alloc<Node>; ///< Allocator for node storage
+	using node_traits		= std::allocator_traits<node_allocator>;                                   ///< Node allocator interface
+
+	static constexpr std::uintptr_t mark_bit = 1;  ///< Set in a link word once its node is being erased
+
+	alignas(cache_line_size) Link						head_[max_level];  ///< Links of the head tower
+	alignas(cache_line_size) std::atomic<size_type>		size_;             ///< Number of elements, a snapshot
+	Compare												comp_;             ///< Key ordering
+	node_allocator										alloc_;            ///< Allocator for node storage
+	mutable EpochDomain									domain_;           ///< Defers freeing unlinked nodes
+
+	bool search(const key_type &key, const Node *target, Link **preds, Node **succs);
+	const Node *lower_node(const key_type &key) const;
+	template<class... Args>
+	Node *create_node(size_type height, Args&&... args);
+	void destroy_node(Node *node) noexcept;
+	void release(Node *node, EpochDomain::Guard &guard) noexcept;
+	bool equal_keys(const key_type &a, const key_type &b) const;
+	static size_type node_units(size_type height) noexcept;
+	static size_type random_height() noexcept;
+	static Node *to_node(std::uintptr_t word) noexcept;
+	static std::uintptr_t to_word(const Node *node) noexcept;
+	static void reclaim(void *context, EpochDomain::Retired *object) noexcept;
+};
+
+#include "internal/concurrent_skip_list.tpp"
+
+#endif
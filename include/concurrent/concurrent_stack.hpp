@@ -0,0 +1,106 @@
+/**
+ * @file concurrent_stack.hpp
+ * @brief Lock-free LIFO stack shared between threads
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef CONCURRENT_STACK_HPP
+#define CONCURRENT_STACK_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "concurrent_node_pool.hpp"
+#include "../memory/cache_line.hpp"
+
+/**
+ * @class ConcurrentStack
+ * @brief Treiber stack for any number of pushing and popping threads
+ * 
+ * @details The concurrent counterpart of Stack. Elements live in nodes
+ * linked from a single atomic top; push and pop each swing the top with
+ * one compare-and-swap and never take a lock.
+ * 
+ * A plain pointer top suffers from ABA: a pop that has read the top
+ * node and its successor can be overtaken by pops and pushes that
+ * bring the same node back, and would then install a successor that is
+ * no longer on the stack. The top therefore names its node by a 32-bit
+ * ConcurrentNodePool index packed with a 32-bit tag that every pop
+ * increments, so any such race makes the compare-and-swap fail. Nodes
+ * are recycled through the pool and only given back to the allocator
+ * when the stack is destroyed, so a stale read of a node link is
+ * always safe.
+ * 
+ * All members except the constructor and destructor may be called from
+ * any number of threads at once.
+ * 
+ * @tparam T Type of elements stored in the stack
+ * @tparam Allocator Allocator used to obtain the nodes
+ * 
+ * @ingroup concurrent_containers
+ */
+template<class T, class Allocator = std::allocator<T>>
+class ConcurrentStack {
+public:
+	using value_type		= T;              ///< Type of stored elements
+	using allocator_type	= Allocator;      ///< Type of node allocator
+	using size_type			= unsigned long;  ///< Type for sizes and counts
+	using reference			= T&;             ///< Reference to element
+	using const_reference	= const T&;       ///< Const reference to element
+
+	explicit ConcurrentStack(const Allocator &alloc = Allocator());
+	ConcurrentStack(const ConcurrentStack &other) = delete;
+	ConcurrentStack &operator=(const ConcurrentStack &other) = delete;
+	~ConcurrentStack();
+
+	void push(const_reference value);
+	void push(value_type &&value);
+	template <class... Args>
+	void emplace(Args&&... args);
+	void reserve(size_type count);
+	bool try_pop(reference out);
+	template <class Function>
+	size_type pop_all(Function visit);
+
+	bool empty() const noexcept;
+	size_type node_capacity() const noexcept;
+	allocator_type get_allocator() const noexcept;
+
+private:
+	/**
+	 * @struct Node
+	 * @brief Link and element storage of one stacked value
+	 */
+	struct Node {
+		std::atomic<std::uint32_t>	next;                ///< Index + 1 of the node below, 0 at the bottom
+		alignas(T) unsigned char	storage[sizeof(T)];  ///< Raw element storage
+
+		/**
+		 * @brief Returns the element storage
+		 * 
+		 * @return Pointer to the element slot
+		 */
+		T *value() noexcept { return reinterpret_cast<T *>(storage); }
+	};
+
+	using node_allocator	= typename std::allocator_traits<Allocator>::template rebind_alloc<Node>; ///< Allocator for the nodes
+	using node_pool			= ConcurrentNodePool<Node, node_allocator>;                               ///< Pool recycling the nodes
+
+	static constexpr std::uint64_t tag_mask = ~std::uint64_t(0xffffffff); ///< High half of the top word
+
+	alignas(cache_line_size) std::atomic<std::uint64_t>	top_;   ///< Tag in the high half, top index + 1 in the low half
+	node_pool											pool_;  ///< Source of all nodes
+
+	void link(Node *node) noexcept;
+	Node *unlink() noexcept;
+};
+
+#include "internal/concurrent_stack.tpp"
+
+#endif
@@ -0,0 +1,116 @@
+/**
+ * @file epoch_domain.hpp
+ * @brief Epoch-based reclamation of nodes unlinked by lock-free containers
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef EPOCH_DOMAIN_HPP
+#define EPOCH_DOMAIN_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <thread>
+
+#include "backoff.hpp"
+#include "../memory/cache_line.hpp"
+
+/**
+ * @class EpochDomain
+ * @brief Defers freeing unlinked nodes until no thread can still read them
+ * 
+ * @details A lock-free container that unlinks a node cannot free it
+ * right away, because other threads may be traversing it. Every
+ * operation on such a container runs inside a Guard, which pins the
+ * thread to the current global epoch in one of slot_count slots.
+ * Unlinked nodes are retired into the pinning slot tagged with the
+ * epoch they were retired in. The global epoch only moves on once
+ * every pinned slot has seen it, so two epochs later no thread can
+ * still hold a pointer to the node, and it is handed to the reclaim
+ * function the next time its slot is pinned.
+ * 
+ * Retired objects embed a Retired link, so retiring never allocates.
+ * Guards claim slots by compare-and-swap, starting at a slot picked
+ * from the thread id, so threads need not register; if every slot is
+ * busy a new guard waits for one to be released.
+ * 
+ * @ingroup concurrent_containers
+ */
+class EpochDomain {
+public:
+	using size_type = unsigned long;  ///< Type for counts and epochs
+
+	/**
+	 * @struct Retired
+	 * @brief Link embedded by objects that can be retired
+	 */
+	struct Retired {
+		Retired	*next_retired = nullptr;  ///< Next object retired into the same list
+	};
+
+	using reclaim_function = void (*)(void *context, Retired *object) noexcept; ///< Frees a retired object
+
+	static constexpr size_type slot_count		= 64;  ///< Threads that can be pinned at once
+	static constexpr size_type advance_period	= 64;  ///< Retirements between attempts to move the epoch on
+
+	/**
+	 * @class Guard
+	 * @brief Pins the calling thread for the lifetime of the guard
+	 * 
+	 * @details Pointers read from a container while a guard is alive
+	 * stay valid until the guard is destroyed.
+	 */
+	class Guard {
+	public:
+		explicit Guard(EpochDomain &domain);
+		Guard(const Guard &other) = delete;
+		Guard &operator=(const Guard &other) = delete;
+		~Guard();
+
+		void retire(Retired *object) noexcept;
+
+	private:
+		EpochDomain		&domain_;  ///< Domain the thread is pinned in
+		size_type		slot_;     ///< Index of the claimed slot
+	};
+
+	EpochDomain(reclaim_function reclaim, void *context) noexcept;
+	EpochDomain(const EpochDomain &other) = delete;
+	EpochDomain &operator=(const EpochDomain &other) = delete;
+	~EpochDomain();
+
+	void reclaim_all() noexcept;
+	size_type epoch() const noexcept;
+
+private:
+	/**
+	 * @struct Slot
+	 * @brief Pin state and retired lists of one guard
+	 * 
+	 * @details Only the thread holding the slot touches the lists.
+	 */
+	struct alignas(cache_line_size) Slot {
+		std::atomic<std::uint64_t>	state;         ///< Pinned epoch << 1 | 1, or 0 when free
+		Retired						*limbo[3];     ///< Retired objects, one list per epoch modulo 3
+		std::uint64_t				retired_in[3]; ///< Epoch the objects of each list were retired in
+		size_type					retired;       ///< Objects retired through this slot so far
+	};
+
+	alignas(cache_line_size) std::atomic<std::uint64_t>	epoch_;               ///< Global epoch
+	Slot												slots_[slot_count];   ///< Pin states of the guards
+	reclaim_function									reclaim_;             ///< Frees retired objects
+	void												*context_;            ///< First argument of reclaim_
+
+	size_type pin();
+	void unpin(size_type slot) noexcept;
+	void collect(Slot &slot, std::uint64_t pinned) noexcept;
+	void free_list(Retired *list) noexcept;
+	bool try_advance() noexcept;
+};
+
+#include "internal/epoch_domain.tpp"
+
+#endif
@@ -0,0 +1,276 @@
+/**
+ * @file concurrent_node_pool.tpp
+ * @brief Implementation of ConcurrentNodePool template class methods
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef CONCURRENT_NODE_POOL_TPP
+#define CONCURRENT_NODE_POOL_TPP
+
+#include "../concurrent_node_pool.hpp"
+
+/**
+ * @brief Constructs an empty pool
+ * 
+ * @details No chunk is allocated until the first node is needed.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] alloc Allocator to use for the chunks
+ */
+template<class Value, class Allocator>
+ConcurrentNodePool<Value, Allocator>::ConcurrentNodePool(const Allocator &alloc)
+	: free_(0), claimed_(0), alloc_(alloc) {
+	for (size_type k = 0; k < max_chunks; ++k)
+		chunks_[k].store(nullptr, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Destructor
+ * 
+ * @details Gives every chunk back to the allocator. Must not run
+ * concurrently with any other member, and no node may still hold a
+ * live Value.
+ * 
+ * @ingroup concurrent_containers
+ */
+template<class Value, class Allocator>
+ConcurrentNodePool<Value, Allocator>::~ConcurrentNodePool() {
+	for (size_type k = 0; k < max_chunks; ++k) {
+		Cell *cells = chunks_[k].load(std::memory_order_relaxed);
+		if (!cells)
+			continue;
+		for (size_type i = 0; i < first_chunk << k; ++i)
+			cell_traits::destroy(alloc_, cells + i);
+		cell_traits::deallocate(alloc_, cells, first_chunk << k);
+	}
+}
+
+/**
+ * @brief Obtains storage for one node
+ * 
+ * @details Pops the free list if it is not empty and otherwise claims
+ * a cell that was never used, allocating a new chunk when the claimed
+ * cell is the first of its chunk.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return Uninitialized storage suitable for a Value
+ * 
+ * @throws std::bad_alloc if the allocator fails or all 2^32 cells are
+ * in use
+ */
+template<class Value, class Allocator>
+typename ConcurrentNodePool<Value, Allocator>::pointer ConcurrentNodePool<Value, Allocator>::allocate() {
+	std::uint64_t top = free_.load(std::memory_order_acquire);
+	while (static_cast<std::uint32_t>(top) != 0) {
+		Cell *first = cell(static_cast<std::uint32_t>(top) - 1);
+		std::uint64_t tag = (top >> 32) + 1;
+		std::uint64_t next = tag << 32 | first->next_free.load(std::memory_order_relaxed);
+		if (free_.compare_exchange_weak(top, next, std::memory_order_acquire, std::memory_order_acquire))
+			return first->value();
+	}
+	return fresh_cell()->value();
+}
+
+/**
+ * @brief Returns node storage to the free list
+ * 
+ * @details The Value stored there must already be destroyed. The
+ * storage is handed out again by a later allocate(), possibly on
+ * another thread.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] node Storage obtained from allocate() on this pool
+ */
+template<class Value, class Allocator>
+void ConcurrentNodePool<Value, Allocator>::deallocate(pointer node) noexcept {
+	Cell *returned = reinterpret_cast<Cell *>(node);
+	std::uint64_t top = free_.load(std::memory_order_relaxed);
+	std::uint64_t next;
+	do {
+		returned->next_free.store(static_cast<std::uint32_t>(top), std::memory_order_relaxed);
+		next = (top & ~std::uint64_t(0xffffffff)) | (returned->index + 1);
+	} while (!free_.compare_exchange_weak(top, next, std::memory_order_release, std::memory_order_relaxed));
+}
+
+/**
+ * @brief Makes sure at least count nodes exist
+ * 
+ * @details Claims fresh cells and puts them on the free list until
+ * count nodes have been obtained in total, so that later allocations
+ * up to that number touch neither the allocator nor the chunk
+ * counter.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] count Number of nodes the pool should hold
+ * 
+ * @throws std::bad_alloc if the allocator fails
+ */
+template<class Value, class Allocator>
+void ConcurrentNodePool<Value, Allocator>::reserve(size_type count) {
+	while (capacity() < count)
+		deallocate(fresh_cell()->value());
+}
+
+/**
+ * @brief Returns the index naming a node
+ * 
+ * @details Indices stay valid for the lifetime of the pool and fit in
+ * 32 bits, so a container can pack one with a tag into a 64-bit word.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] node Storage obtained from allocate() on this pool
+ * @return Index of the node
+ */
+template<class Value, class Allocator>
+typename ConcurrentNodePool<Value, Allocator>::index_type ConcurrentNodePool<Value, Allocator>::index_of(pointer node) const noexcept {
+	return reinterpret_cast<const Cell *>(node)->index;
+}
+
+/**
+ * @brief Returns the node named by an index
+ * 
+ * @details The storage stays valid until the pool is destroyed, even
+ * after the node has been deallocated, so a thread may still read the
+ * atomic members of a node it lost a race for.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] index Index obtained from index_of()
+ * @return Storage of the node
+ */
+template<class Value, class Allocator>
+typename ConcurrentNodePool<Value, Allocator>::pointer ConcurrentNodePool<Value, Allocator>::node_at(index_type index) const noexcept {
+	return cell(index)->value();
+}
+
+/**
+ * @brief Returns the number of nodes obtained so far
+ * 
+ * @details Counts nodes in use as well as free ones. A snapshot when
+ * other threads are active.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return Number of nodes the pool has handed out at least once or
+ * reserved
+ */
+template<class Value, class Allocator>
+typename ConcurrentNodePool<Value, Allocator>::size_type ConcurrentNodePool<Value, Allocator>::capacity() const noexcept {
+	size_type claimed = claimed_.load(std::memory_order_relaxed);
+	return claimed < max_cells ? claimed : max_cells;
+}
+
+/**
+ * @brief Returns a copy of the allocator
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return Copy of the associated allocator
+ */
+template<class Value, class Allocator>
+typename ConcurrentNodePool<Value, Allocator>::allocator_type ConcurrentNodePool<Value, Allocator>::get_allocator() const noexcept {
+	return allocator_type(alloc_);
+}
+
+/**
+ * @brief Finds a cell by index
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] index Index of a cell whose chunk exists
+ * @return Pointer to the cell
+ */
+template<class Value, class Allocator>
+typename ConcurrentNodePool<Value, Allocator>::Cell *ConcurrentNodePool<Value, Allocator>::cell(size_type index) const noexcept {
+	size_type chunk = chunk_of(index);
+	return chunks_[chunk].load(std::memory_order_acquire) + (index + first_chunk - (first_chunk << chunk));
+}
+
+/**
+ * @brief Claims a cell that was never handed out
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return Pointer to the claimed cell
+ * 
+ * @throws std::bad_alloc if the allocator fails or all cells are
+ * claimed
+ */
+template<class Value, class Allocator>
+typename ConcurrentNodePool<Value, Allocator>::Cell *ConcurrentNodePool<Value, Allocator>::fresh_cell() {
+	size_type index = claimed_.fetch_add(1, std::memory_order_relaxed);
+	if (index >= max_cells)
+		throw std::bad_alloc();
+	size_type chunk = chunk_of(index);
+	Cell *cells = chunks_[chunk].load(std::memory_order_acquire);
+	if (!cells)
+		cells = add_chunk(chunk);
+	return cells + (index + first_chunk - (first_chunk << chunk));
+}
+
+/**
+ * @brief Allocates and publishes a chunk
+ * 
+ * @details Several threads may claim the first cells of a new chunk at
+ * once; each allocates it, and all but the one whose compare-and-swap
+ * installs its copy give theirs back.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] chunk Number of the chunk to allocate
+ * @return Pointer to the first cell of the published chunk
+ * 
+ * @throws std::bad_alloc if the allocator fails
+ */
+template<class Value, class Allocator>
+typename ConcurrentNodePool<Value, Allocator>::Cell *ConcurrentNodePool<Value, Allocator>::add_chunk(size_type chunk) {
+	size_type count = first_chunk << chunk;
+	size_type first_index = count - first_chunk;
+	Cell *cells = cell_traits::allocate(alloc_, count);
+	for (size_type i = 0; i < count; ++i) {
+		cell_traits::construct(alloc_, cells + i);
+		cells[i].next_free.store(0, std::memory_order_relaxed);
+		cells[i].index = static_cast<std::uint32_t>(first_index + i);
+	}
+	Cell *expected = nullptr;
+	if (chunks_[chunk].compare_exchange_strong(expected, cells, std::memory_order_acq_rel, std::memory_order_acquire))
+		return cells;
+	for (size_type i = 0; i < count; ++i)
+		cell_traits::destroy(alloc_, cells + i);
+	cell_traits::deallocate(alloc_, cells, count);
+	return expected;
+}
+
+/**
+ * @brief Number of the chunk holding a cell
+ * 
+ * @details Chunk k starts at index (first_chunk << k) - first_chunk,
+ * so the chunk is the position of the highest set bit of
+ * index + first_chunk, less first_chunk_shift.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] index Cell index
+ * @return Chunk number
+ */
+template<class Value, class Allocator>
+typename ConcurrentNodePool<Value, Allocator>::size_type ConcurrentNodePool<Value, Allocator>::chunk_of(size_type index) noexcept {
+	size_type shifted = (index + first_chunk) >> first_chunk_shift;
+#if defined(__GNUC__) || defined(__clang__)
+	return sizeof(size_type) * 8 - 1 - __builtin_clzl(shifted);
+#else
+	size_type chunk = 0;
+	while (shifted >>= 1)
+		++chunk;
+	return chunk;
+#endif
+}
+
+#endif
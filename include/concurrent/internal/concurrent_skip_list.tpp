@@ -0,0 +1,555 @@
+/**
+ * @file concurrent_skip_list.tpp
+ * @brief Implementation of ConcurrentSkipList template class methods
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef CONCURRENT_SKIP_LIST_TPP
+#define CONCURRENT_SKIP_LIST_TPP
+
+#include "../concurrent_skip_list.hpp"
+
+/**
+ * @brief Node constructor
+ * 
+ * @details Constructs the element from args. The tower is initialized
+ * separately by create_node().
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @tparam Args Types of the element constructor arguments
+ * @param[in] levels Height of the tower behind the node
+ * @param[in] args Arguments for the element constructor
+ */
+template<class K, class V, class Compare, class Allocator>
+template<class... Args>
+ConcurrentSkipList<K, V, Compare, Allocator>::Node::Node(size_type levels, Args&&... args)
+	: value(std::forward<Args>(args)...), height(levels), owners(2) {}
+
+/**
+ * @brief Returns the tower of links
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return Array of height links stored right after the node
+ */
+template<class K, class V, class Compare, class Allocator>
+typename ConcurrentSkipList<K, V, Compare, Allocator>::Link *ConcurrentSkipList<K, V, Compare, Allocator>::Node::tower() noexcept {
+	return reinterpret_cast<Link *>(this + 1);
+}
+
+/**
+ * @brief Returns the tower of links
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return Read-only array of height links stored right after the node
+ */
+template<class K, class V, class Compare, class Allocator>
+const typename ConcurrentSkipList<K, V, Compare, Allocator>::Link *ConcurrentSkipList<K, V, Compare, Allocator>::Node::tower() const noexcept {
+	return reinterpret_cast<const Link *>(this + 1);
+}
+
+/**
+ * @brief Constructs an empty map
+ * 
+ * @details No node is allocated until the first insertion.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] comp Key ordering
+ * @param[in] alloc Allocator to use for the nodes
+ */
+template<class K, class V, class Compare, class Allocator>
+ConcurrentSkipList<K, V, Compare, Allocator>::ConcurrentSkipList(const Compare &comp, const Allocator &alloc)
+	: size_(0), comp_(comp), alloc_(alloc), domain_(&ConcurrentSkipList::reclaim, this) {
+	for (size_type i = 0; i < max_level; ++i)
+		head_[i].store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Destructor
+ * 
+ * @details Destroys the elements still linked, then the ones waiting
+ * for reclamation. Must not run concurrently with any other member.
+ * 
+ * @ingroup concurrent_containers
+ */
+template<class K, class V, class Compare, class Allocator>
+ConcurrentSkipList<K, V, Compare, Allocator>::~ConcurrentSkipList() {
+	Node *node = to_node(head_[0].load(std::memory_order_relaxed));
+	while (node) {
+		Node *next = to_node(node->tower()[0].load(std::memory_order_relaxed));
+		destroy_node(node);
+		node = next;
+	}
+	domain_.reclaim_all();
+}
+
+/**
+ * @brief Inserts a key-value pair if the key is not present
+ * 
+ * @details The node becomes visible, and the insertion takes effect,
+ * when it is linked on level 0. The upper levels are linked one by one
+ * afterwards, searching again whenever a predecessor changed; if the
+ * node is erased meanwhile, linking stops and the node is unlinked
+ * again before it is released. If allocation or copying throws, the
+ * map is unchanged.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] key Key to insert
+ * @param[in] value Value to map key to
+ * @return true if the pair was inserted, false if key was present
+ * 
+ * @throws std::bad_alloc if the allocator fails
+ */
+template<class K, class V, class Compare, class Allocator>
+bool ConcurrentSkipList<K, V, Compare, Allocator>::insert(const key_type &key, const mapped_type &value) {
+	EpochDomain::Guard guard(domain_);
+	Link *preds[max_level];
+	Node *succs[max_level];
+	if (search(key, nullptr, preds, succs))
+		return false;
+	Node *node = create_node(random_height(), key, value);
+	for (;;) {
+		std::uintptr_t expected = to_word(succs[0]);
+		node->tower()[0].store(expected, std::memory_order_relaxed);
+		if (preds[0][0].compare_exchange_strong(expected, to_word(node)))
+			break;
+		if (search(key, nullptr, preds, succs)) {
+			destroy_node(node);
+			return false;
+		}
+	}
+	size_.fetch_add(1, std::memory_order_relaxed);
+	for (size_type i = 1; i < node->height; ++i) {
+		bool linked = false;
+		while (!linked) {
+			std::uintptr_t own = node->tower()[i].load();
+			if ((own & mark_bit) || !node->tower()[i].compare_exchange_strong(own, to_word(succs[i])))
+				break;
+			std::uintptr_t expected = to_word(succs[i]);
+			linked = preds[i][i].compare_exchange_strong(expected, to_word(node));
+			if (!linked)
+				search(key, node, preds, succs);
+		}
+		if (!linked)
+			break;
+	}
+	if (node->tower()[0].load() & mark_bit)
+		search(key, node, preds, succs);
+	release(node, guard);
+	return true;
+}
+
+/**
+ * @brief Removes the element with a key
+ * 
+ * @details Marks the node's links from the top level down. The
+ * erasure takes effect when level 0 is marked; a thread that finds it
+ * already marked lost the race to another eraser. The winner then
+ * searches once more, which unlinks the node on every level, and
+ * releases it.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] key Key to remove
+ * @return true if this call removed the element
+ */
+template<class K, class V, class Compare, class Allocator>
+bool ConcurrentSkipList<K, V, Compare, Allocator>::erase(const key_type &key) {
+	EpochDomain::Guard guard(domain_);
+	Link *preds[max_level];
+	Node *succs[max_level];
+	if (!search(key, nullptr, preds, succs))
+		return false;
+	Node *node = succs[0];
+	for (size_type i = node->height; i-- > 1;) {
+		std::uintptr_t word = node->tower()[i].load();
+		while (!(word & mark_bit)) {
+			if (node->tower()[i].compare_exchange_weak(word, word | mark_bit))
+				break;
+		}
+	}
+	std::uintptr_t word = node->tower()[0].load();
+	do {
+		if (word & mark_bit)
+			return false;
+	} while (!node->tower()[0].compare_exchange_weak(word, word | mark_bit));
+	size_.fetch_sub(1, std::memory_order_relaxed);
+	search(key, node, preds, succs);
+	release(node, guard);
+	return true;
+}
+
+/**
+ * @brief Copies the value mapped to a key
+ * 
+ * @details Never writes to shared memory and never retries.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] key Key to look up
+ * @param[out] out Receives a copy of the mapped value if key is present
+ * @return true if key was present
+ */
+template<class K, class V, class Compare, class Allocator>
+bool ConcurrentSkipList<K, V, Compare, Allocator>::find(const key_type &key, mapped_type &out) const {
+	EpochDomain::Guard guard(domain_);
+	const Node *node = lower_node(key);
+	if (!node || comp_(key, node->value.first))
+		return false;
+	out = node->value.second;
+	return true;
+}
+
+/**
+ * @brief Checks whether a key is present
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] key Key to look up
+ * @return true if an element with key exists
+ */
+template<class K, class V, class Compare, class Allocator>
+bool ConcurrentSkipList<K, V, Compare, Allocator>::contains(const key_type &key) const {
+	EpochDomain::Guard guard(domain_);
+	const Node *node = lower_node(key);
+	return node && !comp_(key, node->value.first);
+}
+
+/**
+ * @brief Visits the elements with keys in [first, last) in key order
+ * 
+ * @details Finds first in expected O(log n) and then follows level 0.
+ * The scan is not a snapshot: every element present for the whole scan
+ * is visited exactly once, and elements inserted or erased while it
+ * runs may or may not be.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @tparam Function Callable taking a const value_type reference
+ * @param[in] first Smallest key to visit
+ * @param[in] last Key past the range
+ * @param[in] visit Called with every element in the range
+ * @return Number of elements visited
+ */
+template<class K, class V, class Compare, class Allocator>
+template<class Function>
+typename ConcurrentSkipList<K, V, Compare, Allocator>::size_type ConcurrentSkipList<K, V, Compare, Allocator>::scan(const key_type &first, const key_type &last, Function visit) const {
+	EpochDomain::Guard guard(domain_);
+	size_type count = 0;
+	const Node *node = lower_node(first);
+	while (node && comp_(node->value.first, last)) {
+		std::uintptr_t next = node->tower()[0].load(std::memory_order_acquire);
+		if (!(next & mark_bit)) {
+			visit(node->value);
+			++count;
+		}
+		node = to_node(next);
+	}
+	return count;
+}
+
+/**
+ * @brief Returns number of elements
+ * 
+ * @details A snapshot that may already be stale when other threads
+ * are active.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return Number of elements in the map
+ */
+template<class K, class V, class Compare, class Allocator>
+typename ConcurrentSkipList<K, V, Compare, Allocator>::size_type ConcurrentSkipList<K, V, Compare, Allocator>::size() const noexcept {
+	return size_.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Checks if the map is empty
+ * 
+ * @details A snapshot that may already be stale when other threads
+ * are active.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return true if no element is present
+ */
+template<class K, class V, class Compare, class Allocator>
+bool ConcurrentSkipList<K, V, Compare, Allocator>::empty() const noexcept {
+	return to_node(head_[0].load(std::memory_order_acquire)) == nullptr;
+}
+
+/**
+ * @brief Returns the key ordering
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return Copy of the comparison object
+ */
+template<class K, class V, class Compare, class Allocator>
+typename ConcurrentSkipList<K, V, Compare, Allocator>::key_compare ConcurrentSkipList<K, V, Compare, Allocator>::key_comp() const {
+	return comp_;
+}
+
+/**
+ * @brief Returns a copy of the allocator
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return Copy of the associated allocator
+ */
+template<class K, class V, class Compare, class Allocator>
+typename ConcurrentSkipList<K, V, Compare, Allocator>::allocator_type ConcurrentSkipList<K, V, Compare, Allocator>::get_allocator() const noexcept {
+	return allocator_type(alloc_);
+}
+
+/**
+ * @brief Finds the neighbours of a key on every level, unlinking marked nodes
+ * 
+ * @details Descends from the top level, moving right while the next
+ * node is ordered before key. Every marked node met on the way is
+ * unlinked with a compare-and-swap on its predecessor's link; if that
+ * fails because the predecessor changed or is being erased itself, the
+ * search starts over. With a target, the search also moves past nodes
+ * equal to key other than target, so it reaches and unlinks target on
+ * every level even if a new node with the same key was linked in front
+ * of it.
+ * 
+ * The link operations are sequentially consistent, so an eraser's
+ * final search and an inserter's check for the mark after its last
+ * link cannot both miss each other.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] key Key to search for
+ * @param[in] target Node to search up to, or nullptr
+ * @param[out] preds Receives for every level the tower (or the head)
+ * whose link on that level points to succs
+ * @param[out] succs Receives for every level the first node not
+ * ordered before key (or target), or nullptr
+ * @return true if succs[0] holds key
+ */
+template<class K, class V, class Compare, class Allocator>
+bool ConcurrentSkipList<K, V, Compare, Allocator>::search(const key_type &key, const Node *target, Link **preds, Node **succs) {
+	bool restart;
+	do {
+		restart = false;
+		Link *links = head_;
+		for (size_type i = max_level; i-- > 0 && !restart;) {
+			Node *curr = to_node(links[i].load());
+			while (curr) {
+				std::uintptr_t succ = curr->tower()[i].load();
+				if (succ & mark_bit) {
+					std::uintptr_t expected = to_word(curr);
+					if (!links[i].compare_exchange_strong(expected, succ & ~mark_bit)) {
+						restart = true;
+						break;
+					}
+					curr = to_node(succ);
+				}
+				else if (comp_(curr->value.first, key) || (target && curr != target && !comp_(key, curr->value.first))) {
+					links = curr->tower();
+					curr = to_node(succ);
+				}
+				else
+					break;
+			}
+			preds[i] = links;
+			succs[i] = curr;
+		}
+	} while (restart);
+	return succs[0] && equal_keys(succs[0]->value.first, key);
+}
+
+/**
+ * @brief Finds the first unmarked node not ordered before a key
+ * 
+ * @details Steps over marked nodes instead of unlinking them, so it
+ * never writes and never restarts. Must be called under a guard.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] key Key to search for
+ * @return First node with key >= key that was not being erased when
+ * visited, or nullptr
+ */
+template<class K, class V, class Compare, class Allocator>
+const typename ConcurrentSkipList<K, V, Compare, Allocator>::Node *ConcurrentSkipList<K, V, Compare, Allocator>::lower_node(const key_type &key) const {
+	const Link *links = head_;
+	const Node *curr = nullptr;
+	for (size_type i = max_level; i-- > 0;) {
+		curr = to_node(links[i].load(std::memory_order_acquire));
+		while (curr) {
+			std::uintptr_t succ = curr->tower()[i].load(std::memory_order_acquire);
+			if (!(succ & mark_bit)) {
+				if (!comp_(curr->value.first, key))
+					break;
+				links = curr->tower();
+			}
+			curr = to_node(succ);
+		}
+	}
+	return curr;
+}
+
+/**
+ * @brief Allocates and constructs a node with an empty tower
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @tparam Args Types of the element constructor arguments
+ * @param[in] height Number of levels the node takes part in
+ * @param[in] args Arguments for the element constructor
+ * @return Pointer to the new, unlinked node
+ * 
+ * @throws Anything thrown by the allocator or the element constructor;
+ * the storage is given back in that case
+ */
+template<class K, class V, class Compare, class Allocator>
+template<class... Args>
+typename ConcurrentSkipList<K, V, Compare, Allocator>::Node *ConcurrentSkipList<K, V, Compare, Allocator>::create_node(size_type height, Args&&... args) {
+	static_assert(sizeof(Node) % alignof(Link) == 0, "tower links must be aligned behind the node");
+	Node *node = node_traits::allocate(alloc_, node_units(height));
+	try {
+		::new (static_cast<void *>(node)) Node(height, std::forward<Args>(args)...);
+	}
+	catch (...) {
+		node_traits::deallocate(alloc_, node, node_units(height));
+		throw;
+	}
+	for (size_type i = 0; i < height; ++i)
+		::new (static_cast<void *>(node->tower() + i)) Link(0);
+	return node;
+}
+
+/**
+ * @brief Destroys a node and gives its storage back
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] node Node no thread can reach any more
+ */
+template<class K, class V, class Compare, class Allocator>
+void ConcurrentSkipList<K, V, Compare, Allocator>::destroy_node(Node *node) noexcept {
+	size_type height = node->height;
+	for (size_type i = 0; i < height; ++i)
+		node->tower()[i].~Link();
+	node->~Node();
+	node_traits::deallocate(alloc_, node, node_units(height));
+}
+
+/**
+ * @brief Drops the calling thread's claim on a published node
+ * 
+ * @details The inserter and the eraser each hold one claim; the node
+ * is retired when both are done with it.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] node Node the caller inserted or erased
+ * @param[in] guard Guard of the calling thread
+ */
+template<class K, class V, class Compare, class Allocator>
+void ConcurrentSkipList<K, V, Compare, Allocator>::release(Node *node, EpochDomain::Guard &guard) noexcept {
+	if (node->owners.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		guard.retire(node);
+}
+
+/**
+ * @brief Checks two keys for equivalence under the ordering
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] a First key
+ * @param[in] b Second key
+ * @return true if neither key is ordered before the other
+ */
+template<class K, class V, class Compare, class Allocator>
+bool ConcurrentSkipList<K, V, Compare, Allocator>::equal_keys(const key_type &a, const key_type &b) const {
+	return !comp_(a, b) && !comp_(b, a);
+}
+
+/**
+ * @brief Number of Node-sized units holding a node and its tower
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] height Height of the tower
+ * @return Units to request from the node allocator
+ */
+template<class K, class V, class Compare, class Allocator>
+typename ConcurrentSkipList<K, V, Compare, Allocator>::size_type ConcurrentSkipList<K, V, Compare, Allocator>::node_units(size_type height) noexcept {
+	return (sizeof(Node) + height * sizeof(Link) + sizeof(Node) - 1) / sizeof(Node);
+}
+
+/**
+ * @brief Draws the height of a new tower
+ * 
+ * @details Every thread advances its own xorshift64* generator and
+ * counts pairs of zero bits, so a tower reaches height h + 1 with
+ * probability 4^-h.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return Height between 1 and max_level
+ */
+template<class K, class V, class Compare, class Allocator>
+typename ConcurrentSkipList<K, V, Compare, Allocator>::size_type ConcurrentSkipList<K, V, Compare, Allocator>::random_height() noexcept {
+	thread_local std::uint64_t seed = std::hash<std::thread::id>()(std::this_thread::get_id()) | 1;
+	seed ^= seed >> 12;
+	seed ^= seed << 25;
+	seed ^= seed >> 27;
+	std::uint64_t bits = seed * 0x2545F4914F6CDD1DULL;
+	size_type height = 1;
+	while (height < max_level && (bits & 3) == 0) {
+		++height;
+		bits >>= 2;
+	}
+	return height;
+}
+
+/**
+ * @brief Extracts the node pointer of a link word
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] word Link word, marked or not
+ * @return Successor node, or nullptr
+ */
+template<class K, class V, class Compare, class Allocator>
+typename ConcurrentSkipList<K, V, Compare, Allocator>::Node *ConcurrentSkipList<K, V, Compare, Allocator>::to_node(std::uintptr_t word) noexcept {
+	return reinterpret_cast<Node *>(word & ~mark_bit);
+}
+
+/**
+ * @brief Builds an unmarked link word
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] node Successor node, or nullptr
+ * @return Link word pointing to node
+ */
+template<class K, class V, class Compare, class Allocator>
+std::uintptr_t ConcurrentSkipList<K, V, Compare, Allocator>::to_word(const Node *node) noexcept {
+	return reinterpret_cast<std::uintptr_t>(node);
+}
+
+/**
+ * @brief Reclaim function registered with the epoch domain
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] context The map that retired the node
+ * @param[in] object Retired node
+ */
+template<class K, class V, class Compare, class Allocator>
+void ConcurrentSkipList<K, V, Compare, Allocator>::reclaim(void *context, EpochDomain::Retired *object) noexcept {
+	static_cast<ConcurrentSkipList *>(context)->destroy_node(static_cast<Node *>(object));
+}
+
+#endif
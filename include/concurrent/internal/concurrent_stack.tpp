@@ -0,0 +1,282 @@
+/**
+ * @file concurrent_stack.tpp
+ * @brief Implementation of ConcurrentStack template class methods
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef CONCURRENT_STACK_TPP
+#define CONCURRENT_STACK_TPP
+
+#include "../concurrent_stack.hpp"
+
+/**
+ * @brief Constructs an empty stack
+ * 
+ * @details No node is allocated until the first push.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] alloc Allocator to use for the nodes
+ */
+template<class T, class Allocator>
+ConcurrentStack<T, Allocator>::ConcurrentStack(const Allocator &alloc) : top_(0), pool_(node_allocator(alloc)) {}
+
+/**
+ * @brief Destructor
+ * 
+ * @details Destroys the elements still stacked; the pool then frees
+ * every node at once. Must not run concurrently with any other member.
+ * 
+ * @ingroup concurrent_containers
+ */
+template<class T, class Allocator>
+ConcurrentStack<T, Allocator>::~ConcurrentStack() {
+	std::uint32_t next = static_cast<std::uint32_t>(top_.load(std::memory_order_relaxed));
+	while (next != 0) {
+		Node *node = pool_.node_at(next - 1);
+		std::destroy_at(node->value());
+		next = node->next.load(std::memory_order_relaxed);
+	}
+}
+
+/**
+ * @brief Pushes a copy of value
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] value Value to push
+ * 
+ * @throws std::bad_alloc if the pool needs a new chunk and the
+ * allocator fails
+ */
+template<class T, class Allocator>
+void ConcurrentStack<T, Allocator>::push(const_reference value) {
+	emplace(value);
+}
+
+/**
+ * @brief Moves value onto the stack
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] value Value to move onto the stack
+ * 
+ * @throws std::bad_alloc if the pool needs a new chunk and the
+ * allocator fails
+ */
+template<class T, class Allocator>
+void ConcurrentStack<T, Allocator>::push(value_type &&value) {
+	emplace(std::move(value));
+}
+
+/**
+ * @brief Constructs an element on top of the stack
+ * 
+ * @details The element is built in a node taken from the pool before
+ * the node is published, so a popping thread never sees a partly built
+ * value. If construction throws, the node goes back to the pool and
+ * the stack is unchanged.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @tparam Args Types of the constructor arguments
+ * @param[in] args Arguments forwarded to the constructor of T
+ * 
+ * @throws std::bad_alloc if the pool needs a new chunk and the
+ * allocator fails
+ */
+template<class T, class Allocator>
+template <class... Args>
+void ConcurrentStack<T, Allocator>::emplace(Args&&... args) {
+	Node *node = ::new (static_cast<void *>(pool_.allocate())) Node;
+	try {
+		::new (static_cast<void *>(node->storage)) T(std::forward<Args>(args)...);
+	}
+	catch (...) {
+		pool_.deallocate(node);
+		throw;
+	}
+	link(node);
+}
+
+/**
+ * @brief Makes sure at least count nodes exist
+ * 
+ * @details Fills the node pool so that up to count elements can be
+ * stacked at once without an allocation.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] count Number of nodes the stack should own
+ * 
+ * @throws std::bad_alloc if the allocator fails
+ */
+template<class T, class Allocator>
+void ConcurrentStack<T, Allocator>::reserve(size_type count) {
+	pool_.reserve(count);
+}
+
+/**
+ * @brief Removes the top element if there is one
+ * 
+ * @details If the move assignment into out throws, the element is
+ * pushed back and the exception is rethrown.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[out] out Receives the element by move assignment
+ * @return true if an element was removed, false if the stack is empty
+ */
+template<class T, class Allocator>
+bool ConcurrentStack<T, Allocator>::try_pop(reference out) {
+	Node *node = unlink();
+	if (!node)
+		return false;
+	try {
+		out = std::move(*node->value());
+	}
+	catch (...) {
+		link(node);
+		throw;
+	}
+	std::destroy_at(node->value());
+	pool_.deallocate(node);
+	return true;
+}
+
+/**
+ * @brief Removes every element at once
+ * 
+ * @details Detaches the whole chain with a single successful
+ * compare-and-swap on the top, so the cost of synchronisation does not
+ * depend on the number of elements, then hands each element to visit
+ * from the top down. Elements pushed meanwhile stay on the stack. If
+ * visit throws, the elements not yet visited are destroyed and the
+ * exception is rethrown.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @tparam Function Callable taking a value_type rvalue
+ * @param[in] visit Called with every detached element in LIFO order
+ * @return Number of elements removed
+ */
+template<class T, class Allocator>
+template <class Function>
+typename ConcurrentStack<T, Allocator>::size_type ConcurrentStack<T, Allocator>::pop_all(Function visit) {
+	std::uint64_t top = top_.load(std::memory_order_relaxed);
+	while (static_cast<std::uint32_t>(top) != 0) {
+		std::uint64_t emptied = (top & tag_mask) + (std::uint64_t(1) << 32);
+		if (top_.compare_exchange_weak(top, emptied, std::memory_order_acquire, std::memory_order_relaxed))
+			break;
+	}
+	std::uint32_t next = static_cast<std::uint32_t>(top);
+	size_type count = 0;
+	try {
+		for (; next != 0; ++count) {
+			Node *node = pool_.node_at(next - 1);
+			visit(std::move(*node->value()));
+			next = node->next.load(std::memory_order_relaxed);
+			std::destroy_at(node->value());
+			pool_.deallocate(node);
+		}
+	}
+	catch (...) {
+		while (next != 0) {
+			Node *node = pool_.node_at(next - 1);
+			next = node->next.load(std::memory_order_relaxed);
+			std::destroy_at(node->value());
+			pool_.deallocate(node);
+		}
+		throw;
+	}
+	return count;
+}
+
+/**
+ * @brief Checks if the stack is empty
+ * 
+ * @details A snapshot that may already be stale when other threads
+ * are active.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return true if no element is stacked
+ */
+template<class T, class Allocator>
+bool ConcurrentStack<T, Allocator>::empty() const noexcept {
+	return static_cast<std::uint32_t>(top_.load(std::memory_order_acquire)) == 0;
+}
+
+/**
+ * @brief Returns the number of nodes obtained from the allocator
+ * 
+ * @details Includes the nodes waiting in the pool. It only grows when
+ * more elements are stacked at once than ever before.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return Number of nodes owned by the stack
+ */
+template<class T, class Allocator>
+typename ConcurrentStack<T, Allocator>::size_type ConcurrentStack<T, Allocator>::node_capacity() const noexcept {
+	return pool_.capacity();
+}
+
+/**
+ * @brief Returns a copy of the allocator
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return Copy of the associated allocator
+ */
+template<class T, class Allocator>
+typename ConcurrentStack<T, Allocator>::allocator_type ConcurrentStack<T, Allocator>::get_allocator() const noexcept {
+	return allocator_type(pool_.get_allocator());
+}
+
+/**
+ * @brief Publishes a node as the new top
+ * 
+ * @details Pushes need no tag change: only a pop can be fooled by a
+ * node coming back, and every pop moves the tag on.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] node Node holding a constructed element
+ */
+template<class T, class Allocator>
+void ConcurrentStack<T, Allocator>::link(Node *node) noexcept {
+	std::uint64_t index = pool_.index_of(node) + std::uint64_t(1);
+	std::uint64_t top = top_.load(std::memory_order_relaxed);
+	do {
+		node->next.store(static_cast<std::uint32_t>(top), std::memory_order_relaxed);
+	} while (!top_.compare_exchange_weak(top, (top & tag_mask) | index, std::memory_order_release, std::memory_order_relaxed));
+}
+
+/**
+ * @brief Detaches the top node
+ * 
+ * @details The successor is read from a node that another thread may
+ * pop, recycle and push again at any moment; the tag makes the
+ * compare-and-swap fail in that case, and the node storage itself is
+ * never freed while the stack lives.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return The detached node, or nullptr if the stack is empty
+ */
+template<class T, class Allocator>
+typename ConcurrentStack<T, Allocator>::Node *ConcurrentStack<T, Allocator>::unlink() noexcept {
+	std::uint64_t top = top_.load(std::memory_order_acquire);
+	while (static_cast<std::uint32_t>(top) != 0) {
+		Node *node = pool_.node_at(static_cast<std::uint32_t>(top) - 1);
+		std::uint64_t next = (top & tag_mask) + (std::uint64_t(1) << 32) + node->next.load(std::memory_order_relaxed);
+		if (top_.compare_exchange_weak(top, next, std::memory_order_acquire, std::memory_order_acquire))
+			return node;
+	}
+	return nullptr;
+}
+
+#endif
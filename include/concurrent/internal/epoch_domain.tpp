@@ -0,0 +1,217 @@
+/**
+ * @file epoch_domain.tpp
+ * @brief Implementation of EpochDomain and EpochDomain::Guard
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef EPOCH_DOMAIN_TPP
+#define EPOCH_DOMAIN_TPP
+
+#include "../epoch_domain.hpp"
+
+/**
+ * @brief Pins the calling thread
+ * 
+ * @details Waits with Backoff if all slots are held by other guards.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] domain Domain to pin the thread in
+ */
+inline EpochDomain::Guard::Guard(EpochDomain &domain) : domain_(domain), slot_(domain.pin()) {}
+
+/**
+ * @brief Unpins the thread
+ * 
+ * @details Pointers obtained under the guard must not be used
+ * afterwards.
+ * 
+ * @ingroup concurrent_containers
+ */
+inline EpochDomain::Guard::~Guard() { domain_.unpin(slot_); }
+
+/**
+ * @brief Hands an unlinked object over for deferred reclamation
+ * 
+ * @details The object must already be unreachable for threads that
+ * pin the domain from now on. It is reclaimed once two more epochs
+ * have begun, so threads pinned now may keep reading it until then.
+ * Every advance_period retirements the guard tries to move the global
+ * epoch on.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] object Object to reclaim later, not retired before
+ */
+inline void EpochDomain::Guard::retire(Retired *object) noexcept {
+	Slot &slot = domain_.slots_[slot_];
+	std::uint64_t epoch = domain_.epoch_.load();
+	std::uint64_t list = epoch % 3;
+	if (slot.retired_in[list] != epoch) {
+		domain_.free_list(slot.limbo[list]);
+		slot.limbo[list] = nullptr;
+		slot.retired_in[list] = epoch;
+	}
+	object->next_retired = slot.limbo[list];
+	slot.limbo[list] = object;
+	if (++slot.retired % advance_period == 0)
+		domain_.try_advance();
+}
+
+/**
+ * @brief Constructs a domain at epoch 0 with all slots free
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] reclaim Function freeing a retired object
+ * @param[in] context First argument passed to reclaim
+ */
+inline EpochDomain::EpochDomain(reclaim_function reclaim, void *context) noexcept
+	: epoch_(0), reclaim_(reclaim), context_(context) {
+	for (Slot &slot : slots_) {
+		slot.state.store(0, std::memory_order_relaxed);
+		for (std::uint64_t list = 0; list < 3; ++list) {
+			slot.limbo[list] = nullptr;
+			slot.retired_in[list] = list;
+		}
+		slot.retired = 0;
+	}
+}
+
+/**
+ * @brief Destructor
+ * 
+ * @details Reclaims every object still waiting. Must not run while a
+ * guard is alive.
+ * 
+ * @ingroup concurrent_containers
+ */
+inline EpochDomain::~EpochDomain() { reclaim_all(); }
+
+/**
+ * @brief Reclaims every retired object at once
+ * 
+ * @details Only safe while no guard is alive, e.g. when the owning
+ * container is destroyed.
+ * 
+ * @ingroup concurrent_containers
+ */
+inline void EpochDomain::reclaim_all() noexcept {
+	for (Slot &slot : slots_) {
+		for (std::uint64_t list = 0; list < 3; ++list) {
+			free_list(slot.limbo[list]);
+			slot.limbo[list] = nullptr;
+		}
+	}
+}
+
+/**
+ * @brief Returns the global epoch
+ * 
+ * @details A snapshot when other threads are active.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return Number of times the epoch has moved on
+ */
+inline EpochDomain::size_type EpochDomain::epoch() const noexcept {
+	return static_cast<size_type>(epoch_.load(std::memory_order_relaxed));
+}
+
+/**
+ * @brief Claims a slot and publishes the current epoch in it
+ * 
+ * @details The scan starts at a slot picked from the thread id, so a
+ * thread usually gets the same slot back and finds its own retired
+ * objects there. Both the epoch load and the claim are sequentially
+ * consistent, so every node load that follows is ordered after them.
+ * Objects in the slot that became safe are reclaimed right away.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return Index of the claimed slot
+ */
+inline EpochDomain::size_type EpochDomain::pin() {
+	size_type start = std::hash<std::thread::id>()(std::this_thread::get_id()) % slot_count;
+	Backoff backoff;
+	for (;;) {
+		for (size_type i = 0; i < slot_count; ++i) {
+			size_type index = (start + i) % slot_count;
+			if (slots_[index].state.load(std::memory_order_relaxed) != 0)
+				continue;
+			std::uint64_t expected = 0;
+			std::uint64_t epoch = epoch_.load();
+			if (slots_[index].state.compare_exchange_strong(expected, epoch << 1 | 1)) {
+				collect(slots_[index], epoch);
+				return index;
+			}
+		}
+		backoff.pause();
+	}
+}
+
+/**
+ * @brief Releases a slot
+ * 
+ * @details The retired lists stay in the slot for its next holder.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] slot Index returned by pin()
+ */
+inline void EpochDomain::unpin(size_type slot) noexcept {
+	slots_[slot].state.store(0, std::memory_order_release);
+}
+
+/**
+ * @brief Reclaims the lists of a slot retired two or more epochs ago
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in,out] slot Slot just claimed by the calling thread
+ * @param[in] pinned Epoch the slot was pinned at
+ */
+inline void EpochDomain::collect(Slot &slot, std::uint64_t pinned) noexcept {
+	for (std::uint64_t list = 0; list < 3; ++list) {
+		if (slot.limbo[list] && slot.retired_in[list] + 2 <= pinned) {
+			free_list(slot.limbo[list]);
+			slot.limbo[list] = nullptr;
+		}
+	}
+}
+
+/**
+ * @brief Hands every object of a retired list to the reclaim function
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] list First object of the list, or nullptr
+ */
+inline void EpochDomain::free_list(Retired *list) noexcept {
+	while (list) {
+		Retired *next = list->next_retired;
+		reclaim_(context_, list);
+		list = next;
+	}
+}
+
+/**
+ * @brief Moves the global epoch on if every pinned slot has seen it
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return true if this call advanced the epoch
+ */
+inline bool EpochDomain::try_advance() noexcept {
+	std::uint64_t epoch = epoch_.load();
+	for (const Slot &slot : slots_) {
+		std::uint64_t state = slot.state.load();
+		if (state != 0 && state >> 1 != epoch)
+			return false;
+	}
+	return epoch_.compare_exchange_strong(epoch, epoch + 1);
+}
+
+#endif
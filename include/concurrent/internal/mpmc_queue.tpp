@@ -0,0 +1,342 @@
+/**
+ * @file mpmc_queue.tpp
+ * @brief Implementation of MpmcQueue template class methods
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef MPMC_QUEUE_TPP
+#define MPMC_QUEUE_TPP
+
+#include "../mpmc_queue.hpp"
+
+/**
+ * @brief Constructs an empty queue
+ * 
+ * @details Allocates the slots once; the capacity is rounded up to the
+ * next power of two, and to at least two so that a filled slot can be
+ * told apart from one freed for the next lap. Slot i starts with
+ * sequence number i, free for the producer of position i.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] capacity Minimum number of elements the queue can hold
+ * @param[in] alloc Allocator to use for the slots
+ */
+template<class T, class Allocator>
+MpmcQueue<T, Allocator>::MpmcQueue(size_type capacity, const Allocator &alloc)
+	: enqueue_pos_(0), dequeue_pos_(0), slots_(nullptr),
+	capacity_(next_power_of_two(capacity < 2 ? 2 : capacity)), mask_(capacity_ - 1), alloc_(alloc) {
+	slots_ = slot_traits::allocate(alloc_, capacity_);
+	for (size_type i = 0; i < capacity_; ++i) {
+		slot_traits::construct(alloc_, slots_ + i);
+		slots_[i].sequence.store(i, std::memory_order_relaxed);
+	}
+}
+
+/**
+ * @brief Destructor
+ * 
+ * @details Destroys the elements still queued and frees the slots.
+ * Must not run concurrently with any other member.
+ * 
+ * @ingroup concurrent_containers
+ */
+template<class T, class Allocator>
+MpmcQueue<T, Allocator>::~MpmcQueue() {
+	size_type end = enqueue_pos_.load(std::memory_order_relaxed);
+	for (size_type i = dequeue_pos_.load(std::memory_order_relaxed); i != end; ++i)
+		std::destroy_at(slots_[i & mask_].value());
+	for (size_type i = 0; i < capacity_; ++i)
+		slot_traits::destroy(alloc_, slots_ + i);
+	slot_traits::deallocate(alloc_, slots_, capacity_);
+}
+
+/**
+ * @brief Appends a copy of value if there is room
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] value Value to add
+ * @return true if the value was queued, false if the queue is full
+ */
+template<class T, class Allocator>
+bool MpmcQueue<T, Allocator>::try_enqueue(const_reference value) {
+	return try_emplace(value);
+}
+
+/**
+ * @brief Moves value into the queue if there is room
+ * 
+ * @details value is left untouched when the queue is full.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] value Value to move into the queue
+ * @return true if the value was queued, false if the queue is full
+ */
+template<class T, class Allocator>
+bool MpmcQueue<T, Allocator>::try_enqueue(value_type &&value) {
+	return try_emplace(std::move(value));
+}
+
+/**
+ * @brief Constructs an element in the queue if there is room
+ * 
+ * @details If T can be built from args without throwing it is
+ * constructed directly in the claimed slot. Otherwise it is built
+ * first and moved in, so an exception never leaves a claimed slot
+ * empty.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @tparam Args Types of the constructor arguments
+ * @param[in] args Arguments forwarded to the constructor of T
+ * @return true if the element was queued, false if the queue is full
+ */
+template<class T, class Allocator>
+template <class... Args>
+bool MpmcQueue<T, Allocator>::try_emplace(Args&&... args) {
+	if constexpr (std::is_nothrow_constructible_v<T, Args&&...>) {
+		size_type position;
+		if (claim(enqueue_pos_, 1, 0, position) == 0)
+			return false;
+		Slot &slot = slots_[position & mask_];
+		::new (static_cast<void *>(slot.storage)) T(std::forward<Args>(args)...);
+		slot.sequence.store(position + 1, std::memory_order_release);
+		return true;
+	}
+	else {
+		value_type value(std::forward<Args>(args)...);
+		return try_emplace(std::move(value));
+	}
+}
+
+/**
+ * @brief Appends as many values as fit
+ * 
+ * @details When T is nothrow copy constructible, claims up to count
+ * consecutive positions with a single compare-and-swap, so the batch
+ * lands contiguously and costs one contended operation. Otherwise the
+ * values are enqueued one at a time. Stops at the first value that
+ * does not fit.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] values Array of count elements
+ * @param[in] count Number of elements to append
+ * @return Number of elements queued, which may be less than count
+ */
+template<class T, class Allocator>
+typename MpmcQueue<T, Allocator>::size_type MpmcQueue<T, Allocator>::try_enqueue_n(const_pointer values, size_type count) {
+	if constexpr (std::is_nothrow_copy_constructible_v<T>) {
+		size_type first;
+		size_type claimed = claim(enqueue_pos_, count, 0, first);
+		for (size_type i = 0; i < claimed; ++i) {
+			Slot &slot = slots_[(first + i) & mask_];
+			::new (static_cast<void *>(slot.storage)) T(values[i]);
+			slot.sequence.store(first + i + 1, std::memory_order_release);
+		}
+		return claimed;
+	}
+	else {
+		size_type pushed = 0;
+		while (pushed < count && try_enqueue(values[pushed]))
+			++pushed;
+		return pushed;
+	}
+}
+
+/**
+ * @brief Appends a copy of value, waiting while the queue is full
+ * 
+ * @details Spins with exponential backoff and then yields until a
+ * slot frees up.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] value Value to add
+ */
+template<class T, class Allocator>
+void MpmcQueue<T, Allocator>::enqueue(const_reference value) {
+	value_type copy(value);
+	enqueue(std::move(copy));
+}
+
+/**
+ * @brief Moves value into the queue, waiting while it is full
+ * 
+ * @details Spins with exponential backoff and then yields until a
+ * slot frees up.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] value Value to move into the queue
+ */
+template<class T, class Allocator>
+void MpmcQueue<T, Allocator>::enqueue(value_type &&value) {
+	Backoff backoff;
+	while (!try_emplace(std::move(value)))
+		backoff.pause();
+}
+
+/**
+ * @brief Removes the oldest element if there is one
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[out] out Receives the element by move assignment
+ * @return true if an element was removed, false if the queue is empty
+ */
+template<class T, class Allocator>
+bool MpmcQueue<T, Allocator>::try_dequeue(reference out) {
+	return try_dequeue_n(&out, 1) == 1;
+}
+
+/**
+ * @brief Removes up to count of the oldest elements
+ * 
+ * @details Claims up to count consecutive filled positions with a
+ * single compare-and-swap and moves their elements into out in order.
+ * Each slot is handed back to the producers of the next lap as soon as
+ * it is emptied.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[out] out Array of at least count initialized elements that
+ * receive the values by move assignment
+ * @param[in] count Maximum number of elements to remove
+ * @return Number of elements removed
+ */
+template<class T, class Allocator>
+typename MpmcQueue<T, Allocator>::size_type MpmcQueue<T, Allocator>::try_dequeue_n(pointer out, size_type count) {
+	size_type first;
+	size_type claimed = claim(dequeue_pos_, count, 1, first);
+	for (size_type i = 0; i < claimed; ++i) {
+		Slot &slot = slots_[(first + i) & mask_];
+		out[i] = std::move(*slot.value());
+		std::destroy_at(slot.value());
+		slot.sequence.store(first + i + capacity_, std::memory_order_release);
+	}
+	return claimed;
+}
+
+/**
+ * @brief Removes the oldest element, waiting while the queue is empty
+ * 
+ * @details Spins with exponential backoff and then yields until an
+ * element arrives.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[out] out Receives the element by move assignment
+ */
+template<class T, class Allocator>
+void MpmcQueue<T, Allocator>::dequeue(reference out) {
+	Backoff backoff;
+	while (!try_dequeue(out))
+		backoff.pause();
+}
+
+/**
+ * @brief Returns the number of queued elements
+ * 
+ * @details A snapshot that may already be stale when other threads
+ * are active. Positions claimed by a producer still constructing its
+ * element are counted.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return Number of elements in the queue
+ */
+template<class T, class Allocator>
+typename MpmcQueue<T, Allocator>::size_type MpmcQueue<T, Allocator>::size() const noexcept {
+	size_type dequeued = dequeue_pos_.load(std::memory_order_acquire);
+	size_type enqueued = enqueue_pos_.load(std::memory_order_acquire);
+	size_type queued = enqueued - dequeued;
+	return queued > capacity_ ? capacity_ : queued;
+}
+
+/**
+ * @brief Returns the maximum number of elements
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return Capacity, a power of two
+ */
+template<class T, class Allocator>
+typename MpmcQueue<T, Allocator>::size_type MpmcQueue<T, Allocator>::capacity() const noexcept { return capacity_; }
+
+/**
+ * @brief Checks if the queue is empty
+ * 
+ * @details Same caveats as size().
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return true if no elements are queued
+ */
+template<class T, class Allocator>
+bool MpmcQueue<T, Allocator>::empty() const noexcept { return size() == 0; }
+
+/**
+ * @brief Returns a copy of the allocator
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return Copy of the associated allocator
+ */
+template<class T, class Allocator>
+typename MpmcQueue<T, Allocator>::allocator_type MpmcQueue<T, Allocator>::get_allocator() const noexcept {
+	return allocator_type(alloc_);
+}
+
+/**
+ * @brief Claims up to count consecutive positions from a counter
+ * 
+ * @details Counts how many slots from the current position on are
+ * ready, that is have sequence == position + ready_offset, then
+ * advances the counter past them with one compare-and-swap. Producers
+ * pass 0 (slot free) and consumers 1 (slot filled). A slot whose
+ * sequence is ahead means the counter was read stale, and the claim is
+ * retried; a slot behind means the queue is full or empty.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in,out] position Producer or consumer counter
+ * @param[in] count Maximum number of positions to claim
+ * @param[in] ready_offset Sequence offset marking a slot as ready
+ * @param[out] first First claimed position, set when the result is
+ * not zero
+ * @return Number of positions claimed
+ */
+template<class T, class Allocator>
+typename MpmcQueue<T, Allocator>::size_type MpmcQueue<T, Allocator>::claim(std::atomic<size_type> &position,
+	size_type count, size_type ready_offset, size_type &first) noexcept {
+	size_type pos = position.load(std::memory_order_relaxed);
+	for (;;) {
+		size_type ready = 0;
+		bool stale = false;
+		for (; ready < count; ++ready) {
+			size_type sequence = slots_[(pos + ready) & mask_].sequence.load(std::memory_order_acquire);
+			std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence - (pos + ready + ready_offset));
+			if (diff != 0) {
+				stale = ready == 0 && diff > 0;
+				break;
+			}
+		}
+		if (ready == 0) {
+			if (!stale)
+				return 0;
+			pos = position.load(std::memory_order_relaxed);
+			continue;
+		}
+		if (position.compare_exchange_weak(pos, pos + ready, std::memory_order_relaxed)) {
+			first = pos;
+			return ready;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,221 @@
+/**
+ * @file mpsc_queue.tpp
+ * @brief Implementation of MpscQueue template class methods
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef MPSC_QUEUE_TPP
+#define MPSC_QUEUE_TPP
+
+#include "../mpsc_queue.hpp"
+
+/**
+ * @brief Constructs an empty queue
+ * 
+ * @details Takes the stub node from the pool, which allocates its
+ * first chunk.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] alloc Allocator to use for the nodes
+ * 
+ * @throws std::bad_alloc if the allocator fails
+ */
+template<class T, class Allocator>
+MpscQueue<T, Allocator>::MpscQueue(const Allocator &alloc)
+	: tail_(nullptr), head_(nullptr), pool_(node_allocator(alloc)) {
+	head_ = ::new (static_cast<void *>(pool_.allocate())) Node;
+	head_->next.store(nullptr, std::memory_order_relaxed);
+	tail_.store(head_, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Destructor
+ * 
+ * @details Destroys the elements still queued; the pool then frees
+ * every node at once. Must not run concurrently with any other member.
+ * 
+ * @ingroup concurrent_containers
+ */
+template<class T, class Allocator>
+MpscQueue<T, Allocator>::~MpscQueue() {
+	for (Node *node = head_->next.load(std::memory_order_relaxed); node; node = node->next.load(std::memory_order_relaxed))
+		std::destroy_at(node->value());
+}
+
+/**
+ * @brief Appends a copy of value
+ * 
+ * @details Producer side; may be called from any thread.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] value Value to add
+ * 
+ * @throws std::bad_alloc if the pool needs a new chunk and the
+ * allocator fails
+ */
+template<class T, class Allocator>
+void MpscQueue<T, Allocator>::enqueue(const_reference value) {
+	emplace(value);
+}
+
+/**
+ * @brief Moves value into the queue
+ * 
+ * @details Producer side; may be called from any thread.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] value Value to move into the queue
+ * 
+ * @throws std::bad_alloc if the pool needs a new chunk and the
+ * allocator fails
+ */
+template<class T, class Allocator>
+void MpscQueue<T, Allocator>::enqueue(value_type &&value) {
+	emplace(std::move(value));
+}
+
+/**
+ * @brief Constructs an element at the back of the queue
+ * 
+ * @details Producer side; may be called from any thread. The element
+ * is built in a node taken from the pool before the node is published
+ * with an exchange on the tail, so the consumer never sees a partly
+ * built value. If construction throws, the node goes back to the pool
+ * and the queue is unchanged.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @tparam Args Types of the constructor arguments
+ * @param[in] args Arguments forwarded to the constructor of T
+ * 
+ * @throws std::bad_alloc if the pool needs a new chunk and the
+ * allocator fails
+ */
+template<class T, class Allocator>
+template <class... Args>
+void MpscQueue<T, Allocator>::emplace(Args&&... args) {
+	Node *node = ::new (static_cast<void *>(pool_.allocate())) Node;
+	node->next.store(nullptr, std::memory_order_relaxed);
+	try {
+		::new (static_cast<void *>(node->storage)) T(std::forward<Args>(args)...);
+	}
+	catch (...) {
+		pool_.deallocate(node);
+		throw;
+	}
+	Node *previous = tail_.exchange(node, std::memory_order_acq_rel);
+	previous->next.store(node, std::memory_order_release);
+}
+
+/**
+ * @brief Makes sure at least count nodes exist
+ * 
+ * @details Fills the node pool so that up to count - 1 queued elements
+ * (one node is the stub) never require an allocation. May be called
+ * from any thread.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] count Number of nodes the queue should own
+ * 
+ * @throws std::bad_alloc if the allocator fails
+ */
+template<class T, class Allocator>
+void MpscQueue<T, Allocator>::reserve(size_type count) {
+	pool_.reserve(count);
+}
+
+/**
+ * @brief Removes the oldest element if there is one
+ * 
+ * @details Consumer only.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[out] out Receives the element by move assignment
+ * @return true if an element was removed, false if none is visible
+ */
+template<class T, class Allocator>
+bool MpscQueue<T, Allocator>::try_dequeue(reference out) {
+	return try_dequeue_n(&out, 1) == 1;
+}
+
+/**
+ * @brief Removes up to count of the oldest elements
+ * 
+ * @details Consumer only. Each element is moved into out in order and
+ * destroyed; its node then becomes the new stub and the previous stub
+ * goes back to the pool. If a move assignment throws, that element
+ * stays at the front of the queue.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[out] out Array of at least count initialized elements that
+ * receive the values by move assignment
+ * @param[in] count Maximum number of elements to remove
+ * @return Number of elements removed
+ */
+template<class T, class Allocator>
+typename MpscQueue<T, Allocator>::size_type MpscQueue<T, Allocator>::try_dequeue_n(pointer out, size_type count) {
+	size_type taken = 0;
+	while (taken < count) {
+		Node *next = head_->next.load(std::memory_order_acquire);
+		if (!next)
+			break;
+		out[taken] = std::move(*next->value());
+		std::destroy_at(next->value());
+		pool_.deallocate(head_);
+		head_ = next;
+		++taken;
+	}
+	return taken;
+}
+
+/**
+ * @brief Checks if the queue is empty
+ * 
+ * @details Consumer only. An element whose producer is still linking
+ * it in is not counted.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return true if no element is ready to be dequeued
+ */
+template<class T, class Allocator>
+bool MpscQueue<T, Allocator>::empty() const noexcept {
+	return head_->next.load(std::memory_order_acquire) == nullptr;
+}
+
+/**
+ * @brief Returns the number of nodes obtained from the allocator
+ * 
+ * @details Includes the stub and the nodes waiting in the pool. It
+ * only grows when more elements are queued at once than ever before.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return Number of nodes owned by the queue
+ */
+template<class T, class Allocator>
+typename MpscQueue<T, Allocator>::size_type MpscQueue<T, Allocator>::node_capacity() const noexcept {
+	return pool_.capacity();
+}
+
+/**
+ * @brief Returns a copy of the allocator
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return Copy of the associated allocator
+ */
+template<class T, class Allocator>
+typename MpscQueue<T, Allocator>::allocator_type MpscQueue<T, Allocator>::get_allocator() const noexcept {
+	return allocator_type(pool_.get_allocator());
+}
+
+#endif
@@ -0,0 +1,284 @@
+/**
+ * @file spsc_queue.tpp
+ * @brief Implementation of SpscQueue template class methods
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef SPSC_QUEUE_TPP
+#define SPSC_QUEUE_TPP
+
+#include "../spsc_queue.hpp"
+
+/**
+ * @brief Constructs an empty queue
+ * 
+ * @details Allocates the buffer once; the capacity is rounded up to the
+ * next power of two. The queue never allocates again.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] capacity Minimum number of elements the queue can hold
+ * @param[in] alloc Allocator to use for the buffer
+ */
+template<class T, class Allocator>
+SpscQueue<T, Allocator>::SpscQueue(size_type capacity, const Allocator &alloc)
+	: head_(0), cached_tail_(0), tail_(0), cached_head_(0), data_(nullptr),
+	capacity_(next_power_of_two(capacity)), mask_(capacity_ - 1), alloc_(alloc) {
+	data_ = alloc_traits::allocate(alloc_, capacity_);
+}
+
+/**
+ * @brief Destructor
+ * 
+ * @details Destroys the elements still queued and frees the buffer.
+ * Must not run concurrently with any other member.
+ * 
+ * @ingroup concurrent_containers
+ */
+template<class T, class Allocator>
+SpscQueue<T, Allocator>::~SpscQueue() {
+	size_type tail = tail_.load(std::memory_order_relaxed);
+	for (size_type i = head_.load(std::memory_order_relaxed); i != tail; ++i)
+		alloc_traits::destroy(alloc_, data_ + (i & mask_));
+	alloc_traits::deallocate(alloc_, data_, capacity_);
+}
+
+/**
+ * @brief Appends a copy of value if there is room
+ * 
+ * @details Producer only.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] value Value to add
+ * @return true if the value was queued, false if the queue is full
+ */
+template<class T, class Allocator>
+bool SpscQueue<T, Allocator>::try_push(const_reference value) {
+	return try_emplace(value);
+}
+
+/**
+ * @brief Moves value into the queue if there is room
+ * 
+ * @details Producer only. value is left untouched when the queue is
+ * full.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] value Value to move into the queue
+ * @return true if the value was queued, false if the queue is full
+ */
+template<class T, class Allocator>
+bool SpscQueue<T, Allocator>::try_push(value_type &&value) {
+	return try_emplace(std::move(value));
+}
+
+/**
+ * @brief Constructs an element in place if there is room
+ * 
+ * @details Producer only. The element is constructed before the new
+ * tail is published, so the consumer never sees a partly built value.
+ * If construction throws, the queue is unchanged.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @tparam Args Types of the constructor arguments
+ * @param[in] args Arguments forwarded to the constructor of T
+ * @return true if the element was queued, false if the queue is full
+ */
+template<class T, class Allocator>
+template <class... Args>
+bool SpscQueue<T, Allocator>::try_emplace(Args&&... args) {
+	size_type tail = tail_.load(std::memory_order_relaxed);
+	if (free_slots(tail, 1) == 0)
+		return false;
+	alloc_traits::construct(alloc_, data_ + (tail & mask_), std::forward<Args>(args)...);
+	tail_.store(tail + 1, std::memory_order_release);
+	return true;
+}
+
+/**
+ * @brief Appends as many values as fit
+ * 
+ * @details Producer only. Copies up to count values and publishes them
+ * with a single release store, so a batch costs one synchronisation
+ * instead of one per element. If a copy throws, the values already
+ * copied are published and the exception is rethrown.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] values Array of count elements
+ * @param[in] count Number of elements to append
+ * @return Number of elements queued, which may be less than count
+ */
+template<class T, class Allocator>
+typename SpscQueue<T, Allocator>::size_type SpscQueue<T, Allocator>::try_push_n(const_pointer values, size_type count) {
+	size_type tail = tail_.load(std::memory_order_relaxed);
+	size_type room = free_slots(tail, count);
+	size_type pushed = count < room ? count : room;
+	size_type i = 0;
+	try {
+		for (; i < pushed; ++i)
+			alloc_traits::construct(alloc_, data_ + ((tail + i) & mask_), values[i]);
+	}
+	catch (...) {
+		tail_.store(tail + i, std::memory_order_release);
+		throw;
+	}
+	tail_.store(tail + pushed, std::memory_order_release);
+	return pushed;
+}
+
+/**
+ * @brief Removes the oldest element if there is one
+ * 
+ * @details Consumer only. The slot is handed back to the producer only
+ * after the element has been moved out and destroyed.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[out] out Receives the element by move assignment
+ * @return true if an element was removed, false if the queue is empty
+ */
+template<class T, class Allocator>
+bool SpscQueue<T, Allocator>::try_pop(reference out) {
+	size_type head = head_.load(std::memory_order_relaxed);
+	if (ready_slots(head, 1) == 0)
+		return false;
+	pointer slot = data_ + (head & mask_);
+	out = std::move(*slot);
+	alloc_traits::destroy(alloc_, slot);
+	head_.store(head + 1, std::memory_order_release);
+	return true;
+}
+
+/**
+ * @brief Removes up to count of the oldest elements
+ * 
+ * @details Consumer only. Moves the elements into out in order and
+ * releases all their slots with a single store. If a move assignment
+ * throws, the elements already moved out stay removed, the one that
+ * threw stays at the front of the queue and the exception propagates.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[out] out Array of at least count initialized elements that
+ * receive the values by move assignment
+ * @param[in] count Maximum number of elements to remove
+ * @return Number of elements removed
+ */
+template<class T, class Allocator>
+typename SpscQueue<T, Allocator>::size_type SpscQueue<T, Allocator>::try_pop_n(pointer out, size_type count) {
+	size_type head = head_.load(std::memory_order_relaxed);
+	size_type ready = ready_slots(head, count);
+	size_type popped = count < ready ? count : ready;
+	size_type i = 0;
+	try {
+		for (; i < popped; ++i) {
+			pointer slot = data_ + ((head + i) & mask_);
+			out[i] = std::move(*slot);
+			alloc_traits::destroy(alloc_, slot);
+		}
+	}
+	catch (...) {
+		head_.store(head + i, std::memory_order_release);
+		throw;
+	}
+	head_.store(head + popped, std::memory_order_release);
+	return popped;
+}
+
+/**
+ * @brief Returns the number of queued elements
+ * 
+ * @details Exact when called by the producer or consumer while the
+ * other side is idle; otherwise a snapshot that may already be stale.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return Number of elements in the queue
+ */
+template<class T, class Allocator>
+typename SpscQueue<T, Allocator>::size_type SpscQueue<T, Allocator>::size() const noexcept {
+	size_type head = head_.load(std::memory_order_acquire);
+	return tail_.load(std::memory_order_acquire) - head;
+}
+
+/**
+ * @brief Returns the maximum number of elements
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return Capacity, a power of two
+ */
+template<class T, class Allocator>
+typename SpscQueue<T, Allocator>::size_type SpscQueue<T, Allocator>::capacity() const noexcept { return capacity_; }
+
+/**
+ * @brief Checks if the queue is empty
+ * 
+ * @details Same caveats as size().
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return true if no elements are queued
+ */
+template<class T, class Allocator>
+bool SpscQueue<T, Allocator>::empty() const noexcept { return size() == 0; }
+
+/**
+ * @brief Returns a copy of the allocator
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return Copy of the associated allocator
+ */
+template<class T, class Allocator>
+typename SpscQueue<T, Allocator>::allocator_type SpscQueue<T, Allocator>::get_allocator() const noexcept { return alloc_; }
+
+/**
+ * @brief Number of slots the producer may fill
+ * 
+ * @details Checks against the cached head first and reloads head_ only
+ * when the cached value shows fewer than wanted free slots.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] tail Current tail, as read by the producer
+ * @param[in] wanted Number of slots the caller would like to fill
+ * @return Number of free slots
+ */
+template<class T, class Allocator>
+typename SpscQueue<T, Allocator>::size_type SpscQueue<T, Allocator>::free_slots(size_type tail, size_type wanted) {
+	size_type room = capacity_ - (tail - cached_head_);
+	if (room >= wanted)
+		return room;
+	cached_head_ = head_.load(std::memory_order_acquire);
+	return capacity_ - (tail - cached_head_);
+}
+
+/**
+ * @brief Number of elements the consumer may take
+ * 
+ * @details Checks against the cached tail first and reloads tail_ only
+ * when the cached value shows fewer than wanted elements.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] head Current head, as read by the consumer
+ * @param[in] wanted Number of elements the caller would like to take
+ * @return Number of published elements
+ */
+template<class T, class Allocator>
+typename SpscQueue<T, Allocator>::size_type SpscQueue<T, Allocator>::ready_slots(size_type head, size_type wanted) {
+	size_type ready = cached_tail_ - head;
+	if (ready >= wanted)
+		return ready;
+	cached_tail_ = tail_.load(std::memory_order_acquire);
+	return cached_tail_ - head;
+}
+
+#endif
@@ -0,0 +1,252 @@
+/**
+ * @file work_stealing_deque.tpp
+ * @brief Implementation of WorkStealingDeque template class methods
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef WORK_STEALING_DEQUE_TPP
+#define WORK_STEALING_DEQUE_TPP
+
+#include "../work_stealing_deque.hpp"
+
+/**
+ * @brief Constructs an empty deque
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] capacity Initial number of slots, rounded up to a power
+ * of two
+ * @param[in] alloc Allocator to use for the buffers
+ */
+template<class T, class Allocator>
+WorkStealingDeque<T, Allocator>::WorkStealingDeque(size_type capacity, const Allocator &alloc)
+	: top_(0), bottom_(0), buffer_(nullptr), alloc_(alloc) {
+	buffer_.store(make_buffer(next_power_of_two(capacity), nullptr), std::memory_order_relaxed);
+}
+
+/**
+ * @brief Destructor
+ * 
+ * @details Frees the current buffer and every buffer it replaced.
+ * Must not run concurrently with any other member.
+ * 
+ * @ingroup concurrent_containers
+ */
+template<class T, class Allocator>
+WorkStealingDeque<T, Allocator>::~WorkStealingDeque() {
+	buffer_allocator buffers(alloc_);
+	Buffer *buffer = buffer_.load(std::memory_order_relaxed);
+	while (buffer) {
+		Buffer *retired = buffer->retired;
+		for (size_type i = 0; i < buffer->capacity; ++i)
+			slot_traits::destroy(alloc_, buffer->slots + i);
+		slot_traits::deallocate(alloc_, buffer->slots, buffer->capacity);
+		buffer_traits::destroy(buffers, buffer);
+		buffer_traits::deallocate(buffers, buffer, 1);
+		buffer = retired;
+	}
+}
+
+/**
+ * @brief Pushes an element at the bottom
+ * 
+ * @details Owner only. Stores the element and then publishes the new
+ * bottom with a release store; grows the buffer first when it is full.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] value Value to push
+ * 
+ * @throws std::bad_alloc if the buffer must grow and the allocator
+ * fails; the deque is then unchanged
+ */
+template<class T, class Allocator>
+void WorkStealingDeque<T, Allocator>::push(const_reference value) {
+	index_type bottom = bottom_.load(std::memory_order_relaxed);
+	index_type top = top_.load(std::memory_order_acquire);
+	Buffer *buffer = buffer_.load(std::memory_order_relaxed);
+	if (static_cast<size_type>(bottom - top) >= buffer->capacity)
+		buffer = grow(buffer, top, bottom);
+	buffer->slots[static_cast<size_type>(bottom) & buffer->mask].store(value, std::memory_order_relaxed);
+	bottom_.store(bottom + 1, std::memory_order_release);
+}
+
+/**
+ * @brief Removes the newest element
+ * 
+ * @details Owner only. Reserves the bottom element by lowering bottom,
+ * then checks top. Only when exactly one element is left does it race
+ * the thieves for it with a compare-and-swap on top.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[out] out Receives the element
+ * @return true if an element was removed, false if the deque is empty
+ * or a thief took the last element
+ */
+template<class T, class Allocator>
+bool WorkStealingDeque<T, Allocator>::try_pop(reference out) {
+	index_type bottom = bottom_.load(std::memory_order_relaxed) - 1;
+	Buffer *buffer = buffer_.load(std::memory_order_relaxed);
+	bottom_.store(bottom, std::memory_order_seq_cst);
+	index_type top = top_.load(std::memory_order_seq_cst);
+	if (top > bottom) {
+		bottom_.store(bottom + 1, std::memory_order_relaxed);
+		return false;
+	}
+	T value = buffer->slots[static_cast<size_type>(bottom) & buffer->mask].load(std::memory_order_relaxed);
+	if (top == bottom) {
+		bool won = top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+		bottom_.store(bottom + 1, std::memory_order_relaxed);
+		if (!won)
+			return false;
+	}
+	out = value;
+	return true;
+}
+
+/**
+ * @brief Removes the oldest element on behalf of another thread
+ * 
+ * @details May be called from any number of threads besides the owner.
+ * Reads top, then bottom, then the element, and claims it by advancing
+ * top with a compare-and-swap. A thief that loses the race reports
+ * failure rather than retrying, so a scheduler can move on to another
+ * victim.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[out] out Receives the element
+ * @return true if an element was stolen, false if the deque looked
+ * empty or another thread took the element first
+ */
+template<class T, class Allocator>
+bool WorkStealingDeque<T, Allocator>::try_steal(reference out) {
+	index_type top = top_.load(std::memory_order_seq_cst);
+	index_type bottom = bottom_.load(std::memory_order_seq_cst);
+	if (top >= bottom)
+		return false;
+	Buffer *buffer = buffer_.load(std::memory_order_acquire);
+	T value = buffer->slots[static_cast<size_type>(top) & buffer->mask].load(std::memory_order_relaxed);
+	if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+		return false;
+	out = value;
+	return true;
+}
+
+/**
+ * @brief Returns the number of elements
+ * 
+ * @details A snapshot that may already be stale when other threads
+ * are active.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return Number of elements in the deque
+ */
+template<class T, class Allocator>
+typename WorkStealingDeque<T, Allocator>::size_type WorkStealingDeque<T, Allocator>::size() const noexcept {
+	index_type bottom = bottom_.load(std::memory_order_acquire);
+	index_type top = top_.load(std::memory_order_acquire);
+	return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+}
+
+/**
+ * @brief Returns the number of slots in the current buffer
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return Capacity, a power of two
+ */
+template<class T, class Allocator>
+typename WorkStealingDeque<T, Allocator>::size_type WorkStealingDeque<T, Allocator>::capacity() const noexcept {
+	return buffer_.load(std::memory_order_relaxed)->capacity;
+}
+
+/**
+ * @brief Checks if the deque is empty
+ * 
+ * @details Same caveats as size().
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return true if no elements are stored
+ */
+template<class T, class Allocator>
+bool WorkStealingDeque<T, Allocator>::empty() const noexcept { return size() == 0; }
+
+/**
+ * @brief Returns a copy of the allocator
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @return Copy of the associated allocator
+ */
+template<class T, class Allocator>
+typename WorkStealingDeque<T, Allocator>::allocator_type WorkStealingDeque<T, Allocator>::get_allocator() const noexcept {
+	return allocator_type(alloc_);
+}
+
+/**
+ * @brief Allocates a buffer with all slots constructed
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] capacity Number of slots, a power of two
+ * @param[in] retired Buffer this one replaces, or nullptr
+ * @return The new buffer
+ * 
+ * @throws std::bad_alloc if the allocator fails
+ */
+template<class T, class Allocator>
+typename WorkStealingDeque<T, Allocator>::Buffer *WorkStealingDeque<T, Allocator>::make_buffer(size_type capacity, Buffer *retired) {
+	buffer_allocator buffers(alloc_);
+	Buffer *buffer = buffer_traits::allocate(buffers, 1);
+	buffer_traits::construct(buffers, buffer);
+	try {
+		buffer->slots = slot_traits::allocate(alloc_, capacity);
+	}
+	catch (...) {
+		buffer_traits::destroy(buffers, buffer);
+		buffer_traits::deallocate(buffers, buffer, 1);
+		throw;
+	}
+	for (size_type i = 0; i < capacity; ++i)
+		slot_traits::construct(alloc_, buffer->slots + i);
+	buffer->capacity = capacity;
+	buffer->mask = capacity - 1;
+	buffer->retired = retired;
+	return buffer;
+}
+
+/**
+ * @brief Replaces the buffer with one twice as large
+ * 
+ * @details Owner only. Copies the elements between top and bottom to
+ * the same positions of the new buffer, so neither counter changes,
+ * and publishes it with a release store. A thief still holding the old
+ * buffer reads the same values from it.
+ * 
+ * @ingroup concurrent_containers
+ * 
+ * @param[in] buffer Current buffer
+ * @param[in] top Top as last read by the owner
+ * @param[in] bottom Current bottom
+ * @return The new buffer
+ * 
+ * @throws std::bad_alloc if the allocator fails
+ */
+template<class T, class Allocator>
+typename WorkStealingDeque<T, Allocator>::Buffer *WorkStealingDeque<T, Allocator>::grow(Buffer *buffer, index_type top, index_type bottom) {
+	Buffer *larger = make_buffer(buffer->capacity * 2, buffer);
+	for (index_type i = top; i < bottom; ++i) {
+		T value = buffer->slots[static_cast<size_type>(i) & buffer->mask].load(std::memory_order_relaxed);
+		larger->slots[static_cast<size_type>(i) & larger->mask].store(value, std::memory_order_relaxed);
+	}
+	buffer_.store(larger, std::memory_order_release);
+	return larger;
+}
+
+#endif
@@ -0,0 +1,117 @@
+/**
+ * @file mpmc_queue.hpp
+ * @brief Bounded lock-free multi-producer multi-consumer queue
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef MPMC_QUEUE_HPP
+#define MPMC_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "backoff.hpp"
+#include "../memory/cache_line.hpp"
+#include "../memory/capacity_policy.hpp"
+
+/**
+ * @class MpmcQueue
+ * @brief Bounded FIFO queue for any number of producers and consumers
+ * 
+ * @details Follows Dmitry Vyukov's bounded MPMC design. Every slot of
+ * the power-of-two ring carries a sequence number that says whether it
+ * is free for the producer of a given position or filled for the
+ * consumer of that position. Producers and consumers claim positions
+ * with a compare-and-swap on their own counter, each on its own cache
+ * line, and then hand the slot over with a release store of the
+ * sequence number. There is no lock, and no operation allocates.
+ * 
+ * All members except the constructor and destructor may be called from
+ * any number of threads at once. Because a claimed position cannot be
+ * given back, T must be nothrow move constructible and assignable;
+ * values whose construction may throw are built before a position is
+ * claimed.
+ * 
+ * @tparam T Type of elements stored in the queue
+ * @tparam Allocator Allocator used to obtain the slots
+ * 
+ * @ingroup concurrent_containers
+ */
+template<class T, class Allocator = std::allocator<T>>
+class MpmcQueue {
+	static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>,
+		"MpmcQueue elements must be nothrow movable");
+
+public:
+	using value_type		= T;              ///< Type of stored elements
+	using allocator_type	= Allocator;      ///< Type of storage allocator
+	using size_type			= unsigned long;  ///< Type for sizes and positions
+	using reference			= T&;             ///< Reference to element
+	using const_reference	= const T&;       ///< Const reference to element
+	using pointer			= T*;             ///< Pointer to element
+	using const_pointer		= const T*;       ///< Const pointer to element
+
+	explicit MpmcQueue(size_type capacity, const Allocator &alloc = Allocator());
+	MpmcQueue(const MpmcQueue &other) = delete;
+	MpmcQueue &operator=(const MpmcQueue &other) = delete;
+	~MpmcQueue();
+
+	bool try_enqueue(const_reference value);
+	bool try_enqueue(value_type &&value);
+	template <class... Args>
+	bool try_emplace(Args&&... args);
+	size_type try_enqueue_n(const_pointer values, size_type count);
+	void enqueue(const_reference value);
+	void enqueue(value_type &&value);
+	bool try_dequeue(reference out);
+	size_type try_dequeue_n(pointer out, size_type count);
+	void dequeue(reference out);
+
+	size_type size() const noexcept;
+	size_type capacity() const noexcept;
+	bool empty() const noexcept;
+	allocator_type get_allocator() const noexcept;
+
+private:
+	/**
+	 * @struct Slot
+	 * @brief One cell of the ring and its hand-over sequence number
+	 * 
+	 * @details For position p mapping to this slot, sequence == p means
+	 * the slot is free for the producer of p and sequence == p + 1 that
+	 * it holds the element for the consumer of p.
+	 */
+	struct Slot {
+		std::atomic<size_type>		sequence;            ///< Hand-over state, see above
+		alignas(T) unsigned char	storage[sizeof(T)];  ///< Raw element storage
+
+		/**
+		 * @brief Returns the element storage
+		 * 
+		 * @return Pointer to the element slot
+		 */
+		T *value() noexcept { return reinterpret_cast<T *>(storage); }
+	};
+
+	using slot_allocator	= typename std::allocator_traits<Allocator>::template rebind_alloc<Slot>; ///< Allocator for the slots
+	using slot_traits		= std::allocator_traits<slot_allocator>;                                   ///< Slot allocator interface
+
+	alignas(cache_line_size) std::atomic<size_type>	enqueue_pos_;  ///< Next position for producers
+	alignas(cache_line_size) std::atomic<size_type>	dequeue_pos_;  ///< Next position for consumers
+	alignas(cache_line_size) Slot					*slots_;       ///< Ring of slots
+	size_type										capacity_;     ///< Number of slots, a power of two
+	size_type										mask_;         ///< capacity_ - 1
+	slot_allocator									alloc_;        ///< Allocator owning the slots
+
+	size_type claim(std::atomic<size_type> &position, size_type count, size_type ready_offset,
+		size_type &first) noexcept;
+};
+
+#include "internal/mpmc_queue.tpp"
+
+#endif
@@ -0,0 +1,106 @@
+/**
+ * @file mpsc_queue.hpp
+ * @brief Unbounded lock-free multi-producer single-consumer queue
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef MPSC_QUEUE_HPP
+#define MPSC_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "concurrent_node_pool.hpp"
+#include "../memory/cache_line.hpp"
+
+/**
+ * @class MpscQueue
+ * @brief Unbounded FIFO queue for many producers and one consumer
+ * 
+ * @details The concurrent counterpart of Queue, following Dmitry
+ * Vyukov's intrusive MPSC design. The queue is a singly linked list
+ * that always starts with a stub node: a producer links its node in
+ * with one atomic exchange on the tail, and the consumer advances the
+ * head without any read-modify-write at all.
+ * 
+ * Nodes come from a ConcurrentNodePool owned by the queue. The
+ * consumer hands each emptied node back to the pool and producers take
+ * them from there again, so in steady state no enqueue or dequeue
+ * calls the allocator; reserve() fills the pool up front.
+ * 
+ * Any number of threads may call the producer members (enqueue,
+ * emplace, reserve) while one thread calls the consumer members
+ * (try_dequeue, try_dequeue_n, empty). A producer that has swapped the
+ * tail but not yet linked its node hides the nodes queued after it for
+ * that short moment, so the consumer may briefly see the queue as
+ * empty although later enqueues have returned.
+ * 
+ * @tparam T Type of elements stored in the queue
+ * @tparam Allocator Allocator used to obtain the nodes
+ * 
+ * @ingroup concurrent_containers
+ */
+template<class T, class Allocator = std::allocator<T>>
+class MpscQueue {
+public:
+	using value_type		= T;              ///< Type of stored elements
+	using allocator_type	= Allocator;      ///< Type of node allocator
+	using size_type			= unsigned long;  ///< Type for sizes and counts
+	using reference			= T&;             ///< Reference to element
+	using const_reference	= const T&;       ///< Const reference to element
+	using pointer			= T*;             ///< Pointer to element
+	using const_pointer		= const T*;       ///< Const pointer to element
+
+	explicit MpscQueue(const Allocator &alloc = Allocator());
+	MpscQueue(const MpscQueue &other) = delete;
+	MpscQueue &operator=(const MpscQueue &other) = delete;
+	~MpscQueue();
+
+	void enqueue(const_reference value);
+	void enqueue(value_type &&value);
+	template <class... Args>
+	void emplace(Args&&... args);
+	void reserve(size_type count);
+	bool try_dequeue(reference out);
+	size_type try_dequeue_n(pointer out, size_type count);
+
+	bool empty() const noexcept;
+	size_type node_capacity() const noexcept;
+	allocator_type get_allocator() const noexcept;
+
+private:
+	/**
+	 * @struct Node
+	 * @brief Link and element storage of one queued value
+	 * 
+	 * @details The storage of the stub node at the head holds no
+	 * element.
+	 */
+	struct Node {
+		std::atomic<Node *>			next;                ///< Next node, null at the tail
+		alignas(T) unsigned char	storage[sizeof(T)];  ///< Raw element storage
+
+		/**
+		 * @brief Returns the element storage
+		 * 
+		 * @return Pointer to the element slot
+		 */
+		T *value() noexcept { return reinterpret_cast<T *>(storage); }
+	};
+
+	using node_allocator	= typename std::allocator_traits<Allocator>::template rebind_alloc<Node>; ///< Allocator for the nodes
+	using node_pool			= ConcurrentNodePool<Node, node_allocator>;                               ///< Pool recycling the nodes
+
+	alignas(cache_line_size) std::atomic<Node *>	tail_;  ///< Last node, swapped by producers
+	alignas(cache_line_size) Node					*head_; ///< Stub node, owned by the consumer
+	node_pool										pool_;  ///< Source of all nodes
+};
+
+#include "internal/mpsc_queue.tpp"
+
+#endif
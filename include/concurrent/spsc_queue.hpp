@@ -0,0 +1,102 @@
+/**
+ * @file spsc_queue.hpp
+ * @brief Bounded lock-free single-producer single-consumer queue
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef SPSC_QUEUE_HPP
+#define SPSC_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "../memory/cache_line.hpp"
+#include "../memory/capacity_policy.hpp"
+
+/**
+ * @defgroup concurrent_containers Concurrent Container Module
+ * @brief Containers that can be shared between threads
+ * 
+ * @details This module provides queues and stacks meant to hand data
+ * between threads without a mutex. Each container documents which
+ * threads may call which members; anything not covered by that contract
+ * (construction, destruction, iteration) must not race with other
+ * calls.
+ */
+
+/**
+ * @class SpscQueue
+ * @brief Bounded FIFO queue for exactly one producer and one consumer
+ * 
+ * @details A circular buffer like Deque's, sized once at construction
+ * and rounded up to a power of two so slots are found with a mask. The
+ * head and tail are free-running counters; the producer only writes
+ * the tail and the consumer only writes the head, each published with
+ * release and read with acquire ordering. Both live on their own cache
+ * line together with a cached copy of the other side's counter, so the
+ * shared line is only read when the queue looks full or empty.
+ * 
+ * One thread may call the producer members (try_push, try_emplace,
+ * try_push_n) and one other thread the consumer members (try_pop,
+ * try_pop_n) concurrently. No operation allocates or blocks.
+ * 
+ * @tparam T Type of elements stored in the queue
+ * @tparam Allocator Allocator used to obtain the buffer
+ * 
+ * @ingroup concurrent_containers
+ */
+template<class T, class Allocator = std::allocator<T>>
+class SpscQueue {
+public:
+	using value_type		= T;              ///< Type of stored elements
+	using allocator_type	= Allocator;      ///< Type of storage allocator
+	using size_type			= unsigned long;  ///< Type for sizes and counters
+	using reference			= T&;             ///< Reference to element
+	using const_reference	= const T&;       ///< Const reference to element
+	using pointer			= T*;             ///< Pointer to element
+	using const_pointer		= const T*;       ///< Const pointer to element
+
+	explicit SpscQueue(size_type capacity, const Allocator &alloc = Allocator());
+	SpscQueue(const SpscQueue &other) = delete;
+	SpscQueue &operator=(const SpscQueue &other) = delete;
+	~SpscQueue();
+
+	bool try_push(const_reference value);
+	bool try_push(value_type &&value);
+	template <class... Args>
+	bool try_emplace(Args&&... args);
+	size_type try_push_n(const_pointer values, size_type count);
+	bool try_pop(reference out);
+	size_type try_pop_n(pointer out, size_type count);
+
+	size_type size() const noexcept;
+	size_type capacity() const noexcept;
+	bool empty() const noexcept;
+	allocator_type get_allocator() const noexcept;
+
+private:
+	using alloc_traits = std::allocator_traits<Allocator>; ///< Allocator interface
+
+	alignas(cache_line_size) std::atomic<size_type>	head_;         ///< Count of elements popped, written by the consumer
+	size_type										cached_tail_;  ///< Consumer's last view of tail_
+
+	alignas(cache_line_size) std::atomic<size_type>	tail_;         ///< Count of elements pushed, written by the producer
+	size_type										cached_head_;  ///< Producer's last view of head_
+
+	alignas(cache_line_size) pointer				data_;         ///< Circular buffer
+	size_type										capacity_;     ///< Buffer size, a power of two
+	size_type										mask_;         ///< capacity_ - 1
+	allocator_type									alloc_;        ///< Allocator owning the buffer
+
+	size_type free_slots(size_type tail, size_type wanted);
+	size_type ready_slots(size_type head, size_type wanted);
+};
+
+#include "internal/spsc_queue.tpp"
+
+#endif
@@ -0,0 +1,105 @@
+/**
+ * @file work_stealing_deque.hpp
+ * @brief Chase-Lev work-stealing deque for task schedulers
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef WORK_STEALING_DEQUE_HPP
+#define WORK_STEALING_DEQUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+#include "../memory/cache_line.hpp"
+#include "../memory/capacity_policy.hpp"
+
+/**
+ * @class WorkStealingDeque
+ * @brief Deque owned by one worker thread that other threads steal from
+ * 
+ * @details Follows Chase and Lev's dynamic circular work-stealing deque
+ * with the memory orderings of Lê et al. The owner pushes and pops at
+ * the bottom like a stack; on that path it only loads and stores its
+ * own counter and never performs a read-modify-write, except when it
+ * competes with a thief for the very last element. Thieves take the
+ * oldest element from the top with a compare-and-swap.
+ * 
+ * Elements sit in a circular buffer whose capacity is a power of two,
+ * indexed by free-running counters with a mask as Deque does in its
+ * power-of-two mode. When the owner runs out of room it copies the
+ * elements into a buffer twice as large. Thieves may still be reading
+ * the old buffer, so it is kept until the deque is destroyed; since
+ * every buffer is half the size of the next, this at most doubles the
+ * memory held.
+ * 
+ * A thief reads its element before it knows whether it has won it,
+ * so elements must be trivially copyable; in practice they are task
+ * pointers or small handles.
+ * 
+ * One thread, the owner, may call push, try_pop and capacity; any
+ * number of other threads may call try_steal at the same time.
+ * 
+ * @tparam T Type of elements, trivially copyable
+ * @tparam Allocator Allocator used to obtain the buffers
+ * 
+ * @ingroup concurrent_containers
+ */
+template<class T, class Allocator = std::allocator<T>>
+class WorkStealingDeque {
+	static_assert(std::is_trivially_copyable_v<T>, "WorkStealingDeque elements must be trivially copyable");
+
+public:
+	using value_type		= T;              ///< Type of stored elements
+	using allocator_type	= Allocator;      ///< Type of buffer allocator
+	using size_type			= unsigned long;  ///< Type for sizes
+	using reference			= T&;             ///< Reference to element
+	using const_reference	= const T&;       ///< Const reference to element
+
+	explicit WorkStealingDeque(size_type capacity = 64, const Allocator &alloc = Allocator());
+	WorkStealingDeque(const WorkStealingDeque &other) = delete;
+	WorkStealingDeque &operator=(const WorkStealingDeque &other) = delete;
+	~WorkStealingDeque();
+
+	void push(const_reference value);
+	bool try_pop(reference out);
+	bool try_steal(reference out);
+
+	size_type size() const noexcept;
+	size_type capacity() const noexcept;
+	bool empty() const noexcept;
+	allocator_type get_allocator() const noexcept;
+
+private:
+	/**
+	 * @struct Buffer
+	 * @brief One generation of the circular element buffer
+	 */
+	struct Buffer {
+		std::atomic<T>	*slots;     ///< Element slots, read concurrently by thieves
+		size_type		capacity;   ///< Number of slots, a power of two
+		size_type		mask;       ///< capacity - 1
+		Buffer			*retired;   ///< Previous, smaller buffer kept for late thieves
+	};
+
+	using slot_allocator	= typename std::allocator_traits<Allocator>::template rebind_alloc<std::atomic<T>>; ///< Allocator for the slots
+	using slot_traits		= std::allocator_traits<slot_allocator>;                                             ///< Slot allocator interface
+	using buffer_allocator	= typename std::allocator_traits<Allocator>::template rebind_alloc<Buffer>;          ///< Allocator for buffer headers
+	using buffer_traits		= std::allocator_traits<buffer_allocator>;                                           ///< Buffer allocator interface
+	using index_type		= long;                                                                              ///< Signed position, may briefly pass top
+
+	alignas(cache_line_size) std::atomic<index_type>	top_;      ///< Next position to steal, advanced by thieves and the owner
+	alignas(cache_line_size) std::atomic<index_type>	bottom_;   ///< Next position to push, written by the owner only
+	std::atomic<Buffer *>								buffer_;   ///< Current buffer, replaced by the owner only
+	slot_allocator										alloc_;    ///< Allocator owning the slots
+
+	Buffer *make_buffer(size_type capacity, Buffer *retired);
+	Buffer *grow(Buffer *buffer, index_type top, index_type bottom);
+};
+
+#include "internal/work_stealing_deque.tpp"
+
+#endif
@@ -0,0 +1,216 @@
+/**
+ * @file block_deque.hpp
+ * @brief Segmented double-ended queue with stable element addresses
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2025-01-28
+ */
+
+#ifndef BLOCK_DEQUE_HPP
+#define BLOCK_DEQUE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../collections_config.hpp"
+#include "../memory/relocation.hpp"
+
+/**
+ * @brief Default number of elements per BlockDeque block
+ * 
+ * @details Aims for blocks of about 4 KiB, rounded down to a power of
+ * two and never fewer than 16 elements.
+ * 
+ * @tparam T Type of elements stored in the blocks
+ * @return Number of elements per block
+ * 
+ * @ingroup linear_containers
+ */
+template<class T>
+constexpr std::size_t default_block_size() noexcept {
+	std::size_t count = sizeof(T) < 256 ? 4096 / sizeof(T) : 16;
+	std::size_t block = 1;
+	while (block * 2 <= count)
+		block *= 2;
+	return block;
+}
+
+/**
+ * @class BlockDeque
+ * @brief Double-ended queue storing its elements in fixed-size blocks
+ * 
+ * @details Alternative to Deque for large or long-lived queues. The
+ * elements live in blocks of BlockSize elements, reached through a map
+ * of block pointers. Elements are never moved once constructed:
+ * push_front() and push_back() only ever add a block at either end, so
+ * references and pointers to elements stay valid until the element is
+ * removed (iterators are invalidated by any insertion, as the map may
+ * be reallocated). Growing the map copies one pointer per block, never
+ * the elements. One emptied block is kept as a spare so that pushes and
+ * pops alternating at a block boundary do not reach the allocator.
+ * 
+ * @tparam T Type of elements stored in the deque
+ * @tparam BlockSize Number of elements per block (a power of two)
+ * @tparam Allocator Allocator used to obtain blocks and the block map
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, std::size_t BlockSize = default_block_size<T>(), class Allocator = std::allocator<T>>
+class BlockDeque {
+	static_assert(BlockSize > 0 && (BlockSize & (BlockSize - 1)) == 0, "BlockSize must be a power of two");
+
+public:
+	/**
+	 * @class BasicIterator
+	 * @brief Random access iterator over the blocks of a BlockDeque
+	 * 
+	 * @details Keeps a pointer to the block map and a slot number, so
+	 * jumps and distances are constant time. The const instantiation
+	 * only hands out const references and can be constructed from a
+	 * mutable iterator.
+	 * 
+	 * @tparam IsConst Whether the iterator gives read-only access
+	 */
+	template<bool IsConst>
+	class BasicIterator {
+	public:
+		using iterator_category	= std::random_access_iterator_tag;            ///< Iterator category tag
+		using value_type		= T;                                           ///< Type of elements
+		using difference_type	= std::ptrdiff_t;                              ///< Distance between iterators
+		using pointer			= std::conditional_t<IsConst, const T*, T*>;   ///< Pointer to element
+		using reference			= std::conditional_t<IsConst, const T&, T&>;   ///< Reference to element
+
+		BasicIterator() noexcept;
+		BasicIterator(T *const *blocks, size_t slot) noexcept;
+		BasicIterator(const BasicIterator<false>& other) noexcept;
+
+		reference operator*() const;
+		pointer operator->() const;
+		reference operator[](difference_type offset) const;
+		BasicIterator& operator++();
+		BasicIterator operator++(int);
+		BasicIterator& operator--();
+		BasicIterator operator--(int);
+		BasicIterator& operator+=(difference_type offset);
+		BasicIterator& operator-=(difference_type offset);
+		BasicIterator operator+(difference_type offset) const;
+		BasicIterator operator-(difference_type offset) const;
+		template<bool OtherConst>
+		difference_type operator-(const BasicIterator<OtherConst>& other) const;
+		template<bool OtherConst>
+		bool operator!=(const BasicIterator<OtherConst>& other) const;
+		template<bool OtherConst>
+		bool operator==(const BasicIterator<OtherConst>& other) const;
+		template<bool OtherConst>
+		bool operator<(const BasicIterator<OtherConst>& other) const;
+		template<bool OtherConst>
+		bool operator>(const BasicIterator<OtherConst>& other) const;
+		template<bool OtherConst>
+		bool operator<=(const BasicIterator<OtherConst>& other) const;
+		template<bool OtherConst>
+		bool operator>=(const BasicIterator<OtherConst>& other) const;
+
+		/**
+		 * @brief Offset addition with the offset on the left
+		 * 
+		 * @param[in] offset Number of positions to advance
+		 * @param[in] it Iterator to advance
+		 * @return Iterator offset positions after it
+		 */
+		friend BasicIterator operator+(difference_type offset, const BasicIterator& it) {
+			return it + offset;
+		}
+
+	private:
+		T *const	*blocks_;  ///< Map entry of the deque's first block
+		size_t		slot_;     ///< Slot counted from the start of that block
+
+		friend class BasicIterator<!IsConst>;
+	};
+
+	using Iterator			= BasicIterator<false>; ///< Mutable iterator
+	using ConstIterator		= BasicIterator<true>;  ///< Read-only iterator
+
+	using value_type		= T;              ///< Type of stored elements
+	using allocator_type	= Allocator;      ///< Type of storage allocator
+	using size_type			= unsigned long;  ///< Type for sizes and indices
+	using reference			= T&;             ///< Reference to element
+	using const_reference	= const T&;       ///< Const reference to element
+	using pointer			= T*;             ///< Pointer to element
+	using const_pointer		= const T*;       ///< Const pointer to element
+	using iterator			= Iterator;       ///< Iterator type
+	using const_iterator	= ConstIterator;  ///< Const iterator type
+
+	static constexpr size_type block_size = BlockSize; ///< Elements per block
+
+	BlockDeque() noexcept;
+	explicit BlockDeque(const Allocator &alloc) noexcept;
+	BlockDeque(size_type count, const T &value, const Allocator &alloc = Allocator());
+	BlockDeque(const BlockDeque &other);
+	BlockDeque(BlockDeque &&other) noexcept;
+	template <class Container>
+	BlockDeque(const Container& other);
+	~BlockDeque();
+
+	reference operator[](size_type index);
+	const_reference operator[](size_type index) const;
+	BlockDeque &operator=(const BlockDeque &other);
+	BlockDeque &operator=(BlockDeque &&other)
+		noexcept(alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value);
+
+	void clear() noexcept;
+	reference at(size_type index);
+	const_reference at(size_type index) const;
+	void push_back(const_reference value);
+	void push_back(value_type &&value);
+	void push_front(const_reference value);
+	void push_front(value_type &&value);
+	template <class... Args>
+	reference emplace_back(Args&&... args);
+	template <class... Args>
+	reference emplace_front(Args&&... args);
+	value_type pop_back();
+	value_type pop_front();
+
+	size_type size() const noexcept;
+	size_type block_count() const noexcept;
+	bool empty() const noexcept;
+	void shrink_to_fit() noexcept;
+	iterator begin() noexcept;
+	const_iterator begin() const noexcept;
+	iterator end() noexcept;
+	const_iterator end() const noexcept;
+	allocator_type get_allocator() const noexcept;
+
+private:
+	using alloc_traits		= std::allocator_traits<Allocator>;                       ///< Allocator interface
+	using map_allocator		= typename alloc_traits::template rebind_alloc<pointer>; ///< Allocator for the map
+	using map_traits		= std::allocator_traits<map_allocator>;                   ///< Map allocator interface
+
+	pointer			*map_;          ///< Block pointers, used from first_block_
+	size_type		map_capacity_;  ///< Number of entries in map_
+	size_type		first_block_;   ///< Map index of the first block in use
+	size_type		block_count_;   ///< Number of blocks in use
+	size_type		start_;         ///< Slot of the front element in the first block
+	size_type		size_;          ///< Number of elements in deque
+	pointer			spare_;         ///< Emptied block kept for reuse, or nullptr
+	allocator_type	alloc_;         ///< Allocator owning blocks and map
+
+	pointer element(size_type slot) const noexcept;
+	pointer acquire_block();
+	void release_block(pointer block) noexcept;
+	void reserve_map_slot(bool front);
+	void destroy_elements() noexcept;
+	void drop_blocks() noexcept;
+	void release() noexcept;
+};
+
+#include "internal/block_deque.tpp"
+
+#endif
@@ -9,7 +9,19 @@
 #ifndef DEQUE_HPP
 #define DEQUE_HPP
 
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../collections_config.hpp"
+#include "../memory/capacity_policy.hpp"
+#include "../memory/relocation.hpp"
 
 /**
  * @class Deque
@@ -18,50 +30,137 @@
  * @details Implements a deque (double-ended queue) allowing efficient
  * insertion and deletion at both ends. Uses circular buffer with
  * dynamic resizing for optimal space and time complexity. Provides
- * random access to elements.
+ * random access to elements. Only live elements are constructed in the
+ * underlying raw storage.
+ * 
+ * With a policy that keeps capacity at a power of two (for example
+ * PowerOfTwoCapacityPolicy) buffer indices are wrapped with a mask.
+ * Otherwise a conditional subtraction is used; neither mode divides on
+ * element access.
  * 
  * @tparam T Type of elements stored in the deque
+ * @tparam Allocator Allocator used to obtain raw element storage
+ * @tparam Policy Growth and shrink policy (see CapacityPolicy)
  * 
  * @ingroup linear_containers
  */
-template<class T>
+template<class T, class Allocator = std::allocator<T>, class Policy = DefaultCapacityPolicy>
 class Deque {
 public:
 	/**
-	 * @class Iterator
-	 * @brief Forward iterator for circular buffer traversal
+	 * @class BasicIterator
+	 * @brief Random access iterator for circular buffer traversal
+	 * 
+	 * @details Provides access to deque elements handling the circular
+	 * nature of the underlying buffer transparently. The iterator keeps
+	 * a logical position, so jumps and distances are constant time and
+	 * standard algorithms such as std::sort take their random access
+	 * paths. The const instantiation only hands out const references
+	 * and can be constructed from a mutable iterator.
 	 * 
-	 * @details Provides sequential access to deque elements handling
-	 * the circular nature of the underlying buffer transparently.
+	 * @tparam IsConst Whether the iterator gives read-only access
 	 */
-	class Iterator {
+	template<bool IsConst>
+	class BasicIterator {
+	public:
+		using iterator_category	= std::random_access_iterator_tag;            ///< Iterator category tag
+		using value_type		= T;                                           ///< Type of elements
+		using difference_type	= std::ptrdiff_t;                              ///< Distance between iterators
+		using pointer			= std::conditional_t<IsConst, const T*, T*>;   ///< Pointer to element
+		using reference			= std::conditional_t<IsConst, const T&, T&>;   ///< Reference to element
+
+		BasicIterator() noexcept;
+		BasicIterator(pointer data, size_t capacity, size_t head, size_t position) noexcept;
+		BasicIterator(const BasicIterator<false>& other) noexcept;
+
+		reference operator*() const;
+		pointer operator->() const;
+		reference operator[](difference_type offset) const;
+		BasicIterator& operator++();
+		BasicIterator operator++(int);
+		BasicIterator& operator--();
+		BasicIterator operator--(int);
+		BasicIterator& operator+=(difference_type offset);
+		BasicIterator& operator-=(difference_type offset);
+		BasicIterator operator+(difference_type offset) const;
+		BasicIterator operator-(difference_type offset) const;
+		template<bool OtherConst>
+		difference_type operator-(const BasicIterator<OtherConst>& other) const;
+		template<bool OtherConst>
+		bool operator!=(const BasicIterator<OtherConst>& other) const;
+		template<bool OtherConst>
+		bool operator==(const BasicIterator<OtherConst>& other) const;
+		template<bool OtherConst>
+		bool operator<(const BasicIterator<OtherConst>& other) const;
+		template<bool OtherConst>
+		bool operator>(const BasicIterator<OtherConst>& other) const;
+		template<bool OtherConst>
+		bool operator<=(const BasicIterator<OtherConst>& other) const;
+		template<bool OtherConst>
+		bool operator>=(const BasicIterator<OtherConst>& other) const;
+
+		/**
+		 * @brief Offset addition with the offset on the left
+		 * 
+		 * @param[in] offset Number of positions to advance
+		 * @param[in] it Iterator to advance
+		 * @return Iterator offset positions after it
+		 */
+		friend BasicIterator operator+(difference_type offset, const BasicIterator& it) {
+			return it + offset;
+		}
+
 	private:
-		T* data_;              ///< Pointer to buffer
-		size_t capacity_;      ///< Buffer capacity
-		size_t head_;          ///< Head index in buffer
-		size_t current_index_; ///< Current logical index
-		size_t position_;      ///< Current position in iteration
+		pointer	data_;      ///< Pointer to buffer
+		size_t	capacity_;  ///< Buffer capacity
+		size_t	head_;      ///< Head index in buffer
+		size_t	position_;  ///< Logical position from the front
 
-	public:
-		Iterator(T* data, size_t capacity, size_t head, size_t position);
+		pointer address() const;
 
-		T& operator*() const;
-		Iterator& operator++();
-		bool operator!=(const Iterator& other) const;
-		bool operator==(const Iterator& other) const;
+		friend class BasicIterator<!IsConst>;
 	};
 
+	using Iterator			= BasicIterator<false>; ///< Mutable iterator
+	using ConstIterator		= BasicIterator<true>;  ///< Read-only iterator
+
 	using value_type		= T;              ///< Type of stored elements
+	using allocator_type	= Allocator;      ///< Type of storage allocator
+	using capacity_policy	= Policy;         ///< Growth and shrink policy
 	using size_type			= unsigned long;  ///< Type for sizes and indices
 	using reference			= T&;             ///< Reference to element
 	using const_reference	= const T&;       ///< Const reference to element
 	using pointer			= T*;             ///< Pointer to element
 	using const_pointer		= const T*;       ///< Const pointer to element
 	using iterator			= Iterator;       ///< Iterator type
-	using const_iterator	= const Iterator; ///< Const iterator type
+	using const_iterator	= ConstIterator;  ///< Const iterator type
+
+	/**
+	 * @struct BasicSpans
+	 * @brief The contiguous runs of buffer holding the elements
+	 * 
+	 * @details The elements in order are first[0 .. first_size) followed
+	 * by second[0 .. second_size). second_size is zero unless the live
+	 * data wraps around the end of the buffer.
+	 * 
+	 * @tparam P Pointer type of the runs
+	 */
+	template<class P>
+	struct BasicSpans {
+		P			first;        ///< Run starting at the front element
+		size_type	first_size;   ///< Number of elements in first
+		P			second;       ///< Wrapped run at the start of the buffer
+		size_type	second_size;  ///< Number of elements in second
+	};
+
+	using spans			= BasicSpans<pointer>;        ///< Mutable view of the runs
+	using const_spans	= BasicSpans<const_pointer>;  ///< Read-only view of the runs
+
+	static constexpr bool power_of_two_capacity = has_power_of_two_capacity_v<Policy>; ///< Whether indices wrap by mask
 
 	Deque();
-	Deque(size_type count, const T &value);
+	explicit Deque(const Allocator &alloc) noexcept;
+	Deque(size_type count, const T &value, const Allocator &alloc = Allocator());
 	Deque(const Deque &other);
 	Deque(Deque &&other) noexcept;
 	template <class Container>
@@ -69,18 +168,26 @@ public:
 	~Deque();
 
 	reference operator[](size_type index);
+	const_reference operator[](size_type index) const;
 	Deque &operator=(const Deque &other);
-	Deque &operator=(Deque &&other) noexcept;
+	Deque &operator=(Deque &&other) noexcept(alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value);
 
 	void clear() noexcept;
+	reference at(size_type index);
 	const_reference at(size_type index) const;
 	void push_back(const_reference value);
 	void push_front(const_reference value);
 	value_type pop_back();
 	value_type pop_front();
+	void push_back_n(const_pointer values, size_type count);
+	size_type pop_front_n(pointer out, size_type count);
+	spans as_spans() noexcept;
+	const_spans as_spans() const noexcept;
 
 	size_type size() const noexcept;
 	size_type capacity() const noexcept;
+	void reserve(size_type new_cap);
+	void shrink_to_fit();
 	size_type head() const noexcept;
 	size_type tail() const noexcept;
 	bool empty() const noexcept;
@@ -90,17 +197,27 @@ public:
 	const_iterator begin() const noexcept;
 	iterator end() noexcept;
 	const_iterator end() const noexcept;
+	allocator_type get_allocator() const noexcept;
 
 private:
-	pointer		data_;      ///< Pointer to circular buffer
-	size_type	size_;      ///< Number of elements in deque
-	size_type	capacity_;  ///< Current buffer capacity
-	size_type	head_;      ///< Index of front element
-	size_type	tail_;      ///< Index of back element
+	using alloc_traits = std::allocator_traits<Allocator>; ///< Allocator interface
 
-	void reserve();
-	void shrink_to_fit();
-	void order();
+	pointer			data_;      ///< Pointer to circular buffer
+	size_type		size_;      ///< Number of elements in deque
+	size_type		capacity_;  ///< Current buffer capacity
+	size_type		head_;      ///< Index of front element
+	size_type		tail_;      ///< Index of back element
+	allocator_type	alloc_;     ///< Allocator owning the buffer
+
+	size_type wrap(size_type slot) const noexcept;
+	static size_type fit_capacity(size_type required) noexcept;
+	void shrink_by_policy();
+	void reallocate(size_type new_cap);
+	void transfer(pointer new_data, size_type new_cap);
+	template <class... Args>
+	void grow_and_construct(bool front, Args&&... args);
+	void destroy_elements() noexcept;
+	void release() noexcept;
 };
 
 #include "internal/deque.tpp"
@@ -9,7 +9,15 @@
 #ifndef DOUBLE_LINKED_LIST_HPP
 #define DOUBLE_LINKED_LIST_HPP
 
+#include <cstddef>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "../memory/node_pool.hpp"
 
 /**
  * @class DoubleLinkedList
@@ -20,11 +28,29 @@
  * efficient insertion and deletion at any position with bidirectional
  * traversal capability.
  * 
+ * Index-based access walks from whichever of the head, the tail and
+ * the node reached by the previous index access is closest, so
+ * sequential and nearby accesses take O(1) amortized.
+ * 
+ * Elements can also be inserted, erased and moved between lists in
+ * O(1) relative to an iterator, and merge() and sort() relink nodes
+ * instead of copying elements.
+ * 
+ * Nodes are obtained from a node allocator, by default a PoolAllocator
+ * that carves them out of chunks and reuses freed ones, so building
+ * or cycling through the list rarely reaches the global allocator.
+ * splice() and merge() only relink nodes between lists whose
+ * allocators compare equal, such as default-constructed lists, which
+ * share the pool for their node size, or lists constructed from
+ * copies of one PoolAllocator. Lists with separate allocators fall
+ * back to moving each element into a new node.
+ * 
  * @tparam T Type of elements stored in the list
+ * @tparam Allocator Allocator whose rebound copy allocates the nodes
  * 
  * @ingroup linear_containers
  */
-template<class T>
+template<class T, class Allocator = PoolAllocator<T>>
 class DoubleLinkedList {
 public:
 	/**
@@ -40,41 +66,71 @@ public:
 		Node		*prev; ///< Pointer to previous node in sequence
 
 		Node(const T &value);
+		Node(T &&value);
 	};
 
 	/**
-	 * @class Iterator
-	 * @brief Bidirectional iterator for doubly linked list traversal
+	 * @class BasicIterator
+	 * @brief Bidirectional iterator for list traversal
 	 * 
 	 * @details Provides sequential access to list elements in both
-	 * forward and backward directions through standard iterator
-	 * operations.
+	 * forward and backward directions. The iterator remembers where its
+	 * list keeps the tail, so decrementing end() yields the last
+	 * element. The const instantiation only hands out const references
+	 * and can be constructed from a mutable iterator.
+	 * 
+	 * @tparam IsConst Whether the iterator gives read-only access
 	 */
-	class Iterator {
-	private:
-		Node* current;  ///< Pointer to current node
-
+	template<bool IsConst>
+	class BasicIterator {
 	public:
-		Iterator(Node* node);
+		using iterator_category	= std::bidirectional_iterator_tag;             ///< Iterator category tag
+		using value_type		= T;                                           ///< Type of elements
+		using difference_type	= std::ptrdiff_t;                              ///< Distance between iterators
+		using pointer			= std::conditional_t<IsConst, const T*, T*>;   ///< Pointer to element
+		using reference			= std::conditional_t<IsConst, const T&, T&>;   ///< Reference to element
+		using node_pointer		= std::conditional_t<IsConst, const Node*, Node*>; ///< Pointer to node
+
+		BasicIterator() noexcept;
+		BasicIterator(node_pointer node, Node *const *tail) noexcept;
+		BasicIterator(const BasicIterator<false>& other) noexcept;
+		BasicIterator& operator=(const BasicIterator& other) noexcept = default;
+
+		reference operator*() const;
+		pointer operator->() const;
+		BasicIterator& operator++();
+		BasicIterator operator++(int);
+		BasicIterator& operator--();
+		BasicIterator operator--(int);
+		template<bool OtherConst>
+		bool operator!=(const BasicIterator<OtherConst>& other) const;
+		template<bool OtherConst>
+		bool operator==(const BasicIterator<OtherConst>& other) const;
 
-		T& operator*() const;
-		Iterator& operator++();
-		Iterator& operator--();
-		bool operator!=(const Iterator& other) const;
-		bool operator==(const Iterator& other) const;
+	private:
+		node_pointer	current;  ///< Pointer to current node
+		Node *const		*tail;    ///< Owner's tail pointer, used to step back from end()
+
+		friend class BasicIterator<!IsConst>;
+		friend class DoubleLinkedList;
 	};
 
+	using Iterator			= BasicIterator<false>; ///< Mutable iterator
+	using ConstIterator		= BasicIterator<true>;  ///< Read-only iterator
+
 	using value_type		= T;              ///< Type of stored elements
+	using allocator_type	= Allocator;      ///< Type of node allocator
 	using size_type			= unsigned long;  ///< Type for sizes and indices
 	using reference			= T&;             ///< Reference to element
 	using const_reference	= const T&;       ///< Const reference to element
 	using pointer			= Node*;          ///< Pointer to node
 	using const_pointer		= const Node*;    ///< Const pointer to node
 	using iterator			= Iterator;       ///< Iterator type
-	using const_iterator	= const Iterator; ///< Const iterator type
+	using const_iterator	= ConstIterator;  ///< Const iterator type
 
 	DoubleLinkedList() noexcept;
-	DoubleLinkedList(size_type count, const T &value);
+	explicit DoubleLinkedList(const Allocator &alloc) noexcept;
+	DoubleLinkedList(size_type count, const T &value, const Allocator &alloc = Allocator());
 	DoubleLinkedList(const DoubleLinkedList &other);
 	DoubleLinkedList(DoubleLinkedList &&other) noexcept;
 	template <class Container>
@@ -83,13 +139,22 @@ public:
 
 	reference operator[](size_type index);
 	DoubleLinkedList &operator=(const DoubleLinkedList &other);
-	DoubleLinkedList &operator=(DoubleLinkedList &&other);
+	DoubleLinkedList &operator=(DoubleLinkedList &&other)
+		noexcept(node_traits::propagate_on_container_move_assignment::value || node_traits::is_always_equal::value);
 
 	void clear() noexcept;
 	const_reference at(size_type index) const;
 	void add(const_reference value);
 	pointer insert(size_type index, const_reference value);
 	value_type erase(size_type index);
+	iterator insert_after(const_iterator pos, const_reference value);
+	iterator erase(const_iterator pos);
+	void splice(const_iterator pos, DoubleLinkedList &other);
+	void splice(const_iterator pos, DoubleLinkedList &other, const_iterator first, const_iterator last);
+	template <class Compare = std::less<T>>
+	void merge(DoubleLinkedList &other, Compare comp = Compare());
+	template <class Compare = std::less<T>>
+	void sort(Compare comp = Compare());
 
 	size_type size() const noexcept;
 	bool empty() const noexcept;
@@ -97,6 +162,7 @@ public:
 	const_pointer head() const noexcept;
 	pointer tail() noexcept;
 	const_pointer tail() const noexcept;
+	allocator_type get_allocator() const noexcept;
 
 	iterator begin() noexcept;
 	iterator end() noexcept;
@@ -104,9 +170,30 @@ public:
 	const_iterator end() const noexcept;
 
 private:
-	pointer		head_;  ///< Pointer to first node in list
-	pointer		tail_;  ///< Pointer to last node in list
-	size_type	size_;  ///< Number of elements in list
+	using node_allocator	= typename std::allocator_traits<Allocator>::template rebind_alloc<Node>; ///< Allocator for nodes
+	using node_traits		= std::allocator_traits<node_allocator>;                                   ///< Node allocator interface
+
+	pointer				head_;          ///< Pointer to first node in list
+	pointer				tail_;          ///< Pointer to last node in list
+	size_type			size_;          ///< Number of elements in list
+	node_allocator		alloc_;         ///< Allocator owning the nodes
+	pointer				cursor_;        ///< Node last reached by a non-const index access, or nullptr
+	size_type			cursor_index_;  ///< Index of cursor_
+
+	template <class Arg>
+	pointer create_node(Arg &&value);
+	void destroy_node(pointer node) noexcept;
+	pointer node_at(size_type index) noexcept;
+	pointer find_node(size_type index) const noexcept;
+	void reset_cursor() noexcept;
+	void link_before(pointer next, pointer node) noexcept;
+	void unlink(pointer node) noexcept;
+	pointer adopt(DoubleLinkedList &other, pointer node);
+	bool shares_nodes_with(const DoubleLinkedList &other) const noexcept;
+	template <class Compare>
+	static pointer run_end(pointer first, Compare &comp);
+	template <class Compare>
+	pointer merge_runs(pointer a_first, pointer a_last, pointer b_last, Compare &comp);
 };
 
 #include "internal/double_linked_list.tpp"
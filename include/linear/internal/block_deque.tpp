@@ -0,0 +1,1038 @@
+/**
+ * @file block_deque.tpp
+ * @brief Implementation of BlockDeque template class methods
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2025-01-28
+ */
+
+#ifndef BLOCK_DEQUE_TPP
+#define BLOCK_DEQUE_TPP
+
+#include "../block_deque.hpp"
+
+/**
+ * @brief Default iterator constructor
+ * 
+ * @details Constructs a singular iterator that is not attached to any
+ * deque.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+template<bool IsConst>
+BlockDeque<T, BlockSize, Allocator>::BasicIterator<IsConst>::BasicIterator() noexcept : blocks_(nullptr), slot_(0) {}
+
+/**
+ * @brief Iterator constructor
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] blocks Map entry of the deque's first block
+ * @param[in] slot Slot of the element counted from that block
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+template<bool IsConst>
+BlockDeque<T, BlockSize, Allocator>::BasicIterator<IsConst>::BasicIterator(T *const *blocks, size_t slot) noexcept : blocks_(blocks), slot_(slot) {}
+
+/**
+ * @brief Converting constructor
+ * 
+ * @details Copies a mutable iterator. For the const instantiation this
+ * is the conversion from iterator to const_iterator.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Mutable iterator to copy
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+template<bool IsConst>
+BlockDeque<T, BlockSize, Allocator>::BasicIterator<IsConst>::BasicIterator(const BasicIterator<false>& other) noexcept
+	: blocks_(other.blocks_), slot_(other.slot_) {}
+
+/**
+ * @brief Dereference operator
+ * 
+ * @details Locates the block with a shift and the element inside it
+ * with a mask, as BlockSize is a power of two.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Reference to element pointed to by iterator
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+template<bool IsConst>
+typename BlockDeque<T, BlockSize, Allocator>::template BasicIterator<IsConst>::reference BlockDeque<T, BlockSize, Allocator>::BasicIterator<IsConst>::operator*() const {
+	return blocks_[slot_ / BlockSize][slot_ % BlockSize];
+}
+
+/**
+ * @brief Member access operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Pointer to element pointed to by iterator
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+template<bool IsConst>
+typename BlockDeque<T, BlockSize, Allocator>::template BasicIterator<IsConst>::pointer BlockDeque<T, BlockSize, Allocator>::BasicIterator<IsConst>::operator->() const {
+	return &**this;
+}
+
+/**
+ * @brief Subscript operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] offset Distance from the current position
+ * @return Reference to the element at that position
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+template<bool IsConst>
+typename BlockDeque<T, BlockSize, Allocator>::template BasicIterator<IsConst>::reference BlockDeque<T, BlockSize, Allocator>::BasicIterator<IsConst>::operator[](difference_type offset) const {
+	return *(*this + offset);
+}
+
+/**
+ * @brief Prefix increment operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Reference to this iterator after increment
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+template<bool IsConst>
+typename BlockDeque<T, BlockSize, Allocator>::template BasicIterator<IsConst>& BlockDeque<T, BlockSize, Allocator>::BasicIterator<IsConst>::operator++() {
+	++slot_;
+	return *this;
+}
+
+/**
+ * @brief Postfix increment operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Copy of the iterator before increment
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+template<bool IsConst>
+typename BlockDeque<T, BlockSize, Allocator>::template BasicIterator<IsConst> BlockDeque<T, BlockSize, Allocator>::BasicIterator<IsConst>::operator++(int) {
+	BasicIterator previous = *this;
+	++slot_;
+	return previous;
+}
+
+/**
+ * @brief Prefix decrement operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Reference to this iterator after decrement
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+template<bool IsConst>
+typename BlockDeque<T, BlockSize, Allocator>::template BasicIterator<IsConst>& BlockDeque<T, BlockSize, Allocator>::BasicIterator<IsConst>::operator--() {
+	--slot_;
+	return *this;
+}
+
+/**
+ * @brief Postfix decrement operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Copy of the iterator before decrement
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+template<bool IsConst>
+typename BlockDeque<T, BlockSize, Allocator>::template BasicIterator<IsConst> BlockDeque<T, BlockSize, Allocator>::BasicIterator<IsConst>::operator--(int) {
+	BasicIterator previous = *this;
+	--slot_;
+	return previous;
+}
+
+/**
+ * @brief Compound addition operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] offset Number of positions to advance (may be negative)
+ * @return Reference to this iterator
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+template<bool IsConst>
+typename BlockDeque<T, BlockSize, Allocator>::template BasicIterator<IsConst>& BlockDeque<T, BlockSize, Allocator>::BasicIterator<IsConst>::operator+=(difference_type offset) {
+	slot_ += static_cast<size_t>(offset);
+	return *this;
+}
+
+/**
+ * @brief Compound subtraction operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] offset Number of positions to move back (may be negative)
+ * @return Reference to this iterator
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+template<bool IsConst>
+typename BlockDeque<T, BlockSize, Allocator>::template BasicIterator<IsConst>& BlockDeque<T, BlockSize, Allocator>::BasicIterator<IsConst>::operator-=(difference_type offset) {
+	slot_ -= static_cast<size_t>(offset);
+	return *this;
+}
+
+/**
+ * @brief Addition operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] offset Number of positions to advance (may be negative)
+ * @return Iterator offset positions after this one
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+template<bool IsConst>
+typename BlockDeque<T, BlockSize, Allocator>::template BasicIterator<IsConst> BlockDeque<T, BlockSize, Allocator>::BasicIterator<IsConst>::operator+(difference_type offset) const {
+	BasicIterator result = *this;
+	return result += offset;
+}
+
+/**
+ * @brief Subtraction operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] offset Number of positions to move back (may be negative)
+ * @return Iterator offset positions before this one
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+template<bool IsConst>
+typename BlockDeque<T, BlockSize, Allocator>::template BasicIterator<IsConst> BlockDeque<T, BlockSize, Allocator>::BasicIterator<IsConst>::operator-(difference_type offset) const {
+	BasicIterator result = *this;
+	return result -= offset;
+}
+
+/**
+ * @brief Distance operator
+ * 
+ * @details Both iterators must belong to the same deque and have been
+ * obtained since its last insertion.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Iterator to measure from
+ * @return Signed distance between the two positions
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+template<bool IsConst>
+template<bool OtherConst>
+typename BlockDeque<T, BlockSize, Allocator>::template BasicIterator<IsConst>::difference_type BlockDeque<T, BlockSize, Allocator>::BasicIterator<IsConst>::operator-(const BasicIterator<OtherConst>& other) const {
+	return static_cast<difference_type>(slot_) - static_cast<difference_type>(other.slot_);
+}
+
+/**
+ * @brief Inequality comparison operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Iterator into the same deque
+ * @return Result of comparing the two positions
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+template<bool IsConst>
+template<bool OtherConst>
+bool BlockDeque<T, BlockSize, Allocator>::BasicIterator<IsConst>::operator!=(const BasicIterator<OtherConst>& other) const {
+	return slot_ != other.slot_;
+}
+
+/**
+ * @brief Equality comparison operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Iterator into the same deque
+ * @return Result of comparing the two positions
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+template<bool IsConst>
+template<bool OtherConst>
+bool BlockDeque<T, BlockSize, Allocator>::BasicIterator<IsConst>::operator==(const BasicIterator<OtherConst>& other) const {
+	return slot_ == other.slot_;
+}
+
+/**
+ * @brief Less-than comparison operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Iterator into the same deque
+ * @return Result of comparing the two positions
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+template<bool IsConst>
+template<bool OtherConst>
+bool BlockDeque<T, BlockSize, Allocator>::BasicIterator<IsConst>::operator<(const BasicIterator<OtherConst>& other) const {
+	return slot_ < other.slot_;
+}
+
+/**
+ * @brief Greater-than comparison operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Iterator into the same deque
+ * @return Result of comparing the two positions
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+template<bool IsConst>
+template<bool OtherConst>
+bool BlockDeque<T, BlockSize, Allocator>::BasicIterator<IsConst>::operator>(const BasicIterator<OtherConst>& other) const {
+	return slot_ > other.slot_;
+}
+
+/**
+ * @brief Less-or-equal comparison operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Iterator into the same deque
+ * @return Result of comparing the two positions
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+template<bool IsConst>
+template<bool OtherConst>
+bool BlockDeque<T, BlockSize, Allocator>::BasicIterator<IsConst>::operator<=(const BasicIterator<OtherConst>& other) const {
+	return slot_ <= other.slot_;
+}
+
+/**
+ * @brief Greater-or-equal comparison operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Iterator into the same deque
+ * @return Result of comparing the two positions
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+template<bool IsConst>
+template<bool OtherConst>
+bool BlockDeque<T, BlockSize, Allocator>::BasicIterator<IsConst>::operator>=(const BasicIterator<OtherConst>& other) const {
+	return slot_ >= other.slot_;
+}
+
+/**
+ * @brief Default constructor creating empty deque
+ * 
+ * @details No memory allocation is performed; the block map is
+ * allocated on the first insertion.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+BlockDeque<T, BlockSize, Allocator>::BlockDeque() noexcept
+	: map_(nullptr), map_capacity_(0), first_block_(0), block_count_(0), start_(0), size_(0),
+	spare_(nullptr), alloc_() {}
+
+/**
+ * @brief Constructs empty deque using the given allocator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] alloc Allocator to use for blocks and the block map
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+BlockDeque<T, BlockSize, Allocator>::BlockDeque(const Allocator &alloc) noexcept
+	: map_(nullptr), map_capacity_(0), first_block_(0), block_count_(0), start_(0), size_(0),
+	spare_(nullptr), alloc_(alloc) {}
+
+/**
+ * @brief Constructor creating deque with repeated values
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] count Number of elements to create
+ * @param[in] value Value to initialize each element with
+ * @param[in] alloc Allocator to use for blocks and the block map
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+BlockDeque<T, BlockSize, Allocator>::BlockDeque(size_type count, const T &value, const Allocator &alloc) : BlockDeque(alloc) {
+	try {
+		for (size_type i = 0; i < count; ++i)
+			push_back(value);
+	}
+	catch (...) {
+		release();
+		throw;
+	}
+}
+
+/**
+ * @brief Copy constructor
+ * 
+ * @details Copies the elements in order into freshly allocated blocks.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Deque to copy from
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+BlockDeque<T, BlockSize, Allocator>::BlockDeque(const BlockDeque &other)
+	: BlockDeque(alloc_traits::select_on_container_copy_construction(other.alloc_)) {
+	try {
+		for (const auto& item : other)
+			push_back(item);
+	}
+	catch (...) {
+		release();
+		throw;
+	}
+}
+
+/**
+ * @brief Move constructor
+ * 
+ * @details Takes over the blocks and map of another deque. Elements
+ * keep their addresses. The source deque is left empty.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Deque to move from
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+BlockDeque<T, BlockSize, Allocator>::BlockDeque(BlockDeque &&other) noexcept
+	: map_(other.map_), map_capacity_(other.map_capacity_), first_block_(other.first_block_),
+	block_count_(other.block_count_), start_(other.start_), size_(other.size_), spare_(other.spare_),
+	alloc_(std::move(other.alloc_)) {
+	other.map_ = nullptr;
+	other.map_capacity_ = 0;
+	other.first_block_ = 0;
+	other.block_count_ = 0;
+	other.start_ = 0;
+	other.size_ = 0;
+	other.spare_ = nullptr;
+}
+
+/**
+ * @brief Constructor from generic container
+ * 
+ * @details Constructs a deque from any container supporting
+ * range-based iteration, copying all elements in order.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @tparam Container Type of source container
+ * @param[in] other Container to copy elements from
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+template <class Container>
+BlockDeque<T, BlockSize, Allocator>::BlockDeque(const Container& other) : BlockDeque() {
+	try {
+		for (const auto& item : other)
+			push_back(item);
+	}
+	catch (...) {
+		release();
+		throw;
+	}
+}
+
+/**
+ * @brief Destructor
+ * 
+ * @details Destroys the live elements and frees every block and the
+ * block map.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+BlockDeque<T, BlockSize, Allocator>::~BlockDeque() {
+	release();
+}
+
+/**
+ * @brief Subscript operator
+ * 
+ * @details Provides access to element at specified index. The index is
+ * only checked when COLLECTIONS_BOUNDS_CHECK is enabled; use at() for
+ * access that is always checked.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] index Position of element to access (must be < size)
+ * @return Reference to element at specified index
+ * 
+ * @throws std::out_of_range if index >= size and bounds checking is
+ * enabled
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+typename BlockDeque<T, BlockSize, Allocator>::reference BlockDeque<T, BlockSize, Allocator>::operator[](size_type index) {
+#if COLLECTIONS_BOUNDS_CHECK
+	if (index >= size_)
+		throw std::out_of_range("Index out of range");
+#endif
+	return *element(start_ + index);
+}
+
+/**
+ * @brief Const subscript operator
+ * 
+ * @details Read-only counterpart of operator[], checked only when
+ * COLLECTIONS_BOUNDS_CHECK is enabled.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] index Position of element to access (must be < size)
+ * @return Const reference to element at specified index
+ * 
+ * @throws std::out_of_range if index >= size and bounds checking is
+ * enabled
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+typename BlockDeque<T, BlockSize, Allocator>::const_reference BlockDeque<T, BlockSize, Allocator>::operator[](size_type index) const {
+#if COLLECTIONS_BOUNDS_CHECK
+	if (index >= size_)
+		throw std::out_of_range("Index out of range");
+#endif
+	return *element(start_ + index);
+}
+
+/**
+ * @brief Copy assignment operator
+ * 
+ * @details Replaces the contents with copies of the elements of other.
+ * Blocks already owned are reused where possible.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Deque to copy from
+ * @return Reference to this deque
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+BlockDeque<T, BlockSize, Allocator> &BlockDeque<T, BlockSize, Allocator>::operator=(const BlockDeque &other) {
+	if (this != &other) {
+		clear();
+		for (const auto& item : other)
+			push_back(item);
+	}
+	return *this;
+}
+
+/**
+ * @brief Move assignment operator
+ * 
+ * @details Frees the current contents and takes over the blocks and
+ * map of other, which is left empty. When the allocator does not
+ * propagate and the two allocators differ, the blocks cannot change
+ * hands, so the elements are moved one by one into blocks of this
+ * deque's own instead; only that case can throw.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Deque to move from
+ * @return Reference to this deque
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+BlockDeque<T, BlockSize, Allocator> &BlockDeque<T, BlockSize, Allocator>::operator=(BlockDeque &&other)
+	noexcept(alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value) {
+	if (this != &other) {
+		if constexpr (!alloc_traits::propagate_on_container_move_assignment::value && !alloc_traits::is_always_equal::value) {
+			if (alloc_ != other.alloc_) {
+				clear();
+				for (auto& item : other)
+					push_back(std::move(item));
+				other.clear();
+				return *this;
+			}
+		}
+		release();
+		if constexpr (alloc_traits::propagate_on_container_move_assignment::value)
+			alloc_ = std::move(other.alloc_);
+		map_ = other.map_;
+		map_capacity_ = other.map_capacity_;
+		first_block_ = other.first_block_;
+		block_count_ = other.block_count_;
+		start_ = other.start_;
+		size_ = other.size_;
+		spare_ = other.spare_;
+		other.map_ = nullptr;
+		other.map_capacity_ = 0;
+		other.first_block_ = 0;
+		other.block_count_ = 0;
+		other.start_ = 0;
+		other.size_ = 0;
+		other.spare_ = nullptr;
+	}
+	return *this;
+}
+
+/**
+ * @brief Removes all elements from the deque
+ * 
+ * @details Destroys every element and gives the blocks back, keeping
+ * one as a spare. The block map is kept for reuse.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+void BlockDeque<T, BlockSize, Allocator>::clear() noexcept {
+	destroy_elements();
+	drop_blocks();
+}
+
+/**
+ * @brief Element access with bounds checking
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] index Position of element to access
+ * @return Reference to element at specified index
+ * 
+ * @throws std::out_of_range if index >= size
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+typename BlockDeque<T, BlockSize, Allocator>::reference BlockDeque<T, BlockSize, Allocator>::at(size_type index) {
+	if (index >= size_)
+		throw std::out_of_range("Index out of range");
+	return *element(start_ + index);
+}
+
+/**
+ * @brief Const element access with bounds checking
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] index Position of element to access
+ * @return Const reference to element at specified index
+ * 
+ * @throws std::out_of_range if index >= size
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+typename BlockDeque<T, BlockSize, Allocator>::const_reference BlockDeque<T, BlockSize, Allocator>::at(size_type index) const {
+	if (index >= size_)
+		throw std::out_of_range("Index out of range");
+	return *element(start_ + index);
+}
+
+/**
+ * @brief Adds element to end of deque
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] value Value to add
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+void BlockDeque<T, BlockSize, Allocator>::push_back(const_reference value) {
+	emplace_back(value);
+}
+
+/**
+ * @brief Moves element to end of deque
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] value Value to move into the deque
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+void BlockDeque<T, BlockSize, Allocator>::push_back(value_type &&value) {
+	emplace_back(std::move(value));
+}
+
+/**
+ * @brief Adds element to front of deque
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] value Value to add
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+void BlockDeque<T, BlockSize, Allocator>::push_front(const_reference value) {
+	emplace_front(value);
+}
+
+/**
+ * @brief Moves element to front of deque
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] value Value to move into the deque
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+void BlockDeque<T, BlockSize, Allocator>::push_front(value_type &&value) {
+	emplace_front(std::move(value));
+}
+
+/**
+ * @brief Constructs element in place at end of deque
+ * 
+ * @details When the last block is full a new block is attached after
+ * it; no existing element moves. If construction throws, the deque is
+ * left unchanged.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @tparam Args Types of the constructor arguments
+ * @param[in] args Arguments forwarded to the constructor of T
+ * @return Reference to the new last element
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+template <class... Args>
+typename BlockDeque<T, BlockSize, Allocator>::reference BlockDeque<T, BlockSize, Allocator>::emplace_back(Args&&... args) {
+	size_type slot = start_ + size_;
+	if (slot == block_count_ * BlockSize) {
+		reserve_map_slot(false);
+		pointer block = acquire_block();
+		try {
+			alloc_traits::construct(alloc_, block, std::forward<Args>(args)...);
+		}
+		catch (...) {
+			release_block(block);
+			throw;
+		}
+		map_[first_block_ + block_count_] = block;
+		++block_count_;
+	}
+	else
+		alloc_traits::construct(alloc_, element(slot), std::forward<Args>(args)...);
+	++size_;
+	return *element(slot);
+}
+
+/**
+ * @brief Constructs element in place at front of deque
+ * 
+ * @details When the first block is full a new block is attached before
+ * it; no existing element moves. If construction throws, the deque is
+ * left unchanged.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @tparam Args Types of the constructor arguments
+ * @param[in] args Arguments forwarded to the constructor of T
+ * @return Reference to the new first element
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+template <class... Args>
+typename BlockDeque<T, BlockSize, Allocator>::reference BlockDeque<T, BlockSize, Allocator>::emplace_front(Args&&... args) {
+	if (start_ == 0) {
+		reserve_map_slot(true);
+		pointer block = acquire_block();
+		try {
+			alloc_traits::construct(alloc_, block + BlockSize - 1, std::forward<Args>(args)...);
+		}
+		catch (...) {
+			release_block(block);
+			throw;
+		}
+		map_[--first_block_] = block;
+		++block_count_;
+		start_ = BlockSize - 1;
+	}
+	else {
+		alloc_traits::construct(alloc_, element(start_ - 1), std::forward<Args>(args)...);
+		--start_;
+	}
+	++size_;
+	return *element(start_);
+}
+
+/**
+ * @brief Removes and returns element from end of deque
+ * 
+ * @details A block left empty is handed back (see release_block()).
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Value of removed element
+ * 
+ * @throws std::out_of_range if deque is empty
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+typename BlockDeque<T, BlockSize, Allocator>::value_type BlockDeque<T, BlockSize, Allocator>::pop_back() {
+	if (size_ == 0) throw std::out_of_range("Empty deque");
+	pointer last = element(start_ + size_ - 1);
+	value_type value = std::move(*last);
+	alloc_traits::destroy(alloc_, last);
+	--size_;
+	if (size_ == 0)
+		drop_blocks();
+	else if ((start_ + size_) % BlockSize == 0)
+		release_block(map_[first_block_ + --block_count_]);
+	return value;
+}
+
+/**
+ * @brief Removes and returns element from front of deque
+ * 
+ * @details A block left empty is handed back (see release_block()).
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Value of removed element
+ * 
+ * @throws std::out_of_range if deque is empty
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+typename BlockDeque<T, BlockSize, Allocator>::value_type BlockDeque<T, BlockSize, Allocator>::pop_front() {
+	if (size_ == 0) throw std::out_of_range("Empty deque");
+	pointer first = element(start_);
+	value_type value = std::move(*first);
+	alloc_traits::destroy(alloc_, first);
+	++start_;
+	--size_;
+	if (size_ == 0)
+		drop_blocks();
+	else if (start_ == BlockSize) {
+		release_block(map_[first_block_++]);
+		--block_count_;
+		start_ = 0;
+	}
+	return value;
+}
+
+/**
+ * @brief Returns the number of elements
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Number of elements in deque
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+typename BlockDeque<T, BlockSize, Allocator>::size_type BlockDeque<T, BlockSize, Allocator>::size() const noexcept { return size_; }
+
+/**
+ * @brief Returns the number of blocks holding elements
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Number of blocks in use (the spare block is not counted)
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+typename BlockDeque<T, BlockSize, Allocator>::size_type BlockDeque<T, BlockSize, Allocator>::block_count() const noexcept { return block_count_; }
+
+/**
+ * @brief Checks if deque is empty
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return true if deque is empty, false otherwise
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+bool BlockDeque<T, BlockSize, Allocator>::empty() const noexcept { return size_ == 0; }
+
+/**
+ * @brief Frees memory not needed by the current elements
+ * 
+ * @details Releases the spare block and, if the deque is empty, the
+ * block map. Elements are never moved.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+void BlockDeque<T, BlockSize, Allocator>::shrink_to_fit() noexcept {
+	if (spare_) {
+		alloc_traits::deallocate(alloc_, spare_, BlockSize);
+		spare_ = nullptr;
+	}
+	if (block_count_ == 0 && map_) {
+		map_allocator map_alloc(alloc_);
+		map_traits::deallocate(map_alloc, map_, map_capacity_);
+		map_ = nullptr;
+		map_capacity_ = 0;
+		first_block_ = 0;
+	}
+}
+
+/**
+ * @brief Returns iterator to beginning of deque
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Iterator to first element
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+typename BlockDeque<T, BlockSize, Allocator>::iterator BlockDeque<T, BlockSize, Allocator>::begin() noexcept {
+	return Iterator(map_ + first_block_, start_);
+}
+
+/**
+ * @brief Returns const iterator to beginning of deque
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Const iterator to first element
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+typename BlockDeque<T, BlockSize, Allocator>::const_iterator BlockDeque<T, BlockSize, Allocator>::begin() const noexcept {
+	return ConstIterator(map_ + first_block_, start_);
+}
+
+/**
+ * @brief Returns iterator to end of deque
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Iterator past last element
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+typename BlockDeque<T, BlockSize, Allocator>::iterator BlockDeque<T, BlockSize, Allocator>::end() noexcept {
+	return Iterator(map_ + first_block_, start_ + size_);
+}
+
+/**
+ * @brief Returns const iterator to end of deque
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Const iterator past last element
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+typename BlockDeque<T, BlockSize, Allocator>::const_iterator BlockDeque<T, BlockSize, Allocator>::end() const noexcept {
+	return ConstIterator(map_ + first_block_, start_ + size_);
+}
+
+/**
+ * @brief Returns a copy of the allocator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Copy of the associated allocator
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+typename BlockDeque<T, BlockSize, Allocator>::allocator_type BlockDeque<T, BlockSize, Allocator>::get_allocator() const noexcept { return alloc_; }
+
+/**
+ * @brief Returns the address of a slot
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] slot Slot counted from the start of the first block
+ * @return Pointer to the element storage for that slot
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+typename BlockDeque<T, BlockSize, Allocator>::pointer BlockDeque<T, BlockSize, Allocator>::element(size_type slot) const noexcept {
+	return map_[first_block_ + slot / BlockSize] + slot % BlockSize;
+}
+
+/**
+ * @brief Obtains an uninitialized block
+ * 
+ * @details Reuses the spare block if there is one, otherwise allocates.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Storage for BlockSize elements
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+typename BlockDeque<T, BlockSize, Allocator>::pointer BlockDeque<T, BlockSize, Allocator>::acquire_block() {
+	if (spare_) {
+		pointer block = spare_;
+		spare_ = nullptr;
+		return block;
+	}
+	return alloc_traits::allocate(alloc_, BlockSize);
+}
+
+/**
+ * @brief Gives back an empty block
+ * 
+ * @details Keeps the block as the spare if there is none yet, so that
+ * a push right after a pop at a block boundary does not allocate;
+ * otherwise returns it to the allocator.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] block Block holding no live elements
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+void BlockDeque<T, BlockSize, Allocator>::release_block(pointer block) noexcept {
+	if (!spare_)
+		spare_ = block;
+	else
+		alloc_traits::deallocate(alloc_, block, BlockSize);
+}
+
+/**
+ * @brief Makes room in the map for one more block at either end
+ * 
+ * @details If the map still has free entries at the requested end
+ * nothing happens. If it has plenty of room overall, the used entries
+ * are recentred in place; otherwise a map of twice the size is
+ * allocated. Either way only block pointers are copied, never
+ * elements.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] front true to make room before the first block, false
+ * after the last one
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+void BlockDeque<T, BlockSize, Allocator>::reserve_map_slot(bool front) {
+	if (front ? first_block_ > 0 : first_block_ + block_count_ < map_capacity_)
+		return;
+	size_type needed = block_count_ + 1;
+	size_type new_first;
+	if (map_capacity_ >= 2 * needed) {
+		new_first = (map_capacity_ - needed) / 2 + (front ? 1 : 0);
+		relocate_overlapping(map_ + first_block_, block_count_, map_ + new_first);
+	}
+	else {
+		size_type new_cap = std::max<size_type>(2 * std::max(map_capacity_, needed), 8);
+		map_allocator map_alloc(alloc_);
+		pointer *new_map = map_traits::allocate(map_alloc, new_cap);
+		new_first = (new_cap - needed) / 2 + (front ? 1 : 0);
+		std::copy(map_ + first_block_, map_ + first_block_ + block_count_, new_map + new_first);
+		if (map_)
+			map_traits::deallocate(map_alloc, map_, map_capacity_);
+		map_ = new_map;
+		map_capacity_ = new_cap;
+	}
+	first_block_ = new_first;
+}
+
+/**
+ * @brief Destroys every live element
+ * 
+ * @details Runs the destructor of each element and sets size to zero.
+ * The blocks are kept.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+void BlockDeque<T, BlockSize, Allocator>::destroy_elements() noexcept {
+	for (size_type i = 0; i < size_; ++i)
+		alloc_traits::destroy(alloc_, element(start_ + i));
+	size_ = 0;
+}
+
+/**
+ * @brief Gives back every block of an empty deque
+ * 
+ * @details Hands the blocks to release_block() and recentres the first
+ * block index so the next insertions can grow in both directions
+ * without touching the map.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+void BlockDeque<T, BlockSize, Allocator>::drop_blocks() noexcept {
+	for (size_type i = 0; i < block_count_; ++i)
+		release_block(map_[first_block_ + i]);
+	block_count_ = 0;
+	start_ = 0;
+	first_block_ = map_capacity_ / 2;
+}
+
+/**
+ * @brief Destroys all elements and frees all memory
+ * 
+ * @details Leaves the deque empty without blocks, spare or map.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, std::size_t BlockSize, class Allocator>
+void BlockDeque<T, BlockSize, Allocator>::release() noexcept {
+	destroy_elements();
+	drop_blocks();
+	shrink_to_fit();
+}
+
+#endif
@@ -11,6 +11,18 @@
 
 #include "../deque.hpp"
 
+/**
+ * @brief Default iterator constructor
+ * 
+ * @details Constructs a singular iterator that is not attached to any
+ * deque.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, class Allocator, class Policy>
+template<bool IsConst>
+Deque<T, Allocator, Policy>::BasicIterator<IsConst>::BasicIterator() noexcept : data_(nullptr), capacity_(0), head_(0), position_(0) {}
+
 /**
  * @brief Iterator constructor
  * 
@@ -24,12 +36,25 @@
  * @param[in] head Head index in buffer
  * @param[in] position Logical position in iteration
  */
-template<class T>
-Deque<T>::Iterator::Iterator(T* data, size_t capacity, size_t head, size_t position)
-	: data_(data), capacity_(capacity), head_(head), current_index_(head), position_(position) {
-	if (position_ > 0 && capacity_ > 0)
-		current_index_ = (head_ + position_) % capacity_;
-}
+template<class T, class Allocator, class Policy>
+template<bool IsConst>
+Deque<T, Allocator, Policy>::BasicIterator<IsConst>::BasicIterator(pointer data, size_t capacity, size_t head, size_t position) noexcept
+	: data_(data), capacity_(capacity), head_(head), position_(position) {}
+
+/**
+ * @brief Converting constructor
+ * 
+ * @details Copies a mutable iterator. For the const instantiation this
+ * is the conversion from iterator to const_iterator.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Mutable iterator to copy
+ */
+template<class T, class Allocator, class Policy>
+template<bool IsConst>
+Deque<T, Allocator, Policy>::BasicIterator<IsConst>::BasicIterator(const BasicIterator<false>& other) noexcept
+	: data_(other.data_), capacity_(other.capacity_), head_(other.head_), position_(other.position_) {}
 
 /**
  * @brief Dereference operator
@@ -40,9 +65,42 @@ Deque<T>::Iterator::Iterator(T* data, size_t capacity, size_t head, size_t posit
  * 
  * @return Reference to element pointed to by iterator
  */
-template<class T>
-T& Deque<T>::Iterator::operator*() const {
-	return data_[current_index_];
+template<class T, class Allocator, class Policy>
+template<bool IsConst>
+typename Deque<T, Allocator, Policy>::template BasicIterator<IsConst>::reference Deque<T, Allocator, Policy>::BasicIterator<IsConst>::operator*() const {
+	return *address();
+}
+
+/**
+ * @brief Member access operator
+ * 
+ * @details Returns pointer to element at current iterator position.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Pointer to element pointed to by iterator
+ */
+template<class T, class Allocator, class Policy>
+template<bool IsConst>
+typename Deque<T, Allocator, Policy>::template BasicIterator<IsConst>::pointer Deque<T, Allocator, Policy>::BasicIterator<IsConst>::operator->() const {
+	return address();
+}
+
+/**
+ * @brief Subscript operator
+ * 
+ * @details Returns reference to the element offset positions away from
+ * the current one.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] offset Distance from the current position
+ * @return Reference to the element at that position
+ */
+template<class T, class Allocator, class Policy>
+template<bool IsConst>
+typename Deque<T, Allocator, Policy>::template BasicIterator<IsConst>::reference Deque<T, Allocator, Policy>::BasicIterator<IsConst>::operator[](difference_type offset) const {
+	return *(*this + offset);
 }
 
 /**
@@ -54,47 +112,275 @@ T& Deque<T>::Iterator::operator*() const {
  * 
  * @return Reference to this iterator after increment
  */
-template<class T>
-typename Deque<T>::Iterator& Deque<T>::Iterator::operator++() {
+template<class T, class Allocator, class Policy>
+template<bool IsConst>
+typename Deque<T, Allocator, Policy>::template BasicIterator<IsConst>& Deque<T, Allocator, Policy>::BasicIterator<IsConst>::operator++() {
 	++position_;
-	if (capacity_ > 0)
-		current_index_ = (head_ + position_) % capacity_;
 	return *this;
 }
 
+/**
+ * @brief Postfix increment operator
+ * 
+ * @details Advances iterator to next position in circular buffer.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Copy of the iterator before increment
+ */
+template<class T, class Allocator, class Policy>
+template<bool IsConst>
+typename Deque<T, Allocator, Policy>::template BasicIterator<IsConst> Deque<T, Allocator, Policy>::BasicIterator<IsConst>::operator++(int) {
+	BasicIterator previous = *this;
+	++position_;
+	return previous;
+}
+
+/**
+ * @brief Prefix decrement operator
+ * 
+ * @details Moves iterator to previous position in circular buffer.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Reference to this iterator after decrement
+ */
+template<class T, class Allocator, class Policy>
+template<bool IsConst>
+typename Deque<T, Allocator, Policy>::template BasicIterator<IsConst>& Deque<T, Allocator, Policy>::BasicIterator<IsConst>::operator--() {
+	--position_;
+	return *this;
+}
+
+/**
+ * @brief Postfix decrement operator
+ * 
+ * @details Moves iterator to previous position in circular buffer.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Copy of the iterator before decrement
+ */
+template<class T, class Allocator, class Policy>
+template<bool IsConst>
+typename Deque<T, Allocator, Policy>::template BasicIterator<IsConst> Deque<T, Allocator, Policy>::BasicIterator<IsConst>::operator--(int) {
+	BasicIterator previous = *this;
+	--position_;
+	return previous;
+}
+
+/**
+ * @brief Compound addition operator
+ * 
+ * @details Advances the iterator by offset positions in constant time.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] offset Number of positions to advance (may be negative)
+ * @return Reference to this iterator
+ */
+template<class T, class Allocator, class Policy>
+template<bool IsConst>
+typename Deque<T, Allocator, Policy>::template BasicIterator<IsConst>& Deque<T, Allocator, Policy>::BasicIterator<IsConst>::operator+=(difference_type offset) {
+	position_ += static_cast<size_t>(offset);
+	return *this;
+}
+
+/**
+ * @brief Compound subtraction operator
+ * 
+ * @details Moves the iterator back by offset positions in constant
+ * time.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] offset Number of positions to move back (may be negative)
+ * @return Reference to this iterator
+ */
+template<class T, class Allocator, class Policy>
+template<bool IsConst>
+typename Deque<T, Allocator, Policy>::template BasicIterator<IsConst>& Deque<T, Allocator, Policy>::BasicIterator<IsConst>::operator-=(difference_type offset) {
+	position_ -= static_cast<size_t>(offset);
+	return *this;
+}
+
+/**
+ * @brief Addition operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] offset Number of positions to advance (may be negative)
+ * @return Iterator offset positions after this one
+ */
+template<class T, class Allocator, class Policy>
+template<bool IsConst>
+typename Deque<T, Allocator, Policy>::template BasicIterator<IsConst> Deque<T, Allocator, Policy>::BasicIterator<IsConst>::operator+(difference_type offset) const {
+	BasicIterator result = *this;
+	return result += offset;
+}
+
+/**
+ * @brief Subtraction operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] offset Number of positions to move back (may be negative)
+ * @return Iterator offset positions before this one
+ */
+template<class T, class Allocator, class Policy>
+template<bool IsConst>
+typename Deque<T, Allocator, Policy>::template BasicIterator<IsConst> Deque<T, Allocator, Policy>::BasicIterator<IsConst>::operator-(difference_type offset) const {
+	BasicIterator result = *this;
+	return result -= offset;
+}
+
+/**
+ * @brief Distance operator
+ * 
+ * @details Returns the number of increments needed to go from other
+ * to this iterator. Both must belong to the same deque.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Iterator to measure from
+ * @return Signed distance between the two positions
+ */
+template<class T, class Allocator, class Policy>
+template<bool IsConst>
+template<bool OtherConst>
+typename Deque<T, Allocator, Policy>::template BasicIterator<IsConst>::difference_type Deque<T, Allocator, Policy>::BasicIterator<IsConst>::operator-(const BasicIterator<OtherConst>& other) const {
+	return static_cast<difference_type>(position_) - static_cast<difference_type>(other.position_);
+}
+
 /**
  * @brief Inequality comparison operator
  * 
- * @details Compares two iterators to determine if they are at
- * different positions in the iteration sequence.
+ * @details Compares the logical positions of two iterators into the
+ * same deque.
  * 
  * @ingroup linear_containers
  * 
  * @param[in] other Iterator to compare against
- * @return true if iterators are at different positions, false
- * otherwise
+ * @return Result of comparing the two positions
  */
-template<class T>
-bool Deque<T>::Iterator::operator!=(const Iterator& other) const {
+template<class T, class Allocator, class Policy>
+template<bool IsConst>
+template<bool OtherConst>
+bool Deque<T, Allocator, Policy>::BasicIterator<IsConst>::operator!=(const BasicIterator<OtherConst>& other) const {
 	return position_ != other.position_;
 }
 
 /**
  * @brief Equality comparison operator
  * 
- * @details Compares two iterators to determine if they are at the
- * same position in the iteration sequence.
+ * @details Compares the logical positions of two iterators into the
+ * same deque.
  * 
  * @ingroup linear_containers
  * 
  * @param[in] other Iterator to compare against
- * @return true if iterators are at same position, false otherwise
+ * @return Result of comparing the two positions
  */
-template<class T>
-bool Deque<T>::Iterator::operator==(const Iterator& other) const {
+template<class T, class Allocator, class Policy>
+template<bool IsConst>
+template<bool OtherConst>
+bool Deque<T, Allocator, Policy>::BasicIterator<IsConst>::operator==(const BasicIterator<OtherConst>& other) const {
 	return position_ == other.position_;
 }
 
+/**
+ * @brief Less-than comparison operator
+ * 
+ * @details Compares the logical positions of two iterators into the
+ * same deque.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Iterator to compare against
+ * @return Result of comparing the two positions
+ */
+template<class T, class Allocator, class Policy>
+template<bool IsConst>
+template<bool OtherConst>
+bool Deque<T, Allocator, Policy>::BasicIterator<IsConst>::operator<(const BasicIterator<OtherConst>& other) const {
+	return position_ < other.position_;
+}
+
+/**
+ * @brief Greater-than comparison operator
+ * 
+ * @details Compares the logical positions of two iterators into the
+ * same deque.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Iterator to compare against
+ * @return Result of comparing the two positions
+ */
+template<class T, class Allocator, class Policy>
+template<bool IsConst>
+template<bool OtherConst>
+bool Deque<T, Allocator, Policy>::BasicIterator<IsConst>::operator>(const BasicIterator<OtherConst>& other) const {
+	return position_ > other.position_;
+}
+
+/**
+ * @brief Less-or-equal comparison operator
+ * 
+ * @details Compares the logical positions of two iterators into the
+ * same deque.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Iterator to compare against
+ * @return Result of comparing the two positions
+ */
+template<class T, class Allocator, class Policy>
+template<bool IsConst>
+template<bool OtherConst>
+bool Deque<T, Allocator, Policy>::BasicIterator<IsConst>::operator<=(const BasicIterator<OtherConst>& other) const {
+	return position_ <= other.position_;
+}
+
+/**
+ * @brief Greater-or-equal comparison operator
+ * 
+ * @details Compares the logical positions of two iterators into the
+ * same deque.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Iterator to compare against
+ * @return Result of comparing the two positions
+ */
+template<class T, class Allocator, class Policy>
+template<bool IsConst>
+template<bool OtherConst>
+bool Deque<T, Allocator, Policy>::BasicIterator<IsConst>::operator>=(const BasicIterator<OtherConst>& other) const {
+	return position_ >= other.position_;
+}
+
+/**
+ * @brief Maps the logical position to an element address
+ * 
+ * @details Since the head is below capacity and the position at most
+ * the size, a single conditional subtraction wraps the index without
+ * a division. With power-of-two capacities a mask is used instead.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Pointer to the element at the current position
+ */
+template<class T, class Allocator, class Policy>
+template<bool IsConst>
+typename Deque<T, Allocator, Policy>::template BasicIterator<IsConst>::pointer Deque<T, Allocator, Policy>::BasicIterator<IsConst>::address() const {
+	size_t slot = head_ + position_;
+	if constexpr (power_of_two_capacity)
+		return data_ + (slot & (capacity_ - 1));
+	else
+		return data_ + (slot >= capacity_ ? slot - capacity_ : slot);
+}
+
 /**
  * @brief Default constructor creating empty deque
  * 
@@ -103,42 +389,81 @@ bool Deque<T>::Iterator::operator==(const Iterator& other) const {
  * 
  * @ingroup linear_containers
  */
-template<class T>
-Deque<T>::Deque() : data_(nullptr), size_(0), capacity_(0), head_(0), tail_(0) {}
+template<class T, class Allocator, class Policy>
+Deque<T, Allocator, Policy>::Deque() : data_(nullptr), size_(0), capacity_(0), head_(0), tail_(0), alloc_() {}
+
+/**
+ * @brief Constructs empty deque using the given allocator
+ * 
+ * @details Initializes an empty deque that will obtain its buffer
+ * from a copy of alloc. No memory allocation is performed.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] alloc Allocator to use for the buffer
+ */
+template<class T, class Allocator, class Policy>
+Deque<T, Allocator, Policy>::Deque(const Allocator &alloc) noexcept
+	: data_(nullptr), size_(0), capacity_(0), head_(0), tail_(0), alloc_(alloc) {}
 
 /**
  * @brief Constructor creating deque with repeated values
  * 
  * @details Constructs a deque with the specified number of elements,
- * each initialized to the given value.
+ * each copy-constructed in place from the given value.
  * 
  * @ingroup linear_containers
  * 
  * @param[in] count Number of elements to create
  * @param[in] value Value to initialize each element with
+ * @param[in] alloc Allocator to use for the buffer
  */
-template<class T>
-Deque<T>::Deque(size_type count, const T &value) : size_(count), capacity_(count), head_(0), tail_(0) {
-	data_ = new T[capacity_];
-	for (size_type i = 0; i < size_; ++i)
-		data_[i] = value;
+template<class T, class Allocator, class Policy>
+Deque<T, Allocator, Policy>::Deque(size_type count, const T &value, const Allocator &alloc)
+	: data_(nullptr), size_(0), capacity_(0), head_(0), tail_(0), alloc_(alloc) {
+	if (count == 0)
+		return;
+	capacity_ = fit_capacity(count);
+	data_ = alloc_traits::allocate(alloc_, capacity_);
+	try {
+		for (; size_ < count; ++size_)
+			alloc_traits::construct(alloc_, data_ + size_, value);
+	}
+	catch (...) {
+		release();
+		throw;
+	}
+	tail_ = wrap(size_);
 }
 
 /**
  * @brief Copy constructor
  * 
- * @details Constructs a new deque as a deep copy of another deque,
- * duplicating all elements and internal state.
+ * @details Constructs a new deque as a deep copy of another deque.
+ * Elements are copied in logical order, so the copy starts unwrapped
+ * at the beginning of its buffer.
  * 
  * @ingroup linear_containers
  * 
  * @param[in] other Deque to copy from
  */
-template<class T>
-Deque<T>::Deque(const Deque &other) : size_(other.size_), capacity_(other.capacity_), head_(other.head_), tail_(other.tail_) {
-	data_ = new T[capacity_];
-	for (size_type i = 0; i < size_; ++i)
-		data_[i] = other.data_[i];
+template<class T, class Allocator, class Policy>
+Deque<T, Allocator, Policy>::Deque(const Deque &other)
+	: data_(nullptr), size_(0), capacity_(0), head_(0), tail_(0),
+	alloc_(alloc_traits::select_on_container_copy_construction(other.alloc_)) {
+	if (other.capacity_ == 0)
+		return;
+	data_ = alloc_traits::allocate(alloc_, other.capacity_);
+	capacity_ = other.capacity_;
+	try {
+		for (; size_ < other.size_; ++size_)
+			alloc_traits::construct(alloc_, data_ + size_, other.at(size_));
+	}
+	catch (...) {
+		release();
+		throw;
+	}
+	tail_ = size_ == capacity_ ? 0 : size_;
 }
 
 /**
@@ -152,8 +477,10 @@ Deque<T>::Deque(const Deque &other) : size_(other.size_), capacity_(other.capaci
  * 
  * @param[in] other Deque to move from
  */
-template<class T>
-Deque<T>::Deque(Deque &&other) noexcept : data_(other.data_), size_(other.size_), capacity_(other.capacity_), head_(other.head_), tail_(other.tail_) {
+template<class T, class Allocator, class Policy>
+Deque<T, Allocator, Policy>::Deque(Deque &&other) noexcept
+	: data_(other.data_), size_(other.size_), capacity_(other.capacity_), head_(other.head_),
+	tail_(other.tail_), alloc_(std::move(other.alloc_)) {
 	other.data_ = nullptr;
 	other.size_ = 0;
 	other.capacity_ = 0;
@@ -172,46 +499,86 @@ Deque<T>::Deque(Deque &&other) noexcept : data_(other.data_), size_(other.size_)
  * @tparam Container Type of source container
  * @param[in] other Container to copy elements from
  */
-template<class T>
+template<class T, class Allocator, class Policy>
 template <class Container>
-Deque<T>::Deque(const Container& other) : size_(other.size()), capacity_(other.size()), head_(0), tail_(0) {
-	data_ = new T[capacity_];
-	size_type index = 0;
-	for (const auto& item : other)
-		data_[index++] = item;
+Deque<T, Allocator, Policy>::Deque(const Container& other)
+	: data_(nullptr), size_(0), capacity_(0), head_(0), tail_(0), alloc_() {
+	if (other.size() == 0)
+		return;
+	capacity_ = fit_capacity(other.size());
+	data_ = alloc_traits::allocate(alloc_, capacity_);
+	try {
+		for (const auto& item : other) {
+			alloc_traits::construct(alloc_, data_ + size_, item);
+			++size_;
+		}
+	}
+	catch (...) {
+		release();
+		throw;
+	}
+	tail_ = wrap(size_);
 }
 
 /**
  * @brief Destructor
  * 
- * @details Destroys the deque, deallocating the internal buffer and
- * freeing associated memory.
+ * @details Destroys the deque, destroying the live elements and
+ * freeing the internal buffer.
  * 
  * @ingroup linear_containers
  */
-template<class T>
-Deque<T>::~Deque() {
-	delete[] data_;
+template<class T, class Allocator, class Policy>
+Deque<T, Allocator, Policy>::~Deque() {
+	release();
 }
 
 /**
- * @brief Subscript operator for element access
+ * @brief Subscript operator
  * 
- * @details Provides mutable access to element at specified index,
- * accounting for circular buffer indexing with head offset.
+ * @details Provides access to element at specified index, accounting
+ * for circular buffer indexing with head offset. The index is only
+ * checked when COLLECTIONS_BOUNDS_CHECK is enabled (the default unless
+ * NDEBUG is defined); use at() for access that is always checked.
  * 
  * @ingroup linear_containers
  * 
- * @param[in] index Position of element to access
- * @return Reference to element at specified index
+ * @param[in] index Position of element to access (must be < size)
+ * @return Reference to element at specified position
  * 
- * @throws std::out_of_range if index >= size
+ * @throws std::out_of_range if index >= size and bounds checking is
+ * enabled
+ */
+template<class T, class Allocator, class Policy>
+typename Deque<T, Allocator, Policy>::reference Deque<T, Allocator, Policy>::operator[](size_type index) {
+#if COLLECTIONS_BOUNDS_CHECK
+	if (index >= size_)
+		throw std::out_of_range("Index out of range");
+#endif
+	return data_[wrap(head_ + index)];
+}
+
+/**
+ * @brief Const subscript operator
+ * 
+ * @details Read-only counterpart of operator[], checked only when
+ * COLLECTIONS_BOUNDS_CHECK is enabled.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] index Position of element to access (must be < size)
+ * @return Const reference to element at specified position
+ * 
+ * @throws std::out_of_range if index >= size and bounds checking is
+ * enabled
  */
-template<class T>
-typename Deque<T>::reference Deque<T>::operator[](size_type index) {
+template<class T, class Allocator, class Policy>
+typename Deque<T, Allocator, Policy>::const_reference Deque<T, Allocator, Policy>::operator[](size_type index) const {
+#if COLLECTIONS_BOUNDS_CHECK
 	if (index >= size_)
 		throw std::out_of_range("Index out of range");
-	return data_[(head_ + index) % capacity_];
+#endif
+	return data_[wrap(head_ + index)];
 }
 
 /**
@@ -219,22 +586,25 @@ typename Deque<T>::reference Deque<T>::operator[](size_type index) {
  * 
  * @details Assigns contents of another deque to this deque, replacing
  * all existing elements with deep copies of the source deque's
- * elements.
+ * elements. The existing buffer is reused when it is large enough.
  * 
  * @ingroup linear_containers
  * 
  * @param[in] other Deque to copy from
  * @return Reference to this deque
  */
-template<class T>
-Deque<T> &Deque<T>::operator=(const Deque &other) {
+template<class T, class Allocator, class Policy>
+Deque<T, Allocator, Policy> &Deque<T, Allocator, Policy>::operator=(const Deque &other) {
 	if (this != &other) {
-		delete[] data_;
-		size_ = other.size_;
-		capacity_ = other.capacity_;
-		data_ = new T[capacity_];
-		for (size_type i = 0; i < size_; ++i)
-			data_[i] = other.data_[i];
+		destroy_elements();
+		if (other.size_ > capacity_) {
+			release();
+			data_ = alloc_traits::allocate(alloc_, other.capacity_);
+			capacity_ = other.capacity_;
+		}
+		for (; size_ < other.size_; ++size_)
+			alloc_traits::construct(alloc_, data_ + size_, other.at(size_));
+		tail_ = size_ == capacity_ ? 0 : size_;
 	}
 	return *this;
 }
@@ -243,23 +613,48 @@ Deque<T> &Deque<T>::operator=(const Deque &other) {
  * @brief Move assignment operator
  * 
  * @details Transfers ownership of resources from another deque to
- * this deque, leaving the source deque in a valid empty state.
+ * this deque, leaving the source deque in a valid empty state. When
+ * the allocator does not propagate and the two allocators differ, the
+ * elements are moved into a buffer of this deque's own instead; only
+ * that case can throw.
  * 
  * @ingroup linear_containers
  * 
  * @param[in] other Deque to move from
  * @return Reference to this deque
  */
-template<class T>
-Deque<T> &Deque<T>::operator=(Deque &&other) noexcept {
+template<class T, class Allocator, class Policy>
+Deque<T, Allocator, Policy> &Deque<T, Allocator, Policy>::operator=(Deque &&other)
+	noexcept(alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value) {
 	if (this != &other) {
-		delete[] data_;
+		if constexpr (!alloc_traits::propagate_on_container_move_assignment::value && !alloc_traits::is_always_equal::value) {
+			if (alloc_ != other.alloc_) {
+				destroy_elements();
+				if (other.size_ > capacity_) {
+					release();
+					data_ = alloc_traits::allocate(alloc_, other.capacity_);
+					capacity_ = other.capacity_;
+				}
+				for (; size_ < other.size_; ++size_)
+					alloc_traits::construct(alloc_, data_ + size_, std::move(other[size_]));
+				tail_ = size_ == capacity_ ? 0 : size_;
+				other.clear();
+				return *this;
+			}
+		}
+		release();
+		if constexpr (alloc_traits::propagate_on_container_move_assignment::value)
+			alloc_ = std::move(other.alloc_);
 		data_ = other.data_;
 		size_ = other.size_;
 		capacity_ = other.capacity_;
+		head_ = other.head_;
+		tail_ = other.tail_;
 		other.data_ = nullptr;
 		other.size_ = 0;
 		other.capacity_ = 0;
+		other.head_ = 0;
+		other.tail_ = 0;
 	}
 	return *this;
 }
@@ -267,15 +662,14 @@ Deque<T> &Deque<T>::operator=(Deque &&other) noexcept {
 /**
  * @brief Clears all elements from deque
  * 
- * @details Removes all elements from the deque and shrinks the buffer
- * to fit, resetting the deque to an empty state.
+ * @details Destroys every live element and sets size to zero. The
+ * storage is kept for reuse; call shrink_to_fit() to release it.
  * 
  * @ingroup linear_containers
  */
-template<class T>
-void Deque<T>::clear() noexcept {
-	size_ = 0;
-	shrink_to_fit();
+template<class T, class Allocator, class Policy>
+void Deque<T, Allocator, Policy>::clear() noexcept {
+	destroy_elements();
 }
 
 /**
@@ -291,11 +685,32 @@ void Deque<T>::clear() noexcept {
  * 
  * @throws std::out_of_range if index >= size
  */
-template<class T>
-typename Deque<T>::const_reference Deque<T>::at(size_type index) const {
+template<class T, class Allocator, class Policy>
+typename Deque<T, Allocator, Policy>::const_reference Deque<T, Allocator, Policy>::at(size_type index) const {
 	if (index >= size_)
 		throw std::out_of_range("Index out of range");
-	return data_[(head_ + index) % capacity_];
+	return data_[wrap(head_ + index)];
+}
+
+/**
+ * @brief Access element with bounds checking
+ * 
+ * @details Provides mutable access to element at specified index,
+ * accounting for circular buffer indexing with head offset. The index
+ * is always checked, whatever COLLECTIONS_BOUNDS_CHECK says.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] index Position of element to access
+ * @return Reference to element at specified position
+ * 
+ * @throws std::out_of_range if index >= size
+ */
+template<class T, class Allocator, class Policy>
+typename Deque<T, Allocator, Policy>::reference Deque<T, Allocator, Policy>::at(size_type index) {
+	if (index >= size_)
+		throw std::out_of_range("Index out of range");
+	return data_[wrap(head_ + index)];
 }
 
 /**
@@ -309,12 +724,14 @@ typename Deque<T>::const_reference Deque<T>::at(size_type index) const {
  * 
  * @param[in] value Value to add to deque
  */
-template<class T>
-void Deque<T>::push_back(const_reference value) {
-	if (size_ == capacity_ || capacity_ == 0)
-		reserve();
-	data_[tail_] = value;
-	tail_ = (tail_ + 1) % capacity_;
+template<class T, class Allocator, class Policy>
+void Deque<T, Allocator, Policy>::push_back(const_reference value) {
+	if (size_ == capacity_) {
+		grow_and_construct(false, value);
+		return;
+	}
+	alloc_traits::construct(alloc_, data_ + tail_, value);
+	tail_ = wrap(tail_ + 1);
 	size_++;
 }
 
@@ -329,27 +746,24 @@ void Deque<T>::push_back(const_reference value) {
  * 
  * @param[in] value Value to add to front of deque
  */
-template<class T>
-void Deque<T>::push_front(const_reference value) {
-	if (size_ == capacity_ || capacity_ == 0) {
-		reserve();
-		head_ = capacity_ - 1;
-		data_[head_] = value;
-		size_++;
-	}
-	else {
-		head_ = head_ == 0 ? capacity_ - 1 : head_ - 1;
-		data_[head_] = value;
-		size_++;
+template<class T, class Allocator, class Policy>
+void Deque<T, Allocator, Policy>::push_front(const_reference value) {
+	if (size_ == capacity_) {
+		grow_and_construct(true, value);
+		return;
 	}
+	size_type new_head = head_ == 0 ? capacity_ - 1 : head_ - 1;
+	alloc_traits::construct(alloc_, data_ + new_head, value);
+	head_ = new_head;
+	size_++;
 }
 
 /**
  * @brief Removes and returns element from end of deque
  * 
  * @details Removes the element at the tail of the deque and returns
- * its value. Automatically shrinks capacity if size falls below half
- * of capacity.
+ * its value. Capacity may be reduced as decided by the capacity
+ * policy.
  * 
  * @ingroup linear_containers
  * 
@@ -357,15 +771,14 @@ void Deque<T>::push_front(const_reference value) {
  * 
  * @throws std::out_of_range if deque is empty
  */
-template<class T>
-typename Deque<T>::value_type Deque<T>::pop_back() {
+template<class T, class Allocator, class Policy>
+typename Deque<T, Allocator, Policy>::value_type Deque<T, Allocator, Policy>::pop_back() {
 	if (size_ == 0) throw std::out_of_range("Empty deque");
-	if (capacity_ > 0)
-		tail_ = (tail_ == 0) ? capacity_ - 1 : tail_ - 1;
-	value_type value = data_[tail_];
+	tail_ = (tail_ == 0) ? capacity_ - 1 : tail_ - 1;
+	value_type value = std::move(data_[tail_]);
+	alloc_traits::destroy(alloc_, data_ + tail_);
 	size_--;
-	if (size_ < capacity_ / 2)
-		shrink_to_fit();
+	shrink_by_policy();
 	return value;
 }
 
@@ -373,8 +786,8 @@ typename Deque<T>::value_type Deque<T>::pop_back() {
  * @brief Removes and returns element from front of deque
  * 
  * @details Removes the element at the head of the deque and returns
- * its value. Automatically shrinks capacity if size falls below half
- * of capacity. Properly adjusts head index for circular buffer.
+ * its value. Capacity may be reduced as decided by the capacity
+ * policy. Properly adjusts head index for circular buffer.
  * 
  * @ingroup linear_containers
  * 
@@ -382,18 +795,131 @@ typename Deque<T>::value_type Deque<T>::pop_back() {
  * 
  * @throws std::out_of_range if deque is empty
  */
-template<class T>
-typename Deque<T>::value_type Deque<T>::pop_front() {
+template<class T, class Allocator, class Policy>
+typename Deque<T, Allocator, Policy>::value_type Deque<T, Allocator, Policy>::pop_front() {
 	if (size_ == 0) throw std::out_of_range("Empty deque");
-	value_type value = data_[head_];
+	value_type value = std::move(data_[head_]);
+	alloc_traits::destroy(alloc_, data_ + head_);
+	head_ = wrap(head_ + 1);
 	size_--;
-	if (size_ < capacity_ / 2)
-		shrink_to_fit();
-	if (capacity_ > 0)
-		head_ = (head_ + 1) % capacity_;
+	shrink_by_policy();
 	return value;
 }
 
+/**
+ * @brief Appends a batch of elements to the end of deque
+ * 
+ * @details Grows the buffer at most once, then copies the values into
+ * the free space after the tail, which is at most two contiguous runs.
+ * Trivially copyable types are copied with one memcpy per run. For
+ * other types the elements are copy-constructed, and if one throws the
+ * ones already added are destroyed and the size is left unchanged.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] values Array of count elements, which must not point into
+ * this deque
+ * @param[in] count Number of elements to append
+ */
+template<class T, class Allocator, class Policy>
+void Deque<T, Allocator, Policy>::push_back_n(const_pointer values, size_type count) {
+	if (count == 0)
+		return;
+	if (size_ + count > capacity_)
+		reallocate(fit_capacity(Policy::grow(capacity_, size_ + count)));
+	size_type first_len = std::min(count, capacity_ - tail_);
+	if constexpr (std::is_trivially_copyable_v<T>) {
+		std::memcpy(static_cast<void *>(data_ + tail_), values, first_len * sizeof(T));
+		std::memcpy(static_cast<void *>(data_), values + first_len, (count - first_len) * sizeof(T));
+	}
+	else {
+		size_type i = 0;
+		try {
+			for (; i < count; ++i)
+				alloc_traits::construct(alloc_, data_ + wrap(tail_ + i), values[i]);
+		}
+		catch (...) {
+			while (i > 0)
+				alloc_traits::destroy(alloc_, data_ + wrap(tail_ + --i));
+			throw;
+		}
+	}
+	tail_ = wrap(tail_ + count);
+	size_ += count;
+}
+
+/**
+ * @brief Removes a batch of elements from the front of deque
+ * 
+ * @details Moves up to count front elements into out in order and
+ * removes them. Trivially copyable types are copied with one memcpy
+ * per contiguous run, so at most two. The capacity policy is consulted
+ * once for the whole batch.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[out] out Array of at least count initialized elements that
+ * receive the values by assignment
+ * @param[in] count Maximum number of elements to remove
+ * @return Number of elements removed, min(count, size())
+ */
+template<class T, class Allocator, class Policy>
+typename Deque<T, Allocator, Policy>::size_type Deque<T, Allocator, Policy>::pop_front_n(pointer out, size_type count) {
+	size_type taken = std::min(count, size_);
+	if (taken == 0)
+		return 0;
+	if constexpr (std::is_trivially_copyable_v<T>) {
+		size_type first_len = std::min(taken, capacity_ - head_);
+		std::memcpy(static_cast<void *>(out), data_ + head_, first_len * sizeof(T));
+		std::memcpy(static_cast<void *>(out + first_len), data_, (taken - first_len) * sizeof(T));
+		head_ = wrap(head_ + taken);
+		size_ -= taken;
+	}
+	else {
+		for (size_type i = 0; i < taken; ++i) {
+			out[i] = std::move(data_[head_]);
+			alloc_traits::destroy(alloc_, data_ + head_);
+			head_ = wrap(head_ + 1);
+			--size_;
+		}
+	}
+	shrink_by_policy();
+	return taken;
+}
+
+/**
+ * @brief Returns the contiguous runs holding the elements
+ * 
+ * @details Gives the elements in order as one run starting at the
+ * front element and, if the buffer wraps, a second run at the start of
+ * the buffer. Both runs are empty for an empty deque. The view is
+ * invalidated by any operation that changes the deque.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return The one or two runs of elements
+ */
+template<class T, class Allocator, class Policy>
+typename Deque<T, Allocator, Policy>::spans Deque<T, Allocator, Policy>::as_spans() noexcept {
+	size_type first_len = std::min(size_, capacity_ - head_);
+	return spans{data_ + head_, first_len, data_, size_ - first_len};
+}
+
+/**
+ * @brief Returns the contiguous runs holding the elements
+ * 
+ * @details Read-only counterpart of as_spans().
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return The one or two runs of elements
+ */
+template<class T, class Allocator, class Policy>
+typename Deque<T, Allocator, Policy>::const_spans Deque<T, Allocator, Policy>::as_spans() const noexcept {
+	size_type first_len = std::min(size_, capacity_ - head_);
+	return const_spans{data_ + head_, first_len, data_, size_ - first_len};
+}
+
 /**
  * @brief Returns number of elements in deque
  * 
@@ -404,8 +930,8 @@ typename Deque<T>::value_type Deque<T>::pop_front() {
  * 
  * @return Number of elements in deque
  */
-template<class T>
-typename Deque<T>::size_type Deque<T>::size() const noexcept { return size_; }
+template<class T, class Allocator, class Policy>
+typename Deque<T, Allocator, Policy>::size_type Deque<T, Allocator, Policy>::size() const noexcept { return size_; }
 
 /**
  * @brief Returns current capacity of deque
@@ -417,8 +943,8 @@ typename Deque<T>::size_type Deque<T>::size() const noexcept { return size_; }
  * 
  * @return Current capacity of internal buffer
  */
-template<class T>
-typename Deque<T>::size_type Deque<T>::capacity() const noexcept { return capacity_; }
+template<class T, class Allocator, class Policy>
+typename Deque<T, Allocator, Policy>::size_type Deque<T, Allocator, Policy>::capacity() const noexcept { return capacity_; }
 
 /**
  * @brief Returns head index
@@ -430,8 +956,8 @@ typename Deque<T>::size_type Deque<T>::capacity() const noexcept { return capaci
  * 
  * @return Index of head element in buffer
  */
-template<class T>
-typename Deque<T>::size_type Deque<T>::head() const noexcept { return head_; }
+template<class T, class Allocator, class Policy>
+typename Deque<T, Allocator, Policy>::size_type Deque<T, Allocator, Policy>::head() const noexcept { return head_; }
 
 /**
  * @brief Returns tail index
@@ -443,8 +969,8 @@ typename Deque<T>::size_type Deque<T>::head() const noexcept { return head_; }
  * 
  * @return Index of tail position in buffer
  */
-template<class T>
-typename Deque<T>::size_type Deque<T>::tail() const noexcept { return tail_; }
+template<class T, class Allocator, class Policy>
+typename Deque<T, Allocator, Policy>::size_type Deque<T, Allocator, Policy>::tail() const noexcept { return tail_; }
 
 /**
  * @brief Checks if deque is empty
@@ -455,8 +981,8 @@ typename Deque<T>::size_type Deque<T>::tail() const noexcept { return tail_; }
  * 
  * @return true if deque is empty, false otherwise
  */
-template<class T>
-bool Deque<T>::empty() const noexcept { return size_ == 0; }
+template<class T, class Allocator, class Policy>
+bool Deque<T, Allocator, Policy>::empty() const noexcept { return size_ == 0; }
 
 /**
  * @brief Returns pointer to internal buffer
@@ -468,8 +994,8 @@ bool Deque<T>::empty() const noexcept { return size_ == 0; }
  * 
  * @return Pointer to internal buffer
  */
-template<class T>
-typename Deque<T>::pointer Deque<T>::data() noexcept { return data_; }
+template<class T, class Allocator, class Policy>
+typename Deque<T, Allocator, Policy>::pointer Deque<T, Allocator, Policy>::data() noexcept { return data_; }
 
 /**
  * @brief Returns const pointer to internal buffer
@@ -481,8 +1007,8 @@ typename Deque<T>::pointer Deque<T>::data() noexcept { return data_; }
  * 
  * @return Const pointer to internal buffer
  */
-template<class T>
-typename Deque<T>::const_pointer Deque<T>::data() const noexcept { return data_; }
+template<class T, class Allocator, class Policy>
+typename Deque<T, Allocator, Policy>::const_pointer Deque<T, Allocator, Policy>::data() const noexcept { return data_; }
 
 /**
  * @brief Returns iterator to beginning of deque
@@ -494,8 +1020,8 @@ typename Deque<T>::const_pointer Deque<T>::data() const noexcept { return data_;
  * 
  * @return Iterator to first element
  */
-template<class T>
-typename Deque<T>::iterator Deque<T>::begin() noexcept {
+template<class T, class Allocator, class Policy>
+typename Deque<T, Allocator, Policy>::iterator Deque<T, Allocator, Policy>::begin() noexcept {
 	return Iterator(data_, capacity_, head_, 0);
 }
 
@@ -509,8 +1035,8 @@ typename Deque<T>::iterator Deque<T>::begin() noexcept {
  * 
  * @return Iterator past last element
  */
-template<class T>
-typename Deque<T>::iterator Deque<T>::end() noexcept {
+template<class T, class Allocator, class Policy>
+typename Deque<T, Allocator, Policy>::iterator Deque<T, Allocator, Policy>::end() noexcept {
 	return Iterator(data_, capacity_, head_, size_);
 }
 
@@ -525,9 +1051,9 @@ typename Deque<T>::iterator Deque<T>::end() noexcept {
  * 
  * @return Const iterator to first element
  */
-template<class T>
-typename Deque<T>::const_iterator Deque<T>::begin() const noexcept {
-	return Iterator(data_, capacity_, head_, 0);
+template<class T, class Allocator, class Policy>
+typename Deque<T, Allocator, Policy>::const_iterator Deque<T, Allocator, Policy>::begin() const noexcept {
+	return ConstIterator(data_, capacity_, head_, 0);
 }
 
 /**
@@ -541,84 +1067,263 @@ typename Deque<T>::const_iterator Deque<T>::begin() const noexcept {
  * 
  * @return Const iterator past last element
  */
-template<class T>
-typename Deque<T>::const_iterator Deque<T>::end() const noexcept {
-	return Iterator(data_, capacity_, head_, size_);
+template<class T, class Allocator, class Policy>
+typename Deque<T, Allocator, Policy>::const_iterator Deque<T, Allocator, Policy>::end() const noexcept {
+	return ConstIterator(data_, capacity_, head_, size_);
 }
 
 /**
- * @brief Reserves additional capacity for deque
+ * @brief Returns a copy of the allocator
  * 
- * @details Doubles the current capacity of the internal buffer (or
- * allocates initial capacity if empty). Reorders elements to be
- * contiguous before expansion and resets head and tail indices.
+ * @details Returns the allocator used to obtain the deque's buffer.
  * 
  * @ingroup linear_containers
+ * 
+ * @return Copy of the associated allocator
  */
-template<class T>
-void Deque<T>::reserve() {
-	order();
-	pointer new_data = new T[capacity_ > 0 ? capacity_ * 2 : 1];
-	for (size_type i = 0; i < size_; ++i)
-		new_data[i] = std::move(data_[i]);
-	delete[] data_;
+template<class T, class Allocator, class Policy>
+typename Deque<T, Allocator, Policy>::allocator_type Deque<T, Allocator, Policy>::get_allocator() const noexcept { return alloc_; }
+
+/**
+ * @brief Increases capacity to at least new_cap
+ * 
+ * @details Allocates new buffer if new_cap is greater than current
+ * capacity and relocates the existing elements into it. Does nothing
+ * if new_cap <= current capacity. Reserving ahead of a known number of
+ * insertions avoids every intermediate reallocation.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] new_cap Minimum capacity to reserve
+ */
+template<class T, class Allocator, class Policy>
+void Deque<T, Allocator, Policy>::reserve(size_type new_cap) {
+	if (new_cap > capacity_)
+		reallocate(fit_capacity(new_cap));
+}
+
+/**
+ * @brief Reduces capacity to the current size
+ * 
+ * @details Reallocates so that capacity equals size, or the next power
+ * of two in power-of-two mode. If the deque is empty, the buffer is
+ * released entirely.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, class Allocator, class Policy>
+void Deque<T, Allocator, Policy>::shrink_to_fit() {
+	if (size_ == 0)
+		release();
+	else if (fit_capacity(size_) < capacity_)
+		reallocate(fit_capacity(size_));
+}
+
+/**
+ * @brief Maps a buffer index that may have run past the end
+ * 
+ * @details Callers pass at most twice the capacity minus one, so in
+ * the general case one conditional subtraction wraps the index. In
+ * power-of-two mode the index is masked instead.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] slot Buffer index below 2 * capacity
+ * @return Equivalent index below capacity
+ */
+template<class T, class Allocator, class Policy>
+typename Deque<T, Allocator, Policy>::size_type Deque<T, Allocator, Policy>::wrap(size_type slot) const noexcept {
+	if constexpr (power_of_two_capacity)
+		return slot & (capacity_ - 1);
+	else
+		return slot >= capacity_ ? slot - capacity_ : slot;
+}
+
+/**
+ * @brief Rounds a requested capacity to one this deque may use
+ * 
+ * @details Returns required unchanged, or the next power of two in
+ * power-of-two mode.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] required Minimum number of elements that must fit
+ * @return Capacity to allocate
+ */
+template<class T, class Allocator, class Policy>
+typename Deque<T, Allocator, Policy>::size_type Deque<T, Allocator, Policy>::fit_capacity(size_type required) noexcept {
+	if constexpr (power_of_two_capacity)
+		return next_power_of_two(required);
+	else
+		return required;
+}
+
+/**
+ * @brief Gives back storage after a removal when the policy asks for it
+ * 
+ * @details Queries Policy::shrink with the current size and capacity
+ * and reallocates only if a smaller capacity is returned. With the
+ * default policy this happens once size falls below a quarter of the
+ * capacity, which keeps alternating insertions and removals at a
+ * capacity boundary from reallocating every time. The policy is
+ * applied until it settles, so a bulk removal shrinks with a single
+ * reallocation.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, class Allocator, class Policy>
+void Deque<T, Allocator, Policy>::shrink_by_policy() {
+	size_type new_cap = capacity_;
+	for (size_type next; (next = Policy::shrink(size_, new_cap)) < new_cap && next >= size_; )
+		new_cap = next;
+	if (new_cap >= capacity_)
+		return;
+	if (new_cap == 0)
+		release();
+	else
+		reallocate(new_cap);
+}
+
+/**
+ * @brief Moves the elements into a freshly allocated buffer
+ * 
+ * @details Allocates raw storage for new_cap elements and transfers
+ * the live elements into it. On failure the new buffer is released
+ * and the deque is left unchanged.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] new_cap Capacity of the new buffer (must be >= size)
+ */
+template<class T, class Allocator, class Policy>
+void Deque<T, Allocator, Policy>::reallocate(size_type new_cap) {
+	pointer new_data = alloc_traits::allocate(alloc_, new_cap);
+	try {
+		transfer(new_data, new_cap);
+	}
+	catch (...) {
+		alloc_traits::deallocate(alloc_, new_data, new_cap);
+		throw;
+	}
+}
+
+/**
+ * @brief Transfers the live elements into a new buffer
+ * 
+ * @details Unwraps the circular buffer while relocating: the segment
+ * from head to the end of the buffer and the wrapped segment at its
+ * start are moved in order to the beginning of new_data. Trivially
+ * relocatable types need at most two memcpy calls. Other types are
+ * move-constructed, and if that throws the deque is left unchanged and
+ * the caller still owns new_data.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] new_data Uninitialized storage for at least size elements
+ * @param[in] new_cap Capacity of new_data
+ */
+template<class T, class Allocator, class Policy>
+void Deque<T, Allocator, Policy>::transfer(pointer new_data, size_type new_cap) {
+	size_type first_len = size_ < capacity_ - head_ ? size_ : capacity_ - head_;
+	if constexpr (is_trivially_relocatable_v<T>) {
+		relocate_n(alloc_, data_ + head_, first_len, new_data);
+		relocate_n(alloc_, data_, size_ - first_len, new_data + first_len);
+	}
+	else {
+		size_type i = 0;
+		try {
+			for (; i < size_; ++i)
+				alloc_traits::construct(alloc_, new_data + i, std::move_if_noexcept(data_[wrap(head_ + i)]));
+		}
+		catch (...) {
+			while (i > 0)
+				alloc_traits::destroy(alloc_, new_data + --i);
+			throw;
+		}
+		for (i = 0; i < size_; ++i)
+			alloc_traits::destroy(alloc_, data_ + wrap(head_ + i));
+	}
+	if (data_)
+		alloc_traits::deallocate(alloc_, data_, capacity_);
 	data_ = new_data;
-	capacity_ = capacity_ > 0 ? capacity_ * 2 : 1;
+	capacity_ = new_cap;
 	head_ = 0;
-	tail_ = size_;
+	tail_ = size_ == new_cap ? 0 : size_;
 }
 
 /**
- * @brief Reduces capacity to fit current size
+ * @brief Grows the buffer and constructs a new end element
  * 
- * @details Shrinks the internal buffer to half its current capacity.
- * If deque is not empty, reorders elements to be contiguous and
- * reallocates. If empty, deallocates buffer entirely.
+ * @details Builds the new element in the enlarged buffer before the
+ * existing elements are moved, so args may safely refer to an element
+ * of this deque. The new element becomes the front when front is
+ * true, otherwise the back.
  * 
  * @ingroup linear_containers
+ * 
+ * @tparam Args Types of the constructor arguments
+ * @param[in] front Whether the element is added at the front
+ * @param[in] args Arguments forwarded to the element constructor
  */
-template<class T>
-void Deque<T>::shrink_to_fit() {
-	if (size_ > 0) {
-		order();
-		pointer new_data = new T[capacity_ / 2];
-		for (size_type i = 0; i < size_; ++i)
-			new_data[i] = std::move(data_[i]);
-		delete[] data_;
-		data_ = new_data;
-		capacity_ /= 2;
-		head_ = 0;
-		tail_ = size_;
+template<class T, class Allocator, class Policy>
+template <class... Args>
+void Deque<T, Allocator, Policy>::grow_and_construct(bool front, Args&&... args) {
+	size_type new_cap = Policy::grow(capacity_, size_ + 1);
+	size_type slot = front ? new_cap - 1 : size_;
+	pointer new_data = alloc_traits::allocate(alloc_, new_cap);
+	try {
+		alloc_traits::construct(alloc_, new_data + slot, std::forward<Args>(args)...);
 	}
-	else
-	{
-		delete[] data_;
-		data_ = nullptr;
-		capacity_ = size_;
-		head_ = tail_ = 0;
+	catch (...) {
+		alloc_traits::deallocate(alloc_, new_data, new_cap);
+		throw;
+	}
+	try {
+		transfer(new_data, new_cap);
+	}
+	catch (...) {
+		alloc_traits::destroy(alloc_, new_data + slot);
+		alloc_traits::deallocate(alloc_, new_data, new_cap);
+		throw;
 	}
+	if (front)
+		head_ = slot;
+	else
+		tail_ = wrap(size_ + 1);
+	++size_;
 }
 
 /**
- * @brief Reorders elements to be contiguous
+ * @brief Destroys every live element
  * 
- * @details Rearranges elements in the circular buffer to be stored
- * contiguously starting at index 0, eliminating wrap-around. Resets
- * head to 0 and tail to size. Does nothing if deque is empty or
- * already ordered.
+ * @details Runs the destructor of each stored element and resets
+ * size, head and tail. The buffer itself is kept.
  * 
  * @ingroup linear_containers
  */
-template<class T>
-void Deque<T>::order() {
-	if (size_ == 0 || head_ == 0) return;
-	pointer new_data = new T[capacity_];
+template<class T, class Allocator, class Policy>
+void Deque<T, Allocator, Policy>::destroy_elements() noexcept {
 	for (size_type i = 0; i < size_; ++i)
-		new_data[i] = data_[(head_ + i) % capacity_];
-	delete[] data_;
-	data_ = new_data;
-	head_ = 0;
-	tail_ = size_;
+		alloc_traits::destroy(alloc_, data_ + wrap(head_ + i));
+	size_ = 0;
+	head_ = tail_ = 0;
+}
+
+/**
+ * @brief Destroys all elements and frees the buffer
+ * 
+ * @details Leaves the deque empty with null data pointer and zero
+ * capacity.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, class Allocator, class Policy>
+void Deque<T, Allocator, Policy>::release() noexcept {
+	destroy_elements();
+	if (data_)
+		alloc_traits::deallocate(alloc_, data_, capacity_);
+	data_ = nullptr;
+	capacity_ = 0;
 }
 
 #endif
@@ -21,8 +21,33 @@
  * 
  * @param[in] value Data to store in node
  */
-template<class T>
-DoubleLinkedList<T>::Node::Node(const T &value) : data(value), next(nullptr), prev(nullptr) {}
+template<class T, class Allocator>
+DoubleLinkedList<T, Allocator>::Node::Node(const T &value) : data(value), next(nullptr), prev(nullptr) {}
+
+/**
+ * @brief Node move constructor
+ * 
+ * @details Initializes a node by moving the given value into it, with
+ * null prev/next pointers.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] value Data to move into node
+ */
+template<class T, class Allocator>
+DoubleLinkedList<T, Allocator>::Node::Node(T &&value) : data(std::move(value)), next(nullptr), prev(nullptr) {}
+
+/**
+ * @brief Default iterator constructor
+ * 
+ * @details Constructs a singular iterator that is not attached to any
+ * list.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, class Allocator>
+template<bool IsConst>
+DoubleLinkedList<T, Allocator>::BasicIterator<IsConst>::BasicIterator() noexcept : current(nullptr), tail(nullptr) {}
 
 /**
  * @brief Iterator constructor
@@ -31,10 +56,28 @@ DoubleLinkedList<T>::Node::Node(const T &value) : data(value), next(nullptr), pr
  * 
  * @ingroup linear_containers
  * 
- * @param[in] node Pointer to node for iterator to reference
+ * @param[in] node Pointer to node for iterator to reference, nullptr
+ * for end()
+ * @param[in] tail Address of the owning list's tail pointer
  */
-template<class T>
-DoubleLinkedList<T>::Iterator::Iterator(Node* node) : current(node) {}
+template<class T, class Allocator>
+template<bool IsConst>
+DoubleLinkedList<T, Allocator>::BasicIterator<IsConst>::BasicIterator(node_pointer node, Node *const *tail) noexcept : current(node), tail(tail) {}
+
+/**
+ * @brief Converting constructor
+ * 
+ * @details Copies a mutable iterator. For the const instantiation this
+ * is the conversion from iterator to const_iterator.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Mutable iterator to copy
+ */
+template<class T, class Allocator>
+template<bool IsConst>
+DoubleLinkedList<T, Allocator>::BasicIterator<IsConst>::BasicIterator(const BasicIterator<false>& other) noexcept
+	: current(other.current), tail(other.tail) {}
 
 /**
  * @brief Dereference operator
@@ -45,11 +88,27 @@ DoubleLinkedList<T>::Iterator::Iterator(Node* node) : current(node) {}
  * 
  * @return Reference to element pointed to by iterator
  */
-template<class T>
-T& DoubleLinkedList<T>::Iterator::operator*() const {
+template<class T, class Allocator>
+template<bool IsConst>
+typename DoubleLinkedList<T, Allocator>::template BasicIterator<IsConst>::reference DoubleLinkedList<T, Allocator>::BasicIterator<IsConst>::operator*() const {
 	return current->data;
 }
 
+/**
+ * @brief Member access operator
+ * 
+ * @details Returns pointer to data in current node.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Pointer to element pointed to by iterator
+ */
+template<class T, class Allocator>
+template<bool IsConst>
+typename DoubleLinkedList<T, Allocator>::template BasicIterator<IsConst>::pointer DoubleLinkedList<T, Allocator>::BasicIterator<IsConst>::operator->() const {
+	return &current->data;
+}
+
 /**
  * @brief Prefix increment operator
  * 
@@ -59,27 +118,67 @@ T& DoubleLinkedList<T>::Iterator::operator*() const {
  * 
  * @return Reference to this iterator after increment
  */
-template<class T>
-typename DoubleLinkedList<T>::Iterator& DoubleLinkedList<T>::Iterator::operator++() {
+template<class T, class Allocator>
+template<bool IsConst>
+typename DoubleLinkedList<T, Allocator>::template BasicIterator<IsConst>& DoubleLinkedList<T, Allocator>::BasicIterator<IsConst>::operator++() {
 	if (current) current = current->next;
 	return *this;
 }
 
+/**
+ * @brief Postfix increment operator
+ * 
+ * @details Advances iterator to next node in list.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Copy of the iterator before increment
+ */
+template<class T, class Allocator>
+template<bool IsConst>
+typename DoubleLinkedList<T, Allocator>::template BasicIterator<IsConst> DoubleLinkedList<T, Allocator>::BasicIterator<IsConst>::operator++(int) {
+	BasicIterator previous = *this;
+	++*this;
+	return previous;
+}
+
 /**
  * @brief Prefix decrement operator
  * 
- * @details Moves iterator to previous node in list.
+ * @details Moves iterator to previous node in list. Decrementing
+ * end() moves to the last node.
  * 
  * @ingroup linear_containers
  * 
  * @return Reference to this iterator after decrement
  */
-template<class T>
-typename DoubleLinkedList<T>::Iterator& DoubleLinkedList<T>::Iterator::operator--() {
-	if (current) current = current->prev;
+template<class T, class Allocator>
+template<bool IsConst>
+typename DoubleLinkedList<T, Allocator>::template BasicIterator<IsConst>& DoubleLinkedList<T, Allocator>::BasicIterator<IsConst>::operator--() {
+	if (current)
+		current = current->prev;
+	else if (tail)
+		current = *tail;
 	return *this;
 }
 
+/**
+ * @brief Postfix decrement operator
+ * 
+ * @details Moves iterator to previous node in list.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Copy of the iterator before decrement
+ */
+template<class T, class Allocator>
+template<bool IsConst>
+typename DoubleLinkedList<T, Allocator>::template BasicIterator<IsConst> DoubleLinkedList<T, Allocator>::BasicIterator<IsConst>::operator--(int) {
+	BasicIterator previous = *this;
+	--*this;
+	return previous;
+}
+
 /**
  * @brief Inequality comparison operator
  * 
@@ -91,8 +190,10 @@ typename DoubleLinkedList<T>::Iterator& DoubleLinkedList<T>::Iterator::operator-
  * @param[in] other Iterator to compare against
  * @return true if iterators point to different nodes, false otherwise
  */
-template<class T>
-bool DoubleLinkedList<T>::Iterator::operator!=(const Iterator& other) const {
+template<class T, class Allocator>
+template<bool IsConst>
+template<bool OtherConst>
+bool DoubleLinkedList<T, Allocator>::BasicIterator<IsConst>::operator!=(const BasicIterator<OtherConst>& other) const {
 	return current != other.current;
 }
 
@@ -107,8 +208,10 @@ bool DoubleLinkedList<T>::Iterator::operator!=(const Iterator& other) const {
  * @param[in] other Iterator to compare against
  * @return true if iterators point to same node, false otherwise
  */
-template<class T>
-bool DoubleLinkedList<T>::Iterator::operator==(const Iterator& other) const {
+template<class T, class Allocator>
+template<bool IsConst>
+template<bool OtherConst>
+bool DoubleLinkedList<T, Allocator>::BasicIterator<IsConst>::operator==(const BasicIterator<OtherConst>& other) const {
 	return current == other.current;
 }
 
@@ -120,8 +223,20 @@ bool DoubleLinkedList<T>::Iterator::operator==(const Iterator& other) const {
  * 
  * @ingroup linear_containers
  */
-template<class T>
-DoubleLinkedList<T>::DoubleLinkedList() noexcept : head_(nullptr), tail_(nullptr), size_(0) {}
+template<class T, class Allocator>
+DoubleLinkedList<T, Allocator>::DoubleLinkedList() noexcept : head_(nullptr), tail_(nullptr), size_(0), cursor_(nullptr), cursor_index_(0) {}
+
+/**
+ * @brief Constructs an empty list using the given allocator
+ * 
+ * @details No node is allocated until the first element is added.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] alloc Allocator to obtain nodes from
+ */
+template<class T, class Allocator>
+DoubleLinkedList<T, Allocator>::DoubleLinkedList(const Allocator &alloc) noexcept : head_(nullptr), tail_(nullptr), size_(0), alloc_(alloc), cursor_(nullptr), cursor_index_(0) {}
 
 /**
  * @brief Constructor creating list with repeated values
@@ -133,9 +248,10 @@ DoubleLinkedList<T>::DoubleLinkedList() noexcept : head_(nullptr), tail_(nullptr
  * 
  * @param[in] count Number of elements to create
  * @param[in] value Value to initialize each element with
+ * @param[in] alloc Allocator to obtain nodes from
  */
-template<class T>
-DoubleLinkedList<T>::DoubleLinkedList(size_type count, const T &value) : head_(nullptr), tail_(nullptr), size_(0) {
+template<class T, class Allocator>
+DoubleLinkedList<T, Allocator>::DoubleLinkedList(size_type count, const T &value, const Allocator &alloc) : head_(nullptr), tail_(nullptr), size_(0), alloc_(alloc), cursor_(nullptr), cursor_index_(0) {
 	for (size_type i = 0; i < count; i++)
 		add(value);
 }
@@ -150,8 +266,10 @@ DoubleLinkedList<T>::DoubleLinkedList(size_type count, const T &value) : head_(n
  * 
  * @param[in] other List to copy from
  */
-template<class T>
-DoubleLinkedList<T>::DoubleLinkedList(const DoubleLinkedList &other) : head_(nullptr), tail_(nullptr), size_(0) {
+template<class T, class Allocator>
+DoubleLinkedList<T, Allocator>::DoubleLinkedList(const DoubleLinkedList &other)
+	: head_(nullptr), tail_(nullptr), size_(0),
+	alloc_(node_traits::select_on_container_copy_construction(other.alloc_)), cursor_(nullptr), cursor_index_(0) {
 	pointer cur = other.head_;
 	while (cur) {
 		add(cur->data);
@@ -170,10 +288,14 @@ DoubleLinkedList<T>::DoubleLinkedList(const DoubleLinkedList &other) : head_(nul
  * 
  * @param[in] other List to move from
  */
-template<class T>
-DoubleLinkedList<T>::DoubleLinkedList(DoubleLinkedList &&other) noexcept : head_(other.head_), tail_(other.tail_), size_(other.size_) {
+template<class T, class Allocator>
+DoubleLinkedList<T, Allocator>::DoubleLinkedList(DoubleLinkedList &&other) noexcept
+	: head_(other.head_), tail_(other.tail_), size_(other.size_), alloc_(std::move(other.alloc_)),
+	cursor_(nullptr), cursor_index_(0) {
 	other.head_ = nullptr;
+	other.tail_ = nullptr;
 	other.size_ = 0;
+	other.reset_cursor();
 }
 
 /**
@@ -187,9 +309,9 @@ DoubleLinkedList<T>::DoubleLinkedList(DoubleLinkedList &&other) noexcept : head_
  * @tparam Container Type of source container
  * @param[in] other Container to copy elements from
  */
-template<class T>
+template<class T, class Allocator>
 template <class Container>
-DoubleLinkedList<T>::DoubleLinkedList(const Container& other) : head_(nullptr), tail_(nullptr), size_(0) {
+DoubleLinkedList<T, Allocator>::DoubleLinkedList(const Container& other) : head_(nullptr), tail_(nullptr), size_(0), cursor_(nullptr), cursor_index_(0) {
 	for (const auto& item : other)
 		add(item);
 }
@@ -202,8 +324,8 @@ DoubleLinkedList<T>::DoubleLinkedList(const Container& other) : head_(nullptr),
  * 
  * @ingroup linear_containers
  */
-template<class T>
-DoubleLinkedList<T>::~DoubleLinkedList() {
+template<class T, class Allocator>
+DoubleLinkedList<T, Allocator>::~DoubleLinkedList() {
 	clear();
 }
 
@@ -211,8 +333,9 @@ DoubleLinkedList<T>::~DoubleLinkedList() {
  * @brief Subscript operator for element access
  * 
  * @details Provides mutable access to element at specified index.
- * Optimizes traversal by starting from head or tail depending on
- * index position.
+ * Walks from whichever of the head, the tail and the node reached by
+ * the previous operator[] access is closest to index, without moving
+ * that cursor, so concurrent const reads stay safe.
  * 
  * @ingroup linear_containers
  * 
@@ -221,22 +344,11 @@ DoubleLinkedList<T>::~DoubleLinkedList() {
  * 
  * @throws std::out_of_range if index >= size
  */
-template<class T>
-typename DoubleLinkedList<T>::reference DoubleLinkedList<T>::operator[](size_type index) {
+template<class T, class Allocator>
+typename DoubleLinkedList<T, Allocator>::reference DoubleLinkedList<T, Allocator>::operator[](size_type index) {
 	if (index >= size_)
 		throw std::out_of_range("Index out of range");
-	pointer cur;
-	if (index <= size_ / 2) {
-		cur = head_;
-		for (size_type i = 0; i < index; i++)
-			cur = cur->next;
-	}
-	else {
-		cur = tail_;
-		for (size_type i = size_ - 1; i > index; i--)
-			cur = cur->prev;
-	}
-	return cur->data;
+	return node_at(index)->data;
 }
 
 /**
@@ -251,8 +363,8 @@ typename DoubleLinkedList<T>::reference DoubleLinkedList<T>::operator[](size_typ
  * @param[in] other List to copy from
  * @return Reference to this list
  */
-template<class T>
-DoubleLinkedList<T> &DoubleLinkedList<T>::operator=(const DoubleLinkedList &other) {
+template<class T, class Allocator>
+DoubleLinkedList<T, Allocator> &DoubleLinkedList<T, Allocator>::operator=(const DoubleLinkedList &other) {
 	if (this != &other) {
 		clear();
 		pointer cur = other.head_;
@@ -268,23 +380,36 @@ DoubleLinkedList<T> &DoubleLinkedList<T>::operator=(const DoubleLinkedList &othe
  * @brief Move assignment operator
  * 
  * @details Transfers ownership of resources from another list to this
- * list, leaving the source list in a valid empty state.
+ * list, leaving the source list in a valid empty state. When the
+ * allocator does not propagate and this list cannot free other's
+ * nodes, the elements are moved into new nodes one by one instead;
+ * only that case can throw.
  * 
  * @ingroup linear_containers
  * 
  * @param[in] other List to move from
  * @return Reference to this list
  */
-template<class T>
-DoubleLinkedList<T> &DoubleLinkedList<T>::operator=(DoubleLinkedList &&other) {
+template<class T, class Allocator>
+DoubleLinkedList<T, Allocator> &DoubleLinkedList<T, Allocator>::operator=(DoubleLinkedList &&other)
+	noexcept(node_traits::propagate_on_container_move_assignment::value || node_traits::is_always_equal::value) {
 	if (this != &other) {
 		clear();
+		if constexpr (node_traits::propagate_on_container_move_assignment::value)
+			alloc_ = std::move(other.alloc_);
+		else if (!shares_nodes_with(other)) {
+			for (pointer cur = other.head_; cur; cur = cur->next)
+				link_before(nullptr, create_node(std::move(cur->data)));
+			other.clear();
+			return *this;
+		}
 		head_ = other.head_;
 		tail_ = other.tail_;
 		size_ = other.size_;
 		other.head_ = nullptr;
 		other.tail_ = nullptr;
 		other.size_ = 0;
+		other.reset_cursor();
 	}
 	return *this;
 }
@@ -298,25 +423,26 @@ DoubleLinkedList<T> &DoubleLinkedList<T>::operator=(DoubleLinkedList &&other) {
  * 
  * @ingroup linear_containers
  */
-template<class T>
-void DoubleLinkedList<T>::clear() noexcept {
+template<class T, class Allocator>
+void DoubleLinkedList<T, Allocator>::clear() noexcept {
 	pointer cur = head_;
 	while (cur) {
 		pointer temp = cur->next;
-		delete cur;
+		destroy_node(cur);
 		cur = temp;
 	}
 	head_ = nullptr;
 	tail_ = nullptr;
 	size_ = 0;
+	reset_cursor();
 }
 
 /**
  * @brief Const element access with bounds checking
  * 
  * @details Provides read-only access to element at specified index.
- * Optimizes traversal by starting from head or tail depending on
- * index position.
+ * Walks from whichever of the head, the tail and the node reached by
+ * the previous index access is closest to index.
  * 
  * @ingroup linear_containers
  * 
@@ -325,22 +451,11 @@ void DoubleLinkedList<T>::clear() noexcept {
  * 
  * @throws std::out_of_range if index >= size
  */
-template<class T>
-typename DoubleLinkedList<T>::const_reference DoubleLinkedList<T>::at(size_type index) const {
+template<class T, class Allocator>
+typename DoubleLinkedList<T, Allocator>::const_reference DoubleLinkedList<T, Allocator>::at(size_type index) const {
 	if (index >= size_)
 		throw std::out_of_range("Index out of range");
-	pointer cur;
-	if (index <= size_ / 2) {
-		cur = head_;
-		for (size_type i = 0; i < index; i++)
-			cur = cur->next;
-	}
-	else {
-		cur = tail_;
-		for (size_type i = size_ - 1; i > index; i--)
-			cur = cur->prev;
-	}
-	return cur->data;
+	return find_node(index)->data;
 }
 
 /**
@@ -354,9 +469,9 @@ typename DoubleLinkedList<T>::const_reference DoubleLinkedList<T>::at(size_type
  * 
  * @param[in] value Value to add to list
  */
-template<class T>
-void DoubleLinkedList<T>::add(const_reference value) {
-	pointer new_node = new Node(value);
+template<class T, class Allocator>
+void DoubleLinkedList<T, Allocator>::add(const_reference value) {
+	pointer new_node = create_node(value);
 	if (!tail_ && !head_) {
 		tail_ = new_node;
 		head_ = new_node;
@@ -384,15 +499,16 @@ void DoubleLinkedList<T>::add(const_reference value) {
  * 
  * @throws std::out_of_range if index > size
  */
-template<class T>
-typename DoubleLinkedList<T>::pointer DoubleLinkedList<T>::insert(size_type index, const_reference value) {
+template<class T, class Allocator>
+typename DoubleLinkedList<T, Allocator>::pointer DoubleLinkedList<T, Allocator>::insert(size_type index, const_reference value) {
 	if (index > size_) throw std::out_of_range("insert index out of range");
-	pointer new_node = new Node(value);
+	pointer new_node = create_node(value);
 	if (index == 0) {
 		new_node->next = head_;
 		if (head_) head_->prev = new_node;
 		head_ = new_node;
 		if (size_ == 0) tail_ = new_node;
+		if (cursor_) cursor_index_++;
 	}
 	else if (index == size_) {
 		new_node->prev = tail_;
@@ -401,8 +517,7 @@ typename DoubleLinkedList<T>::pointer DoubleLinkedList<T>::insert(size_type inde
 		if (size_ == 0) head_ = new_node;
 	}
 	else {
-		pointer cur = head_;
-		for (size_type i = 0; i < index - 1; ++i) cur = cur->next;
+		pointer cur = node_at(index - 1);
 		new_node->next = cur->next;
 		new_node->prev = cur;
 		cur->next->prev = new_node;
@@ -426,8 +541,8 @@ typename DoubleLinkedList<T>::pointer DoubleLinkedList<T>::insert(size_type inde
  * 
  * @throws std::out_of_range if index >= size or list is empty
  */
-template<class T>
-typename DoubleLinkedList<T>::value_type DoubleLinkedList<T>::erase(size_type index) {
+template<class T, class Allocator>
+typename DoubleLinkedList<T, Allocator>::value_type DoubleLinkedList<T, Allocator>::erase(size_type index) {
 	if (index >= size_ || head_ == nullptr) throw std::out_of_range("erase index out of range");
 	value_type val;
 	if (index == 0) {
@@ -436,12 +551,15 @@ typename DoubleLinkedList<T>::value_type DoubleLinkedList<T>::erase(size_type in
 		head_ = head_->next;
 		if (head_) head_->prev = nullptr;
 		if (tail_ == to_delete) tail_ = nullptr;
-		delete to_delete;
+		if (cursor_ == to_delete)
+			reset_cursor();
+		else if (cursor_)
+			cursor_index_--;
+		destroy_node(to_delete);
 		size_--;
 		return val;
 	}
-	pointer cur = head_;
-	for (size_type i = 0; i < index - 1; ++i) cur = cur->next;
+	pointer cur = node_at(index - 1);
 	pointer to_delete = cur->next;
 	val = to_delete->data;
 	cur->next = to_delete->next;
@@ -449,11 +567,200 @@ typename DoubleLinkedList<T>::value_type DoubleLinkedList<T>::erase(size_type in
 		to_delete->next->prev = cur;
 	if (tail_ == to_delete)
 		tail_ = cur;
-	delete to_delete;
+	destroy_node(to_delete);
 	size_--;
 	return val;
 }
 
+/**
+ * @brief Inserts element after an iterator position
+ * 
+ * @details Links a new node directly behind pos without walking the
+ * list.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] pos Element to insert after, or end() to insert at the
+ * front
+ * @param[in] value Element to insert
+ * @return Iterator to the inserted element
+ */
+template<class T, class Allocator>
+typename DoubleLinkedList<T, Allocator>::iterator DoubleLinkedList<T, Allocator>::insert_after(const_iterator pos, const_reference value) {
+	pointer prev = const_cast<pointer>(pos.current);
+	pointer node = create_node(value);
+	link_before(prev ? prev->next : head_, node);
+	return Iterator(node, &tail_);
+}
+
+/**
+ * @brief Removes the element at an iterator position
+ * 
+ * @details Unlinks and frees the node without walking the list.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] pos Element to remove
+ * @return Iterator to the element that followed the removed one
+ * 
+ * @throws std::out_of_range If pos is end()
+ */
+template<class T, class Allocator>
+typename DoubleLinkedList<T, Allocator>::iterator DoubleLinkedList<T, Allocator>::erase(const_iterator pos) {
+	pointer victim = const_cast<pointer>(pos.current);
+	if (!victim) throw std::out_of_range("erase position is end()");
+	pointer next = victim->next;
+	unlink(victim);
+	destroy_node(victim);
+	size_--;
+	return Iterator(next, &tail_);
+}
+
+/**
+ * @brief Moves all elements of another list before an iterator position
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] pos Element to insert before, or end() to append
+ * @param[in,out] other List to take the elements from, left empty
+ */
+template<class T, class Allocator>
+void DoubleLinkedList<T, Allocator>::splice(const_iterator pos, DoubleLinkedList &other) {
+	splice(pos, other, other.begin(), other.end());
+}
+
+/**
+ * @brief Moves a range of elements from another list before an
+ * iterator position
+ * 
+ * @details Moves the elements in [first, last). When both lists can
+ * free each other's nodes (the same list, or equal allocators), the
+ * range is relinked as a whole: in O(1) within one list, and with one
+ * walk to count the elements between two lists. Otherwise each element
+ * is moved into a node from this list's allocator. other may be this
+ * list as long as pos is not inside the range.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] pos Element to insert before, or end() to append
+ * @param[in,out] other List to take the elements from
+ * @param[in] first First element to move
+ * @param[in] last Element after the last one to move, or end()
+ */
+template<class T, class Allocator>
+void DoubleLinkedList<T, Allocator>::splice(const_iterator pos, DoubleLinkedList &other, const_iterator first, const_iterator last) {
+	pointer next = const_cast<pointer>(pos.current);
+	pointer chain_first = const_cast<pointer>(first.current);
+	pointer stop = const_cast<pointer>(last.current);
+	if (chain_first == stop)
+		return;
+	if (!shares_nodes_with(other)) {
+		while (chain_first != stop) {
+			pointer following = chain_first->next;
+			link_before(next, adopt(other, chain_first));
+			chain_first = following;
+		}
+		return;
+	}
+	pointer chain_last = stop ? stop->prev : other.tail_;
+	other.reset_cursor();
+	reset_cursor();
+	if (this != &other) {
+		size_type count = 1;
+		for (pointer cur = chain_first; cur != chain_last; cur = cur->next)
+			++count;
+		other.size_ -= count;
+		size_ += count;
+	}
+	if (chain_first->prev)
+		chain_first->prev->next = stop;
+	else
+		other.head_ = stop;
+	if (stop)
+		stop->prev = chain_first->prev;
+	else
+		other.tail_ = chain_first->prev;
+	pointer prev = next ? next->prev : tail_;
+	chain_first->prev = prev;
+	chain_last->next = next;
+	if (prev)
+		prev->next = chain_first;
+	else
+		head_ = chain_first;
+	if (next)
+		next->prev = chain_last;
+	else
+		tail_ = chain_last;
+}
+
+/**
+ * @brief Merges another sorted list into this sorted list
+ * 
+ * @details Walks both lists once and links each node of other in
+ * front of the first element of this list that compares greater, so
+ * the merge is stable: of two equal elements, the one from this list
+ * comes first. Nodes are relinked when the allocators allow it and
+ * moved into new nodes otherwise. other is left empty.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @tparam Compare Strict weak ordering on T
+ * @param[in,out] other Sorted list to merge in
+ * @param[in] comp Comparison both lists are sorted by
+ */
+template<class T, class Allocator>
+template <class Compare>
+void DoubleLinkedList<T, Allocator>::merge(DoubleLinkedList &other, Compare comp) {
+	if (this == &other)
+		return;
+	pointer cur = head_;
+	while (other.head_) {
+		if (cur && !comp(other.head_->data, cur->data))
+			cur = cur->next;
+		else if (!cur && shares_nodes_with(other)) {
+			splice(end(), other);
+			return;
+		}
+		else
+			link_before(cur, adopt(other, other.head_));
+	}
+}
+
+/**
+ * @brief Sorts the list by relinking its nodes
+ * 
+ * @details Natural merge sort: each pass finds the runs that are
+ * already in order and merges neighbouring runs in place, so sorted or
+ * nearly sorted input takes a single pass, and in general
+ * O(n log n) comparisons are made. Elements are never copied or moved
+ * and iterators stay valid. The sort is stable. If comp throws, every
+ * element is still in the list, in unspecified order.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @tparam Compare Strict weak ordering on T
+ * @param[in] comp Comparison to sort by
+ */
+template<class T, class Allocator>
+template <class Compare>
+void DoubleLinkedList<T, Allocator>::sort(Compare comp) {
+	if (size_ < 2)
+		return;
+	size_type runs;
+	do {
+		runs = 0;
+		pointer first = head_;
+		while (first) {
+			pointer a_last = run_end(first, comp);
+			++runs;
+			if (!a_last->next)
+				break;
+			pointer b_last = run_end(a_last->next, comp);
+			first = merge_runs(first, a_last, b_last, comp)->next;
+		}
+	} while (runs > 1);
+}
+
 /**
  * @brief Returns number of elements in list
  * 
@@ -464,8 +771,8 @@ typename DoubleLinkedList<T>::value_type DoubleLinkedList<T>::erase(size_type in
  * 
  * @return Number of elements in list
  */
-template<class T>
-typename DoubleLinkedList<T>::size_type DoubleLinkedList<T>::size() const noexcept { return size_; }
+template<class T, class Allocator>
+typename DoubleLinkedList<T, Allocator>::size_type DoubleLinkedList<T, Allocator>::size() const noexcept { return size_; }
 
 /**
  * @brief Checks if list is empty
@@ -476,8 +783,8 @@ typename DoubleLinkedList<T>::size_type DoubleLinkedList<T>::size() const noexce
  * 
  * @return true if list is empty, false otherwise
  */
-template<class T>
-bool DoubleLinkedList<T>::empty() const noexcept { return size_ == 0; }
+template<class T, class Allocator>
+bool DoubleLinkedList<T, Allocator>::empty() const noexcept { return size_ == 0; }
 
 /**
  * @brief Returns pointer to first node
@@ -488,8 +795,8 @@ bool DoubleLinkedList<T>::empty() const noexcept { return size_ == 0; }
  * 
  * @return Pointer to head node, nullptr if list is empty
  */
-template<class T>
-typename DoubleLinkedList<T>::pointer DoubleLinkedList<T>::head() noexcept { return head_; }
+template<class T, class Allocator>
+typename DoubleLinkedList<T, Allocator>::pointer DoubleLinkedList<T, Allocator>::head() noexcept { return head_; }
 
 /**
  * @brief Returns const pointer to first node
@@ -500,8 +807,8 @@ typename DoubleLinkedList<T>::pointer DoubleLinkedList<T>::head() noexcept { ret
  * 
  * @return Const pointer to head node, nullptr if list is empty
  */
-template<class T>
-typename DoubleLinkedList<T>::const_pointer DoubleLinkedList<T>::head() const noexcept { return head_; }
+template<class T, class Allocator>
+typename DoubleLinkedList<T, Allocator>::const_pointer DoubleLinkedList<T, Allocator>::head() const noexcept { return head_; }
 
 /**
  * @brief Returns pointer to last node
@@ -512,8 +819,8 @@ typename DoubleLinkedList<T>::const_pointer DoubleLinkedList<T>::head() const no
  * 
  * @return Pointer to tail node, nullptr if list is empty
  */
-template<class T>
-typename DoubleLinkedList<T>::pointer DoubleLinkedList<T>::tail() noexcept { return tail_; }
+template<class T, class Allocator>
+typename DoubleLinkedList<T, Allocator>::pointer DoubleLinkedList<T, Allocator>::tail() noexcept { return tail_; }
 
 /**
  * @brief Returns const pointer to last node
@@ -524,8 +831,8 @@ typename DoubleLinkedList<T>::pointer DoubleLinkedList<T>::tail() noexcept { ret
  * 
  * @return Const pointer to tail node, nullptr if list is empty
  */
-template<class T>
-typename DoubleLinkedList<T>::const_pointer DoubleLinkedList<T>::tail() const noexcept { return tail_; }
+template<class T, class Allocator>
+typename DoubleLinkedList<T, Allocator>::const_pointer DoubleLinkedList<T, Allocator>::tail() const noexcept { return tail_; }
 
 /**
  * @brief Returns iterator to beginning of list
@@ -537,8 +844,8 @@ typename DoubleLinkedList<T>::const_pointer DoubleLinkedList<T>::tail() const no
  * 
  * @return Iterator to first element
  */
-template<class T>
-typename DoubleLinkedList<T>::iterator DoubleLinkedList<T>::begin() noexcept { return Iterator(head_); }
+template<class T, class Allocator>
+typename DoubleLinkedList<T, Allocator>::iterator DoubleLinkedList<T, Allocator>::begin() noexcept { return Iterator(head_, &tail_); }
 
 /**
  * @brief Returns iterator to end of list
@@ -550,8 +857,8 @@ typename DoubleLinkedList<T>::iterator DoubleLinkedList<T>::begin() noexcept { r
  * 
  * @return Iterator past last element
  */
-template<class T>
-typename DoubleLinkedList<T>::iterator DoubleLinkedList<T>::end() noexcept { return Iterator(nullptr); }
+template<class T, class Allocator>
+typename DoubleLinkedList<T, Allocator>::iterator DoubleLinkedList<T, Allocator>::end() noexcept { return Iterator(nullptr, &tail_); }
 
 /**
  * @brief Returns const iterator to beginning of list
@@ -563,8 +870,8 @@ typename DoubleLinkedList<T>::iterator DoubleLinkedList<T>::end() noexcept { ret
  * 
  * @return Const iterator to first element
  */
-template<class T>
-typename DoubleLinkedList<T>::const_iterator DoubleLinkedList<T>::begin() const noexcept { return Iterator(head_); }
+template<class T, class Allocator>
+typename DoubleLinkedList<T, Allocator>::const_iterator DoubleLinkedList<T, Allocator>::begin() const noexcept { return ConstIterator(head_, &tail_); }
 
 /**
  * @brief Returns const iterator to end of list
@@ -577,7 +884,272 @@ typename DoubleLinkedList<T>::const_iterator DoubleLinkedList<T>::begin() const
  * 
  * @return Const iterator past last element
  */
-template<class T>
-typename DoubleLinkedList<T>::const_iterator DoubleLinkedList<T>::end() const noexcept { return Iterator(nullptr); }
+template<class T, class Allocator>
+typename DoubleLinkedList<T, Allocator>::const_iterator DoubleLinkedList<T, Allocator>::end() const noexcept { return ConstIterator(nullptr, &tail_); }
+
+/**
+ * @brief Returns a copy of the allocator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Allocator rebound back to the element type
+ */
+template<class T, class Allocator>
+typename DoubleLinkedList<T, Allocator>::allocator_type DoubleLinkedList<T, Allocator>::get_allocator() const noexcept { return allocator_type(alloc_); }
+
+/**
+ * @brief Allocates and constructs a node
+ * 
+ * @ingroup linear_containers
+ * 
+ * @tparam Arg Type of the value, T or a reference to T
+ * @param[in] value Value to copy or move into the node
+ * @return Pointer to the new, unlinked node
+ * 
+ * @throws Anything thrown by the allocator or the constructor of T; no
+ * memory is leaked in that case
+ */
+template<class T, class Allocator>
+template <class Arg>
+typename DoubleLinkedList<T, Allocator>::pointer DoubleLinkedList<T, Allocator>::create_node(Arg &&value) {
+	pointer node = node_traits::allocate(alloc_, 1);
+	try {
+		node_traits::construct(alloc_, node, std::forward<Arg>(value));
+	}
+	catch (...) {
+		node_traits::deallocate(alloc_, node, 1);
+		throw;
+	}
+	return node;
+}
+
+/**
+ * @brief Destroys a node and gives its memory back to the allocator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] node Unlinked node obtained from create_node()
+ */
+template<class T, class Allocator>
+void DoubleLinkedList<T, Allocator>::destroy_node(pointer node) noexcept {
+	node_traits::destroy(alloc_, node);
+	node_traits::deallocate(alloc_, node, 1);
+}
+
+/**
+ * @brief Finds the node at an index and remembers it
+ * 
+ * @details Moves the cursor to the node found by find_node(), so
+ * sequential and nearby accesses cost O(1) amortized.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] index Position of the node (must be < size)
+ * @return Node at index
+ */
+template<class T, class Allocator>
+typename DoubleLinkedList<T, Allocator>::pointer DoubleLinkedList<T, Allocator>::node_at(size_type index) noexcept {
+	pointer cur = find_node(index);
+	cursor_ = cur;
+	cursor_index_ = index;
+	return cur;
+}
+
+/**
+ * @brief Finds the node at an index without moving the cursor
+ * 
+ * @details Starts from whichever of the head, the tail and the cached
+ * cursor is fewest links away and walks in the needed direction.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] index Position of the node (must be < size)
+ * @return Node at index
+ */
+template<class T, class Allocator>
+typename DoubleLinkedList<T, Allocator>::pointer DoubleLinkedList<T, Allocator>::find_node(size_type index) const noexcept {
+	pointer cur = head_;
+	size_type i = 0;
+	size_type distance = index;
+	if (size_ - 1 - index < distance) {
+		cur = tail_;
+		i = size_ - 1;
+		distance = size_ - 1 - index;
+	}
+	if (cursor_ && (cursor_index_ > index ? cursor_index_ - index : index - cursor_index_) < distance) {
+		cur = cursor_;
+		i = cursor_index_;
+	}
+	for (; i < index; ++i)
+		cur = cur->next;
+	for (; i > index; --i)
+		cur = cur->prev;
+	return cur;
+}
+
+/**
+ * @brief Forgets the cached cursor
+ * 
+ * @details Called whenever nodes are relinked in a way that changes
+ * indices the cursor cannot follow cheaply.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, class Allocator>
+void DoubleLinkedList<T, Allocator>::reset_cursor() noexcept {
+	cursor_ = nullptr;
+	cursor_index_ = 0;
+}
+
+/**
+ * @brief Links an unlinked node before another node
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] next Node to link before, or nullptr to append
+ * @param[in] node Node to link
+ */
+template<class T, class Allocator>
+void DoubleLinkedList<T, Allocator>::link_before(pointer next, pointer node) noexcept {
+	pointer prev = next ? next->prev : tail_;
+	node->prev = prev;
+	node->next = next;
+	if (prev)
+		prev->next = node;
+	else
+		head_ = node;
+	if (next)
+		next->prev = node;
+	else
+		tail_ = node;
+	size_++;
+	reset_cursor();
+}
+
+/**
+ * @brief Unlinks a node without freeing it or changing the size
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] node Node of this list to unlink
+ */
+template<class T, class Allocator>
+void DoubleLinkedList<T, Allocator>::unlink(pointer node) noexcept {
+	if (node->prev)
+		node->prev->next = node->next;
+	else
+		head_ = node->next;
+	if (node->next)
+		node->next->prev = node->prev;
+	else
+		tail_ = node->prev;
+	node->next = nullptr;
+	node->prev = nullptr;
+	reset_cursor();
+}
+
+/**
+ * @brief Takes a node out of another list
+ * 
+ * @details If this list cannot free other's nodes, the element is
+ * moved into a new node from this list's allocator and the old node is
+ * freed by other.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in,out] other List to take the node from
+ * @param[in] node Node of other to take
+ * @return Unlinked node owned by this list's allocator
+ * 
+ * @throws Anything thrown by the allocator or the move constructor of
+ * T; other then still holds the element
+ */
+template<class T, class Allocator>
+typename DoubleLinkedList<T, Allocator>::pointer DoubleLinkedList<T, Allocator>::adopt(DoubleLinkedList &other, pointer node) {
+	pointer adopted = shares_nodes_with(other) ? node : create_node(std::move(node->data));
+	other.unlink(node);
+	other.size_--;
+	if (adopted != node)
+		other.destroy_node(node);
+	return adopted;
+}
+
+/**
+ * @brief Checks whether nodes can move between two lists by relinking
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other List to compare with
+ * @return true if this list's allocator can free other's nodes
+ */
+template<class T, class Allocator>
+bool DoubleLinkedList<T, Allocator>::shares_nodes_with(const DoubleLinkedList &other) const noexcept {
+	if constexpr (node_traits::is_always_equal::value)
+		return true;
+	else
+		return this == &other || alloc_ == other.alloc_;
+}
+
+/**
+ * @brief Finds the end of the sorted run starting at a node
+ * 
+ * @ingroup linear_containers
+ * 
+ * @tparam Compare Strict weak ordering on T
+ * @param[in] first First node of the run
+ * @param[in] comp Comparison to sort by
+ * @return Last node of the longest non-descending run from first
+ */
+template<class T, class Allocator>
+template <class Compare>
+typename DoubleLinkedList<T, Allocator>::pointer DoubleLinkedList<T, Allocator>::run_end(pointer first, Compare &comp) {
+	while (first->next && !comp(first->next->data, first->data))
+		first = first->next;
+	return first;
+}
+
+/**
+ * @brief Merges two adjacent sorted runs in place
+ * 
+ * @details Moves each node of the second run in front of the first
+ * node of the first run that compares greater. The list stays fully
+ * linked after every step.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @tparam Compare Strict weak ordering on T
+ * @param[in] a_first First node of the first run
+ * @param[in] a_last Last node of the first run
+ * @param[in] b_last Last node of the second run, which starts right
+ * after a_last
+ * @param[in] comp Comparison to sort by
+ * @return Last node of the merged run
+ */
+template<class T, class Allocator>
+template <class Compare>
+typename DoubleLinkedList<T, Allocator>::pointer DoubleLinkedList<T, Allocator>::merge_runs(pointer a_first, pointer a_last, pointer b_last, Compare &comp) {
+	pointer stop = b_last->next;
+	pointer a = a_first;
+	pointer b = a_last->next;
+	while (b != stop) {
+		if (comp(b->data, a->data)) {
+			pointer next_b = b->next;
+			unlink(b);
+			b->prev = a->prev;
+			b->next = a;
+			if (a->prev)
+				a->prev->next = b;
+			else
+				head_ = b;
+			a->prev = b;
+			b = next_b;
+		}
+		else if (a == a_last)
+			break;
+		else
+			a = a->next;
+	}
+	return b == stop ? a_last : b_last;
+}
 
-#endif
\ No newline at end of file
+#endif
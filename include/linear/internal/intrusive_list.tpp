@@ -0,0 +1,673 @@
+/**
+ * @file intrusive_list.tpp
+ * @brief Implementation of IntrusiveListHook and IntrusiveList
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef INTRUSIVE_LIST_TPP
+#define INTRUSIVE_LIST_TPP
+
+#include "../intrusive_list.hpp"
+
+/**
+ * @brief Constructs an unlinked hook
+ * 
+ * @ingroup linear_containers
+ */
+inline IntrusiveListHook::IntrusiveListHook() noexcept : prev_(nullptr), next_(nullptr) {}
+
+/**
+ * @brief Copy constructor
+ * 
+ * @details The copy of an object is not on any list, so the new hook
+ * starts unlinked whatever the state of other.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Hook of the copied object (ignored)
+ */
+inline IntrusiveListHook::IntrusiveListHook(const IntrusiveListHook &other) noexcept : prev_(nullptr), next_(nullptr) {
+	(void)other;
+}
+
+/**
+ * @brief Copy assignment operator
+ * 
+ * @details Leaves the hook as it is, so assigning to a linked object
+ * keeps it on its list.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Hook of the assigned object (ignored)
+ * @return Reference to this hook
+ */
+inline IntrusiveListHook &IntrusiveListHook::operator=(const IntrusiveListHook &other) noexcept {
+	(void)other;
+	return *this;
+}
+
+/**
+ * @brief Checks whether the hook is on a list
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return true if the owning object is linked into a list
+ */
+inline bool IntrusiveListHook::is_linked() const noexcept { return next_ != nullptr; }
+
+/**
+ * @brief Default iterator constructor
+ * 
+ * @details Constructs a singular iterator that is not attached to any
+ * list.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, IntrusiveListHook T::*Hook>
+template<bool IsConst>
+IntrusiveList<T, Hook>::BasicIterator<IsConst>::BasicIterator() noexcept : current(nullptr) {}
+
+/**
+ * @brief Iterator constructor
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] hook Hook of the element to reference, or the list's
+ * sentinel for end()
+ */
+template<class T, IntrusiveListHook T::*Hook>
+template<bool IsConst>
+IntrusiveList<T, Hook>::BasicIterator<IsConst>::BasicIterator(hook_pointer hook) noexcept : current(hook) {}
+
+/**
+ * @brief Converting constructor
+ * 
+ * @details Copies a mutable iterator. For the const instantiation this
+ * is the conversion from iterator to const_iterator.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Mutable iterator to copy
+ */
+template<class T, IntrusiveListHook T::*Hook>
+template<bool IsConst>
+IntrusiveList<T, Hook>::BasicIterator<IsConst>::BasicIterator(const BasicIterator<false>& other) noexcept : current(other.current) {}
+
+/**
+ * @brief Dereference operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Reference to the object owning the current hook
+ */
+template<class T, IntrusiveListHook T::*Hook>
+template<bool IsConst>
+typename IntrusiveList<T, Hook>::template BasicIterator<IsConst>::reference IntrusiveList<T, Hook>::BasicIterator<IsConst>::operator*() const {
+	return *owner(current);
+}
+
+/**
+ * @brief Member access operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Pointer to the object owning the current hook
+ */
+template<class T, IntrusiveListHook T::*Hook>
+template<bool IsConst>
+typename IntrusiveList<T, Hook>::template BasicIterator<IsConst>::pointer IntrusiveList<T, Hook>::BasicIterator<IsConst>::operator->() const {
+	return owner(current);
+}
+
+/**
+ * @brief Prefix increment operator
+ * 
+ * @details Advances to the next element; incrementing the last element
+ * yields end().
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Reference to this iterator after increment
+ */
+template<class T, IntrusiveListHook T::*Hook>
+template<bool IsConst>
+typename IntrusiveList<T, Hook>::template BasicIterator<IsConst>& IntrusiveList<T, Hook>::BasicIterator<IsConst>::operator++() {
+	current = current->next_;
+	return *this;
+}
+
+/**
+ * @brief Postfix increment operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Copy of the iterator before increment
+ */
+template<class T, IntrusiveListHook T::*Hook>
+template<bool IsConst>
+typename IntrusiveList<T, Hook>::template BasicIterator<IsConst> IntrusiveList<T, Hook>::BasicIterator<IsConst>::operator++(int) {
+	BasicIterator previous = *this;
+	++*this;
+	return previous;
+}
+
+/**
+ * @brief Prefix decrement operator
+ * 
+ * @details Moves to the previous element; decrementing end() yields
+ * the last element.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Reference to this iterator after decrement
+ */
+template<class T, IntrusiveListHook T::*Hook>
+template<bool IsConst>
+typename IntrusiveList<T, Hook>::template BasicIterator<IsConst>& IntrusiveList<T, Hook>::BasicIterator<IsConst>::operator--() {
+	current = current->prev_;
+	return *this;
+}
+
+/**
+ * @brief Postfix decrement operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Copy of the iterator before decrement
+ */
+template<class T, IntrusiveListHook T::*Hook>
+template<bool IsConst>
+typename IntrusiveList<T, Hook>::template BasicIterator<IsConst> IntrusiveList<T, Hook>::BasicIterator<IsConst>::operator--(int) {
+	BasicIterator previous = *this;
+	--*this;
+	return previous;
+}
+
+/**
+ * @brief Inequality comparison operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Iterator to compare against
+ * @return true if iterators point to different elements
+ */
+template<class T, IntrusiveListHook T::*Hook>
+template<bool IsConst>
+template<bool OtherConst>
+bool IntrusiveList<T, Hook>::BasicIterator<IsConst>::operator!=(const BasicIterator<OtherConst>& other) const {
+	return current != other.current;
+}
+
+/**
+ * @brief Equality comparison operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Iterator to compare against
+ * @return true if iterators point to the same element
+ */
+template<class T, IntrusiveListHook T::*Hook>
+template<bool IsConst>
+template<bool OtherConst>
+bool IntrusiveList<T, Hook>::BasicIterator<IsConst>::operator==(const BasicIterator<OtherConst>& other) const {
+	return current == other.current;
+}
+
+/**
+ * @brief Default constructor creating empty list
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, IntrusiveListHook T::*Hook>
+IntrusiveList<T, Hook>::IntrusiveList() noexcept : sentinel_(), size_(0) {
+	sentinel_.prev_ = &sentinel_;
+	sentinel_.next_ = &sentinel_;
+}
+
+/**
+ * @brief Move constructor
+ * 
+ * @details Takes over the elements of other in O(1), leaving other
+ * empty.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in,out] other List to take the elements from
+ */
+template<class T, IntrusiveListHook T::*Hook>
+IntrusiveList<T, Hook>::IntrusiveList(IntrusiveList &&other) noexcept : IntrusiveList() {
+	take(other);
+}
+
+/**
+ * @brief Destructor
+ * 
+ * @details Unlinks every element; the objects themselves are left
+ * alone.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, IntrusiveListHook T::*Hook>
+IntrusiveList<T, Hook>::~IntrusiveList() { clear(); }
+
+/**
+ * @brief Move assignment operator
+ * 
+ * @details Unlinks the current elements and takes over those of other,
+ * leaving other empty.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in,out] other List to take the elements from
+ * @return Reference to this list
+ */
+template<class T, IntrusiveListHook T::*Hook>
+IntrusiveList<T, Hook> &IntrusiveList<T, Hook>::operator=(IntrusiveList &&other) noexcept {
+	if (this != &other) {
+		clear();
+		take(other);
+	}
+	return *this;
+}
+
+/**
+ * @brief Unlinks all elements
+ * 
+ * @details Resets every hook so the objects can be destroyed or linked
+ * into another list. Takes O(n).
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::clear() noexcept {
+	IntrusiveListHook *cur = sentinel_.next_;
+	while (cur != &sentinel_) {
+		IntrusiveListHook *next = cur->next_;
+		cur->prev_ = nullptr;
+		cur->next_ = nullptr;
+		cur = next;
+	}
+	sentinel_.prev_ = &sentinel_;
+	sentinel_.next_ = &sentinel_;
+	size_ = 0;
+}
+
+/**
+ * @brief Returns the first element
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Reference to the first element
+ * 
+ * @throws std::out_of_range If the list is empty
+ */
+template<class T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::reference IntrusiveList<T, Hook>::front() {
+	if (!size_) throw std::out_of_range("List is empty");
+	return *owner(sentinel_.next_);
+}
+
+/**
+ * @brief Returns the first element
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Const reference to the first element
+ * 
+ * @throws std::out_of_range If the list is empty
+ */
+template<class T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::const_reference IntrusiveList<T, Hook>::front() const {
+	if (!size_) throw std::out_of_range("List is empty");
+	return *owner(sentinel_.next_);
+}
+
+/**
+ * @brief Returns the last element
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Reference to the last element
+ * 
+ * @throws std::out_of_range If the list is empty
+ */
+template<class T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::reference IntrusiveList<T, Hook>::back() {
+	if (!size_) throw std::out_of_range("List is empty");
+	return *owner(sentinel_.prev_);
+}
+
+/**
+ * @brief Returns the last element
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Const reference to the last element
+ * 
+ * @throws std::out_of_range If the list is empty
+ */
+template<class T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::const_reference IntrusiveList<T, Hook>::back() const {
+	if (!size_) throw std::out_of_range("List is empty");
+	return *owner(sentinel_.prev_);
+}
+
+/**
+ * @brief Links an object at the end of the list
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in,out] value Object to link, not on any list through Hook
+ * 
+ * @throws std::invalid_argument If value is already linked through Hook
+ */
+template<class T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::add(reference value) { insert(end(), value); }
+
+/**
+ * @brief Links an object at the front of the list
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in,out] value Object to link, not on any list through Hook
+ * 
+ * @throws std::invalid_argument If value is already linked through Hook
+ */
+template<class T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::push_front(reference value) { insert(begin(), value); }
+
+/**
+ * @brief Unlinks the first element
+ * 
+ * @ingroup linear_containers
+ * 
+ * @throws std::out_of_range If the list is empty
+ */
+template<class T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::pop_front() {
+	if (!size_) throw std::out_of_range("List is empty");
+	erase(begin());
+}
+
+/**
+ * @brief Unlinks the last element
+ * 
+ * @ingroup linear_containers
+ * 
+ * @throws std::out_of_range If the list is empty
+ */
+template<class T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::pop_back() {
+	if (!size_) throw std::out_of_range("List is empty");
+	erase(--end());
+}
+
+/**
+ * @brief Links an object before an iterator position
+ * 
+ * @details Never allocates or copies value.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] pos Element to insert before, or end() to append
+ * @param[in,out] value Object to link, not on any list through Hook
+ * @return Iterator to value
+ * 
+ * @throws std::invalid_argument If value is already linked through Hook
+ */
+template<class T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::iterator IntrusiveList<T, Hook>::insert(const_iterator pos, reference value) {
+	IntrusiveListHook *hook = &(value.*Hook);
+	if (hook->is_linked()) throw std::invalid_argument("Element is already linked");
+	link_before(const_cast<IntrusiveListHook *>(pos.current), hook);
+	size_++;
+	return Iterator(hook);
+}
+
+/**
+ * @brief Unlinks the element at an iterator position
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] pos Element to unlink
+ * @return Iterator to the element that followed the unlinked one
+ * 
+ * @throws std::out_of_range If pos is end()
+ */
+template<class T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::iterator IntrusiveList<T, Hook>::erase(const_iterator pos) {
+	IntrusiveListHook *hook = const_cast<IntrusiveListHook *>(pos.current);
+	if (hook == &sentinel_) throw std::out_of_range("erase position is end()");
+	IntrusiveListHook *next = hook->next_;
+	unlink(hook);
+	size_--;
+	return Iterator(next);
+}
+
+/**
+ * @brief Unlinks an object known to be on this list
+ * 
+ * @details Needs neither a search nor an iterator, which is the main
+ * reason to keep objects on intrusive lists. An object linked through
+ * Hook into another list cannot be told apart from one on this list,
+ * so passing one is undefined behavior.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in,out] value Object linked into this list through Hook
+ * 
+ * @throws std::invalid_argument If value is not linked through Hook
+ */
+template<class T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::remove(reference value) {
+	IntrusiveListHook *hook = &(value.*Hook);
+	if (!hook->is_linked()) throw std::invalid_argument("Element is not linked");
+	unlink(hook);
+	size_--;
+}
+
+/**
+ * @brief Moves all elements of another list before an iterator position
+ * 
+ * @details Relinks the whole chain in O(1).
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] pos Element to insert before, or end() to append
+ * @param[in,out] other List to take the elements from, left empty
+ * unless it is this list
+ */
+template<class T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::splice(const_iterator pos, IntrusiveList &other) noexcept {
+	splice(pos, other, other.begin(), other.end());
+}
+
+/**
+ * @brief Moves a range of elements from another list before an
+ * iterator position
+ * 
+ * @details Moves the elements in [first, last) by relinking the chain
+ * as a whole: in O(1) within one list or when moving all of other,
+ * and otherwise with one walk to count the elements. other may be this list as long as pos is
+ * not inside the range.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] pos Element to insert before, or end() to append
+ * @param[in,out] other List to take the elements from
+ * @param[in] first First element to move
+ * @param[in] last Element after the last one to move, or end()
+ */
+template<class T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::splice(const_iterator pos, IntrusiveList &other, const_iterator first, const_iterator last) noexcept {
+	IntrusiveListHook *next = const_cast<IntrusiveListHook *>(pos.current);
+	IntrusiveListHook *chain_first = const_cast<IntrusiveListHook *>(first.current);
+	IntrusiveListHook *stop = const_cast<IntrusiveListHook *>(last.current);
+	if (chain_first == stop || next == stop)
+		return;
+	IntrusiveListHook *chain_last = stop->prev_;
+	if (this != &other) {
+		size_type count = other.size_;
+		if (chain_first != other.sentinel_.next_ || stop != &other.sentinel_) {
+			count = 1;
+			for (IntrusiveListHook *cur = chain_first; cur != chain_last; cur = cur->next_)
+				++count;
+		}
+		other.size_ -= count;
+		size_ += count;
+	}
+	chain_first->prev_->next_ = stop;
+	stop->prev_ = chain_first->prev_;
+	chain_first->prev_ = next->prev_;
+	chain_last->next_ = next;
+	next->prev_->next_ = chain_first;
+	next->prev_ = chain_last;
+}
+
+/**
+ * @brief Returns number of linked elements
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Number of elements in list
+ */
+template<class T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::size_type IntrusiveList<T, Hook>::size() const noexcept { return size_; }
+
+/**
+ * @brief Checks if list is empty
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return true if no element is linked, false otherwise
+ */
+template<class T, IntrusiveListHook T::*Hook>
+bool IntrusiveList<T, Hook>::empty() const noexcept { return size_ == 0; }
+
+/**
+ * @brief Returns an iterator to an object on this list
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] value Object linked into this list through Hook
+ * @return Iterator to value
+ */
+template<class T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::iterator IntrusiveList<T, Hook>::iterator_to(reference value) noexcept {
+	return Iterator(&(value.*Hook));
+}
+
+/**
+ * @brief Returns a const iterator to an object on this list
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] value Object linked into this list through Hook
+ * @return Const iterator to value
+ */
+template<class T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::const_iterator IntrusiveList<T, Hook>::iterator_to(const_reference value) const noexcept {
+	return ConstIterator(&(value.*Hook));
+}
+
+/**
+ * @brief Returns iterator to beginning of list
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Iterator to first element
+ */
+template<class T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::iterator IntrusiveList<T, Hook>::begin() noexcept { return Iterator(sentinel_.next_); }
+
+/**
+ * @brief Returns iterator to end of list
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Iterator to the sentinel past the last element
+ */
+template<class T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::iterator IntrusiveList<T, Hook>::end() noexcept { return Iterator(&sentinel_); }
+
+/**
+ * @brief Returns const iterator to beginning of list
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Const iterator to first element
+ */
+template<class T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::const_iterator IntrusiveList<T, Hook>::begin() const noexcept { return ConstIterator(sentinel_.next_); }
+
+/**
+ * @brief Returns const iterator to end of list
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Const iterator to the sentinel past the last element
+ */
+template<class T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::const_iterator IntrusiveList<T, Hook>::end() const noexcept { return ConstIterator(&sentinel_); }
+
+/**
+ * @brief Finds the object that embeds a hook
+ * 
+ * @details See member_owner(); T must be a standard-layout type.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] hook Hook of an element
+ * @return Object whose Hook member is hook
+ */
+template<class T, IntrusiveListHook T::*Hook>
+T *IntrusiveList<T, Hook>::owner(const IntrusiveListHook *hook) noexcept {
+	return member_owner<T, IntrusiveListHook, Hook>(hook);
+}
+
+/**
+ * @brief Links an unlinked hook before another hook
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] next Hook to link before, possibly the sentinel
+ * @param[in] hook Hook to link
+ */
+template<class T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::link_before(IntrusiveListHook *next, IntrusiveListHook *hook) noexcept {
+	hook->prev_ = next->prev_;
+	hook->next_ = next;
+	next->prev_->next_ = hook;
+	next->prev_ = hook;
+}
+
+/**
+ * @brief Unlinks a hook and resets it
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] hook Linked hook of an element
+ */
+template<class T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::unlink(IntrusiveListHook *hook) noexcept {
+	hook->prev_->next_ = hook->next_;
+	hook->next_->prev_ = hook->prev_;
+	hook->prev_ = nullptr;
+	hook->next_ = nullptr;
+}
+
+/**
+ * @brief Takes over the elements of another list
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in,out] other List to empty, while this list is empty
+ */
+template<class T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::take(IntrusiveList &other) noexcept {
+	splice(end(), other);
+}
+
+#endif
@@ -0,0 +1,540 @@
+/**
+ * @file intrusive_slist.tpp
+ * @brief Implementation of IntrusiveSListHook and IntrusiveSList
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef INTRUSIVE_SLIST_TPP
+#define INTRUSIVE_SLIST_TPP
+
+#include "../intrusive_slist.hpp"
+
+/**
+ * @brief Constructs an unlinked hook
+ * 
+ * @ingroup linear_containers
+ */
+inline IntrusiveSListHook::IntrusiveSListHook() noexcept : next_(nullptr) {}
+
+/**
+ * @brief Copy constructor
+ * 
+ * @details The copy of an object is not on any list, so the new hook
+ * starts unlinked whatever the state of other.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Hook of the copied object (ignored)
+ */
+inline IntrusiveSListHook::IntrusiveSListHook(const IntrusiveSListHook &other) noexcept : next_(nullptr) {
+	(void)other;
+}
+
+/**
+ * @brief Copy assignment operator
+ * 
+ * @details Leaves the hook as it is, so assigning to a linked object
+ * keeps it on its list.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Hook of the assigned object (ignored)
+ * @return Reference to this hook
+ */
+inline IntrusiveSListHook &IntrusiveSListHook::operator=(const IntrusiveSListHook &other) noexcept {
+	(void)other;
+	return *this;
+}
+
+/**
+ * @brief Checks whether the hook is on a list
+ * 
+ * @details Lists are circular through their sentinel, so a linked hook
+ * never has a null successor.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return true if the owning object is linked into a list
+ */
+inline bool IntrusiveSListHook::is_linked() const noexcept { return next_ != nullptr; }
+
+/**
+ * @brief Default iterator constructor
+ * 
+ * @details Constructs a singular iterator that is not attached to any
+ * list.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+template<bool IsConst>
+IntrusiveSList<T, Hook>::BasicIterator<IsConst>::BasicIterator() noexcept : current(nullptr) {}
+
+/**
+ * @brief Iterator constructor
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] hook Hook of the element to reference, or the list's
+ * sentinel for end()
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+template<bool IsConst>
+IntrusiveSList<T, Hook>::BasicIterator<IsConst>::BasicIterator(hook_pointer hook) noexcept : current(hook) {}
+
+/**
+ * @brief Converting constructor
+ * 
+ * @details Copies a mutable iterator. For the const instantiation this
+ * is the conversion from iterator to const_iterator.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Mutable iterator to copy
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+template<bool IsConst>
+IntrusiveSList<T, Hook>::BasicIterator<IsConst>::BasicIterator(const BasicIterator<false>& other) noexcept : current(other.current) {}
+
+/**
+ * @brief Dereference operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Reference to the object owning the current hook
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+template<bool IsConst>
+typename IntrusiveSList<T, Hook>::template BasicIterator<IsConst>::reference IntrusiveSList<T, Hook>::BasicIterator<IsConst>::operator*() const {
+	return *owner(current);
+}
+
+/**
+ * @brief Member access operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Pointer to the object owning the current hook
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+template<bool IsConst>
+typename IntrusiveSList<T, Hook>::template BasicIterator<IsConst>::pointer IntrusiveSList<T, Hook>::BasicIterator<IsConst>::operator->() const {
+	return owner(current);
+}
+
+/**
+ * @brief Prefix increment operator
+ * 
+ * @details Advances to the next element; incrementing the last element
+ * yields end(), and incrementing end() yields begin().
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Reference to this iterator after increment
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+template<bool IsConst>
+typename IntrusiveSList<T, Hook>::template BasicIterator<IsConst>& IntrusiveSList<T, Hook>::BasicIterator<IsConst>::operator++() {
+	current = current->next_;
+	return *this;
+}
+
+/**
+ * @brief Postfix increment operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Copy of the iterator before increment
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+template<bool IsConst>
+typename IntrusiveSList<T, Hook>::template BasicIterator<IsConst> IntrusiveSList<T, Hook>::BasicIterator<IsConst>::operator++(int) {
+	BasicIterator previous = *this;
+	++*this;
+	return previous;
+}
+
+/**
+ * @brief Inequality comparison operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Iterator to compare against
+ * @return true if iterators point to different elements
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+template<bool IsConst>
+template<bool OtherConst>
+bool IntrusiveSList<T, Hook>::BasicIterator<IsConst>::operator!=(const BasicIterator<OtherConst>& other) const {
+	return current != other.current;
+}
+
+/**
+ * @brief Equality comparison operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Iterator to compare against
+ * @return true if iterators point to the same element
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+template<bool IsConst>
+template<bool OtherConst>
+bool IntrusiveSList<T, Hook>::BasicIterator<IsConst>::operator==(const BasicIterator<OtherConst>& other) const {
+	return current == other.current;
+}
+
+/**
+ * @brief Default constructor creating empty list
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+IntrusiveSList<T, Hook>::IntrusiveSList() noexcept : sentinel_(), tail_(&sentinel_), size_(0) {
+	sentinel_.next_ = &sentinel_;
+}
+
+/**
+ * @brief Move constructor
+ * 
+ * @details Takes over the elements of other in O(1), leaving other
+ * empty.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in,out] other List to take the elements from
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+IntrusiveSList<T, Hook>::IntrusiveSList(IntrusiveSList &&other) noexcept : IntrusiveSList() {
+	splice_after(end(), other);
+}
+
+/**
+ * @brief Destructor
+ * 
+ * @details Unlinks every element; the objects themselves are left
+ * alone.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+IntrusiveSList<T, Hook>::~IntrusiveSList() { clear(); }
+
+/**
+ * @brief Move assignment operator
+ * 
+ * @details Unlinks the current elements and takes over those of other,
+ * leaving other empty.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in,out] other List to take the elements from
+ * @return Reference to this list
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+IntrusiveSList<T, Hook> &IntrusiveSList<T, Hook>::operator=(IntrusiveSList &&other) noexcept {
+	if (this != &other) {
+		clear();
+		splice_after(end(), other);
+	}
+	return *this;
+}
+
+/**
+ * @brief Unlinks all elements
+ * 
+ * @details Resets every hook so the objects can be destroyed or linked
+ * into another list. Takes O(n).
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+void IntrusiveSList<T, Hook>::clear() noexcept {
+	IntrusiveSListHook *cur = sentinel_.next_;
+	while (cur != &sentinel_) {
+		IntrusiveSListHook *next = cur->next_;
+		cur->next_ = nullptr;
+		cur = next;
+	}
+	sentinel_.next_ = &sentinel_;
+	tail_ = &sentinel_;
+	size_ = 0;
+}
+
+/**
+ * @brief Returns the first element
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Reference to the first element
+ * 
+ * @throws std::out_of_range If the list is empty
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+typename IntrusiveSList<T, Hook>::reference IntrusiveSList<T, Hook>::front() {
+	if (!size_) throw std::out_of_range("List is empty");
+	return *owner(sentinel_.next_);
+}
+
+/**
+ * @brief Returns the first element
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Const reference to the first element
+ * 
+ * @throws std::out_of_range If the list is empty
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+typename IntrusiveSList<T, Hook>::const_reference IntrusiveSList<T, Hook>::front() const {
+	if (!size_) throw std::out_of_range("List is empty");
+	return *owner(sentinel_.next_);
+}
+
+/**
+ * @brief Returns the last element
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Reference to the last element
+ * 
+ * @throws std::out_of_range If the list is empty
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+typename IntrusiveSList<T, Hook>::reference IntrusiveSList<T, Hook>::back() {
+	if (!size_) throw std::out_of_range("List is empty");
+	return *owner(tail_);
+}
+
+/**
+ * @brief Returns the last element
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Const reference to the last element
+ * 
+ * @throws std::out_of_range If the list is empty
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+typename IntrusiveSList<T, Hook>::const_reference IntrusiveSList<T, Hook>::back() const {
+	if (!size_) throw std::out_of_range("List is empty");
+	return *owner(tail_);
+}
+
+/**
+ * @brief Links an object at the end of the list
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in,out] value Object to link, not on any list through Hook
+ * 
+ * @throws std::invalid_argument If value is already linked through Hook
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+void IntrusiveSList<T, Hook>::add(reference value) { insert_after(ConstIterator(tail_), value); }
+
+/**
+ * @brief Links an object at the front of the list
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in,out] value Object to link, not on any list through Hook
+ * 
+ * @throws std::invalid_argument If value is already linked through Hook
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+void IntrusiveSList<T, Hook>::push_front(reference value) { insert_after(end(), value); }
+
+/**
+ * @brief Unlinks the first element
+ * 
+ * @ingroup linear_containers
+ * 
+ * @throws std::out_of_range If the list is empty
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+void IntrusiveSList<T, Hook>::pop_front() { erase_after(end()); }
+
+/**
+ * @brief Links an object after an iterator position
+ * 
+ * @details Never allocates or copies value.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] pos Element to insert after, or end() to insert at the
+ * front
+ * @param[in,out] value Object to link, not on any list through Hook
+ * @return Iterator to value
+ * 
+ * @throws std::invalid_argument If value is already linked through Hook
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+typename IntrusiveSList<T, Hook>::iterator IntrusiveSList<T, Hook>::insert_after(const_iterator pos, reference value) {
+	IntrusiveSListHook *hook = &(value.*Hook);
+	if (hook->is_linked()) throw std::invalid_argument("Element is already linked");
+	IntrusiveSListHook *prev = const_cast<IntrusiveSListHook *>(pos.current);
+	hook->next_ = prev->next_;
+	prev->next_ = hook;
+	if (prev == tail_)
+		tail_ = hook;
+	size_++;
+	return Iterator(hook);
+}
+
+/**
+ * @brief Unlinks the element after an iterator position
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] pos Element before the one to unlink, or end() to unlink
+ * the first element
+ * @return Iterator to the element that followed the unlinked one
+ * 
+ * @throws std::out_of_range If pos has no successor
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+typename IntrusiveSList<T, Hook>::iterator IntrusiveSList<T, Hook>::erase_after(const_iterator pos) {
+	IntrusiveSListHook *prev = const_cast<IntrusiveSListHook *>(pos.current);
+	IntrusiveSListHook *victim = prev->next_;
+	if (victim == &sentinel_) throw std::out_of_range("erase_after position has no successor");
+	prev->next_ = victim->next_;
+	if (victim == tail_)
+		tail_ = prev;
+	victim->next_ = nullptr;
+	size_--;
+	return Iterator(prev->next_);
+}
+
+/**
+ * @brief Moves all elements of another list after an iterator position
+ * 
+ * @details Relinks the whole chain in O(1).
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] pos Element to insert after, or end() to insert at the
+ * front
+ * @param[in,out] other List to take the elements from, left empty
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+void IntrusiveSList<T, Hook>::splice_after(const_iterator pos, IntrusiveSList &other) noexcept {
+	if (this == &other || other.empty())
+		return;
+	IntrusiveSListHook *prev = const_cast<IntrusiveSListHook *>(pos.current);
+	other.tail_->next_ = prev->next_;
+	prev->next_ = other.sentinel_.next_;
+	if (prev == tail_)
+		tail_ = other.tail_;
+	size_ += other.size_;
+	other.sentinel_.next_ = &other.sentinel_;
+	other.tail_ = &other.sentinel_;
+	other.size_ = 0;
+}
+
+/**
+ * @brief Returns number of linked elements
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Number of elements in list
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+typename IntrusiveSList<T, Hook>::size_type IntrusiveSList<T, Hook>::size() const noexcept { return size_; }
+
+/**
+ * @brief Checks if list is empty
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return true if no element is linked, false otherwise
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+bool IntrusiveSList<T, Hook>::empty() const noexcept { return size_ == 0; }
+
+/**
+ * @brief Returns an iterator to an object on this list
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] value Object linked into this list through Hook
+ * @return Iterator to value
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+typename IntrusiveSList<T, Hook>::iterator IntrusiveSList<T, Hook>::iterator_to(reference value) noexcept {
+	return Iterator(&(value.*Hook));
+}
+
+/**
+ * @brief Returns a const iterator to an object on this list
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] value Object linked into this list through Hook
+ * @return Const iterator to value
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+typename IntrusiveSList<T, Hook>::const_iterator IntrusiveSList<T, Hook>::iterator_to(const_reference value) const noexcept {
+	return ConstIterator(&(value.*Hook));
+}
+
+/**
+ * @brief Returns iterator to beginning of list
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Iterator to first element
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+typename IntrusiveSList<T, Hook>::iterator IntrusiveSList<T, Hook>::begin() noexcept { return Iterator(sentinel_.next_); }
+
+/**
+ * @brief Returns iterator to end of list
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Iterator to the sentinel, past the last and before the
+ * first element
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+typename IntrusiveSList<T, Hook>::iterator IntrusiveSList<T, Hook>::end() noexcept { return Iterator(&sentinel_); }
+
+/**
+ * @brief Returns const iterator to beginning of list
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Const iterator to first element
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+typename IntrusiveSList<T, Hook>::const_iterator IntrusiveSList<T, Hook>::begin() const noexcept { return ConstIterator(sentinel_.next_); }
+
+/**
+ * @brief Returns const iterator to end of list
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Const iterator to the sentinel, past the last and before the
+ * first element
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+typename IntrusiveSList<T, Hook>::const_iterator IntrusiveSList<T, Hook>::end() const noexcept { return ConstIterator(&sentinel_); }
+
+/**
+ * @brief Finds the object that embeds a hook
+ * 
+ * @details See member_owner(); T must be a standard-layout type.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] hook Hook of an element
+ * @return Object whose Hook member is hook
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+T *IntrusiveSList<T, Hook>::owner(const IntrusiveSListHook *hook) noexcept {
+	return member_owner<T, IntrusiveSListHook, Hook>(hook);
+}
+
+#endif
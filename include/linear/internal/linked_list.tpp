@@ -20,8 +20,31 @@
  * 
  * @param[in] value Data to store in node
  */
-template<class T>
-LinkedList<T>::Node::Node(const T &value) : data(value), next(nullptr) {}
+template<class T, class Allocator>
+LinkedList<T, Allocator>::Node::Node(const T &value) : data(value), next(nullptr) {}
+
+/**
+ * @brief Node move constructor
+ * 
+ * @details Initializes a node by moving the given value into it.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] value Data to move into node
+ */
+template<class T, class Allocator>
+LinkedList<T, Allocator>::Node::Node(T &&value) : data(std::move(value)), next(nullptr) {}
+
+/**
+ * @brief Default iterator constructor
+ * 
+ * @details Constructs a singular iterator equal to end().
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, class Allocator>
+template<bool IsConst>
+LinkedList<T, Allocator>::BasicIterator<IsConst>::BasicIterator() noexcept : current(nullptr) {}
 
 /**
  * @brief Iterator constructor
@@ -32,8 +55,23 @@ LinkedList<T>::Node::Node(const T &value) : data(value), next(nullptr) {}
  * 
  * @param[in] node Pointer to node for iterator to reference
  */
-template<class T>
-LinkedList<T>::Iterator::Iterator(Node* node) : current(node) {}
+template<class T, class Allocator>
+template<bool IsConst>
+LinkedList<T, Allocator>::BasicIterator<IsConst>::BasicIterator(node_pointer node) noexcept : current(node) {}
+
+/**
+ * @brief Converting constructor
+ * 
+ * @details Copies a mutable iterator. For the const instantiation this
+ * is the conversion from iterator to const_iterator.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Mutable iterator to copy
+ */
+template<class T, class Allocator>
+template<bool IsConst>
+LinkedList<T, Allocator>::BasicIterator<IsConst>::BasicIterator(const BasicIterator<false>& other) noexcept : current(other.current) {}
 
 /**
  * @brief Dereference operator
@@ -44,11 +82,27 @@ LinkedList<T>::Iterator::Iterator(Node* node) : current(node) {}
  * 
  * @return Reference to element pointed to by iterator
  */
-template<class T>
-T& LinkedList<T>::Iterator::operator*() const {
+template<class T, class Allocator>
+template<bool IsConst>
+typename LinkedList<T, Allocator>::template BasicIterator<IsConst>::reference LinkedList<T, Allocator>::BasicIterator<IsConst>::operator*() const {
 	return current->data;
 }
 
+/**
+ * @brief Member access operator
+ * 
+ * @details Returns pointer to data in current node.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Pointer to element pointed to by iterator
+ */
+template<class T, class Allocator>
+template<bool IsConst>
+typename LinkedList<T, Allocator>::template BasicIterator<IsConst>::pointer LinkedList<T, Allocator>::BasicIterator<IsConst>::operator->() const {
+	return &current->data;
+}
+
 /**
  * @brief Prefix increment operator
  * 
@@ -58,19 +112,41 @@ T& LinkedList<T>::Iterator::operator*() const {
  * 
  * @return Reference to this iterator after increment
  */
-template<class T>
-typename LinkedList<T>::Iterator& LinkedList<T>::Iterator::operator++() {
+template<class T, class Allocator>
+template<bool IsConst>
+typename LinkedList<T, Allocator>::template BasicIterator<IsConst>& LinkedList<T, Allocator>::BasicIterator<IsConst>::operator++() {
 	if (current) current = current->next;
 	return *this;
 }
 
-template<class T>
-bool LinkedList<T>::Iterator::operator!=(const Iterator& other) const {
+/**
+ * @brief Postfix increment operator
+ * 
+ * @details Advances iterator to next node in list.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Copy of the iterator before increment
+ */
+template<class T, class Allocator>
+template<bool IsConst>
+typename LinkedList<T, Allocator>::template BasicIterator<IsConst> LinkedList<T, Allocator>::BasicIterator<IsConst>::operator++(int) {
+	BasicIterator previous = *this;
+	++*this;
+	return previous;
+}
+
+template<class T, class Allocator>
+template<bool IsConst>
+template<bool OtherConst>
+bool LinkedList<T, Allocator>::BasicIterator<IsConst>::operator!=(const BasicIterator<OtherConst>& other) const {
 	return current != other.current;
 }
 
-template<class T>
-bool LinkedList<T>::Iterator::operator==(const Iterator& other) const {
+template<class T, class Allocator>
+template<bool IsConst>
+template<bool OtherConst>
+bool LinkedList<T, Allocator>::BasicIterator<IsConst>::operator==(const BasicIterator<OtherConst>& other) const {
 	return current == other.current;
 }
 
@@ -82,8 +158,20 @@ bool LinkedList<T>::Iterator::operator==(const Iterator& other) const {
  * 
  * @ingroup linear_containers
  */
-template<class T>
-LinkedList<T>::LinkedList() noexcept : head_(nullptr), tail_(nullptr), size_(0) {}
+template<class T, class Allocator>
+LinkedList<T, Allocator>::LinkedList() noexcept : head_(nullptr), tail_(nullptr), size_(0), cursor_(nullptr), cursor_index_(0) {}
+
+/**
+ * @brief Constructs an empty list using the given allocator
+ * 
+ * @details No node is allocated until the first element is added.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] alloc Allocator to obtain nodes from
+ */
+template<class T, class Allocator>
+LinkedList<T, Allocator>::LinkedList(const Allocator &alloc) noexcept : head_(nullptr), tail_(nullptr), size_(0), alloc_(alloc), cursor_(nullptr), cursor_index_(0) {}
 
 /**
  * @brief Constructs list with count copies of value
@@ -95,9 +183,10 @@ LinkedList<T>::LinkedList() noexcept : head_(nullptr), tail_(nullptr), size_(0)
  * 
  * @param[in] count Number of elements to create
  * @param[in] value Value to initialize elements with
+ * @param[in] alloc Allocator to obtain nodes from
  */
-template<class T>
-LinkedList<T>::LinkedList(size_type count, const T &value) : head_(nullptr), tail_(nullptr), size_(0) {
+template<class T, class Allocator>
+LinkedList<T, Allocator>::LinkedList(size_type count, const T &value, const Allocator &alloc) : head_(nullptr), tail_(nullptr), size_(0), alloc_(alloc), cursor_(nullptr), cursor_index_(0) {
 	for (size_type i = 0; i < count; i++)
 		add(value);
 }
@@ -112,8 +201,10 @@ LinkedList<T>::LinkedList(size_type count, const T &value) : head_(nullptr), tai
  * 
  * @param[in] other LinkedList to copy from
  */
-template<class T>
-LinkedList<T>::LinkedList(const LinkedList &other) : head_(nullptr), tail_(nullptr), size_(0) {
+template<class T, class Allocator>
+LinkedList<T, Allocator>::LinkedList(const LinkedList &other)
+	: head_(nullptr), tail_(nullptr), size_(0),
+	alloc_(node_traits::select_on_container_copy_construction(other.alloc_)), cursor_(nullptr), cursor_index_(0) {
 	pointer cur = other.head_;
 	while (cur) {
 		add(cur->data);
@@ -131,10 +222,14 @@ LinkedList<T>::LinkedList(const LinkedList &other) : head_(nullptr), tail_(nullp
  * 
  * @param[in] other LinkedList to move from (rvalue reference)
  */
-template<class T>
-LinkedList<T>::LinkedList(LinkedList &&other) noexcept : head_(other.head_), tail_(other.tail_), size_(other.size_) {
+template<class T, class Allocator>
+LinkedList<T, Allocator>::LinkedList(LinkedList &&other) noexcept
+	: head_(other.head_), tail_(other.tail_), size_(other.size_), alloc_(std::move(other.alloc_)),
+	cursor_(nullptr), cursor_index_(0) {
 	other.head_ = nullptr;
+	other.tail_ = nullptr;
 	other.size_ = 0;
+	other.reset_cursor();
 }
 
 /**
@@ -148,9 +243,9 @@ LinkedList<T>::LinkedList(LinkedList &&other) noexcept : head_(other.head_), tai
  * @tparam Container Type of source container
  * @param[in] other Container to copy elements from
  */
-template<class T>
+template<class T, class Allocator>
 template <class Container>
-LinkedList<T>::LinkedList(const Container& other) : head_(nullptr), tail_(nullptr), size_(0) {
+LinkedList<T, Allocator>::LinkedList(const Container& other) : head_(nullptr), tail_(nullptr), size_(0), cursor_(nullptr), cursor_index_(0) {
 	for (const auto& item : other)
 		add(item);
 }
@@ -162,17 +257,18 @@ LinkedList<T>::LinkedList(const Container& other) : head_(nullptr), tail_(nullpt
  * 
  * @ingroup linear_containers
  */
-template<class T>
-LinkedList<T>::~LinkedList() {
+template<class T, class Allocator>
+LinkedList<T, Allocator>::~LinkedList() {
 	clear();
 }
 
 /**
  * @brief Subscript operator with bounds checking
  * 
- * @details Provides access to element at specified index. Traverses
- * list from head to reach the element. Throws exception if index is
- * out of range.
+ * @details Provides access to element at specified index. Walks from
+ * the node reached by the previous index access when that one lies
+ * before index, so ascending loops over all indices take O(n) in
+ * total. Throws exception if index is out of range.
  * 
  * @ingroup linear_containers
  * 
@@ -181,14 +277,11 @@ LinkedList<T>::~LinkedList() {
  * 
  * @throws std::out_of_range If index >= size
  */
-template<class T>
-typename LinkedList<T>::reference LinkedList<T>::operator[](size_type index) {
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::reference LinkedList<T, Allocator>::operator[](size_type index) {
 	if (index >= size_)
 		throw std::out_of_range("Index out of range");
-	pointer cur = head_;
-	for (size_type i = 0; i < index; i++)
-		cur = cur->next;
-	return cur->data;
+	return node_at(index)->data;
 }
 
 /**
@@ -202,8 +295,8 @@ typename LinkedList<T>::reference LinkedList<T>::operator[](size_type index) {
  * @param[in] other LinkedList to copy from
  * @return Reference to this list
  */
-template<class T>
-LinkedList<T> &LinkedList<T>::operator=(const LinkedList &other) {
+template<class T, class Allocator>
+LinkedList<T, Allocator> &LinkedList<T, Allocator>::operator=(const LinkedList &other) {
 	if (this != &other) {
 		clear();
 		pointer cur = other.head_;
@@ -220,22 +313,35 @@ LinkedList<T> &LinkedList<T>::operator=(const LinkedList &other) {
  * 
  * @details Transfers ownership of nodes from another list without
  * copying. Clears existing nodes first. Source list is left empty.
+ * When the allocator does not propagate and this list cannot free
+ * other's nodes, the elements are moved into new nodes one by one
+ * instead; only that case can throw.
  * 
  * @ingroup linear_containers
  * 
  * @param[in] other LinkedList to move from (rvalue reference)
  * @return Reference to this list
  */
-template<class T>
-LinkedList<T> &LinkedList<T>::operator=(LinkedList &&other) {
+template<class T, class Allocator>
+LinkedList<T, Allocator> &LinkedList<T, Allocator>::operator=(LinkedList &&other)
+	noexcept(node_traits::propagate_on_container_move_assignment::value || node_traits::is_always_equal::value) {
 	if (this != &other) {
 		clear();
+		if constexpr (node_traits::propagate_on_container_move_assignment::value)
+			alloc_ = std::move(other.alloc_);
+		else if (!shares_nodes_with(other)) {
+			for (pointer cur = other.head_; cur; cur = cur->next)
+				link_after(tail_, create_node(std::move(cur->data)));
+			other.clear();
+			return *this;
+		}
 		head_ = other.head_;
 		tail_ = other.tail_;
 		size_ = other.size_;
 		other.head_ = nullptr;
 		other.tail_ = nullptr;
 		other.size_ = 0;
+		other.reset_cursor();
 	}
 	return *this;
 }
@@ -248,24 +354,27 @@ LinkedList<T> &LinkedList<T>::operator=(LinkedList &&other) {
  * 
  * @ingroup linear_containers
  */
-template<class T>
-void LinkedList<T>::clear() noexcept {
+template<class T, class Allocator>
+void LinkedList<T, Allocator>::clear() noexcept {
 	pointer cur = head_;
 	while (cur) {
 		pointer temp = cur->next;
-		delete cur;
+		destroy_node(cur);
 		cur = temp;
 	}
 	head_ = nullptr;
 	tail_ = nullptr;
 	size_ = 0;
+	reset_cursor();
 }
 
 /**
  * @brief Access element with bounds checking
  * 
  * @details Provides const access to element at specified index.
- * Traverses list from head. Throws exception if index is out of range.
+ * Continues from the index last accessed through operator[] when
+ * possible, but never moves that cursor, so concurrent const reads
+ * stay safe. Throws exception if index is out of range.
  * 
  * @ingroup linear_containers
  * 
@@ -274,14 +383,11 @@ void LinkedList<T>::clear() noexcept {
  * 
  * @throws std::out_of_range If index >= size
  */
-template<class T>
-typename LinkedList<T>::const_reference LinkedList<T>::at(size_type index) const {
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::const_reference LinkedList<T, Allocator>::at(size_type index) const {
 	if (index >= size_)
 		throw std::out_of_range("Index out of range");
-	pointer cur = head_;
-	for (size_type i = 0; i < index; i++)
-		cur = cur->next;
-	return cur->data;
+	return find_node(index)->data;
 }
 
 /**
@@ -294,9 +400,9 @@ typename LinkedList<T>::const_reference LinkedList<T>::at(size_type index) const
  * 
  * @param[in] value Element to append
  */
-template<class T>
-void LinkedList<T>::add(const_reference value) {
-	pointer new_node = new Node(value);
+template<class T, class Allocator>
+void LinkedList<T, Allocator>::add(const_reference value) {
+	pointer new_node = create_node(value);
 	if (!tail_ && !head_) {
 		tail_ = new_node;
 		head_ = new_node;
@@ -313,7 +419,8 @@ void LinkedList<T>::add(const_reference value) {
  * 
  * @details Creates a new node and inserts it at the given index.
  * Shifts all subsequent elements one position. Updates head/tail as
- * needed.
+ * needed. The predecessor is found like in operator[], so inserting at
+ * ascending indices does not rescan the list.
  * 
  * @ingroup linear_containers
  * 
@@ -323,18 +430,18 @@ void LinkedList<T>::add(const_reference value) {
  * 
  * @throws std::out_of_range If index > size
  */
-template<class T>
-typename LinkedList<T>::pointer LinkedList<T>::insert(size_type index, const_reference value) {
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::pointer LinkedList<T, Allocator>::insert(size_type index, const_reference value) {
 	if (index > size_) throw std::out_of_range("insert index out of range");
-	pointer new_node = new Node(value);
+	pointer new_node = create_node(value);
 	if (index == 0) {
 		new_node->next = head_;
 		head_ = new_node;
 		if (size_ == 0) tail_ = new_node;
+		if (cursor_) cursor_index_++;
 	}
 	else {
-		pointer cur = head_;
-		for (size_type i = 0; i < index - 1; ++i) cur = cur->next;
+		pointer cur = node_at(index - 1);
 		new_node->next = cur->next;
 		cur->next = new_node;
 		if (new_node->next == nullptr) tail_ = new_node;
@@ -348,6 +455,7 @@ typename LinkedList<T>::pointer LinkedList<T>::insert(size_type index, const_ref
  * 
  * @details Removes the node at given index and deallocates it. Updates
  * pointers to maintain list integrity. Adjusts head/tail as needed.
+ * The predecessor is found like in operator[].
  * 
  * @ingroup linear_containers
  * 
@@ -356,8 +464,8 @@ typename LinkedList<T>::pointer LinkedList<T>::insert(size_type index, const_ref
  * 
  * @throws std::out_of_range If index >= size or list is empty
  */
-template<class T>
-typename LinkedList<T>::value_type LinkedList<T>::erase(size_type index) {
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::value_type LinkedList<T, Allocator>::erase(size_type index) {
 	if (index >= size_ || head_ == nullptr) throw std::out_of_range("erase index out of range");
 	value_type val;
 	if (index == 0) {
@@ -365,22 +473,221 @@ typename LinkedList<T>::value_type LinkedList<T>::erase(size_type index) {
 		val = to_delete->data;
 		head_ = head_->next;
 		if (tail_ == to_delete) tail_ = nullptr;
-		delete to_delete;
+		if (cursor_ == to_delete)
+			reset_cursor();
+		else if (cursor_)
+			cursor_index_--;
+		destroy_node(to_delete);
 		size_--;
 		return val;
 	}
-	pointer cur = head_;
-	for (size_type i = 0; i < index - 1; ++i) cur = cur->next;
+	pointer cur = node_at(index - 1);
 	pointer to_delete = cur->next;
 	val = to_delete->data;
 	cur->next = to_delete->next;
 	if (tail_ == to_delete)
 		tail_ = cur;
-	delete to_delete;
+	destroy_node(to_delete);
 	size_--;
 	return val;
 }
 
+/**
+ * @brief Inserts element after an iterator position
+ * 
+ * @details Links a new node directly behind pos without walking the
+ * list.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] pos Element to insert after, or end() to insert at the
+ * front
+ * @param[in] value Element to insert
+ * @return Iterator to the inserted element
+ */
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::iterator LinkedList<T, Allocator>::insert_after(const_iterator pos, const_reference value) {
+	pointer node = create_node(value);
+	link_after(const_cast<pointer>(pos.current), node);
+	return Iterator(node);
+}
+
+/**
+ * @brief Removes the element after an iterator position
+ * 
+ * @details Unlinks and frees the node behind pos without walking the
+ * list.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] pos Element before the one to remove, or end() to remove
+ * the first element
+ * @return Iterator to the element that followed the removed one
+ * 
+ * @throws std::out_of_range If no element follows pos
+ */
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::iterator LinkedList<T, Allocator>::erase_after(const_iterator pos) {
+	pointer prev = const_cast<pointer>(pos.current);
+	pointer &link = next_of(prev);
+	pointer victim = link;
+	if (!victim) throw std::out_of_range("erase_after position has no successor");
+	reset_cursor();
+	link = victim->next;
+	if (tail_ == victim)
+		tail_ = prev;
+	destroy_node(victim);
+	size_--;
+	return Iterator(link);
+}
+
+/**
+ * @brief Moves all elements of another list after an iterator position
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] pos Element to insert after, or end() to insert at the
+ * front
+ * @param[in,out] other List to take the elements from, left empty
+ */
+template<class T, class Allocator>
+void LinkedList<T, Allocator>::splice_after(const_iterator pos, LinkedList &other) {
+	splice_after(pos, other, other.end(), other.end());
+}
+
+/**
+ * @brief Moves a range of elements from another list after an iterator
+ * position
+ * 
+ * @details Moves the elements strictly between first and last. When
+ * both lists can free each other's nodes (the same list, or equal
+ * allocators), the nodes are relinked as a whole and only counted;
+ * otherwise each element is moved into a node from this list's
+ * allocator. other may be this list as long as pos is not inside the
+ * range.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] pos Element to insert after, or end() to insert at the
+ * front
+ * @param[in,out] other List to take the elements from
+ * @param[in] first Element before the range, or end() to start at the
+ * front of other
+ * @param[in] last Element after the range, or end() to run to the end
+ * of other
+ */
+template<class T, class Allocator>
+void LinkedList<T, Allocator>::splice_after(const_iterator pos, LinkedList &other, const_iterator first, const_iterator last) {
+	pointer after = const_cast<pointer>(pos.current);
+	pointer before = const_cast<pointer>(first.current);
+	pointer stop = const_cast<pointer>(last.current);
+	if (!shares_nodes_with(other)) {
+		while (other.next_of(before) != stop) {
+			pointer node = adopt_after(other, before);
+			link_after(after, node);
+			after = node;
+		}
+		return;
+	}
+	pointer &source = other.next_of(before);
+	pointer chain_first = source;
+	if (chain_first == stop)
+		return;
+	pointer chain_last = chain_first;
+	size_type count = 1;
+	while (chain_last->next != stop) {
+		chain_last = chain_last->next;
+		++count;
+	}
+	source = stop;
+	if (!stop)
+		other.tail_ = before;
+	other.size_ -= count;
+	other.reset_cursor();
+	reset_cursor();
+	pointer &target = next_of(after);
+	chain_last->next = target;
+	target = chain_first;
+	if (!chain_last->next)
+		tail_ = chain_last;
+	size_ += count;
+}
+
+/**
+ * @brief Merges another sorted list into this sorted list
+ * 
+ * @details Walks both lists once and links each node of other in
+ * front of the first element of this list that compares greater, so
+ * the merge is stable: of two equal elements, the one from this list
+ * comes first. Nodes are relinked when the allocators allow it and
+ * moved into new nodes otherwise. other is left empty.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @tparam Compare Strict weak ordering on T
+ * @param[in,out] other Sorted list to merge in
+ * @param[in] comp Comparison both lists are sorted by
+ */
+template<class T, class Allocator>
+template <class Compare>
+void LinkedList<T, Allocator>::merge(LinkedList &other, Compare comp) {
+	if (this == &other)
+		return;
+	pointer prev = nullptr;
+	pointer cur = head_;
+	while (other.head_) {
+		if (cur && !comp(other.head_->data, cur->data)) {
+			prev = cur;
+			cur = cur->next;
+		}
+		else if (!cur && shares_nodes_with(other)) {
+			splice_after(ConstIterator(prev), other);
+			return;
+		}
+		else {
+			pointer node = adopt_after(other, nullptr);
+			link_after(prev, node);
+			prev = node;
+		}
+	}
+}
+
+/**
+ * @brief Sorts the list by relinking its nodes
+ * 
+ * @details Natural merge sort: each pass finds the runs that are
+ * already in order and merges neighbouring runs in place, so sorted or
+ * nearly sorted input takes a single pass, and in general
+ * O(n log n) comparisons are made. Elements are never copied or moved
+ * and iterators stay valid. The sort is stable. If comp throws, every
+ * element is still in the list, in unspecified order.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @tparam Compare Strict weak ordering on T
+ * @param[in] comp Comparison to sort by
+ */
+template<class T, class Allocator>
+template <class Compare>
+void LinkedList<T, Allocator>::sort(Compare comp) {
+	if (size_ < 2)
+		return;
+	reset_cursor();
+	size_type runs;
+	do {
+		runs = 0;
+		pointer before = nullptr;
+		while (next_of(before)) {
+			pointer a_last = run_end(next_of(before), comp);
+			++runs;
+			if (!a_last->next)
+				break;
+			pointer b_last = run_end(a_last->next, comp);
+			before = merge_runs(before, a_last, b_last, comp);
+		}
+	} while (runs > 1);
+}
+
 /**
  * @brief Returns the number of elements
  * 
@@ -391,8 +698,8 @@ typename LinkedList<T>::value_type LinkedList<T>::erase(size_type index) {
  * 
  * @return Number of elements in list
  */
-template<class T>
-typename LinkedList<T>::size_type LinkedList<T>::size() const noexcept { return size_; }
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::size_type LinkedList<T, Allocator>::size() const noexcept { return size_; }
 
 /**
  * @brief Checks if list is empty
@@ -403,8 +710,8 @@ typename LinkedList<T>::size_type LinkedList<T>::size() const noexcept { return
  * 
  * @return true if list is empty, false otherwise
  */
-template<class T>
-bool LinkedList<T>::empty() const noexcept { return size_ == 0; }
+template<class T, class Allocator>
+bool LinkedList<T, Allocator>::empty() const noexcept { return size_ == 0; }
 
 /**
  * @brief Returns pointer to head node
@@ -415,8 +722,8 @@ bool LinkedList<T>::empty() const noexcept { return size_ == 0; }
  * 
  * @return Pointer to head node
  */
-template<class T>
-typename LinkedList<T>::pointer LinkedList<T>::head() noexcept { return head_; }
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::pointer LinkedList<T, Allocator>::head() noexcept { return head_; }
 
 /**
  * @brief Returns const pointer to head node
@@ -427,8 +734,8 @@ typename LinkedList<T>::pointer LinkedList<T>::head() noexcept { return head_; }
  * 
  * @return Const pointer to head node
  */
-template<class T>
-typename LinkedList<T>::const_pointer LinkedList<T>::head() const noexcept { return head_; }
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::const_pointer LinkedList<T, Allocator>::head() const noexcept { return head_; }
 
 /**
  * @brief Returns pointer to tail node
@@ -439,8 +746,8 @@ typename LinkedList<T>::const_pointer LinkedList<T>::head() const noexcept { ret
  * 
  * @return Pointer to tail node
  */
-template<class T>
-typename LinkedList<T>::pointer LinkedList<T>::tail() noexcept { return tail_; }
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::pointer LinkedList<T, Allocator>::tail() noexcept { return tail_; }
 
 /**
  * @brief Returns const pointer to tail node
@@ -451,8 +758,8 @@ typename LinkedList<T>::pointer LinkedList<T>::tail() noexcept { return tail_; }
  * 
  * @return Const pointer to tail node
  */
-template<class T>
-typename LinkedList<T>::const_pointer LinkedList<T>::tail() const noexcept { return tail_; }
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::const_pointer LinkedList<T, Allocator>::tail() const noexcept { return tail_; }
 
 /**
  * @brief Returns iterator to beginning
@@ -464,8 +771,8 @@ typename LinkedList<T>::const_pointer LinkedList<T>::tail() const noexcept { ret
  * 
  * @return Iterator to the first element
  */
-template<class T>
-typename LinkedList<T>::iterator LinkedList<T>::begin() noexcept { return Iterator(head_); }
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::iterator LinkedList<T, Allocator>::begin() noexcept { return Iterator(head_); }
 
 /**
  * @brief Returns iterator to end
@@ -477,8 +784,8 @@ typename LinkedList<T>::iterator LinkedList<T>::begin() noexcept { return Iterat
  * 
  * @return Iterator to the element following the last element
  */
-template<class T>
-typename LinkedList<T>::iterator LinkedList<T>::end() noexcept { return Iterator(nullptr); }
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::iterator LinkedList<T, Allocator>::end() noexcept { return Iterator(); }
 
 /**
  * @brief Returns const iterator to beginning
@@ -490,8 +797,8 @@ typename LinkedList<T>::iterator LinkedList<T>::end() noexcept { return Iterator
  * 
  * @return Const iterator to the first element
  */
-template<class T>
-typename LinkedList<T>::const_iterator LinkedList<T>::begin() const noexcept { return Iterator(head_); }
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::const_iterator LinkedList<T, Allocator>::begin() const noexcept { return ConstIterator(head_); }
 
 /**
  * @brief Returns const iterator to end
@@ -503,7 +810,257 @@ typename LinkedList<T>::const_iterator LinkedList<T>::begin() const noexcept { r
  * 
  * @return Const iterator to the element following the last element
  */
-template<class T>
-typename LinkedList<T>::const_iterator LinkedList<T>::end() const noexcept { return Iterator(nullptr); }
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::const_iterator LinkedList<T, Allocator>::end() const noexcept { return ConstIterator(); }
+
+/**
+ * @brief Returns a copy of the allocator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Allocator rebound back to the element type
+ */
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::allocator_type LinkedList<T, Allocator>::get_allocator() const noexcept { return allocator_type(alloc_); }
+
+/**
+ * @brief Allocates and constructs a node
+ * 
+ * @ingroup linear_containers
+ * 
+ * @tparam Arg Type of the value, T or a reference to T
+ * @param[in] value Value to copy or move into the node
+ * @return Pointer to the new, unlinked node
+ * 
+ * @throws Anything thrown by the allocator or the constructor of T; no
+ * memory is leaked in that case
+ */
+template<class T, class Allocator>
+template <class Arg>
+typename LinkedList<T, Allocator>::pointer LinkedList<T, Allocator>::create_node(Arg &&value) {
+	pointer node = node_traits::allocate(alloc_, 1);
+	try {
+		node_traits::construct(alloc_, node, std::forward<Arg>(value));
+	}
+	catch (...) {
+		node_traits::deallocate(alloc_, node, 1);
+		throw;
+	}
+	return node;
+}
+
+/**
+ * @brief Destroys a node and gives its memory back to the allocator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] node Unlinked node obtained from create_node()
+ */
+template<class T, class Allocator>
+void LinkedList<T, Allocator>::destroy_node(pointer node) noexcept {
+	node_traits::destroy(alloc_, node);
+	node_traits::deallocate(alloc_, node, 1);
+}
+
+/**
+ * @brief Finds the node at an index and remembers it
+ * 
+ * @details Moves the cursor to the node found by find_node(), so
+ * sequential and nearby accesses cost O(1) amortized.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] index Position of the node (must be < size)
+ * @return Node at index
+ */
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::pointer LinkedList<T, Allocator>::node_at(size_type index) noexcept {
+	pointer cur = find_node(index);
+	cursor_ = cur;
+	cursor_index_ = index;
+	return cur;
+}
+
+/**
+ * @brief Finds the node at an index without moving the cursor
+ * 
+ * @details Walks forward from the cached cursor when it does not lie
+ * past index, and from the head otherwise; the last index is served by
+ * the tail directly.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] index Position of the node (must be < size)
+ * @return Node at index
+ */
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::pointer LinkedList<T, Allocator>::find_node(size_type index) const noexcept {
+	if (index == size_ - 1)
+		return tail_;
+	pointer cur = head_;
+	size_type i = 0;
+	if (cursor_ && cursor_index_ <= index) {
+		cur = cursor_;
+		i = cursor_index_;
+	}
+	for (; i < index; ++i)
+		cur = cur->next;
+	return cur;
+}
+
+/**
+ * @brief Forgets the cached cursor
+ * 
+ * @details Called whenever nodes are relinked in a way that changes
+ * indices the cursor cannot follow cheaply.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, class Allocator>
+void LinkedList<T, Allocator>::reset_cursor() noexcept {
+	cursor_ = nullptr;
+	cursor_index_ = 0;
+}
+
+/**
+ * @brief Returns the link that points at the node after another
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] node Node whose successor link to return, or nullptr for
+ * the head pointer
+ * @return Reference to node->next, or to head_
+ */
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::pointer &LinkedList<T, Allocator>::next_of(pointer node) noexcept {
+	return node ? node->next : head_;
+}
+
+/**
+ * @brief Links an unlinked node after another node
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] prev Node to link after, or nullptr to link at the front
+ * @param[in] node Node to link
+ */
+template<class T, class Allocator>
+void LinkedList<T, Allocator>::link_after(pointer prev, pointer node) noexcept {
+	pointer &link = next_of(prev);
+	node->next = link;
+	link = node;
+	if (!node->next)
+		tail_ = node;
+	size_++;
+	reset_cursor();
+}
+
+/**
+ * @brief Takes the node after a position out of another list
+ * 
+ * @details If this list cannot free other's nodes, the element is
+ * moved into a new node from this list's allocator and the old node is
+ * freed by other.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in,out] other List to take the node from
+ * @param[in] before Node of other before the one to take, or nullptr
+ * for its first node
+ * @return Unlinked node owned by this list's allocator
+ * 
+ * @throws Anything thrown by the allocator or the move constructor of
+ * T; other then still holds the element
+ */
+template<class T, class Allocator>
+typename LinkedList<T, Allocator>::pointer LinkedList<T, Allocator>::adopt_after(LinkedList &other, pointer before) {
+	pointer &link = other.next_of(before);
+	pointer node = link;
+	pointer adopted = shares_nodes_with(other) ? node : create_node(std::move(node->data));
+	other.reset_cursor();
+	link = node->next;
+	if (other.tail_ == node)
+		other.tail_ = before;
+	other.size_--;
+	if (adopted != node)
+		other.destroy_node(node);
+	adopted->next = nullptr;
+	return adopted;
+}
+
+/**
+ * @brief Checks whether nodes can move between two lists by relinking
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other List to compare with
+ * @return true if this list's allocator can free other's nodes
+ */
+template<class T, class Allocator>
+bool LinkedList<T, Allocator>::shares_nodes_with(const LinkedList &other) const noexcept {
+	if constexpr (node_traits::is_always_equal::value)
+		return true;
+	else
+		return this == &other || alloc_ == other.alloc_;
+}
+
+/**
+ * @brief Finds the end of the sorted run starting at a node
+ * 
+ * @ingroup linear_containers
+ * 
+ * @tparam Compare Strict weak ordering on T
+ * @param[in] first First node of the run
+ * @param[in] comp Comparison to sort by
+ * @return Last node of the longest non-descending run from first
+ */
+template<class T, class Allocator>
+template <class Compare>
+typename LinkedList<T, Allocator>::pointer LinkedList<T, Allocator>::run_end(pointer first, Compare &comp) {
+	while (first->next && !comp(first->next->data, first->data))
+		first = first->next;
+	return first;
+}
+
+/**
+ * @brief Merges two adjacent sorted runs in place
+ * 
+ * @details Moves each node of the second run in front of the first
+ * node of the first run that compares greater. The list stays fully
+ * linked after every step.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @tparam Compare Strict weak ordering on T
+ * @param[in] before Node before the first run, or nullptr
+ * @param[in] a_last Last node of the first run
+ * @param[in] b_last Last node of the second run, which starts right
+ * after a_last
+ * @param[in] comp Comparison to sort by
+ * @return Last node of the merged run
+ */
+template<class T, class Allocator>
+template <class Compare>
+typename LinkedList<T, Allocator>::pointer LinkedList<T, Allocator>::merge_runs(pointer before, pointer a_last, pointer b_last, Compare &comp) {
+	pointer stop = b_last->next;
+	pointer cursor = before;
+	pointer b = a_last->next;
+	while (b != stop && cursor != a_last) {
+		pointer &link = next_of(cursor);
+		pointer a = link;
+		if (comp(b->data, a->data)) {
+			a_last->next = b->next;
+			if (tail_ == b)
+				tail_ = a_last;
+			b->next = a;
+			link = b;
+			cursor = b;
+			b = a_last->next;
+		}
+		else
+			cursor = a;
+	}
+	return b == stop ? a_last : b_last;
+}
 
-#endif
\ No newline at end of file
+#endif
@@ -21,8 +21,32 @@
  * 
  * @param[in] value Data to store in node
  */
-template<class T>
-Queue<T>::Node::Node(const T &value) : data(value), next(nullptr), prev(nullptr) {}
+template<class T, class Allocator>
+Queue<T, Allocator>::Node::Node(const T &value) : data(value), next(nullptr), prev(nullptr) {}
+
+/**
+ * @brief Node move constructor
+ * 
+ * @details Initializes a node by moving the given value into it.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] value Data to move into node
+ */
+template<class T, class Allocator>
+Queue<T, Allocator>::Node::Node(T &&value) : data(std::move(value)), next(nullptr), prev(nullptr) {}
+
+/**
+ * @brief Default iterator constructor
+ * 
+ * @details Constructs a singular iterator that is not attached to any
+ * queue.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, class Allocator>
+template<bool IsConst>
+Queue<T, Allocator>::BasicIterator<IsConst>::BasicIterator() noexcept : current(nullptr), tail(nullptr) {}
 
 /**
  * @brief Iterator constructor
@@ -31,10 +55,28 @@ Queue<T>::Node::Node(const T &value) : data(value), next(nullptr), prev(nullptr)
  * 
  * @ingroup linear_containers
  * 
- * @param[in] node Pointer to node for iterator to reference
+ * @param[in] node Pointer to node for iterator to reference, nullptr
+ * for end()
+ * @param[in] tail Address of the owning queue's tail pointer
  */
-template<class T>
-Queue<T>::Iterator::Iterator(Node* node) : current(node) {}
+template<class T, class Allocator>
+template<bool IsConst>
+Queue<T, Allocator>::BasicIterator<IsConst>::BasicIterator(node_pointer node, Node *const *tail) noexcept : current(node), tail(tail) {}
+
+/**
+ * @brief Converting constructor
+ * 
+ * @details Copies a mutable iterator. For the const instantiation this
+ * is the conversion from iterator to const_iterator.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Mutable iterator to copy
+ */
+template<class T, class Allocator>
+template<bool IsConst>
+Queue<T, Allocator>::BasicIterator<IsConst>::BasicIterator(const BasicIterator<false>& other) noexcept
+	: current(other.current), tail(other.tail) {}
 
 /**
  * @brief Dereference operator
@@ -45,11 +87,27 @@ Queue<T>::Iterator::Iterator(Node* node) : current(node) {}
  * 
  * @return Reference to element pointed to by iterator
  */
-template<class T>
-T& Queue<T>::Iterator::operator*() const {
+template<class T, class Allocator>
+template<bool IsConst>
+typename Queue<T, Allocator>::template BasicIterator<IsConst>::reference Queue<T, Allocator>::BasicIterator<IsConst>::operator*() const {
 	return current->data;
 }
 
+/**
+ * @brief Member access operator
+ * 
+ * @details Returns pointer to data in current node.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Pointer to element pointed to by iterator
+ */
+template<class T, class Allocator>
+template<bool IsConst>
+typename Queue<T, Allocator>::template BasicIterator<IsConst>::pointer Queue<T, Allocator>::BasicIterator<IsConst>::operator->() const {
+	return &current->data;
+}
+
 /**
  * @brief Prefix increment operator
  * 
@@ -59,27 +117,67 @@ T& Queue<T>::Iterator::operator*() const {
  * 
  * @return Reference to this iterator after increment
  */
-template<class T>
-typename Queue<T>::Iterator& Queue<T>::Iterator::operator++() {
+template<class T, class Allocator>
+template<bool IsConst>
+typename Queue<T, Allocator>::template BasicIterator<IsConst>& Queue<T, Allocator>::BasicIterator<IsConst>::operator++() {
 	if (current) current = current->next;
 	return *this;
 }
 
+/**
+ * @brief Postfix increment operator
+ * 
+ * @details Advances iterator to next node in queue.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Copy of the iterator before increment
+ */
+template<class T, class Allocator>
+template<bool IsConst>
+typename Queue<T, Allocator>::template BasicIterator<IsConst> Queue<T, Allocator>::BasicIterator<IsConst>::operator++(int) {
+	BasicIterator previous = *this;
+	++*this;
+	return previous;
+}
+
 /**
  * @brief Prefix decrement operator
  * 
- * @details Moves iterator to previous node in queue.
+ * @details Moves iterator to previous node in queue. Decrementing
+ * end() moves to the last node.
  * 
  * @ingroup linear_containers
  * 
  * @return Reference to this iterator after decrement
  */
-template<class T>
-typename Queue<T>::Iterator& Queue<T>::Iterator::operator--() {
-	if (current) current = current->prev;
+template<class T, class Allocator>
+template<bool IsConst>
+typename Queue<T, Allocator>::template BasicIterator<IsConst>& Queue<T, Allocator>::BasicIterator<IsConst>::operator--() {
+	if (current)
+		current = current->prev;
+	else if (tail)
+		current = *tail;
 	return *this;
 }
 
+/**
+ * @brief Postfix decrement operator
+ * 
+ * @details Moves iterator to previous node in queue.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Copy of the iterator before decrement
+ */
+template<class T, class Allocator>
+template<bool IsConst>
+typename Queue<T, Allocator>::template BasicIterator<IsConst> Queue<T, Allocator>::BasicIterator<IsConst>::operator--(int) {
+	BasicIterator previous = *this;
+	--*this;
+	return previous;
+}
+
 /**
  * @brief Inequality comparison operator
  * 
@@ -91,8 +189,10 @@ typename Queue<T>::Iterator& Queue<T>::Iterator::operator--() {
  * @param[in] other Iterator to compare against
  * @return true if iterators point to different nodes, false otherwise
  */
-template<class T>
-bool Queue<T>::Iterator::operator!=(const Iterator& other) const {
+template<class T, class Allocator>
+template<bool IsConst>
+template<bool OtherConst>
+bool Queue<T, Allocator>::BasicIterator<IsConst>::operator!=(const BasicIterator<OtherConst>& other) const {
 	return current != other.current;
 }
 
@@ -107,8 +207,10 @@ bool Queue<T>::Iterator::operator!=(const Iterator& other) const {
  * @param[in] other Iterator to compare against
  * @return true if iterators point to same node, false otherwise
  */
-template<class T>
-bool Queue<T>::Iterator::operator==(const Iterator& other) const {
+template<class T, class Allocator>
+template<bool IsConst>
+template<bool OtherConst>
+bool Queue<T, Allocator>::BasicIterator<IsConst>::operator==(const BasicIterator<OtherConst>& other) const {
 	return current == other.current;
 }
 
@@ -120,8 +222,20 @@ bool Queue<T>::Iterator::operator==(const Iterator& other) const {
  * 
  * @ingroup linear_containers
  */
-template<class T>
-Queue<T>::Queue() noexcept : head_(nullptr), tail_(nullptr), size_(0) {}
+template<class T, class Allocator>
+Queue<T, Allocator>::Queue() noexcept : head_(nullptr), tail_(nullptr), size_(0) {}
+
+/**
+ * @brief Constructs an empty queue using the given allocator
+ * 
+ * @details No node is allocated until the first element is added.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] alloc Allocator to obtain nodes from
+ */
+template<class T, class Allocator>
+Queue<T, Allocator>::Queue(const Allocator &alloc) noexcept : head_(nullptr), tail_(nullptr), size_(0), alloc_(alloc) {}
 
 /**
  * @brief Constructor creating queue with repeated values
@@ -133,9 +247,10 @@ Queue<T>::Queue() noexcept : head_(nullptr), tail_(nullptr), size_(0) {}
  * 
  * @param[in] count Number of elements to create
  * @param[in] value Value to initialize each element with
+ * @param[in] alloc Allocator to obtain nodes from
  */
-template<class T>
-Queue<T>::Queue(size_type count, const T &value) : head_(nullptr), tail_(nullptr), size_(0) {
+template<class T, class Allocator>
+Queue<T, Allocator>::Queue(size_type count, const T &value, const Allocator &alloc) : head_(nullptr), tail_(nullptr), size_(0), alloc_(alloc) {
 	for (size_type i = 0; i < count; i++)
 		enqueue(value);
 }
@@ -150,8 +265,10 @@ Queue<T>::Queue(size_type count, const T &value) : head_(nullptr), tail_(nullptr
  * 
  * @param[in] other Queue to copy from
  */
-template<class T>
-Queue<T>::Queue(const Queue &other) : head_(nullptr), tail_(nullptr), size_(0) {
+template<class T, class Allocator>
+Queue<T, Allocator>::Queue(const Queue &other)
+	: head_(nullptr), tail_(nullptr), size_(0),
+	alloc_(node_traits::select_on_container_copy_construction(other.alloc_)) {
 	pointer cur = other.head_;
 	while (cur) {
 		enqueue(cur->data);
@@ -170,9 +287,11 @@ Queue<T>::Queue(const Queue &other) : head_(nullptr), tail_(nullptr), size_(0) {
  * 
  * @param[in] other Queue to move from
  */
-template<class T>
-Queue<T>::Queue(Queue &&other) noexcept : head_(other.head_), tail_(other.tail_), size_(other.size_) {
+template<class T, class Allocator>
+Queue<T, Allocator>::Queue(Queue &&other) noexcept
+	: head_(other.head_), tail_(other.tail_), size_(other.size_), alloc_(std::move(other.alloc_)) {
 	other.head_ = nullptr;
+	other.tail_ = nullptr;
 	other.size_ = 0;
 }
 
@@ -187,9 +306,9 @@ Queue<T>::Queue(Queue &&other) noexcept : head_(other.head_), tail_(other.tail_)
  * @tparam Container Type of source container
  * @param[in] other Container to copy elements from
  */
-template<class T>
+template<class T, class Allocator>
 template <class Container>
-Queue<T>::Queue(const Container& other) : head_(nullptr), tail_(nullptr), size_(0) {
+Queue<T, Allocator>::Queue(const Container& other) : head_(nullptr), tail_(nullptr), size_(0) {
 	for (const auto& item : other)
 		enqueue(item);
 }
@@ -202,8 +321,8 @@ Queue<T>::Queue(const Container& other) : head_(nullptr), tail_(nullptr), size_(
  * 
  * @ingroup linear_containers
  */
-template<class T>
-Queue<T>::~Queue() {
+template<class T, class Allocator>
+Queue<T, Allocator>::~Queue() {
 	clear();
 }
 
@@ -221,8 +340,8 @@ Queue<T>::~Queue() {
  * 
  * @throws std::out_of_range if index >= size
  */
-template<class T>
-typename Queue<T>::reference Queue<T>::operator[](size_type index) {
+template<class T, class Allocator>
+typename Queue<T, Allocator>::reference Queue<T, Allocator>::operator[](size_type index) {
 	if (index >= size_)
 		throw std::out_of_range("Index out of range");
 	pointer cur;
@@ -251,8 +370,8 @@ typename Queue<T>::reference Queue<T>::operator[](size_type index) {
  * @param[in] other Queue to copy from
  * @return Reference to this queue
  */
-template<class T>
-Queue<T> &Queue<T>::operator=(const Queue &other) {
+template<class T, class Allocator>
+Queue<T, Allocator> &Queue<T, Allocator>::operator=(const Queue &other) {
 	if (this != &other) {
 		clear();
 		pointer cur = other.head_;
@@ -268,17 +387,37 @@ Queue<T> &Queue<T>::operator=(const Queue &other) {
  * @brief Move assignment operator
  * 
  * @details Transfers ownership of resources from another queue to
- * this queue, leaving the source queue in a valid empty state.
+ * this queue, leaving the source queue in a valid empty state. When
+ * the allocator does not propagate and this queue cannot free other's
+ * nodes, the elements are moved into new nodes one by one instead;
+ * only that case can throw.
  * 
  * @ingroup linear_containers
  * 
  * @param[in] other Queue to move from
  * @return Reference to this queue
  */
-template<class T>
-Queue<T> &Queue<T>::operator=(Queue &&other) {
+template<class T, class Allocator>
+Queue<T, Allocator> &Queue<T, Allocator>::operator=(Queue &&other)
+	noexcept(node_traits::propagate_on_container_move_assignment::value || node_traits::is_always_equal::value) {
 	if (this != &other) {
 		clear();
+		if constexpr (node_traits::propagate_on_container_move_assignment::value)
+			alloc_ = std::move(other.alloc_);
+		else if (!shares_nodes_with(other)) {
+			for (pointer cur = other.head_; cur; cur = cur->next) {
+				pointer node = create_node(std::move(cur->data));
+				node->prev = tail_;
+				if (tail_)
+					tail_->next = node;
+				else
+					head_ = node;
+				tail_ = node;
+				size_++;
+			}
+			other.clear();
+			return *this;
+		}
 		head_ = other.head_;
 		tail_ = other.tail_;
 		size_ = other.size_;
@@ -298,12 +437,12 @@ Queue<T> &Queue<T>::operator=(Queue &&other) {
  * 
  * @ingroup linear_containers
  */
-template<class T>
-void Queue<T>::clear() noexcept {
+template<class T, class Allocator>
+void Queue<T, Allocator>::clear() noexcept {
 	pointer cur = head_;
 	while (cur) {
 		pointer temp = cur->next;
-		delete cur;
+		destroy_node(cur);
 		cur = temp;
 	}
 	head_ = nullptr;
@@ -325,8 +464,8 @@ void Queue<T>::clear() noexcept {
  * 
  * @throws std::out_of_range if index >= size
  */
-template<class T>
-typename Queue<T>::const_reference Queue<T>::at(size_type index) const {
+template<class T, class Allocator>
+typename Queue<T, Allocator>::const_reference Queue<T, Allocator>::at(size_type index) const {
 	if (index >= size_)
 		throw std::out_of_range("Index out of range");
 	pointer cur;
@@ -354,9 +493,9 @@ typename Queue<T>::const_reference Queue<T>::at(size_type index) const {
  * 
  * @param[in] value Value to enqueue
  */
-template<class T>
-void Queue<T>::enqueue(const_reference value) {
-	pointer new_node = new Node(value);
+template<class T, class Allocator>
+void Queue<T, Allocator>::enqueue(const_reference value) {
+	pointer new_node = create_node(value);
 	if (!tail_ && !head_) {
 		tail_ = new_node;
 		head_ = new_node;
@@ -382,19 +521,19 @@ void Queue<T>::enqueue(const_reference value) {
  * 
  * @throws std::out_of_range if queue is empty
  */
-template<class T>
-typename Queue<T>::value_type Queue<T>::dequeue() {
+template<class T, class Allocator>
+typename Queue<T, Allocator>::value_type Queue<T, Allocator>::dequeue() {
 	if (head_ == nullptr) throw std::out_of_range("Empty queue");
 	value_type value = head_->data;
 	if (head_ == tail_) {
-		delete head_;
+		destroy_node(head_);
 		head_ = nullptr;
 		tail_ = nullptr;
 		--size_;
 		return value;
 	}
 	pointer next = head_->next;
-	delete head_;
+	destroy_node(head_);
 	head_ = next;
 	if (head_) head_->prev = nullptr;
 	--size_;
@@ -411,8 +550,8 @@ typename Queue<T>::value_type Queue<T>::dequeue() {
  * 
  * @return Number of elements in queue
  */
-template<class T>
-typename Queue<T>::size_type Queue<T>::size() const noexcept { return size_; }
+template<class T, class Allocator>
+typename Queue<T, Allocator>::size_type Queue<T, Allocator>::size() const noexcept { return size_; }
 
 /**
  * @brief Checks if queue is empty
@@ -423,8 +562,8 @@ typename Queue<T>::size_type Queue<T>::size() const noexcept { return size_; }
  * 
  * @return true if queue is empty, false otherwise
  */
-template<class T>
-bool Queue<T>::empty() const noexcept { return size_ == 0; }
+template<class T, class Allocator>
+bool Queue<T, Allocator>::empty() const noexcept { return size_ == 0; }
 
 /**
  * @brief Returns pointer to first node
@@ -435,8 +574,8 @@ bool Queue<T>::empty() const noexcept { return size_ == 0; }
  * 
  * @return Pointer to head node, nullptr if queue is empty
  */
-template<class T>
-typename Queue<T>::pointer Queue<T>::head() noexcept { return head_; }
+template<class T, class Allocator>
+typename Queue<T, Allocator>::pointer Queue<T, Allocator>::head() noexcept { return head_; }
 
 /**
  * @brief Returns const pointer to first node
@@ -447,8 +586,8 @@ typename Queue<T>::pointer Queue<T>::head() noexcept { return head_; }
  * 
  * @return Const pointer to head node, nullptr if queue is empty
  */
-template<class T>
-typename Queue<T>::const_pointer Queue<T>::head() const noexcept { return head_; }
+template<class T, class Allocator>
+typename Queue<T, Allocator>::const_pointer Queue<T, Allocator>::head() const noexcept { return head_; }
 
 /**
  * @brief Returns pointer to last node
@@ -459,8 +598,8 @@ typename Queue<T>::const_pointer Queue<T>::head() const noexcept { return head_;
  * 
  * @return Pointer to tail node, nullptr if queue is empty
  */
-template<class T>
-typename Queue<T>::pointer Queue<T>::tail() noexcept { return tail_; }
+template<class T, class Allocator>
+typename Queue<T, Allocator>::pointer Queue<T, Allocator>::tail() noexcept { return tail_; }
 
 /**
  * @brief Returns const pointer to last node
@@ -471,8 +610,8 @@ typename Queue<T>::pointer Queue<T>::tail() noexcept { return tail_; }
  * 
  * @return Const pointer to tail node, nullptr if queue is empty
  */
-template<class T>
-typename Queue<T>::const_pointer Queue<T>::tail() const noexcept { return tail_; }
+template<class T, class Allocator>
+typename Queue<T, Allocator>::const_pointer Queue<T, Allocator>::tail() const noexcept { return tail_; }
 
 /**
  * @brief Returns iterator to beginning of queue
@@ -484,8 +623,8 @@ typename Queue<T>::const_pointer Queue<T>::tail() const noexcept { return tail_;
  * 
  * @return Iterator to first element
  */
-template<class T>
-typename Queue<T>::iterator Queue<T>::begin() noexcept { return Iterator(head_); }
+template<class T, class Allocator>
+typename Queue<T, Allocator>::iterator Queue<T, Allocator>::begin() noexcept { return Iterator(head_, &tail_); }
 
 /**
  * @brief Returns iterator to end of queue
@@ -497,8 +636,8 @@ typename Queue<T>::iterator Queue<T>::begin() noexcept { return Iterator(head_);
  * 
  * @return Iterator past last element
  */
-template<class T>
-typename Queue<T>::iterator Queue<T>::end() noexcept { return Iterator(nullptr); }
+template<class T, class Allocator>
+typename Queue<T, Allocator>::iterator Queue<T, Allocator>::end() noexcept { return Iterator(nullptr, &tail_); }
 
 /**
  * @brief Returns const iterator to beginning of queue
@@ -510,8 +649,8 @@ typename Queue<T>::iterator Queue<T>::end() noexcept { return Iterator(nullptr);
  * 
  * @return Const iterator to first element
  */
-template<class T>
-typename Queue<T>::const_iterator Queue<T>::begin() const noexcept { return Iterator(head_); }
+template<class T, class Allocator>
+typename Queue<T, Allocator>::const_iterator Queue<T, Allocator>::begin() const noexcept { return ConstIterator(head_, &tail_); }
 
 /**
  * @brief Returns const iterator to end of queue
@@ -524,7 +663,72 @@ typename Queue<T>::const_iterator Queue<T>::begin() const noexcept { return Iter
  * 
  * @return Const iterator past last element
  */
-template<class T>
-typename Queue<T>::const_iterator Queue<T>::end() const noexcept { return Iterator(nullptr); }
+template<class T, class Allocator>
+typename Queue<T, Allocator>::const_iterator Queue<T, Allocator>::end() const noexcept { return ConstIterator(nullptr, &tail_); }
+
+/**
+ * @brief Returns a copy of the allocator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Allocator rebound back to the element type
+ */
+template<class T, class Allocator>
+typename Queue<T, Allocator>::allocator_type Queue<T, Allocator>::get_allocator() const noexcept { return allocator_type(alloc_); }
+
+/**
+ * @brief Allocates and constructs a node
+ * 
+ * @ingroup linear_containers
+ * 
+ * @tparam Arg Type of the value, T or a reference to T
+ * @param[in] value Value to copy or move into the node
+ * @return Pointer to the new, unlinked node
+ * 
+ * @throws Anything thrown by the allocator or the constructor of T; no
+ * memory is leaked in that case
+ */
+template<class T, class Allocator>
+template <class Arg>
+typename Queue<T, Allocator>::pointer Queue<T, Allocator>::create_node(Arg &&value) {
+	pointer node = node_traits::allocate(alloc_, 1);
+	try {
+		node_traits::construct(alloc_, node, std::forward<Arg>(value));
+	}
+	catch (...) {
+		node_traits::deallocate(alloc_, node, 1);
+		throw;
+	}
+	return node;
+}
+
+/**
+ * @brief Destroys a node and gives its memory back to the allocator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] node Unlinked node obtained from create_node()
+ */
+template<class T, class Allocator>
+void Queue<T, Allocator>::destroy_node(pointer node) noexcept {
+	node_traits::destroy(alloc_, node);
+	node_traits::deallocate(alloc_, node, 1);
+}
+
+/**
+ * @brief Checks whether nodes can move between two queues by relinking
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Queue to compare with
+ * @return true if this queue's allocator can free other's nodes
+ */
+template<class T, class Allocator>
+bool Queue<T, Allocator>::shares_nodes_with(const Queue &other) const noexcept {
+	if constexpr (node_traits::is_always_equal::value)
+		return true;
+	else
+		return this == &other || alloc_ == other.alloc_;
+}
 
 #endif
\ No newline at end of file
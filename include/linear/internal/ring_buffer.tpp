@@ -0,0 +1,980 @@
+/**
+ * @file ring_buffer.tpp
+ * @brief Implementation of RingBuffer template class methods
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2025-01-28
+ */
+
+#ifndef RING_BUFFER_TPP
+#define RING_BUFFER_TPP
+
+#include "../ring_buffer.hpp"
+
+/**
+ * @brief Default iterator constructor
+ * 
+ * @details Constructs a singular iterator that is not attached to any
+ * ring buffer.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, std::size_t N, class Allocator>
+template<bool IsConst>
+RingBuffer<T, N, Allocator>::BasicIterator<IsConst>::BasicIterator() noexcept : data_(nullptr), capacity_(0), head_(0), position_(0) {}
+
+/**
+ * @brief Iterator constructor
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] data Pointer to buffer
+ * @param[in] capacity Buffer capacity
+ * @param[in] head Index of the oldest element
+ * @param[in] position Logical position in iteration
+ */
+template<class T, std::size_t N, class Allocator>
+template<bool IsConst>
+RingBuffer<T, N, Allocator>::BasicIterator<IsConst>::BasicIterator(pointer data, size_t capacity, size_t head, size_t position) noexcept
+	: data_(data), capacity_(capacity), head_(head), position_(position) {}
+
+/**
+ * @brief Converting constructor
+ * 
+ * @details Copies a mutable iterator. For the const instantiation this
+ * is the conversion from iterator to const_iterator.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Mutable iterator to copy
+ */
+template<class T, std::size_t N, class Allocator>
+template<bool IsConst>
+RingBuffer<T, N, Allocator>::BasicIterator<IsConst>::BasicIterator(const BasicIterator<false>& other) noexcept
+	: data_(other.data_), capacity_(other.capacity_), head_(other.head_), position_(other.position_) {}
+
+/**
+ * @brief Dereference operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Reference to element pointed to by iterator
+ */
+template<class T, std::size_t N, class Allocator>
+template<bool IsConst>
+typename RingBuffer<T, N, Allocator>::template BasicIterator<IsConst>::reference RingBuffer<T, N, Allocator>::BasicIterator<IsConst>::operator*() const {
+	return *address();
+}
+
+/**
+ * @brief Member access operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Pointer to element pointed to by iterator
+ */
+template<class T, std::size_t N, class Allocator>
+template<bool IsConst>
+typename RingBuffer<T, N, Allocator>::template BasicIterator<IsConst>::pointer RingBuffer<T, N, Allocator>::BasicIterator<IsConst>::operator->() const {
+	return address();
+}
+
+/**
+ * @brief Subscript operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] offset Distance from the current position
+ * @return Reference to the element at that position
+ */
+template<class T, std::size_t N, class Allocator>
+template<bool IsConst>
+typename RingBuffer<T, N, Allocator>::template BasicIterator<IsConst>::reference RingBuffer<T, N, Allocator>::BasicIterator<IsConst>::operator[](difference_type offset) const {
+	return *(*this + offset);
+}
+
+/**
+ * @brief Prefix increment operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Reference to this iterator after increment
+ */
+template<class T, std::size_t N, class Allocator>
+template<bool IsConst>
+typename RingBuffer<T, N, Allocator>::template BasicIterator<IsConst>& RingBuffer<T, N, Allocator>::BasicIterator<IsConst>::operator++() {
+	++position_;
+	return *this;
+}
+
+/**
+ * @brief Postfix increment operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Copy of the iterator before increment
+ */
+template<class T, std::size_t N, class Allocator>
+template<bool IsConst>
+typename RingBuffer<T, N, Allocator>::template BasicIterator<IsConst> RingBuffer<T, N, Allocator>::BasicIterator<IsConst>::operator++(int) {
+	BasicIterator previous = *this;
+	++position_;
+	return previous;
+}
+
+/**
+ * @brief Prefix decrement operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Reference to this iterator after decrement
+ */
+template<class T, std::size_t N, class Allocator>
+template<bool IsConst>
+typename RingBuffer<T, N, Allocator>::template BasicIterator<IsConst>& RingBuffer<T, N, Allocator>::BasicIterator<IsConst>::operator--() {
+	--position_;
+	return *this;
+}
+
+/**
+ * @brief Postfix decrement operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Copy of the iterator before decrement
+ */
+template<class T, std::size_t N, class Allocator>
+template<bool IsConst>
+typename RingBuffer<T, N, Allocator>::template BasicIterator<IsConst> RingBuffer<T, N, Allocator>::BasicIterator<IsConst>::operator--(int) {
+	BasicIterator previous = *this;
+	--position_;
+	return previous;
+}
+
+/**
+ * @brief Compound addition operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] offset Number of positions to advance (may be negative)
+ * @return Reference to this iterator
+ */
+template<class T, std::size_t N, class Allocator>
+template<bool IsConst>
+typename RingBuffer<T, N, Allocator>::template BasicIterator<IsConst>& RingBuffer<T, N, Allocator>::BasicIterator<IsConst>::operator+=(difference_type offset) {
+	position_ += static_cast<size_t>(offset);
+	return *this;
+}
+
+/**
+ * @brief Compound subtraction operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] offset Number of positions to move back (may be negative)
+ * @return Reference to this iterator
+ */
+template<class T, std::size_t N, class Allocator>
+template<bool IsConst>
+typename RingBuffer<T, N, Allocator>::template BasicIterator<IsConst>& RingBuffer<T, N, Allocator>::BasicIterator<IsConst>::operator-=(difference_type offset) {
+	position_ -= static_cast<size_t>(offset);
+	return *this;
+}
+
+/**
+ * @brief Addition operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] offset Number of positions to advance (may be negative)
+ * @return Iterator offset positions after this one
+ */
+template<class T, std::size_t N, class Allocator>
+template<bool IsConst>
+typename RingBuffer<T, N, Allocator>::template BasicIterator<IsConst> RingBuffer<T, N, Allocator>::BasicIterator<IsConst>::operator+(difference_type offset) const {
+	BasicIterator result = *this;
+	return result += offset;
+}
+
+/**
+ * @brief Subtraction operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] offset Number of positions to move back (may be negative)
+ * @return Iterator offset positions before this one
+ */
+template<class T, std::size_t N, class Allocator>
+template<bool IsConst>
+typename RingBuffer<T, N, Allocator>::template BasicIterator<IsConst> RingBuffer<T, N, Allocator>::BasicIterator<IsConst>::operator-(difference_type offset) const {
+	BasicIterator result = *this;
+	return result -= offset;
+}
+
+/**
+ * @brief Distance operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Iterator into the same ring buffer
+ * @return Signed distance between the two positions
+ */
+template<class T, std::size_t N, class Allocator>
+template<bool IsConst>
+template<bool OtherConst>
+typename RingBuffer<T, N, Allocator>::template BasicIterator<IsConst>::difference_type RingBuffer<T, N, Allocator>::BasicIterator<IsConst>::operator-(const BasicIterator<OtherConst>& other) const {
+	return static_cast<difference_type>(position_) - static_cast<difference_type>(other.position_);
+}
+
+/**
+ * @brief Inequality comparison operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Iterator into the same ring buffer
+ * @return Result of comparing the two positions
+ */
+template<class T, std::size_t N, class Allocator>
+template<bool IsConst>
+template<bool OtherConst>
+bool RingBuffer<T, N, Allocator>::BasicIterator<IsConst>::operator!=(const BasicIterator<OtherConst>& other) const {
+	return position_ != other.position_;
+}
+
+/**
+ * @brief Equality comparison operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Iterator into the same ring buffer
+ * @return Result of comparing the two positions
+ */
+template<class T, std::size_t N, class Allocator>
+template<bool IsConst>
+template<bool OtherConst>
+bool RingBuffer<T, N, Allocator>::BasicIterator<IsConst>::operator==(const BasicIterator<OtherConst>& other) const {
+	return position_ == other.position_;
+}
+
+/**
+ * @brief Less-than comparison operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Iterator into the same ring buffer
+ * @return Result of comparing the two positions
+ */
+template<class T, std::size_t N, class Allocator>
+template<bool IsConst>
+template<bool OtherConst>
+bool RingBuffer<T, N, Allocator>::BasicIterator<IsConst>::operator<(const BasicIterator<OtherConst>& other) const {
+	return position_ < other.position_;
+}
+
+/**
+ * @brief Greater-than comparison operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Iterator into the same ring buffer
+ * @return Result of comparing the two positions
+ */
+template<class T, std::size_t N, class Allocator>
+template<bool IsConst>
+template<bool OtherConst>
+bool RingBuffer<T, N, Allocator>::BasicIterator<IsConst>::operator>(const BasicIterator<OtherConst>& other) const {
+	return position_ > other.position_;
+}
+
+/**
+ * @brief Less-or-equal comparison operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Iterator into the same ring buffer
+ * @return Result of comparing the two positions
+ */
+template<class T, std::size_t N, class Allocator>
+template<bool IsConst>
+template<bool OtherConst>
+bool RingBuffer<T, N, Allocator>::BasicIterator<IsConst>::operator<=(const BasicIterator<OtherConst>& other) const {
+	return position_ <= other.position_;
+}
+
+/**
+ * @brief Greater-or-equal comparison operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Iterator into the same ring buffer
+ * @return Result of comparing the two positions
+ */
+template<class T, std::size_t N, class Allocator>
+template<bool IsConst>
+template<bool OtherConst>
+bool RingBuffer<T, N, Allocator>::BasicIterator<IsConst>::operator>=(const BasicIterator<OtherConst>& other) const {
+	return position_ >= other.position_;
+}
+
+/**
+ * @brief Maps the logical position to an element address
+ * 
+ * @details The head is below capacity and the position at most the
+ * size, so a single conditional subtraction wraps the index.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Pointer to the element at the current position
+ */
+template<class T, std::size_t N, class Allocator>
+template<bool IsConst>
+typename RingBuffer<T, N, Allocator>::template BasicIterator<IsConst>::pointer RingBuffer<T, N, Allocator>::BasicIterator<IsConst>::address() const {
+	size_t slot = head_ + position_;
+	return data_ + (slot >= capacity_ ? slot - capacity_ : slot);
+}
+
+/**
+ * @brief Constructs an empty fixed-capacity ring buffer
+ * 
+ * @details Only available when N is fixed. The elements are stored
+ * inside the object, so nothing is allocated.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] mode Behaviour when pushing into a full buffer
+ */
+template<class T, std::size_t N, class Allocator>
+RingBuffer<T, N, Allocator>::RingBuffer(RingBufferMode mode) noexcept
+	: data_(nullptr), capacity_(N), head_(0), size_(0), mode_(mode), alloc_() {
+	static_assert(fixed_capacity, "A run-time sized RingBuffer needs a capacity");
+}
+
+/**
+ * @brief Constructs an empty run-time sized ring buffer
+ * 
+ * @details Only available when N is dynamic_capacity. Allocates the
+ * buffer for capacity elements; it is the only allocation the ring
+ * buffer ever makes.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] capacity Maximum number of elements
+ * @param[in] mode Behaviour when pushing into a full buffer
+ * @param[in] alloc Allocator to use for the buffer
+ */
+template<class T, std::size_t N, class Allocator>
+RingBuffer<T, N, Allocator>::RingBuffer(size_type capacity, RingBufferMode mode, const Allocator &alloc)
+	: data_(nullptr), capacity_(capacity), head_(0), size_(0), mode_(mode), alloc_(alloc) {
+	static_assert(!fixed_capacity, "The capacity of this RingBuffer is fixed by N");
+	if (capacity_ > 0)
+		data_ = alloc_traits::allocate(alloc_, capacity_);
+}
+
+/**
+ * @brief Copy constructor
+ * 
+ * @details Copies the elements oldest first, along with the capacity
+ * and mode. The copy starts unwrapped at the beginning of its buffer.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Ring buffer to copy from
+ */
+template<class T, std::size_t N, class Allocator>
+RingBuffer<T, N, Allocator>::RingBuffer(const RingBuffer &other)
+	: data_(nullptr), capacity_(other.capacity_), head_(0), size_(0), mode_(other.mode_),
+	alloc_(alloc_traits::select_on_container_copy_construction(other.alloc_)) {
+	if constexpr (!fixed_capacity) {
+		if (capacity_ > 0)
+			data_ = alloc_traits::allocate(alloc_, capacity_);
+	}
+	try {
+		for (; size_ < other.size_; ++size_)
+			alloc_traits::construct(alloc_, buffer() + size_, other[size_]);
+	}
+	catch (...) {
+		release();
+		throw;
+	}
+}
+
+/**
+ * @brief Move constructor
+ * 
+ * @details A run-time sized buffer is taken over, leaving other with
+ * zero capacity. A fixed-capacity buffer has its elements moved one by
+ * one, leaving other empty.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Ring buffer to move from
+ */
+template<class T, std::size_t N, class Allocator>
+RingBuffer<T, N, Allocator>::RingBuffer(RingBuffer &&other) noexcept(!fixed_capacity || std::is_nothrow_move_constructible_v<T>)
+	: data_(nullptr), capacity_(other.capacity_), head_(0), size_(0), mode_(other.mode_),
+	alloc_(std::move(other.alloc_)) {
+	if constexpr (fixed_capacity)
+		take_elements(other);
+	else {
+		data_ = other.data_;
+		head_ = other.head_;
+		size_ = other.size_;
+		other.data_ = nullptr;
+		other.capacity_ = 0;
+		other.head_ = 0;
+		other.size_ = 0;
+	}
+}
+
+/**
+ * @brief Destructor
+ * 
+ * @details Destroys the elements and frees the run-time sized buffer.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, std::size_t N, class Allocator>
+RingBuffer<T, N, Allocator>::~RingBuffer() {
+	release();
+}
+
+/**
+ * @brief Subscript operator
+ * 
+ * @details Index 0 is the oldest element. The index is only checked
+ * when COLLECTIONS_BOUNDS_CHECK is enabled; use at() for access that
+ * is always checked.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] index Position of element to access (must be < size)
+ * @return Reference to element at specified index
+ * 
+ * @throws std::out_of_range if index >= size and bounds checking is
+ * enabled
+ */
+template<class T, std::size_t N, class Allocator>
+typename RingBuffer<T, N, Allocator>::reference RingBuffer<T, N, Allocator>::operator[](size_type index) {
+#if COLLECTIONS_BOUNDS_CHECK
+	if (index >= size_)
+		throw std::out_of_range("Index out of range");
+#endif
+	return buffer()[wrap(head_ + index)];
+}
+
+/**
+ * @brief Const subscript operator
+ * 
+ * @details Read-only counterpart of operator[], checked only when
+ * COLLECTIONS_BOUNDS_CHECK is enabled.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] index Position of element to access (must be < size)
+ * @return Const reference to element at specified index
+ * 
+ * @throws std::out_of_range if index >= size and bounds checking is
+ * enabled
+ */
+template<class T, std::size_t N, class Allocator>
+typename RingBuffer<T, N, Allocator>::const_reference RingBuffer<T, N, Allocator>::operator[](size_type index) const {
+#if COLLECTIONS_BOUNDS_CHECK
+	if (index >= size_)
+		throw std::out_of_range("Index out of range");
+#endif
+	return buffer()[wrap(head_ + index)];
+}
+
+/**
+ * @brief Copy assignment operator
+ * 
+ * @details Replaces the contents, capacity and mode with those of
+ * other. A run-time sized buffer is reallocated only if the
+ * capacities differ.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Ring buffer to copy from
+ * @return Reference to this ring buffer
+ */
+template<class T, std::size_t N, class Allocator>
+RingBuffer<T, N, Allocator> &RingBuffer<T, N, Allocator>::operator=(const RingBuffer &other) {
+	if (this == &other)
+		return *this;
+	clear();
+	if constexpr (!fixed_capacity) {
+		if (capacity_ != other.capacity_) {
+			pointer new_data = other.capacity_ > 0 ? alloc_traits::allocate(alloc_, other.capacity_) : nullptr;
+			if (data_)
+				alloc_traits::deallocate(alloc_, data_, capacity_);
+			data_ = new_data;
+			capacity_ = other.capacity_;
+		}
+	}
+	mode_ = other.mode_;
+	for (; size_ < other.size_; ++size_)
+		alloc_traits::construct(alloc_, buffer() + size_, other[size_]);
+	return *this;
+}
+
+/**
+ * @brief Move assignment operator
+ * 
+ * @details Like the move constructor, takes over a run-time sized
+ * buffer and moves the elements of a fixed-capacity one. If the
+ * allocator does not propagate and differs from the one of other, the
+ * buffer cannot be taken over: the elements are moved into storage of
+ * the same capacity owned by this allocator, and other is cleared.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Ring buffer to move from
+ * @return Reference to this ring buffer
+ */
+template<class T, std::size_t N, class Allocator>
+RingBuffer<T, N, Allocator> &RingBuffer<T, N, Allocator>::operator=(RingBuffer &&other)
+	noexcept(fixed_capacity ? std::is_nothrow_move_constructible_v<T>
+		: alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value) {
+	if (this == &other)
+		return *this;
+	mode_ = other.mode_;
+	if constexpr (fixed_capacity) {
+		clear();
+		take_elements(other);
+	}
+	else {
+		if constexpr (!alloc_traits::propagate_on_container_move_assignment::value && !alloc_traits::is_always_equal::value) {
+			if (alloc_ != other.alloc_) {
+				clear();
+				if (capacity_ != other.capacity_) {
+					pointer new_data = other.capacity_ > 0 ? alloc_traits::allocate(alloc_, other.capacity_) : nullptr;
+					if (data_)
+						alloc_traits::deallocate(alloc_, data_, capacity_);
+					data_ = new_data;
+					capacity_ = other.capacity_;
+				}
+				take_elements(other);
+				return *this;
+			}
+		}
+		release();
+		if constexpr (alloc_traits::propagate_on_container_move_assignment::value)
+			alloc_ = std::move(other.alloc_);
+		data_ = other.data_;
+		capacity_ = other.capacity_;
+		head_ = other.head_;
+		size_ = other.size_;
+		other.data_ = nullptr;
+		other.capacity_ = 0;
+		other.head_ = 0;
+		other.size_ = 0;
+	}
+	return *this;
+}
+
+/**
+ * @brief Removes all elements
+ * 
+ * @details Destroys every element. Capacity is unchanged.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, std::size_t N, class Allocator>
+void RingBuffer<T, N, Allocator>::clear() noexcept {
+	for (size_type i = 0; i < size_; ++i)
+		alloc_traits::destroy(alloc_, buffer() + wrap(head_ + i));
+	head_ = 0;
+	size_ = 0;
+}
+
+/**
+ * @brief Element access with bounds checking
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] index Position of element to access, 0 being the oldest
+ * @return Reference to element at specified index
+ * 
+ * @throws std::out_of_range if index >= size
+ */
+template<class T, std::size_t N, class Allocator>
+typename RingBuffer<T, N, Allocator>::reference RingBuffer<T, N, Allocator>::at(size_type index) {
+	if (index >= size_)
+		throw std::out_of_range("Index out of range");
+	return buffer()[wrap(head_ + index)];
+}
+
+/**
+ * @brief Const element access with bounds checking
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] index Position of element to access, 0 being the oldest
+ * @return Const reference to element at specified index
+ * 
+ * @throws std::out_of_range if index >= size
+ */
+template<class T, std::size_t N, class Allocator>
+typename RingBuffer<T, N, Allocator>::const_reference RingBuffer<T, N, Allocator>::at(size_type index) const {
+	if (index >= size_)
+		throw std::out_of_range("Index out of range");
+	return buffer()[wrap(head_ + index)];
+}
+
+/**
+ * @brief Returns the oldest element
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Reference to the element pop() would remove next
+ * 
+ * @throws std::out_of_range if the buffer is empty
+ */
+template<class T, std::size_t N, class Allocator>
+typename RingBuffer<T, N, Allocator>::reference RingBuffer<T, N, Allocator>::front() {
+	if (size_ == 0) throw std::out_of_range("Empty ring buffer");
+	return buffer()[head_];
+}
+
+/**
+ * @brief Returns the oldest element
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Const reference to the element pop() would remove next
+ * 
+ * @throws std::out_of_range if the buffer is empty
+ */
+template<class T, std::size_t N, class Allocator>
+typename RingBuffer<T, N, Allocator>::const_reference RingBuffer<T, N, Allocator>::front() const {
+	if (size_ == 0) throw std::out_of_range("Empty ring buffer");
+	return buffer()[head_];
+}
+
+/**
+ * @brief Returns the newest element
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Reference to the most recently pushed element
+ * 
+ * @throws std::out_of_range if the buffer is empty
+ */
+template<class T, std::size_t N, class Allocator>
+typename RingBuffer<T, N, Allocator>::reference RingBuffer<T, N, Allocator>::back() {
+	if (size_ == 0) throw std::out_of_range("Empty ring buffer");
+	return buffer()[wrap(head_ + size_ - 1)];
+}
+
+/**
+ * @brief Returns the newest element
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Const reference to the most recently pushed element
+ * 
+ * @throws std::out_of_range if the buffer is empty
+ */
+template<class T, std::size_t N, class Allocator>
+typename RingBuffer<T, N, Allocator>::const_reference RingBuffer<T, N, Allocator>::back() const {
+	if (size_ == 0) throw std::out_of_range("Empty ring buffer");
+	return buffer()[wrap(head_ + size_ - 1)];
+}
+
+/**
+ * @brief Adds element as the newest
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] value Value to add
+ * @return true if the value was stored, false if the buffer is full
+ * in reject mode
+ */
+template<class T, std::size_t N, class Allocator>
+bool RingBuffer<T, N, Allocator>::push(const_reference value) {
+	return emplace(value);
+}
+
+/**
+ * @brief Moves element in as the newest
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] value Value to move into the buffer
+ * @return true if the value was stored, false if the buffer is full
+ * in reject mode
+ */
+template<class T, std::size_t N, class Allocator>
+bool RingBuffer<T, N, Allocator>::push(value_type &&value) {
+	return emplace(std::move(value));
+}
+
+/**
+ * @brief Constructs element in place as the newest
+ * 
+ * @details If the buffer is full, reject mode leaves it unchanged and
+ * returns false. Overwrite mode builds the new value first and then
+ * move-assigns it over the oldest element, so args may refer to an
+ * element of this buffer. Never allocates.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @tparam Args Types of the constructor arguments
+ * @param[in] args Arguments forwarded to the constructor of T
+ * @return true if the value was stored, false if it was rejected
+ */
+template<class T, std::size_t N, class Allocator>
+template <class... Args>
+bool RingBuffer<T, N, Allocator>::emplace(Args&&... args) {
+	if (size_ < capacity_) {
+		alloc_traits::construct(alloc_, buffer() + wrap(head_ + size_), std::forward<Args>(args)...);
+		++size_;
+		return true;
+	}
+	if (mode_ == RingBufferMode::reject || capacity_ == 0)
+		return false;
+	value_type value(std::forward<Args>(args)...);
+	buffer()[head_] = std::move(value);
+	head_ = wrap(head_ + 1);
+	return true;
+}
+
+/**
+ * @brief Removes and returns the oldest element
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Value of removed element
+ * 
+ * @throws std::out_of_range if the buffer is empty
+ */
+template<class T, std::size_t N, class Allocator>
+typename RingBuffer<T, N, Allocator>::value_type RingBuffer<T, N, Allocator>::pop() {
+	if (size_ == 0) throw std::out_of_range("Empty ring buffer");
+	pointer oldest = buffer() + head_;
+	value_type value = std::move(*oldest);
+	alloc_traits::destroy(alloc_, oldest);
+	head_ = wrap(head_ + 1);
+	--size_;
+	return value;
+}
+
+/**
+ * @brief Removes the oldest element if there is one
+ * 
+ * @details Non-throwing alternative to pop() for polling loops.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[out] out Receives the oldest element by move assignment
+ * @return true if an element was removed, false if the buffer is empty
+ */
+template<class T, std::size_t N, class Allocator>
+bool RingBuffer<T, N, Allocator>::try_pop(reference out) {
+	if (size_ == 0)
+		return false;
+	pointer oldest = buffer() + head_;
+	out = std::move(*oldest);
+	alloc_traits::destroy(alloc_, oldest);
+	head_ = wrap(head_ + 1);
+	--size_;
+	return true;
+}
+
+/**
+ * @brief Returns the number of elements
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Number of elements in the buffer
+ */
+template<class T, std::size_t N, class Allocator>
+typename RingBuffer<T, N, Allocator>::size_type RingBuffer<T, N, Allocator>::size() const noexcept { return size_; }
+
+/**
+ * @brief Returns the maximum number of elements
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Capacity fixed at construction
+ */
+template<class T, std::size_t N, class Allocator>
+typename RingBuffer<T, N, Allocator>::size_type RingBuffer<T, N, Allocator>::capacity() const noexcept { return capacity_; }
+
+/**
+ * @brief Checks if the buffer is empty
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return true if the buffer holds no elements
+ */
+template<class T, std::size_t N, class Allocator>
+bool RingBuffer<T, N, Allocator>::empty() const noexcept { return size_ == 0; }
+
+/**
+ * @brief Checks if the buffer is full
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return true if the next push is rejected or overwrites
+ */
+template<class T, std::size_t N, class Allocator>
+bool RingBuffer<T, N, Allocator>::full() const noexcept { return size_ == capacity_; }
+
+/**
+ * @brief Returns the behaviour when full
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Mode chosen at construction
+ */
+template<class T, std::size_t N, class Allocator>
+RingBufferMode RingBuffer<T, N, Allocator>::mode() const noexcept { return mode_; }
+
+/**
+ * @brief Returns iterator to the oldest element
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Iterator to first element
+ */
+template<class T, std::size_t N, class Allocator>
+typename RingBuffer<T, N, Allocator>::iterator RingBuffer<T, N, Allocator>::begin() noexcept {
+	return Iterator(buffer(), capacity_, head_, 0);
+}
+
+/**
+ * @brief Returns const iterator to the oldest element
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Const iterator to first element
+ */
+template<class T, std::size_t N, class Allocator>
+typename RingBuffer<T, N, Allocator>::const_iterator RingBuffer<T, N, Allocator>::begin() const noexcept {
+	return ConstIterator(buffer(), capacity_, head_, 0);
+}
+
+/**
+ * @brief Returns iterator past the newest element
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Iterator past last element
+ */
+template<class T, std::size_t N, class Allocator>
+typename RingBuffer<T, N, Allocator>::iterator RingBuffer<T, N, Allocator>::end() noexcept {
+	return Iterator(buffer(), capacity_, head_, size_);
+}
+
+/**
+ * @brief Returns const iterator past the newest element
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Const iterator past last element
+ */
+template<class T, std::size_t N, class Allocator>
+typename RingBuffer<T, N, Allocator>::const_iterator RingBuffer<T, N, Allocator>::end() const noexcept {
+	return ConstIterator(buffer(), capacity_, head_, size_);
+}
+
+/**
+ * @brief Returns a copy of the allocator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Copy of the associated allocator
+ */
+template<class T, std::size_t N, class Allocator>
+typename RingBuffer<T, N, Allocator>::allocator_type RingBuffer<T, N, Allocator>::get_allocator() const noexcept { return alloc_; }
+
+/**
+ * @brief Returns the element storage
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Inline storage when N is fixed, otherwise the allocated
+ * buffer
+ */
+template<class T, std::size_t N, class Allocator>
+typename RingBuffer<T, N, Allocator>::pointer RingBuffer<T, N, Allocator>::buffer() noexcept {
+	if constexpr (fixed_capacity)
+		return inline_.data();
+	else
+		return data_;
+}
+
+/**
+ * @brief Returns the element storage
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Inline storage when N is fixed, otherwise the allocated
+ * buffer
+ */
+template<class T, std::size_t N, class Allocator>
+typename RingBuffer<T, N, Allocator>::const_pointer RingBuffer<T, N, Allocator>::buffer() const noexcept {
+	if constexpr (fixed_capacity)
+		return inline_.data();
+	else
+		return data_;
+}
+
+/**
+ * @brief Maps a buffer index that may have run past the end
+ * 
+ * @details Callers pass less than twice the capacity, so one
+ * conditional subtraction is enough. For a fixed N the capacity is a
+ * constant the compiler can fold.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] slot Buffer index below 2 * capacity
+ * @return Equivalent index below capacity
+ */
+template<class T, std::size_t N, class Allocator>
+typename RingBuffer<T, N, Allocator>::size_type RingBuffer<T, N, Allocator>::wrap(size_type slot) const noexcept {
+	if constexpr (fixed_capacity)
+		return slot >= N ? slot - N : slot;
+	else
+		return slot >= capacity_ ? slot - capacity_ : slot;
+}
+
+/**
+ * @brief Moves the elements of another buffer here
+ * 
+ * @details Expects this buffer to be empty and at least as large as
+ * other. The elements are
+ * move-constructed oldest first into the start of the storage and
+ * other is cleared.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in,out] other Buffer to take the elements from
+ */
+template<class T, std::size_t N, class Allocator>
+void RingBuffer<T, N, Allocator>::take_elements(RingBuffer &other) {
+	head_ = 0;
+	for (; size_ < other.size_; ++size_)
+		alloc_traits::construct(alloc_, buffer() + size_, std::move(other[size_]));
+	other.clear();
+}
+
+/**
+ * @brief Destroys all elements and frees the run-time sized buffer
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, std::size_t N, class Allocator>
+void RingBuffer<T, N, Allocator>::release() noexcept {
+	clear();
+	if constexpr (!fixed_capacity) {
+		if (data_)
+			alloc_traits::deallocate(alloc_, data_, capacity_);
+		data_ = nullptr;
+		capacity_ = 0;
+	}
+}
+
+#endif
@@ -0,0 +1,837 @@
+/**
+ * @file skip_list.tpp
+ * @brief Implementation of SkipList template class methods
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef SKIP_LIST_TPP
+#define SKIP_LIST_TPP
+
+#include "../skip_list.hpp"
+
+/**
+ * @brief Node constructor
+ * 
+ * @details Constructs the element from args. The tower is initialized
+ * separately by create_node().
+ * 
+ * @ingroup linear_containers
+ * 
+ * @tparam Args Types of the element constructor arguments
+ * @param[in] levels Height of the tower behind the node
+ * @param[in] args Arguments for the element constructor
+ */
+template<class K, class V, class Compare>
+template<class... Args>
+SkipList<K, V, Compare>::Node::Node(size_type levels, Args&&... args) : value(std::forward<Args>(args)...), height(levels) {}
+
+/**
+ * @brief Returns the tower of links
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Array of height links stored right after the node
+ */
+template<class K, class V, class Compare>
+typename SkipList<K, V, Compare>::Node **SkipList<K, V, Compare>::Node::tower() noexcept {
+	return reinterpret_cast<Node **>(this + 1);
+}
+
+/**
+ * @brief Returns the tower of links
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Read-only array of height links stored right after the node
+ */
+template<class K, class V, class Compare>
+typename SkipList<K, V, Compare>::Node *const *SkipList<K, V, Compare>::Node::tower() const noexcept {
+	return reinterpret_cast<Node *const *>(this + 1);
+}
+
+/**
+ * @brief Default iterator constructor
+ * 
+ * @details Constructs an iterator equal to end().
+ * 
+ * @ingroup linear_containers
+ */
+template<class K, class V, class Compare>
+template<bool IsConst>
+SkipList<K, V, Compare>::BasicIterator<IsConst>::BasicIterator() noexcept : current(nullptr) {}
+
+/**
+ * @brief Iterator constructor
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] node Node to reference, nullptr for end()
+ */
+template<class K, class V, class Compare>
+template<bool IsConst>
+SkipList<K, V, Compare>::BasicIterator<IsConst>::BasicIterator(node_pointer node) noexcept : current(node) {}
+
+/**
+ * @brief Converting constructor
+ * 
+ * @details Copies a mutable iterator. For the const instantiation this
+ * is the conversion from iterator to const_iterator.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Mutable iterator to copy
+ */
+template<class K, class V, class Compare>
+template<bool IsConst>
+SkipList<K, V, Compare>::BasicIterator<IsConst>::BasicIterator(const BasicIterator<false>& other) noexcept : current(other.current) {}
+
+/**
+ * @brief Dereference operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Reference to the key-value pair of the current node
+ */
+template<class K, class V, class Compare>
+template<bool IsConst>
+typename SkipList<K, V, Compare>::template BasicIterator<IsConst>::reference SkipList<K, V, Compare>::BasicIterator<IsConst>::operator*() const {
+	return current->value;
+}
+
+/**
+ * @brief Member access operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Pointer to the key-value pair of the current node
+ */
+template<class K, class V, class Compare>
+template<bool IsConst>
+typename SkipList<K, V, Compare>::template BasicIterator<IsConst>::pointer SkipList<K, V, Compare>::BasicIterator<IsConst>::operator->() const {
+	return &current->value;
+}
+
+/**
+ * @brief Prefix increment operator
+ * 
+ * @details Advances to the element with the next larger key by
+ * following the level 0 link.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Reference to this iterator after increment
+ */
+template<class K, class V, class Compare>
+template<bool IsConst>
+typename SkipList<K, V, Compare>::template BasicIterator<IsConst>& SkipList<K, V, Compare>::BasicIterator<IsConst>::operator++() {
+	if (current) current = current->tower()[0];
+	return *this;
+}
+
+/**
+ * @brief Postfix increment operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Copy of the iterator before increment
+ */
+template<class K, class V, class Compare>
+template<bool IsConst>
+typename SkipList<K, V, Compare>::template BasicIterator<IsConst> SkipList<K, V, Compare>::BasicIterator<IsConst>::operator++(int) {
+	BasicIterator previous = *this;
+	++*this;
+	return previous;
+}
+
+/**
+ * @brief Inequality comparison operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Iterator to compare against
+ * @return true if iterators point to different nodes
+ */
+template<class K, class V, class Compare>
+template<bool IsConst>
+template<bool OtherConst>
+bool SkipList<K, V, Compare>::BasicIterator<IsConst>::operator!=(const BasicIterator<OtherConst>& other) const {
+	return current != other.current;
+}
+
+/**
+ * @brief Equality comparison operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Iterator to compare against
+ * @return true if iterators point to the same node
+ */
+template<class K, class V, class Compare>
+template<bool IsConst>
+template<bool OtherConst>
+bool SkipList<K, V, Compare>::BasicIterator<IsConst>::operator==(const BasicIterator<OtherConst>& other) const {
+	return current == other.current;
+}
+
+/**
+ * @brief Default constructor creating empty map
+ * 
+ * @details No pool is created until the first element is inserted.
+ * 
+ * @ingroup linear_containers
+ */
+template<class K, class V, class Compare>
+SkipList<K, V, Compare>::SkipList() : SkipList(Compare()) {}
+
+/**
+ * @brief Constructs an empty map ordered by the given comparison
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] comp Key ordering
+ */
+template<class K, class V, class Compare>
+SkipList<K, V, Compare>::SkipList(const Compare &comp)
+	: head_(), pools_(), size_(0), level_(0), seed_(0x9E3779B97F4A7C15ULL), comp_(comp) {}
+
+/**
+ * @brief Copy constructor
+ * 
+ * @details Copies the elements in order, giving every copy the tower
+ * height of its original, so the copy is built in O(n) without any
+ * searching. The copy gets pools of its own.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Map to copy from
+ */
+template<class K, class V, class Compare>
+SkipList<K, V, Compare>::SkipList(const SkipList &other) : SkipList(other.comp_) {
+	seed_ = other.seed_;
+	try {
+		append_copy(other);
+	}
+	catch (...) {
+		clear();
+		throw;
+	}
+}
+
+/**
+ * @brief Move constructor
+ * 
+ * @details Takes over the nodes and pools of other in O(max_level),
+ * leaving other empty.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in,out] other Map to move from
+ */
+template<class K, class V, class Compare>
+SkipList<K, V, Compare>::SkipList(SkipList &&other) noexcept : SkipList(other.comp_) {
+	take(other);
+}
+
+/**
+ * @brief Destructor
+ * 
+ * @details Destroys all elements; the pools then release their chunks.
+ * 
+ * @ingroup linear_containers
+ */
+template<class K, class V, class Compare>
+SkipList<K, V, Compare>::~SkipList() {
+	clear();
+}
+
+/**
+ * @brief Copy assignment operator
+ * 
+ * @details Builds the copy first, so this map is left unchanged if
+ * copying throws.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Map to copy from
+ * @return Reference to this map
+ */
+template<class K, class V, class Compare>
+SkipList<K, V, Compare> &SkipList<K, V, Compare>::operator=(const SkipList &other) {
+	if (this != &other) {
+		SkipList copy(other);
+		clear();
+		comp_ = copy.comp_;
+		take(copy);
+	}
+	return *this;
+}
+
+/**
+ * @brief Move assignment operator
+ * 
+ * @details Destroys the current elements and takes over the nodes and
+ * pools of other, leaving other empty.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in,out] other Map to move from
+ * @return Reference to this map
+ */
+template<class K, class V, class Compare>
+SkipList<K, V, Compare> &SkipList<K, V, Compare>::operator=(SkipList &&other) noexcept {
+	if (this != &other) {
+		clear();
+		comp_ = other.comp_;
+		take(other);
+	}
+	return *this;
+}
+
+/**
+ * @brief Accesses or inserts the value mapped to a key
+ * 
+ * @details Inserts a value-initialized element if key is not present.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] key Key to look up
+ * @return Reference to the mapped value
+ */
+template<class K, class V, class Compare>
+typename SkipList<K, V, Compare>::mapped_type &SkipList<K, V, Compare>::operator[](const key_type &key) {
+	Node **update[max_level];
+	Node *node = lower_node(key, update);
+	if (node && equal_keys(node->value.first, key))
+		return node->value.second;
+	node = create_node(random_height(), std::piecewise_construct, std::forward_as_tuple(key), std::tuple<>());
+	link(node, update);
+	return node->value.second;
+}
+
+/**
+ * @brief Removes all elements
+ * 
+ * @details Destroys every element and returns its block to the pools,
+ * which keep their chunks for later insertions.
+ * 
+ * @ingroup linear_containers
+ */
+template<class K, class V, class Compare>
+void SkipList<K, V, Compare>::clear() noexcept {
+	Node *cur = head_[0];
+	while (cur) {
+		Node *next = cur->tower()[0];
+		destroy_node(cur);
+		cur = next;
+	}
+	for (size_type i = 0; i < max_level; ++i)
+		head_[i] = nullptr;
+	size_ = 0;
+	level_ = 0;
+}
+
+/**
+ * @brief Accesses the value mapped to a key
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] key Key to look up
+ * @return Reference to the mapped value
+ * 
+ * @throws std::out_of_range If key is not present
+ */
+template<class K, class V, class Compare>
+typename SkipList<K, V, Compare>::mapped_type &SkipList<K, V, Compare>::at(const key_type &key) {
+	iterator found = find(key);
+	if (found == end()) throw std::out_of_range("Key not found");
+	return found->second;
+}
+
+/**
+ * @brief Accesses the value mapped to a key
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] key Key to look up
+ * @return Const reference to the mapped value
+ * 
+ * @throws std::out_of_range If key is not present
+ */
+template<class K, class V, class Compare>
+const typename SkipList<K, V, Compare>::mapped_type &SkipList<K, V, Compare>::at(const key_type &key) const {
+	const_iterator found = find(key);
+	if (found == end()) throw std::out_of_range("Key not found");
+	return found->second;
+}
+
+/**
+ * @brief Inserts a key-value pair if the key is not present
+ * 
+ * @details Searches once, recording the last node before key on every
+ * level, and links the new node behind those nodes up to its randomly
+ * drawn height. Nothing changes if allocation or copying throws.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] key Key to insert
+ * @param[in] value Value to map key to
+ * @return Iterator to the element with key, and whether it was
+ * inserted
+ */
+template<class K, class V, class Compare>
+std::pair<typename SkipList<K, V, Compare>::iterator, bool> SkipList<K, V, Compare>::insert(const key_type &key, const mapped_type &value) {
+	Node **update[max_level];
+	Node *node = lower_node(key, update);
+	if (node && equal_keys(node->value.first, key))
+		return std::make_pair(Iterator(node), false);
+	node = create_node(random_height(), key, value);
+	link(node, update);
+	return std::make_pair(Iterator(node), true);
+}
+
+/**
+ * @brief Removes the element with a key
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] key Key to remove
+ * @return Number of elements removed (0 or 1)
+ */
+template<class K, class V, class Compare>
+typename SkipList<K, V, Compare>::size_type SkipList<K, V, Compare>::erase(const key_type &key) {
+	Node **update[max_level];
+	Node *node = lower_node(key, update);
+	if (!node || !equal_keys(node->value.first, key))
+		return 0;
+	unlink(node, update);
+	destroy_node(node);
+	return 1;
+}
+
+/**
+ * @brief Removes the element at an iterator position
+ * 
+ * @details Searches for the element's predecessors in expected
+ * O(log n), as a singly linked tower does not know them.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] pos Element to remove
+ * @return Iterator to the element that followed the removed one
+ * 
+ * @throws std::out_of_range If pos is end()
+ */
+template<class K, class V, class Compare>
+typename SkipList<K, V, Compare>::iterator SkipList<K, V, Compare>::erase(const_iterator pos) {
+	Node *node = const_cast<Node *>(pos.current);
+	if (!node) throw std::out_of_range("erase position is end()");
+	Node **update[max_level];
+	lower_node(node->value.first, update);
+	Node *next = node->tower()[0];
+	unlink(node, update);
+	destroy_node(node);
+	return Iterator(next);
+}
+
+/**
+ * @brief Finds the element with a key
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] key Key to look up
+ * @return Iterator to the element, or end() if key is not present
+ */
+template<class K, class V, class Compare>
+typename SkipList<K, V, Compare>::iterator SkipList<K, V, Compare>::find(const key_type &key) {
+	Node *node = lower_node(key, nullptr);
+	return Iterator(node && equal_keys(node->value.first, key) ? node : nullptr);
+}
+
+/**
+ * @brief Finds the element with a key
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] key Key to look up
+ * @return Const iterator to the element, or end() if key is not present
+ */
+template<class K, class V, class Compare>
+typename SkipList<K, V, Compare>::const_iterator SkipList<K, V, Compare>::find(const key_type &key) const {
+	const Node *node = lower_node(key, nullptr);
+	return ConstIterator(node && equal_keys(node->value.first, key) ? node : nullptr);
+}
+
+/**
+ * @brief Checks whether a key is present
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] key Key to look up
+ * @return true if an element with key exists
+ */
+template<class K, class V, class Compare>
+bool SkipList<K, V, Compare>::contains(const key_type &key) const { return find(key) != end(); }
+
+/**
+ * @brief Finds the first element not ordered before a key
+ * 
+ * @details Iterating from lower_bound(a) to lower_bound(b) visits the
+ * keys in [a, b).
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] key Key to compare against
+ * @return Iterator to the first element with key >= key, or end()
+ */
+template<class K, class V, class Compare>
+typename SkipList<K, V, Compare>::iterator SkipList<K, V, Compare>::lower_bound(const key_type &key) {
+	return Iterator(lower_node(key, nullptr));
+}
+
+/**
+ * @brief Finds the first element not ordered before a key
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] key Key to compare against
+ * @return Const iterator to the first element with key >= key, or end()
+ */
+template<class K, class V, class Compare>
+typename SkipList<K, V, Compare>::const_iterator SkipList<K, V, Compare>::lower_bound(const key_type &key) const {
+	return ConstIterator(lower_node(key, nullptr));
+}
+
+/**
+ * @brief Finds the first element ordered after a key
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] key Key to compare against
+ * @return Iterator to the first element with key > key, or end()
+ */
+template<class K, class V, class Compare>
+typename SkipList<K, V, Compare>::iterator SkipList<K, V, Compare>::upper_bound(const key_type &key) {
+	return Iterator(upper_node(key));
+}
+
+/**
+ * @brief Finds the first element ordered after a key
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] key Key to compare against
+ * @return Const iterator to the first element with key > key, or end()
+ */
+template<class K, class V, class Compare>
+typename SkipList<K, V, Compare>::const_iterator SkipList<K, V, Compare>::upper_bound(const key_type &key) const {
+	return ConstIterator(upper_node(key));
+}
+
+/**
+ * @brief Returns number of elements
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Number of elements in the map
+ */
+template<class K, class V, class Compare>
+typename SkipList<K, V, Compare>::size_type SkipList<K, V, Compare>::size() const noexcept { return size_; }
+
+/**
+ * @brief Checks if the map is empty
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return true if the map has no elements, false otherwise
+ */
+template<class K, class V, class Compare>
+bool SkipList<K, V, Compare>::empty() const noexcept { return size_ == 0; }
+
+/**
+ * @brief Returns the number of levels in use
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Height of the tallest tower, 0 when empty
+ */
+template<class K, class V, class Compare>
+typename SkipList<K, V, Compare>::size_type SkipList<K, V, Compare>::level() const noexcept { return level_; }
+
+/**
+ * @brief Returns the key ordering
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Copy of the comparison object
+ */
+template<class K, class V, class Compare>
+typename SkipList<K, V, Compare>::key_compare SkipList<K, V, Compare>::key_comp() const { return comp_; }
+
+/**
+ * @brief Returns iterator to the smallest key
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Iterator to first element
+ */
+template<class K, class V, class Compare>
+typename SkipList<K, V, Compare>::iterator SkipList<K, V, Compare>::begin() noexcept { return Iterator(head_[0]); }
+
+/**
+ * @brief Returns iterator past the largest key
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Iterator to end
+ */
+template<class K, class V, class Compare>
+typename SkipList<K, V, Compare>::iterator SkipList<K, V, Compare>::end() noexcept { return Iterator(); }
+
+/**
+ * @brief Returns const iterator to the smallest key
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Const iterator to first element
+ */
+template<class K, class V, class Compare>
+typename SkipList<K, V, Compare>::const_iterator SkipList<K, V, Compare>::begin() const noexcept { return ConstIterator(head_[0]); }
+
+/**
+ * @brief Returns const iterator past the largest key
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Const iterator to end
+ */
+template<class K, class V, class Compare>
+typename SkipList<K, V, Compare>::const_iterator SkipList<K, V, Compare>::end() const noexcept { return ConstIterator(); }
+
+/**
+ * @brief Finds the first node not ordered before a key
+ * 
+ * @details Descends from the highest level in use, moving right while
+ * the next node's key is smaller than key.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] key Key to search for
+ * @param[out] update If not nullptr, receives for every level in use
+ * the tower (or the head) whose link on that level points at or past
+ * key
+ * @return First node with key >= key, or nullptr
+ */
+template<class K, class V, class Compare>
+typename SkipList<K, V, Compare>::Node *SkipList<K, V, Compare>::lower_node(const key_type &key, Node **update[]) const {
+	Node **links = const_cast<Node **>(head_);
+	for (size_type i = level_; i-- > 0;) {
+		while (links[i] && comp_(links[i]->value.first, key))
+			links = links[i]->tower();
+		if (update)
+			update[i] = links;
+	}
+	return links[0];
+}
+
+/**
+ * @brief Finds the first node ordered after a key
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] key Key to search for
+ * @return First node with key > key, or nullptr
+ */
+template<class K, class V, class Compare>
+typename SkipList<K, V, Compare>::Node *SkipList<K, V, Compare>::upper_node(const key_type &key) const {
+	Node **links = const_cast<Node **>(head_);
+	for (size_type i = level_; i-- > 0;) {
+		while (links[i] && !comp_(key, links[i]->value.first))
+			links = links[i]->tower();
+	}
+	return links[0];
+}
+
+/**
+ * @brief Allocates and constructs a node with an empty tower
+ * 
+ * @details Takes a block from the pool for the given height, creating
+ * the pool on first use. Taller towers are rarer, so their pools start
+ * with smaller chunks.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @tparam Args Types of the element constructor arguments
+ * @param[in] height Number of levels the node takes part in
+ * @param[in] args Arguments for the element constructor
+ * @return Pointer to the new, unlinked node
+ * 
+ * @throws Anything thrown by the pool or the element constructor; the
+ * block is returned to the pool in that case
+ */
+template<class K, class V, class Compare>
+template<class... Args>
+typename SkipList<K, V, Compare>::Node *SkipList<K, V, Compare>::create_node(size_type height, Args&&... args) {
+	static_assert(sizeof(Node) % alignof(Node *) == 0, "tower links must be aligned behind the node");
+	std::unique_ptr<NodePool> &pool = pools_[height - 1];
+	if (!pool) {
+		size_type first_chunk = 64 >> (2 * (height - 1) < 6 ? 2 * (height - 1) : 6);
+		pool = std::make_unique<NodePool>(sizeof(Node) + height * sizeof(Node *), alignof(Node), first_chunk);
+	}
+	void *block = pool->allocate();
+	Node *node;
+	try {
+		node = ::new (block) Node(height, std::forward<Args>(args)...);
+	}
+	catch (...) {
+		pool->deallocate(block);
+		throw;
+	}
+	for (size_type i = 0; i < height; ++i)
+		::new (static_cast<void *>(node->tower() + i)) Node *(nullptr);
+	return node;
+}
+
+/**
+ * @brief Destroys a node and returns its block to the pool
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] node Unlinked node obtained from create_node()
+ */
+template<class K, class V, class Compare>
+void SkipList<K, V, Compare>::destroy_node(Node *node) noexcept {
+	size_type height = node->height;
+	node->~Node();
+	pools_[height - 1]->deallocate(node);
+}
+
+/**
+ * @brief Links a new node behind the towers found by lower_node()
+ * 
+ * @details Levels above the ones in use are linked from the head.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] node Unlinked node
+ * @param[in] update Towers recorded by lower_node() for node's key
+ */
+template<class K, class V, class Compare>
+void SkipList<K, V, Compare>::link(Node *node, Node **update[]) noexcept {
+	for (size_type i = 0; i < node->height; ++i) {
+		Node **links = i < level_ ? update[i] : head_;
+		node->tower()[i] = links[i];
+		links[i] = node;
+	}
+	if (node->height > level_)
+		level_ = node->height;
+	size_++;
+}
+
+/**
+ * @brief Unlinks a node from every level it takes part in
+ * 
+ * @details Drops levels that become empty.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] node Linked node
+ * @param[in] update Towers recorded by lower_node() for node's key
+ */
+template<class K, class V, class Compare>
+void SkipList<K, V, Compare>::unlink(Node *node, Node **update[]) noexcept {
+	for (size_type i = 0; i < node->height; ++i)
+		update[i][i] = node->tower()[i];
+	while (level_ > 0 && !head_[level_ - 1])
+		--level_;
+	size_--;
+}
+
+/**
+ * @brief Appends copies of all elements of another map
+ * 
+ * @details Keeps the last tower on every level, so each copy is linked
+ * in O(height).
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Map to copy from, while this map is empty
+ */
+template<class K, class V, class Compare>
+void SkipList<K, V, Compare>::append_copy(const SkipList &other) {
+	Node **last[max_level];
+	for (size_type i = 0; i < max_level; ++i)
+		last[i] = head_;
+	for (const Node *cur = other.head_[0]; cur; cur = cur->tower()[0]) {
+		Node *node = create_node(cur->height, cur->value);
+		for (size_type i = 0; i < node->height; ++i) {
+			last[i][i] = node;
+			last[i] = node->tower();
+		}
+		if (node->height > level_)
+			level_ = node->height;
+		size_++;
+	}
+}
+
+/**
+ * @brief Takes over the nodes and pools of another map
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in,out] other Map to empty, while this map is empty
+ */
+template<class K, class V, class Compare>
+void SkipList<K, V, Compare>::take(SkipList &other) noexcept {
+	for (size_type i = 0; i < max_level; ++i) {
+		head_[i] = other.head_[i];
+		other.head_[i] = nullptr;
+		pools_[i] = std::move(other.pools_[i]);
+	}
+	size_ = other.size_;
+	level_ = other.level_;
+	seed_ = other.seed_;
+	other.size_ = 0;
+	other.level_ = 0;
+}
+
+/**
+ * @brief Draws the height of a new tower
+ * 
+ * @details Advances a xorshift64* generator and counts pairs of zero
+ * bits, so a tower reaches height h + 1 with probability 4^-h.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Height between 1 and max_level
+ */
+template<class K, class V, class Compare>
+typename SkipList<K, V, Compare>::size_type SkipList<K, V, Compare>::random_height() noexcept {
+	seed_ ^= seed_ >> 12;
+	seed_ ^= seed_ << 25;
+	seed_ ^= seed_ >> 27;
+	std::uint64_t bits = seed_ * 0x2545F4914F6CDD1DULL;
+	size_type height = 1;
+	while (height < max_level && (bits & 3) == 0) {
+		++height;
+		bits >>= 2;
+	}
+	return height;
+}
+
+/**
+ * @brief Checks two keys for equivalence under the ordering
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] a First key
+ * @param[in] b Second key
+ * @return true if neither key is ordered before the other
+ */
+template<class K, class V, class Compare>
+bool SkipList<K, V, Compare>::equal_keys(const key_type &a, const key_type &b) const {
+	return !comp_(a, b) && !comp_(b, a);
+}
+
+#endif
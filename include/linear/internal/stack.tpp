@@ -19,42 +19,78 @@
  * 
  * @ingroup linear_containers
  */
-template<class T>
-Stack<T>::Stack() noexcept : data_(nullptr), size_(0), capacity_(0) {}
+template<class T, class Allocator, class Policy>
+Stack<T, Allocator, Policy>::Stack() noexcept : data_(nullptr), size_(0), capacity_(0), alloc_() {}
+
+/**
+ * @brief Constructs empty stack using the given allocator
+ * 
+ * @details Initializes an empty stack that will obtain its storage
+ * from a copy of alloc. No memory allocation is performed.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] alloc Allocator to use for all storage
+ */
+template<class T, class Allocator, class Policy>
+Stack<T, Allocator, Policy>::Stack(const Allocator &alloc) noexcept : data_(nullptr), size_(0), capacity_(0), alloc_(alloc) {}
 
 /**
  * @brief Constructs stack with count copies of value
  * 
- * @details Allocates memory for count elements and initializes each
- * element with a copy of the provided value.
+ * @details Allocates raw storage for count elements and
+ * copy-constructs each element in place from the provided value.
  * 
  * @ingroup linear_containers
  * 
  * @param[in] count Number of elements to create
  * @param[in] value Value to initialize elements with
+ * @param[in] alloc Allocator to use for all storage
  */
-template<class T>
-Stack<T>::Stack(size_type count, const T &value) : size_(count), capacity_(count) {
-	data_ = new T[capacity_];
-	for (size_type i = 0; i < size_; ++i)
-		data_[i] = value;
+template<class T, class Allocator, class Policy>
+Stack<T, Allocator, Policy>::Stack(size_type count, const T &value, const Allocator &alloc)
+	: data_(nullptr), size_(0), capacity_(0), alloc_(alloc) {
+	if (count == 0)
+		return;
+	data_ = alloc_traits::allocate(alloc_, count);
+	capacity_ = count;
+	try {
+		for (; size_ < count; ++size_)
+			alloc_traits::construct(alloc_, data_ + size_, value);
+	}
+	catch (...) {
+		release();
+		throw;
+	}
 }
 
 /**
  * @brief Copy constructor
  * 
- * @details Creates a deep copy of another stack, allocating new memory
- * and copying all elements.
+ * @details Creates a deep copy of another stack, allocating new
+ * storage and copy-constructing only the live elements. The new stack
+ * has the same size and capacity as the source.
  * 
  * @ingroup linear_containers
  * 
  * @param[in] other Stack to copy from
  */
-template<class T>
-Stack<T>::Stack(const Stack &other) : size_(other.size_), capacity_(other.capacity_) {
-	data_ = new T[capacity_];
-	for (size_type i = 0; i < size_; ++i)
-		data_[i] = other.data_[i];
+template<class T, class Allocator, class Policy>
+Stack<T, Allocator, Policy>::Stack(const Stack &other)
+	: data_(nullptr), size_(0), capacity_(0),
+	alloc_(alloc_traits::select_on_container_copy_construction(other.alloc_)) {
+	if (other.capacity_ == 0)
+		return;
+	data_ = alloc_traits::allocate(alloc_, other.capacity_);
+	capacity_ = other.capacity_;
+	try {
+		for (; size_ < other.size_; ++size_)
+			alloc_traits::construct(alloc_, data_ + size_, other.data_[size_]);
+	}
+	catch (...) {
+		release();
+		throw;
+	}
 }
 
 /**
@@ -67,8 +103,9 @@ Stack<T>::Stack(const Stack &other) : size_(other.size_), capacity_(other.capaci
  * 
  * @param[in] other Stack to move from (rvalue reference)
  */
-template<class T>
-Stack<T>::Stack(Stack &&other) noexcept : data_(other.data_), size_(other.size_), capacity_(other.capacity_) {
+template<class T, class Allocator, class Policy>
+Stack<T, Allocator, Policy>::Stack(Stack &&other) noexcept
+	: data_(other.data_), size_(other.size_), capacity_(other.capacity_), alloc_(std::move(other.alloc_)) {
 	other.data_ = nullptr;
 	other.size_ = 0;
 	other.capacity_ = 0;
@@ -85,67 +122,108 @@ Stack<T>::Stack(Stack &&other) noexcept : data_(other.data_), size_(other.size_)
  * @tparam Container Type of source container
  * @param[in] other Container to copy elements from
  */
-template<class T>
+template<class T, class Allocator, class Policy>
 template <class Container>
-Stack<T>::Stack(const Container& other) : size_(other.size()), capacity_(other.size()) {
-	data_ = new T[capacity_];
-	size_type index = 0;
-	for (const auto& item : other)
-		data_[index++] = item;
+Stack<T, Allocator, Policy>::Stack(const Container& other) : data_(nullptr), size_(0), capacity_(0), alloc_() {
+	if (other.size() == 0)
+		return;
+	data_ = alloc_traits::allocate(alloc_, other.size());
+	capacity_ = other.size();
+	try {
+		for (const auto& item : other) {
+			alloc_traits::construct(alloc_, data_ + size_, item);
+			++size_;
+		}
+	}
+	catch (...) {
+		release();
+		throw;
+	}
 }
 
 /**
  * @brief Destructor
  * 
- * @details Releases all dynamically allocated memory.
+ * @details Destroys the live elements and releases the storage.
  * 
  * @ingroup linear_containers
  */
-template<class T>
-Stack<T>::~Stack() {
-	delete[] data_;
+template<class T, class Allocator, class Policy>
+Stack<T, Allocator, Policy>::~Stack() {
+	release();
 }
 
 /**
- * @brief Subscript operator with bounds checking
+ * @brief Subscript operator
  * 
- * @details Provides access to element at specified index with bounds
- * checking. Throws exception if index is out of range.
+ * @details Provides access to element at specified index. The
+ * index is only checked when COLLECTIONS_BOUNDS_CHECK is enabled (the
+ * default unless NDEBUG is defined); use at() for access that is
+ * always checked.
  * 
  * @ingroup linear_containers
  * 
- * @param[in] index Position of element to access
+ * @param[in] index Position of element to access (must be < size)
  * @return Reference to element at specified position
  * 
- * @throws std::out_of_range If index >= size
+ * @throws std::out_of_range If index >= size and bounds checking is
+ * enabled
+ */
+template<class T, class Allocator, class Policy>
+typename Stack<T, Allocator, Policy>::reference Stack<T, Allocator, Policy>::operator[](size_type index) {
+#if COLLECTIONS_BOUNDS_CHECK
+	if (index >= size_)
+		throw std::out_of_range("Index out of range");
+#endif
+	return data_[index];
+}
+
+/**
+ * @brief Const subscript operator
+ * 
+ * @details Read-only counterpart of operator[], checked only when
+ * COLLECTIONS_BOUNDS_CHECK is enabled.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] index Position of element to access (must be < size)
+ * @return Const reference to element at specified position
+ * 
+ * @throws std::out_of_range If index >= size and bounds checking is
+ * enabled
  */
-template<class T>
-typename Stack<T>::reference Stack<T>::operator[](size_type index) {
+template<class T, class Allocator, class Policy>
+typename Stack<T, Allocator, Policy>::const_reference Stack<T, Allocator, Policy>::operator[](size_type index) const {
+#if COLLECTIONS_BOUNDS_CHECK
 	if (index >= size_)
 		throw std::out_of_range("Index out of range");
+#endif
 	return data_[index];
 }
 
 /**
  * @brief Copy assignment operator
  * 
- * @details Replaces contents with a deep copy of another stack.
- * Handles self-assignment correctly.
+ * @details Replaces contents with a deep copy of another stack. Handles
+ * self-assignment correctly. Existing storage is reused when it is
+ * large enough to hold the source elements.
  * 
  * @ingroup linear_containers
  * 
  * @param[in] other Stack to copy from
  * @return Reference to this stack
  */
-template<class T>
-Stack<T> &Stack<T>::operator=(const Stack &other) {
+template<class T, class Allocator, class Policy>
+Stack<T, Allocator, Policy> &Stack<T, Allocator, Policy>::operator=(const Stack &other) {
 	if (this != &other) {
-		delete[] data_;
-		size_ = other.size_;
-		capacity_ = other.capacity_;
-		data_ = new T[capacity_];
-		for (size_type i = 0; i < size_; ++i)
-			data_[i] = other.data_[i];
+		destroy_elements();
+		if (other.size_ > capacity_) {
+			release();
+			data_ = alloc_traits::allocate(alloc_, other.capacity_);
+			capacity_ = other.capacity_;
+		}
+		for (; size_ < other.size_; ++size_)
+			alloc_traits::construct(alloc_, data_ + size_, other.data_[size_]);
 	}
 	return *this;
 }
@@ -154,17 +232,37 @@ Stack<T> &Stack<T>::operator=(const Stack &other) {
  * @brief Move assignment operator
  * 
  * @details Transfers ownership of resources from another stack without
- * copying. Handles self-assignment. Source stack is left empty.
+ * copying. Handles self-assignment. Source stack is left empty. When
+ * the allocator does not propagate and the two allocators differ, this
+ * stack cannot free other's buffer, so the elements are moved into
+ * storage of its own instead; only that case can throw.
  * 
  * @ingroup linear_containers
  * 
  * @param[in] other Stack to move from (rvalue reference)
  * @return Reference to this stack
  */
-template<class T>
-Stack<T> &Stack<T>::operator=(Stack &&other) noexcept {
+template<class T, class Allocator, class Policy>
+Stack<T, Allocator, Policy> &Stack<T, Allocator, Policy>::operator=(Stack &&other)
+	noexcept(alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value) {
 	if (this != &other) {
-		delete[] data_;
+		if constexpr (!alloc_traits::propagate_on_container_move_assignment::value && !alloc_traits::is_always_equal::value) {
+			if (alloc_ != other.alloc_) {
+				destroy_elements();
+				if (other.size_ > capacity_) {
+					release();
+					data_ = alloc_traits::allocate(alloc_, other.capacity_);
+					capacity_ = other.capacity_;
+				}
+				for (; size_ < other.size_; ++size_)
+					alloc_traits::construct(alloc_, data_ + size_, std::move(other.data_[size_]));
+				other.clear();
+				return *this;
+			}
+		}
+		release();
+		if constexpr (alloc_traits::propagate_on_container_move_assignment::value)
+			alloc_ = std::move(other.alloc_);
 		data_ = other.data_;
 		size_ = other.size_;
 		capacity_ = other.capacity_;
@@ -178,14 +276,14 @@ Stack<T> &Stack<T>::operator=(Stack &&other) noexcept {
 /**
  * @brief Removes all elements from stack
  * 
- * @details Sets size to zero and reduces capacity.
+ * @details Destroys every live element and sets size to zero. The
+ * storage is kept for reuse; call shrink_to_fit() to release it.
  * 
  * @ingroup linear_containers
  */
-template<class T>
-void Stack<T>::clear() noexcept {
-	size_ = 0;
-	shrink_to_fit();
+template<class T, class Allocator, class Policy>
+void Stack<T, Allocator, Policy>::clear() noexcept {
+	destroy_elements();
 }
 
 /**
@@ -201,8 +299,28 @@ void Stack<T>::clear() noexcept {
  * 
  * @throws std::out_of_range If index >= size
  */
-template<class T>
-typename Stack<T>::const_reference Stack<T>::at(size_type index) const {
+template<class T, class Allocator, class Policy>
+typename Stack<T, Allocator, Policy>::const_reference Stack<T, Allocator, Policy>::at(size_type index) const {
+	if (index >= size_)
+		throw std::out_of_range("Index out of range");
+	return data_[index];
+}
+
+/**
+ * @brief Access element with bounds checking
+ * 
+ * @details Provides mutable access to element at specified index. The
+ * index is always checked, whatever COLLECTIONS_BOUNDS_CHECK says.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] index Position of element to access
+ * @return Reference to element at specified position
+ * 
+ * @throws std::out_of_range If index >= size
+ */
+template<class T, class Allocator, class Policy>
+typename Stack<T, Allocator, Policy>::reference Stack<T, Allocator, Policy>::at(size_type index) {
 	if (index >= size_)
 		throw std::out_of_range("Index out of range");
 	return data_[index];
@@ -212,17 +330,20 @@ typename Stack<T>::const_reference Stack<T>::at(size_type index) const {
  * @brief Pushes element onto top of stack
  * 
  * @details Adds the given value to the top of the stack.
- * Automatically increases capacity if needed using exponential growth.
+ * Automatically increases capacity if needed as decided by the
+ * capacity policy.
  * 
  * @ingroup linear_containers
  * 
  * @param[in] value Element to push onto stack
  */
-template<class T>
-void Stack<T>::push(const_reference value) {
-	if (size_ == capacity_)
-		reserve(capacity_ == 0 ? 1 : capacity_ * 2);
-	data_[size_] = value;
+template<class T, class Allocator, class Policy>
+void Stack<T, Allocator, Policy>::push(const_reference value) {
+	if (size_ == capacity_) {
+		grow_and_construct(value);
+		return;
+	}
+	alloc_traits::construct(alloc_, data_ + size_, value);
 	size_++;
 }
 
@@ -230,20 +351,21 @@ void Stack<T>::push(const_reference value) {
  * @brief Removes and returns top element from stack
  * 
  * @details Removes the element at the top of the stack and returns its
- * value. Reduces capacity if size becomes significantly smaller.
+ * value. Capacity may be reduced as decided by the capacity policy.
  * 
  * @ingroup linear_containers
  * 
- * @return Copy of the removed top element
+ * @return The removed top element
  * 
  * @throws std::out_of_range If stack is empty
  */
-template<class T>
-typename Stack<T>::value_type Stack<T>::pop() {
+template<class T, class Allocator, class Policy>
+typename Stack<T, Allocator, Policy>::value_type Stack<T, Allocator, Policy>::pop() {
 	if (size_ == 0) throw std::out_of_range("Empty stack");
-	value_type value = data_[size_ - 1];
+	value_type value = std::move(data_[size_ - 1]);
 	--size_;
-	shrink_to_fit();
+	alloc_traits::destroy(alloc_, data_ + size_);
+	shrink_by_policy();
 	return value;
 }
 
@@ -257,8 +379,8 @@ typename Stack<T>::value_type Stack<T>::pop() {
  * 
  * @return Number of elements in stack
  */
-template<class T>
-typename Stack<T>::size_type Stack<T>::size() const noexcept { return size_; }
+template<class T, class Allocator, class Policy>
+typename Stack<T, Allocator, Policy>::size_type Stack<T, Allocator, Policy>::size() const noexcept { return size_; }
 
 /**
  * @brief Returns the capacity
@@ -270,8 +392,8 @@ typename Stack<T>::size_type Stack<T>::size() const noexcept { return size_; }
  * 
  * @return Capacity of currently allocated storage
  */
-template<class T>
-typename Stack<T>::size_type Stack<T>::capacity() const noexcept { return capacity_; }
+template<class T, class Allocator, class Policy>
+typename Stack<T, Allocator, Policy>::size_type Stack<T, Allocator, Policy>::capacity() const noexcept { return capacity_; }
 
 /**
  * @brief Checks if stack is empty
@@ -282,8 +404,8 @@ typename Stack<T>::size_type Stack<T>::capacity() const noexcept { return capaci
  * 
  * @return true if stack is empty, false otherwise
  */
-template<class T>
-bool Stack<T>::empty() const noexcept { return size_ == 0; }
+template<class T, class Allocator, class Policy>
+bool Stack<T, Allocator, Policy>::empty() const noexcept { return size_ == 0; }
 
 /**
  * @brief Returns pointer to underlying array
@@ -295,8 +417,8 @@ bool Stack<T>::empty() const noexcept { return size_ == 0; }
  * 
  * @return Pointer to underlying element storage
  */
-template<class T>
-typename Stack<T>::pointer Stack<T>::data() noexcept { return data_; }
+template<class T, class Allocator, class Policy>
+typename Stack<T, Allocator, Policy>::pointer Stack<T, Allocator, Policy>::data() noexcept { return data_; }
 
 /**
  * @brief Returns const pointer to underlying array
@@ -308,8 +430,8 @@ typename Stack<T>::pointer Stack<T>::data() noexcept { return data_; }
  * 
  * @return Const pointer to underlying element storage
  */
-template<class T>
-typename Stack<T>::const_pointer Stack<T>::data() const noexcept { return data_; }
+template<class T, class Allocator, class Policy>
+typename Stack<T, Allocator, Policy>::const_pointer Stack<T, Allocator, Policy>::data() const noexcept { return data_; }
 
 /**
  * @brief Returns iterator to beginning
@@ -321,8 +443,8 @@ typename Stack<T>::const_pointer Stack<T>::data() const noexcept { return data_;
  * 
  * @return Iterator to the first element
  */
-template<class T>
-typename Stack<T>::iterator Stack<T>::begin() noexcept { return data_; }
+template<class T, class Allocator, class Policy>
+typename Stack<T, Allocator, Policy>::iterator Stack<T, Allocator, Policy>::begin() noexcept { return data_; }
 
 /**
  * @brief Returns const iterator to beginning
@@ -334,8 +456,8 @@ typename Stack<T>::iterator Stack<T>::begin() noexcept { return data_; }
  * 
  * @return Const iterator to the first element
  */
-template<class T>
-typename Stack<T>::const_iterator Stack<T>::begin() const noexcept { return data_; }
+template<class T, class Allocator, class Policy>
+typename Stack<T, Allocator, Policy>::const_iterator Stack<T, Allocator, Policy>::begin() const noexcept { return data_; }
 
 /**
  * @brief Returns iterator to end
@@ -347,8 +469,8 @@ typename Stack<T>::const_iterator Stack<T>::begin() const noexcept { return data
  * 
  * @return Iterator to the element following the last element
  */
-template<class T>
-typename Stack<T>::iterator Stack<T>::end() noexcept { return data_ + size_; }
+template<class T, class Allocator, class Policy>
+typename Stack<T, Allocator, Policy>::iterator Stack<T, Allocator, Policy>::end() noexcept { return data_ + size_; }
 
 /**
  * @brief Returns const iterator to end
@@ -360,57 +482,192 @@ typename Stack<T>::iterator Stack<T>::end() noexcept { return data_ + size_; }
  * 
  * @return Const iterator to the element following the last element
  */
-template<class T>
-typename Stack<T>::const_iterator Stack<T>::end() const noexcept { return data_ + size_; }
+template<class T, class Allocator, class Policy>
+typename Stack<T, Allocator, Policy>::const_iterator Stack<T, Allocator, Policy>::end() const noexcept { return data_ + size_; }
+
+/**
+ * @brief Returns a copy of the allocator
+ * 
+ * @details Returns the allocator used to obtain the stack's storage.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Copy of the associated allocator
+ */
+template<class T, class Allocator, class Policy>
+typename Stack<T, Allocator, Policy>::allocator_type Stack<T, Allocator, Policy>::get_allocator() const noexcept { return alloc_; }
 
 /**
  * @brief Increases capacity to at least new_cap
  * 
  * @details Allocates new storage if new_cap is greater than current
- * capacity. Moves existing elements to new storage using move
- * semantics.
+ * capacity and relocates the existing elements into it. Does nothing
+ * if new_cap <= current capacity. Reserving ahead of a known number of
+ * insertions avoids every intermediate reallocation.
  * 
  * @ingroup linear_containers
  * 
  * @param[in] new_cap Minimum capacity to reserve
  */
-template<class T>
-void Stack<T>::reserve(size_type new_cap) {
-	if (new_cap > capacity_) {
-		pointer new_data = new T[new_cap];
-		for (size_type i = 0; i < size_; ++i)
-			new_data[i] = std::move(data_[i]);
-		delete[] data_;
-		data_ = new_data;
-		capacity_ = new_cap;
+template<class T, class Allocator, class Policy>
+void Stack<T, Allocator, Policy>::reserve(size_type new_cap) {
+	if (new_cap > capacity_)
+		reallocate(new_cap);
+}
+
+/**
+ * @brief Reduces capacity to the current size
+ * 
+ * @details Reallocates so that capacity equals size. If the stack is
+ * empty, the storage is released entirely.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, class Allocator, class Policy>
+void Stack<T, Allocator, Policy>::shrink_to_fit() {
+	if (size_ == 0)
+		release();
+	else if (size_ < capacity_)
+		reallocate(size_);
+}
+
+/**
+ * @brief Gives back storage after a removal when the policy asks for it
+ * 
+ * @details Queries Policy::shrink with the current size and capacity
+ * and reallocates only if a smaller capacity is returned. With the
+ * default policy this happens once size falls below a quarter of the
+ * capacity, which keeps alternating insertions and removals at a
+ * capacity boundary from reallocating every time. The policy is
+ * applied until it settles, so a bulk removal shrinks with a single
+ * reallocation.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, class Allocator, class Policy>
+void Stack<T, Allocator, Policy>::shrink_by_policy() {
+	size_type new_cap = capacity_;
+	for (size_type next; (next = Policy::shrink(size_, new_cap)) < new_cap && next >= size_; )
+		new_cap = next;
+	if (new_cap >= capacity_)
+		return;
+	if (new_cap == 0)
+		release();
+	else
+		reallocate(new_cap);
+}
+
+/**
+ * @brief Moves the elements into freshly allocated storage
+ * 
+ * @details Allocates raw storage for new_cap elements and transfers
+ * the live elements into it. On failure the new block is released and
+ * the stack is left unchanged.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] new_cap Capacity of the new storage (must be >= size)
+ */
+template<class T, class Allocator, class Policy>
+void Stack<T, Allocator, Policy>::reallocate(size_type new_cap) {
+	pointer new_data = alloc_traits::allocate(alloc_, new_cap);
+	try {
+		transfer(new_data, new_cap);
+	}
+	catch (...) {
+		alloc_traits::deallocate(alloc_, new_data, new_cap);
+		throw;
 	}
 }
 
 /**
- * @brief Reduces capacity to better fit current size
+ * @brief Transfers the live elements into new storage
  * 
- * @details If size is less than half of capacity, reallocates to halve
- * the capacity. If size is zero, deallocates all memory.
+ * @details Relocates the elements into new_data and adopts it as the
+ * stack's storage. Trivially relocatable types are moved with a
+ * single memcpy; other types are move-constructed one by one. If that
+ * throws, the stack is left unchanged and the caller still owns
+ * new_data.
  * 
  * @ingroup linear_containers
+ * 
+ * @param[in] new_data Uninitialized storage for at least size elements
+ * @param[in] new_cap Capacity of new_data
  */
-template<class T>
-void Stack<T>::shrink_to_fit() {
-	if (size_ > 0) {
-		if (size_ < capacity_ / 2) {
-			pointer new_data = new T[capacity_ / 2];
-			for (size_type i = 0; i < size_; ++i)
-				new_data[i] = std::move(data_[i]);
-			delete[] data_;
-			data_ = new_data;
-			capacity_ /= 2;
-		}
+template<class T, class Allocator, class Policy>
+void Stack<T, Allocator, Policy>::transfer(pointer new_data, size_type new_cap) {
+	relocate_n(alloc_, data_, size_, new_data);
+	if (data_)
+		alloc_traits::deallocate(alloc_, data_, capacity_);
+	data_ = new_data;
+	capacity_ = new_cap;
+}
+
+/**
+ * @brief Grows the storage and constructs a new last element
+ * 
+ * @details Builds the new element in the enlarged block before the
+ * existing elements are moved, so args may safely refer to an element
+ * of this stack.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @tparam Args Types of the constructor arguments
+ * @param[in] args Arguments forwarded to the element constructor
+ */
+template<class T, class Allocator, class Policy>
+template <class... Args>
+void Stack<T, Allocator, Policy>::grow_and_construct(Args&&... args) {
+	size_type new_cap = Policy::grow(capacity_, size_ + 1);
+	pointer new_data = alloc_traits::allocate(alloc_, new_cap);
+	try {
+		alloc_traits::construct(alloc_, new_data + size_, std::forward<Args>(args)...);
+	}
+	catch (...) {
+		alloc_traits::deallocate(alloc_, new_data, new_cap);
+		throw;
+	}
+	try {
+		transfer(new_data, new_cap);
 	}
-	else {
-		delete[] data_;
-		data_ = nullptr;
-		capacity_ = size_;
+	catch (...) {
+		alloc_traits::destroy(alloc_, new_data + size_);
+		alloc_traits::deallocate(alloc_, new_data, new_cap);
+		throw;
 	}
+	++size_;
+}
+
+/**
+ * @brief Destroys every live element
+ * 
+ * @details Runs the destructor of each stored element and sets size to
+ * zero. The storage itself is kept.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, class Allocator, class Policy>
+void Stack<T, Allocator, Policy>::destroy_elements() noexcept {
+	for (size_type i = 0; i < size_; ++i)
+		alloc_traits::destroy(alloc_, data_ + i);
+	size_ = 0;
+}
+
+/**
+ * @brief Destroys all elements and frees the storage
+ * 
+ * @details Leaves the stack empty with null data pointer and zero
+ * capacity.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, class Allocator, class Policy>
+void Stack<T, Allocator, Policy>::release() noexcept {
+	destroy_elements();
+	if (data_)
+		alloc_traits::deallocate(alloc_, data_, capacity_);
+	data_ = nullptr;
+	capacity_ = 0;
 }
 
 #endif
\ No newline at end of file
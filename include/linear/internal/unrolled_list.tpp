@@ -0,0 +1,816 @@
+/**
+ * @file unrolled_list.tpp
+ * @brief Implementation of UnrolledList template class methods
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef UNROLLED_LIST_TPP
+#define UNROLLED_LIST_TPP
+
+#include "../unrolled_list.hpp"
+
+/**
+ * @brief Node constructor
+ * 
+ * @details Creates an empty node. The element slots are left
+ * uninitialized.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, std::size_t K, class Allocator>
+UnrolledList<T, K, Allocator>::Node::Node() noexcept : next(nullptr), count(0) {}
+
+/**
+ * @brief Returns the element slots of the node
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Pointer to the first slot
+ */
+template<class T, std::size_t K, class Allocator>
+T *UnrolledList<T, K, Allocator>::Node::items() noexcept {
+	return reinterpret_cast<T *>(storage);
+}
+
+/**
+ * @brief Returns the element slots of the node
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Const pointer to the first slot
+ */
+template<class T, std::size_t K, class Allocator>
+const T *UnrolledList<T, K, Allocator>::Node::items() const noexcept {
+	return reinterpret_cast<const T *>(storage);
+}
+
+/**
+ * @brief Default iterator constructor
+ * 
+ * @details Constructs a singular iterator equal to end().
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, std::size_t K, class Allocator>
+template<bool IsConst>
+UnrolledList<T, K, Allocator>::BasicIterator<IsConst>::BasicIterator() noexcept : current(nullptr), slot(0) {}
+
+/**
+ * @brief Iterator constructor
+ * 
+ * @details Constructs an iterator pointing to an element of a node.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] node Node holding the element, or nullptr for end()
+ * @param[in] slot Index of the element within the node
+ */
+template<class T, std::size_t K, class Allocator>
+template<bool IsConst>
+UnrolledList<T, K, Allocator>::BasicIterator<IsConst>::BasicIterator(node_pointer node, std::size_t slot) noexcept
+	: current(node), slot(slot) {}
+
+/**
+ * @brief Converting constructor
+ * 
+ * @details Copies a mutable iterator. For the const instantiation this
+ * is the conversion from iterator to const_iterator.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Mutable iterator to copy
+ */
+template<class T, std::size_t K, class Allocator>
+template<bool IsConst>
+UnrolledList<T, K, Allocator>::BasicIterator<IsConst>::BasicIterator(const BasicIterator<false>& other) noexcept
+	: current(other.current), slot(other.slot) {}
+
+/**
+ * @brief Dereference operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Reference to element pointed to by iterator
+ */
+template<class T, std::size_t K, class Allocator>
+template<bool IsConst>
+typename UnrolledList<T, K, Allocator>::template BasicIterator<IsConst>::reference UnrolledList<T, K, Allocator>::BasicIterator<IsConst>::operator*() const {
+	return current->items()[slot];
+}
+
+/**
+ * @brief Member access operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Pointer to element pointed to by iterator
+ */
+template<class T, std::size_t K, class Allocator>
+template<bool IsConst>
+typename UnrolledList<T, K, Allocator>::template BasicIterator<IsConst>::pointer UnrolledList<T, K, Allocator>::BasicIterator<IsConst>::operator->() const {
+	return current->items() + slot;
+}
+
+/**
+ * @brief Prefix increment operator
+ * 
+ * @details Advances to the next slot, moving on to the next node after
+ * the last element of the current one.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Reference to this iterator after increment
+ */
+template<class T, std::size_t K, class Allocator>
+template<bool IsConst>
+typename UnrolledList<T, K, Allocator>::template BasicIterator<IsConst>& UnrolledList<T, K, Allocator>::BasicIterator<IsConst>::operator++() {
+	if (current && ++slot == current->count) {
+		current = current->next;
+		slot = 0;
+	}
+	return *this;
+}
+
+/**
+ * @brief Postfix increment operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Copy of the iterator before increment
+ */
+template<class T, std::size_t K, class Allocator>
+template<bool IsConst>
+typename UnrolledList<T, K, Allocator>::template BasicIterator<IsConst> UnrolledList<T, K, Allocator>::BasicIterator<IsConst>::operator++(int) {
+	BasicIterator previous = *this;
+	++*this;
+	return previous;
+}
+
+/**
+ * @brief Inequality comparison operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Iterator to compare against
+ * @return true if iterators point to different elements
+ */
+template<class T, std::size_t K, class Allocator>
+template<bool IsConst>
+template<bool OtherConst>
+bool UnrolledList<T, K, Allocator>::BasicIterator<IsConst>::operator!=(const BasicIterator<OtherConst>& other) const {
+	return !(*this == other);
+}
+
+/**
+ * @brief Equality comparison operator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other Iterator to compare against
+ * @return true if iterators point to the same element
+ */
+template<class T, std::size_t K, class Allocator>
+template<bool IsConst>
+template<bool OtherConst>
+bool UnrolledList<T, K, Allocator>::BasicIterator<IsConst>::operator==(const BasicIterator<OtherConst>& other) const {
+	return current == other.current && slot == other.slot;
+}
+
+/**
+ * @brief Default constructor creating empty list
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, std::size_t K, class Allocator>
+UnrolledList<T, K, Allocator>::UnrolledList() noexcept : head_(nullptr), tail_(nullptr), size_(0), nodes_(0) {}
+
+/**
+ * @brief Constructs an empty list using the given allocator
+ * 
+ * @details No node is allocated until the first element is added.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] alloc Allocator to obtain nodes from
+ */
+template<class T, std::size_t K, class Allocator>
+UnrolledList<T, K, Allocator>::UnrolledList(const Allocator &alloc) noexcept
+	: head_(nullptr), tail_(nullptr), size_(0), nodes_(0), alloc_(alloc) {}
+
+/**
+ * @brief Constructs list with count copies of value
+ * 
+ * @details Fills every node completely, so the list uses the minimal
+ * number of nodes.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] count Number of elements to create
+ * @param[in] value Value to initialize elements with
+ * @param[in] alloc Allocator to obtain nodes from
+ */
+template<class T, std::size_t K, class Allocator>
+UnrolledList<T, K, Allocator>::UnrolledList(size_type count, const T &value, const Allocator &alloc)
+	: head_(nullptr), tail_(nullptr), size_(0), nodes_(0), alloc_(alloc) {
+	try {
+		for (size_type i = 0; i < count; i++)
+			add(value);
+	}
+	catch (...) {
+		clear();
+		throw;
+	}
+}
+
+/**
+ * @brief Copy constructor
+ * 
+ * @details Copies the elements in order into completely filled nodes,
+ * so the copy may use fewer nodes than other.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other UnrolledList to copy from
+ */
+template<class T, std::size_t K, class Allocator>
+UnrolledList<T, K, Allocator>::UnrolledList(const UnrolledList &other)
+	: head_(nullptr), tail_(nullptr), size_(0), nodes_(0),
+	alloc_(node_traits::select_on_container_copy_construction(other.alloc_)) {
+	try {
+		for (const auto &item : other)
+			add(item);
+	}
+	catch (...) {
+		clear();
+		throw;
+	}
+}
+
+/**
+ * @brief Move constructor
+ * 
+ * @details Takes over the nodes of other, which is left empty.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other UnrolledList to move from
+ */
+template<class T, std::size_t K, class Allocator>
+UnrolledList<T, K, Allocator>::UnrolledList(UnrolledList &&other) noexcept
+	: head_(other.head_), tail_(other.tail_), size_(other.size_), nodes_(other.nodes_), alloc_(std::move(other.alloc_)) {
+	other.head_ = nullptr;
+	other.tail_ = nullptr;
+	other.size_ = 0;
+	other.nodes_ = 0;
+}
+
+/**
+ * @brief Constructs list from another container
+ * 
+ * @details Copies the elements of any container that supports a
+ * range-based for loop.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @tparam Container Type of source container
+ * @param[in] other Container to copy elements from
+ */
+template<class T, std::size_t K, class Allocator>
+template <class Container>
+UnrolledList<T, K, Allocator>::UnrolledList(const Container& other) : head_(nullptr), tail_(nullptr), size_(0), nodes_(0) {
+	try {
+		for (const auto& item : other)
+			add(item);
+	}
+	catch (...) {
+		clear();
+		throw;
+	}
+}
+
+/**
+ * @brief Destructor
+ * 
+ * @details Destroys all elements and frees all nodes.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, std::size_t K, class Allocator>
+UnrolledList<T, K, Allocator>::~UnrolledList() {
+	clear();
+}
+
+/**
+ * @brief Subscript operator with bounds checking
+ * 
+ * @details Skips whole nodes until it reaches the one holding index.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] index Position of element to access
+ * @return Reference to element at specified position
+ * 
+ * @throws std::out_of_range If index >= size
+ */
+template<class T, std::size_t K, class Allocator>
+typename UnrolledList<T, K, Allocator>::reference UnrolledList<T, K, Allocator>::operator[](size_type index) {
+	if (index >= size_)
+		throw std::out_of_range("Index out of range");
+	Node *node = locate(index, nullptr);
+	return node->items()[index];
+}
+
+/**
+ * @brief Copy assignment operator
+ * 
+ * @details Replaces the contents with a copy of other's elements.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other UnrolledList to copy from
+ * @return Reference to this list
+ */
+template<class T, std::size_t K, class Allocator>
+UnrolledList<T, K, Allocator> &UnrolledList<T, K, Allocator>::operator=(const UnrolledList &other) {
+	if (this != &other) {
+		clear();
+		for (const auto &item : other)
+			add(item);
+	}
+	return *this;
+}
+
+/**
+ * @brief Move assignment operator
+ * 
+ * @details Frees the current nodes and takes over those of other,
+ * which is left empty. When the allocator does not propagate and the
+ * two allocators differ, the elements are moved into nodes of this
+ * list's own instead; only that case can throw.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] other UnrolledList to move from
+ * @return Reference to this list
+ */
+template<class T, std::size_t K, class Allocator>
+UnrolledList<T, K, Allocator> &UnrolledList<T, K, Allocator>::operator=(UnrolledList &&other)
+	noexcept(node_traits::propagate_on_container_move_assignment::value || node_traits::is_always_equal::value) {
+	if (this != &other) {
+		clear();
+		if constexpr (node_traits::propagate_on_container_move_assignment::value)
+			alloc_ = std::move(other.alloc_);
+		else if (!node_traits::is_always_equal::value && alloc_ != other.alloc_) {
+			for (auto &item : other)
+				append(std::move(item));
+			other.clear();
+			return *this;
+		}
+		head_ = other.head_;
+		tail_ = other.tail_;
+		size_ = other.size_;
+		nodes_ = other.nodes_;
+		other.head_ = nullptr;
+		other.tail_ = nullptr;
+		other.size_ = 0;
+		other.nodes_ = 0;
+	}
+	return *this;
+}
+
+/**
+ * @brief Removes all elements from list
+ * 
+ * @details Destroys every element and frees every node.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, std::size_t K, class Allocator>
+void UnrolledList<T, K, Allocator>::clear() noexcept {
+	Node *cur = head_;
+	while (cur) {
+		Node *next = cur->next;
+		destroy_node(cur);
+		cur = next;
+	}
+	head_ = nullptr;
+	tail_ = nullptr;
+	size_ = 0;
+	nodes_ = 0;
+}
+
+/**
+ * @brief Access element with bounds checking
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] index Position of element to access
+ * @return Const reference to element at specified position
+ * 
+ * @throws std::out_of_range If index >= size
+ */
+template<class T, std::size_t K, class Allocator>
+typename UnrolledList<T, K, Allocator>::const_reference UnrolledList<T, K, Allocator>::at(size_type index) const {
+	if (index >= size_)
+		throw std::out_of_range("Index out of range");
+	const Node *node = locate(index, nullptr);
+	return node->items()[index];
+}
+
+/**
+ * @brief Adds element to end of list
+ * 
+ * @details Constructs the element in the last node, or in a new node
+ * when the last one is full.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] value Element to append
+ */
+template<class T, std::size_t K, class Allocator>
+void UnrolledList<T, K, Allocator>::add(const_reference value) {
+	append(value);
+}
+
+/**
+ * @brief Inserts element at specified position
+ * 
+ * @details Shifts the later elements of the target node up by one
+ * slot. A full node is split first, so at most K elements move.
+ * Inserting at size() behaves like add().
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] index Position where to insert (must be <= size)
+ * @param[in] value Element to insert
+ * @return Iterator to the inserted element
+ * 
+ * @throws std::out_of_range If index > size
+ */
+template<class T, std::size_t K, class Allocator>
+typename UnrolledList<T, K, Allocator>::iterator UnrolledList<T, K, Allocator>::insert(size_type index, const_reference value) {
+	if (index > size_) throw std::out_of_range("insert index out of range");
+	if (index == size_) {
+		add(value);
+		return iterator(tail_, tail_->count - 1);
+	}
+	value_type item(value);
+	Node *node = locate(index, nullptr);
+	if (node->count == K) {
+		split(node);
+		if (index > node->count) {
+			index -= node->count;
+			node = node->next;
+		}
+	}
+	insert_at(node, index, std::move(item));
+	return iterator(node, index);
+}
+
+/**
+ * @brief Removes element at specified position
+ * 
+ * @details Shifts the later elements of the node down by one slot,
+ * then frees the node if it became empty or merges it with its
+ * successor if it fell below half full.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] index Position of element to remove
+ * @return The removed element
+ * 
+ * @throws std::out_of_range If index >= size
+ */
+template<class T, std::size_t K, class Allocator>
+typename UnrolledList<T, K, Allocator>::value_type UnrolledList<T, K, Allocator>::erase(size_type index) {
+	if (index >= size_) throw std::out_of_range("erase index out of range");
+	Node *prev = nullptr;
+	Node *node = locate(index, &prev);
+	value_type val = std::move(node->items()[index]);
+	remove_at(node, index);
+	rebalance(node, prev);
+	return val;
+}
+
+/**
+ * @brief Returns the number of elements
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Number of elements in list
+ */
+template<class T, std::size_t K, class Allocator>
+typename UnrolledList<T, K, Allocator>::size_type UnrolledList<T, K, Allocator>::size() const noexcept { return size_; }
+
+/**
+ * @brief Checks if list is empty
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return true if list is empty, false otherwise
+ */
+template<class T, std::size_t K, class Allocator>
+bool UnrolledList<T, K, Allocator>::empty() const noexcept { return size_ == 0; }
+
+/**
+ * @brief Returns the number of nodes
+ * 
+ * @details Lies between size() / K and about 2 * size() / K + 1 after
+ * appends and inserts; erases can leave sparser nodes behind.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Number of nodes in list
+ */
+template<class T, std::size_t K, class Allocator>
+typename UnrolledList<T, K, Allocator>::size_type UnrolledList<T, K, Allocator>::node_count() const noexcept { return nodes_; }
+
+/**
+ * @brief Returns a copy of the allocator
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Allocator rebound back to the element type
+ */
+template<class T, std::size_t K, class Allocator>
+typename UnrolledList<T, K, Allocator>::allocator_type UnrolledList<T, K, Allocator>::get_allocator() const noexcept {
+	return allocator_type(alloc_);
+}
+
+/**
+ * @brief Returns iterator to beginning
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Iterator to the first element
+ */
+template<class T, std::size_t K, class Allocator>
+typename UnrolledList<T, K, Allocator>::iterator UnrolledList<T, K, Allocator>::begin() noexcept { return Iterator(head_, 0); }
+
+/**
+ * @brief Returns iterator to end
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Iterator to the element following the last element
+ */
+template<class T, std::size_t K, class Allocator>
+typename UnrolledList<T, K, Allocator>::iterator UnrolledList<T, K, Allocator>::end() noexcept { return Iterator(); }
+
+/**
+ * @brief Returns const iterator to beginning
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Const iterator to the first element
+ */
+template<class T, std::size_t K, class Allocator>
+typename UnrolledList<T, K, Allocator>::const_iterator UnrolledList<T, K, Allocator>::begin() const noexcept { return ConstIterator(head_, 0); }
+
+/**
+ * @brief Returns const iterator to end
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Const iterator to the element following the last element
+ */
+template<class T, std::size_t K, class Allocator>
+typename UnrolledList<T, K, Allocator>::const_iterator UnrolledList<T, K, Allocator>::end() const noexcept { return ConstIterator(); }
+
+/**
+ * @brief Appends an element to the end of the list
+ * 
+ * @details Constructs the element in the last node, or in a new node
+ * when the last one is full.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @tparam Arg Type of the value, T or a reference to T
+ * @param[in] value Element to copy or move in
+ */
+template<class T, std::size_t K, class Allocator>
+template <class Arg>
+void UnrolledList<T, K, Allocator>::append(Arg &&value) {
+	if (tail_ && tail_->count < K) {
+		node_traits::construct(alloc_, tail_->items() + tail_->count, std::forward<Arg>(value));
+		++tail_->count;
+		++size_;
+		return;
+	}
+	Node *node = create_node();
+	try {
+		node_traits::construct(alloc_, node->items(), std::forward<Arg>(value));
+	}
+	catch (...) {
+		destroy_node(node);
+		throw;
+	}
+	node->count = 1;
+	if (tail_)
+		tail_->next = node;
+	else
+		head_ = node;
+	tail_ = node;
+	++nodes_;
+	++size_;
+}
+
+/**
+ * @brief Allocates an empty, unlinked node
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Pointer to the new node
+ */
+template<class T, std::size_t K, class Allocator>
+typename UnrolledList<T, K, Allocator>::Node *UnrolledList<T, K, Allocator>::create_node() {
+	Node *node = node_traits::allocate(alloc_, 1);
+	node_traits::construct(alloc_, node);
+	return node;
+}
+
+/**
+ * @brief Destroys the elements of a node and frees it
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] node Unlinked node obtained from create_node()
+ */
+template<class T, std::size_t K, class Allocator>
+void UnrolledList<T, K, Allocator>::destroy_node(Node *node) noexcept {
+	for (std::size_t i = 0; i < node->count; ++i)
+		node_traits::destroy(alloc_, node->items() + i);
+	node_traits::destroy(alloc_, node);
+	node_traits::deallocate(alloc_, node, 1);
+}
+
+/**
+ * @brief Finds the node holding an element
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in,out] index Position in the list (must be < size); receives
+ * the slot within the returned node
+ * @param[out] prev If not nullptr, receives the node before the
+ * returned one, or nullptr for the first node
+ * @return Node holding the element
+ */
+template<class T, std::size_t K, class Allocator>
+typename UnrolledList<T, K, Allocator>::Node *UnrolledList<T, K, Allocator>::locate(size_type &index, Node **prev) const noexcept {
+	Node *before = nullptr;
+	Node *node = head_;
+	while (index >= node->count) {
+		index -= node->count;
+		before = node;
+		node = node->next;
+	}
+	if (prev)
+		*prev = before;
+	return node;
+}
+
+/**
+ * @brief Moves the upper half of a node into a new successor
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] node Node to split
+ * 
+ * @throws std::bad_alloc if no node can be allocated, or anything a
+ * copy constructor of T throws; the list is then unchanged
+ */
+template<class T, std::size_t K, class Allocator>
+void UnrolledList<T, K, Allocator>::split(Node *node) {
+	Node *fresh = create_node();
+	std::size_t keep = node->count / 2;
+	try {
+		relocate_n(alloc_, node->items() + keep, node->count - keep, fresh->items());
+	}
+	catch (...) {
+		destroy_node(fresh);
+		throw;
+	}
+	fresh->count = node->count - keep;
+	node->count = keep;
+	fresh->next = node->next;
+	node->next = fresh;
+	if (tail_ == node)
+		tail_ = fresh;
+	++nodes_;
+}
+
+/**
+ * @brief Inserts an element into a node that has room
+ * 
+ * @details Opens a gap at slot with a single memmove for trivially
+ * relocatable types, or by shifting the later elements up otherwise.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] node Node holding fewer than K elements
+ * @param[in] slot Position within the node (must be <= count)
+ * @param[in] value Element to move into the gap
+ */
+template<class T, std::size_t K, class Allocator>
+void UnrolledList<T, K, Allocator>::insert_at(Node *node, size_type slot, value_type &&value) {
+	T *items = node->items();
+	std::size_t count = node->count;
+	if constexpr (is_trivially_relocatable_v<T>) {
+		relocate_overlapping(items + slot, count - slot, items + slot + 1);
+		try {
+			node_traits::construct(alloc_, items + slot, std::move(value));
+		}
+		catch (...) {
+			relocate_overlapping(items + slot + 1, count - slot, items + slot);
+			throw;
+		}
+		++node->count;
+	}
+	else if (slot == count) {
+		node_traits::construct(alloc_, items + count, std::move(value));
+		++node->count;
+	}
+	else {
+		node_traits::construct(alloc_, items + count, std::move(items[count - 1]));
+		++node->count;
+		++size_;
+		std::move_backward(items + slot, items + count - 1, items + count);
+		items[slot] = std::move(value);
+		return;
+	}
+	++size_;
+}
+
+/**
+ * @brief Removes the element at a slot of a node
+ * 
+ * @details Closes the gap with a single memmove for trivially
+ * relocatable types, or by shifting the later elements down otherwise.
+ * Does not free or merge the node.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] node Node holding the element
+ * @param[in] slot Position within the node (must be < count)
+ */
+template<class T, std::size_t K, class Allocator>
+void UnrolledList<T, K, Allocator>::remove_at(Node *node, size_type slot) {
+	T *items = node->items();
+	std::size_t count = node->count;
+	if constexpr (is_trivially_relocatable_v<T>) {
+		node_traits::destroy(alloc_, items + slot);
+		relocate_overlapping(items + slot + 1, count - slot - 1, items + slot);
+	}
+	else {
+		std::move(items + slot + 1, items + count, items + slot);
+		node_traits::destroy(alloc_, items + count - 1);
+	}
+	--node->count;
+	--size_;
+}
+
+/**
+ * @brief Restores node occupancy after an erase
+ * 
+ * @details Frees the node if it is empty. If it is less than half full
+ * and its elements fit into it together with those of its successor,
+ * the successor's elements are relocated into it and the successor is
+ * freed. Merging is skipped for types whose move constructor may
+ * throw, which only leaves the node sparser.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] node Node an element was just removed from
+ * @param[in] prev Node before it, or nullptr for the first node
+ */
+template<class T, std::size_t K, class Allocator>
+void UnrolledList<T, K, Allocator>::rebalance(Node *node, Node *prev) noexcept {
+	if (node->count == 0) {
+		if (prev)
+			prev->next = node->next;
+		else
+			head_ = node->next;
+		if (tail_ == node)
+			tail_ = prev;
+		destroy_node(node);
+		--nodes_;
+		return;
+	}
+	if constexpr (is_trivially_relocatable_v<T> || std::is_nothrow_move_constructible_v<T>) {
+		Node *next = node->next;
+		if (node->count * 2 >= K || !next || node->count + next->count > K)
+			return;
+		relocate_n(alloc_, next->items(), next->count, node->items() + node->count);
+		node->count += next->count;
+		next->count = 0;
+		node->next = next->next;
+		if (tail_ == next)
+			tail_ = node;
+		destroy_node(next);
+		--nodes_;
+	}
+}
+
+#endif
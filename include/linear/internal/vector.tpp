@@ -19,43 +19,78 @@
  * 
  * @ingroup linear_containers
  */
-template<class T>
-Vector<T>::Vector() noexcept : data_(nullptr), size_(0), capacity_(0) {}
+template<class T, class Allocator, class Policy>
+Vector<T, Allocator, Policy>::Vector() noexcept : data_(nullptr), size_(0), capacity_(0), alloc_() {}
+
+/**
+ * @brief Constructs empty vector using the given allocator
+ * 
+ * @details Initializes an empty vector that will obtain its storage
+ * from a copy of alloc. No memory allocation is performed.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] alloc Allocator to use for all storage
+ */
+template<class T, class Allocator, class Policy>
+Vector<T, Allocator, Policy>::Vector(const Allocator &alloc) noexcept : data_(nullptr), size_(0), capacity_(0), alloc_(alloc) {}
 
 /**
  * @brief Constructs vector with count copies of value
  * 
- * @details Allocates memory for count elements and initializes each
- * element with a copy of the provided value.
+ * @details Allocates raw storage for count elements and
+ * copy-constructs each element in place from the provided value.
  * 
  * @ingroup linear_containers
  * 
  * @param[in] count Number of elements to create
  * @param[in] value Value to initialize elements with
+ * @param[in] alloc Allocator to use for all storage
  */
-template<class T>
-Vector<T>::Vector(size_type count, const T &value) : size_(count), capacity_(count) {
-	data_ = new T[capacity_];
-	for (size_type i = 0; i < size_; ++i)
-		data_[i] = value;
+template<class T, class Allocator, class Policy>
+Vector<T, Allocator, Policy>::Vector(size_type count, const T &value, const Allocator &alloc)
+	: data_(nullptr), size_(0), capacity_(0), alloc_(alloc) {
+	if (count == 0)
+		return;
+	data_ = alloc_traits::allocate(alloc_, count);
+	capacity_ = count;
+	try {
+		for (; size_ < count; ++size_)
+			alloc_traits::construct(alloc_, data_ + size_, value);
+	}
+	catch (...) {
+		release();
+		throw;
+	}
 }
 
 /**
  * @brief Copy constructor
  * 
- * @details Creates a deep copy of another vector, allocating new memory
- * and copying all elements. The new vector has the same size and
- * capacity as the source.
+ * @details Creates a deep copy of another vector, allocating new
+ * storage and copy-constructing only the live elements. The new vector
+ * has the same size and capacity as the source.
  * 
  * @ingroup linear_containers
  * 
  * @param[in] other Vector to copy from
  */
-template<class T>
-Vector<T>::Vector(const Vector &other) : size_(other.size_), capacity_(other.capacity_) {
-	data_ = new T[capacity_];
-	for (size_type i = 0; i < size_; ++i)
-		data_[i] = other.data_[i];
+template<class T, class Allocator, class Policy>
+Vector<T, Allocator, Policy>::Vector(const Vector &other)
+	: data_(nullptr), size_(0), capacity_(0),
+	alloc_(alloc_traits::select_on_container_copy_construction(other.alloc_)) {
+	if (other.capacity_ == 0)
+		return;
+	data_ = alloc_traits::allocate(alloc_, other.capacity_);
+	capacity_ = other.capacity_;
+	try {
+		for (; size_ < other.size_; ++size_)
+			alloc_traits::construct(alloc_, data_ + size_, other.data_[size_]);
+	}
+	catch (...) {
+		release();
+		throw;
+	}
 }
 
 /**
@@ -68,8 +103,9 @@ Vector<T>::Vector(const Vector &other) : size_(other.size_), capacity_(other.cap
  * 
  * @param[in] other Vector to move from (rvalue reference)
  */
-template<class T>
-Vector<T>::Vector(Vector &&other) noexcept : data_(other.data_), size_(other.size_), capacity_(other.capacity_) {
+template<class T, class Allocator, class Policy>
+Vector<T, Allocator, Policy>::Vector(Vector &&other) noexcept
+	: data_(other.data_), size_(other.size_), capacity_(other.capacity_), alloc_(std::move(other.alloc_)) {
 	other.data_ = nullptr;
 	other.size_ = 0;
 	other.capacity_ = 0;
@@ -86,44 +122,82 @@ Vector<T>::Vector(Vector &&other) noexcept : data_(other.data_), size_(other.siz
  * @tparam Container Type of source container
  * @param[in] other Container to copy elements from
  */
-template<class T>
+template<class T, class Allocator, class Policy>
 template <class Container>
-Vector<T>::Vector(const Container& other) : size_(other.size()), capacity_(other.size()) {
-	data_ = new T[capacity_];
-	size_type index = 0;
-	for (const auto& item : other)
-		data_[index++] = item;
+Vector<T, Allocator, Policy>::Vector(const Container& other) : data_(nullptr), size_(0), capacity_(0), alloc_() {
+	if (other.size() == 0)
+		return;
+	data_ = alloc_traits::allocate(alloc_, other.size());
+	capacity_ = other.size();
+	try {
+		for (const auto& item : other) {
+			alloc_traits::construct(alloc_, data_ + size_, item);
+			++size_;
+		}
+	}
+	catch (...) {
+		release();
+		throw;
+	}
 }
 
 /**
  * @brief Destructor
  * 
- * @details Releases all dynamically allocated memory.
+ * @details Destroys the live elements and releases the storage.
  * 
  * @ingroup linear_containers
  */
-template<class T>
-Vector<T>::~Vector() {
-	delete[] data_;
+template<class T, class Allocator, class Policy>
+Vector<T, Allocator, Policy>::~Vector() {
+	release();
 }
 
 /**
- * @brief Subscript operator with bounds checking
+ * @brief Subscript operator
  * 
- * @details Provides access to element at specified index with bounds
- * checking. Throws exception if index is out of range.
+ * @details Provides access to element at specified index. The
+ * index is only checked when COLLECTIONS_BOUNDS_CHECK is enabled (the
+ * default unless NDEBUG is defined); use at() for access that is
+ * always checked.
  * 
  * @ingroup linear_containers
  * 
- * @param[in] index Position of element to access
+ * @param[in] index Position of element to access (must be < size)
  * @return Reference to element at specified position
  * 
- * @throws std::out_of_range If index >= size
+ * @throws std::out_of_range If index >= size and bounds checking is
+ * enabled
+ */
+template<class T, class Allocator, class Policy>
+typename Vector<T, Allocator, Policy>::reference Vector<T, Allocator, Policy>::operator[](size_type index) {
+#if COLLECTIONS_BOUNDS_CHECK
+	if (index >= size_)
+		throw std::out_of_range("Index out of range");
+#endif
+	return data_[index];
+}
+
+/**
+ * @brief Const subscript operator
+ * 
+ * @details Read-only counterpart of operator[], checked only when
+ * COLLECTIONS_BOUNDS_CHECK is enabled.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] index Position of element to access (must be < size)
+ * @return Const reference to element at specified position
+ * 
+ * @throws std::out_of_range If index >= size and bounds checking is
+ * enabled
  */
-template<class T>
-typename Vector<T>::reference Vector<T>::operator[](size_type index) {
+template<class T, class Allocator, class Policy>
+typename Vector<T, Allocator, Policy>::const_reference Vector<T, Allocator, Policy>::operator[](size_type index) const {
+#if COLLECTIONS_BOUNDS_CHECK
 	if (index >= size_)
 		throw std::out_of_range("Index out of range");
+#endif
 	return data_[index];
 }
 
@@ -131,22 +205,25 @@ typename Vector<T>::reference Vector<T>::operator[](size_type index) {
  * @brief Copy assignment operator
  * 
  * @details Replaces contents with a deep copy of another vector. Handles
- * self-assignment correctly. Deallocates existing memory before copying.
+ * self-assignment correctly. Existing storage is reused when it is
+ * large enough to hold the source elements.
  * 
  * @ingroup linear_containers
  * 
  * @param[in] other Vector to copy from
  * @return Reference to this vector
  */
-template<class T>
-Vector<T> &Vector<T>::operator=(const Vector &other) {
+template<class T, class Allocator, class Policy>
+Vector<T, Allocator, Policy> &Vector<T, Allocator, Policy>::operator=(const Vector &other) {
 	if (this != &other) {
-		delete[] data_;
-		size_ = other.size_;
-		capacity_ = other.capacity_;
-		data_ = new T[capacity_];
-		for (size_type i = 0; i < size_; ++i)
-			data_[i] = other.data_[i];
+		destroy_elements();
+		if (other.size_ > capacity_) {
+			release();
+			data_ = alloc_traits::allocate(alloc_, other.capacity_);
+			capacity_ = other.capacity_;
+		}
+		for (; size_ < other.size_; ++size_)
+			alloc_traits::construct(alloc_, data_ + size_, other.data_[size_]);
 	}
 	return *this;
 }
@@ -155,17 +232,37 @@ Vector<T> &Vector<T>::operator=(const Vector &other) {
  * @brief Move assignment operator
  * 
  * @details Transfers ownership of resources from another vector without
- * copying. Handles self-assignment. Source vector is left empty.
+ * copying. Handles self-assignment. Source vector is left empty. When
+ * the allocator does not propagate and the two allocators differ, this
+ * vector cannot free other's buffer, so the elements are moved into
+ * storage of its own instead; only that case can throw.
  * 
  * @ingroup linear_containers
  * 
  * @param[in] other Vector to move from (rvalue reference)
  * @return Reference to this vector
  */
-template<class T>
-Vector<T> &Vector<T>::operator=(Vector &&other) noexcept {
+template<class T, class Allocator, class Policy>
+Vector<T, Allocator, Policy> &Vector<T, Allocator, Policy>::operator=(Vector &&other)
+	noexcept(alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value) {
 	if (this != &other) {
-		delete[] data_;
+		if constexpr (!alloc_traits::propagate_on_container_move_assignment::value && !alloc_traits::is_always_equal::value) {
+			if (alloc_ != other.alloc_) {
+				destroy_elements();
+				if (other.size_ > capacity_) {
+					release();
+					data_ = alloc_traits::allocate(alloc_, other.capacity_);
+					capacity_ = other.capacity_;
+				}
+				for (; size_ < other.size_; ++size_)
+					alloc_traits::construct(alloc_, data_ + size_, std::move(other.data_[size_]));
+				other.clear();
+				return *this;
+			}
+		}
+		release();
+		if constexpr (alloc_traits::propagate_on_container_move_assignment::value)
+			alloc_ = std::move(other.alloc_);
 		data_ = other.data_;
 		size_ = other.size_;
 		capacity_ = other.capacity_;
@@ -179,15 +276,14 @@ Vector<T> &Vector<T>::operator=(Vector &&other) noexcept {
 /**
  * @brief Removes all elements from vector
  * 
- * @details Sets size to zero and reduces capacity. Does not release all
- * memory but shrinks capacity to fit remaining elements.
+ * @details Destroys every live element and sets size to zero. The
+ * storage is kept for reuse; call shrink_to_fit() to release it.
  * 
  * @ingroup linear_containers
  */
-template<class T>
-void Vector<T>::clear() noexcept {
-	size_ = 0;
-	shrink_to_fit();
+template<class T, class Allocator, class Policy>
+void Vector<T, Allocator, Policy>::clear() noexcept {
+	destroy_elements();
 }
 
 /**
@@ -203,8 +299,28 @@ void Vector<T>::clear() noexcept {
  * 
  * @throws std::out_of_range If index >= size
  */
-template<class T>
-typename Vector<T>::const_reference Vector<T>::at(size_type index) const {
+template<class T, class Allocator, class Policy>
+typename Vector<T, Allocator, Policy>::const_reference Vector<T, Allocator, Policy>::at(size_type index) const {
+	if (index >= size_)
+		throw std::out_of_range("Index out of range");
+	return data_[index];
+}
+
+/**
+ * @brief Access element with bounds checking
+ * 
+ * @details Provides mutable access to element at specified index. The
+ * index is always checked, whatever COLLECTIONS_BOUNDS_CHECK says.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] index Position of element to access
+ * @return Reference to element at specified position
+ * 
+ * @throws std::out_of_range If index >= size
+ */
+template<class T, class Allocator, class Policy>
+typename Vector<T, Allocator, Policy>::reference Vector<T, Allocator, Policy>::at(size_type index) {
 	if (index >= size_)
 		throw std::out_of_range("Index out of range");
 	return data_[index];
@@ -214,21 +330,69 @@ typename Vector<T>::const_reference Vector<T>::at(size_type index) const {
  * @brief Adds element to end of vector
  * 
  * @details Appends the given value to the end of the vector.
- * Automatically increases capacity if needed using exponential growth
- * strategy.
+ * Automatically increases capacity if needed as decided by the
+ * capacity policy.
  * 
  * @ingroup linear_containers
  * 
  * @param[in] value Element to append
  */
-template<class T>
-void Vector<T>::add(const_reference value) {
-	if (size_ == capacity_)
-		reserve(capacity_ == 0 ? 1 : capacity_ * 2);
-	data_[size_] = value;
+template<class T, class Allocator, class Policy>
+void Vector<T, Allocator, Policy>::add(const_reference value) {
+	if (size_ == capacity_) {
+		grow_and_construct(value);
+		return;
+	}
+	alloc_traits::construct(alloc_, data_ + size_, value);
+	size_++;
+}
+
+/**
+ * @brief Moves element to end of vector
+ * 
+ * @details Appends the given value by move construction, avoiding a
+ * copy of its contents. Automatically increases capacity if needed as
+ * decided by the capacity policy.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] value Element to append (rvalue reference)
+ */
+template<class T, class Allocator, class Policy>
+void Vector<T, Allocator, Policy>::add(value_type &&value) {
+	if (size_ == capacity_) {
+		grow_and_construct(std::move(value));
+		return;
+	}
+	alloc_traits::construct(alloc_, data_ + size_, std::move(value));
 	size_++;
 }
 
+/**
+ * @brief Constructs element in place at end of vector
+ * 
+ * @details Forwards args to the element constructor directly in the
+ * vector's storage, so no temporary is created. The arguments may
+ * refer to elements of this vector even when it has to grow.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @tparam Args Types of the constructor arguments
+ * @param[in] args Arguments forwarded to the element constructor
+ * @return Reference to the new element
+ */
+template<class T, class Allocator, class Policy>
+template <class... Args>
+typename Vector<T, Allocator, Policy>::reference Vector<T, Allocator, Policy>::emplace_back(Args&&... args) {
+	if (size_ == capacity_)
+		grow_and_construct(std::forward<Args>(args)...);
+	else {
+		alloc_traits::construct(alloc_, data_ + size_, std::forward<Args>(args)...);
+		size_++;
+	}
+	return data_[size_ - 1];
+}
+
 /**
  * @brief Inserts element at specified position
  * 
@@ -244,15 +408,85 @@ void Vector<T>::add(const_reference value) {
  * 
  * @throws std::out_of_range If index > size
  */
-template<class T>
-typename Vector<T>::pointer Vector<T>::insert(size_type index, const_reference value) {
+template<class T, class Allocator, class Policy>
+typename Vector<T, Allocator, Policy>::pointer Vector<T, Allocator, Policy>::insert(size_type index, const_reference value) {
 	if (index > size_) throw std::out_of_range("insert index out of range");
+	if (index == size_) {
+		add(value);
+		return data_ + index;
+	}
+	value_type copy(value);
 	if (size_ == capacity_)
-		reserve(capacity_ == 0 ? 1 : capacity_ * 2);
-	for (size_type i = size_; i > index; --i)
-		data_[i] = data_[i - 1];
-	data_[index] = value;
+		reserve(Policy::grow(capacity_, size_ + 1));
+	alloc_traits::construct(alloc_, data_ + size_, std::move(data_[size_ - 1]));
 	++size_;
+	std::move_backward(data_ + index, data_ + size_ - 2, data_ + size_ - 1);
+	data_[index] = std::move(copy);
+	return data_ + index;
+}
+
+/**
+ * @brief Appends a range of elements
+ * 
+ * @details Copies [first, last) to the end of the vector with at most
+ * one reallocation. The range may come from this vector.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @tparam InputIt Type of the source iterators
+ * @param[in] first Start of the range to append
+ * @param[in] last End of the range to append
+ */
+template<class T, class Allocator, class Policy>
+template <class InputIt>
+void Vector<T, Allocator, Policy>::append(InputIt first, InputIt last) {
+	insert(size_, first, last);
+}
+
+/**
+ * @brief Inserts a range of elements at specified position
+ * 
+ * @details Inserts copies of [first, last) before the element at
+ * index. The tail is shifted once by the length of the range (with a
+ * single memmove for trivially relocatable types) and at most one
+ * reallocation is performed. Ranges that cannot be measured up front,
+ * or that point into this vector, are buffered first.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @tparam InputIt Type of the source iterators
+ * @param[in] index Position where to insert (must be <= size)
+ * @param[in] first Start of the range to insert
+ * @param[in] last End of the range to insert
+ * @return Pointer to the first inserted element
+ * 
+ * @throws std::out_of_range If index > size
+ */
+template<class T, class Allocator, class Policy>
+template <class InputIt>
+typename Vector<T, Allocator, Policy>::pointer Vector<T, Allocator, Policy>::insert(size_type index, InputIt first, InputIt last) {
+	if (index > size_) throw std::out_of_range("insert index out of range");
+	if constexpr (!is_forward_iterator<InputIt>::value) {
+		Vector buffer(alloc_);
+		for (; first != last; ++first)
+			buffer.emplace_back(*first);
+		insert_range(index, std::make_move_iterator(buffer.begin()), buffer.size());
+	}
+	else if constexpr (std::is_convertible_v<InputIt, const_pointer>) {
+		const_pointer src = first;
+		size_type count = static_cast<size_type>(std::distance(first, last));
+		if (std::less_equal<const_pointer>()(data_, src) && std::less<const_pointer>()(src, data_ + size_)) {
+			Vector buffer(alloc_);
+			buffer.reserve(count);
+			for (size_type i = 0; i < count; ++i)
+				buffer.add(src[i]);
+			insert_range(index, std::make_move_iterator(buffer.begin()), count);
+		}
+		else
+			insert_range(index, first, count);
+	}
+	else
+		insert_range(index, first, static_cast<size_type>(std::distance(first, last)));
 	return data_ + index;
 }
 
@@ -260,27 +494,95 @@ typename Vector<T>::pointer Vector<T>::insert(size_type index, const_reference v
  * @brief Removes element at specified position
  * 
  * @details Removes the element at given index and shifts all subsequent
- * elements one position to the left. Reduces capacity if size becomes
- * significantly smaller.
+ * elements one position to the left. Capacity may be reduced as
+ * decided by the capacity policy.
  * 
  * @ingroup linear_containers
  * 
  * @param[in] index Position of element to remove
- * @return Copy of the removed element
+ * @return The removed element
  * 
  * @throws std::out_of_range If index >= size
  */
-template<class T>
-typename Vector<T>::value_type Vector<T>::erase(size_type index) {
+template<class T, class Allocator, class Policy>
+typename Vector<T, Allocator, Policy>::value_type Vector<T, Allocator, Policy>::erase(size_type index) {
 	if (index >= size_) throw std::out_of_range("erase index out of range");
-	value_type val = data_[index];
-	for (size_type i = index; i < size_ - 1; ++i)
-		data_[i] = data_[i + 1];
-	--size_;
-	shrink_to_fit();
+	value_type val = std::move(data_[index]);
+	erase(index, index + 1);
 	return val;
 }
 
+/**
+ * @brief Removes a range of elements
+ * 
+ * @details Removes the elements in [first, last) and closes the gap
+ * with a single shift of the tail, using one memmove for trivially
+ * relocatable types. Capacity may be reduced as decided by the
+ * capacity policy.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] first Index of the first element to remove
+ * @param[in] last Index one past the last element to remove
+ * @return Number of elements removed
+ * 
+ * @throws std::out_of_range If first > last or last > size
+ */
+template<class T, class Allocator, class Policy>
+typename Vector<T, Allocator, Policy>::size_type Vector<T, Allocator, Policy>::erase(size_type first, size_type last) {
+	if (first > last || last > size_) throw std::out_of_range("erase range out of range");
+	size_type count = last - first;
+	if (count == 0)
+		return 0;
+	if constexpr (is_trivially_relocatable_v<T>) {
+		for (size_type i = first; i < last; ++i)
+			alloc_traits::destroy(alloc_, data_ + i);
+		relocate_overlapping(data_ + last, size_ - last, data_ + first);
+	}
+	else {
+		std::move(data_ + last, data_ + size_, data_ + first);
+		for (size_type i = size_ - count; i < size_; ++i)
+			alloc_traits::destroy(alloc_, data_ + i);
+	}
+	size_ -= count;
+	shrink_by_policy();
+	return count;
+}
+
+/**
+ * @brief Removes every element matching a predicate
+ * 
+ * @details Compacts the kept elements towards the front in a single
+ * pass, so each survivor is moved at most once, then destroys the
+ * leftover tail. Capacity may be reduced as decided by the capacity
+ * policy.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @tparam Predicate Unary predicate taking a const reference
+ * @param[in] pred Returns true for elements to remove
+ * @return Number of elements removed
+ */
+template<class T, class Allocator, class Policy>
+template <class Predicate>
+typename Vector<T, Allocator, Policy>::size_type Vector<T, Allocator, Policy>::erase_if(Predicate pred) {
+	size_type kept = 0;
+	while (kept < size_ && !pred(static_cast<const_reference>(data_[kept])))
+		++kept;
+	for (size_type i = kept + 1; i < size_; ++i) {
+		if (!pred(static_cast<const_reference>(data_[i])))
+			data_[kept++] = std::move(data_[i]);
+	}
+	size_type removed = size_ - kept;
+	if (removed == 0)
+		return 0;
+	for (size_type i = kept; i < size_; ++i)
+		alloc_traits::destroy(alloc_, data_ + i);
+	size_ = kept;
+	shrink_by_policy();
+	return removed;
+}
+
 /**
  * @brief Returns the number of elements
  * 
@@ -291,8 +593,8 @@ typename Vector<T>::value_type Vector<T>::erase(size_type index) {
  * 
  * @return Number of elements in vector
  */
-template<class T>
-typename Vector<T>::size_type Vector<T>::size() const noexcept { return size_; }
+template<class T, class Allocator, class Policy>
+typename Vector<T, Allocator, Policy>::size_type Vector<T, Allocator, Policy>::size() const noexcept { return size_; }
 
 /**
  * @brief Returns the capacity
@@ -304,8 +606,8 @@ typename Vector<T>::size_type Vector<T>::size() const noexcept { return size_; }
  * 
  * @return Capacity of currently allocated storage
  */
-template<class T>
-typename Vector<T>::size_type Vector<T>::capacity() const noexcept { return capacity_; }
+template<class T, class Allocator, class Policy>
+typename Vector<T, Allocator, Policy>::size_type Vector<T, Allocator, Policy>::capacity() const noexcept { return capacity_; }
 
 /**
  * @brief Checks if vector is empty
@@ -316,8 +618,8 @@ typename Vector<T>::size_type Vector<T>::capacity() const noexcept { return capa
  * 
  * @return true if vector is empty, false otherwise
  */
-template<class T>
-bool Vector<T>::empty() const noexcept { return size_ == 0; }
+template<class T, class Allocator, class Policy>
+bool Vector<T, Allocator, Policy>::empty() const noexcept { return size_ == 0; }
 
 /**
  * @brief Returns pointer to underlying array
@@ -329,8 +631,8 @@ bool Vector<T>::empty() const noexcept { return size_ == 0; }
  * 
  * @return Pointer to underlying element storage
  */
-template<class T>
-typename Vector<T>::pointer Vector<T>::data() noexcept { return data_; }
+template<class T, class Allocator, class Policy>
+typename Vector<T, Allocator, Policy>::pointer Vector<T, Allocator, Policy>::data() noexcept { return data_; }
 
 /**
  * @brief Returns const pointer to underlying array
@@ -342,8 +644,8 @@ typename Vector<T>::pointer Vector<T>::data() noexcept { return data_; }
  * 
  * @return Const pointer to underlying element storage
  */
-template<class T>
-typename Vector<T>::const_pointer Vector<T>::data() const noexcept { return data_; }
+template<class T, class Allocator, class Policy>
+typename Vector<T, Allocator, Policy>::const_pointer Vector<T, Allocator, Policy>::data() const noexcept { return data_; }
 
 /**
  * @brief Returns iterator to beginning
@@ -355,8 +657,8 @@ typename Vector<T>::const_pointer Vector<T>::data() const noexcept { return data
  * 
  * @return Iterator to the first element
  */
-template<class T>
-typename Vector<T>::iterator Vector<T>::begin() noexcept { return data_; }
+template<class T, class Allocator, class Policy>
+typename Vector<T, Allocator, Policy>::iterator Vector<T, Allocator, Policy>::begin() noexcept { return data_; }
 
 /**
  * @brief Returns const iterator to beginning
@@ -368,8 +670,8 @@ typename Vector<T>::iterator Vector<T>::begin() noexcept { return data_; }
  * 
  * @return Const iterator to the first element
  */
-template<class T>
-typename Vector<T>::const_iterator Vector<T>::begin() const noexcept { return data_; }
+template<class T, class Allocator, class Policy>
+typename Vector<T, Allocator, Policy>::const_iterator Vector<T, Allocator, Policy>::begin() const noexcept { return data_; }
 
 /**
  * @brief Returns iterator to end
@@ -381,8 +683,8 @@ typename Vector<T>::const_iterator Vector<T>::begin() const noexcept { return da
  * 
  * @return Iterator to the element following the last element
  */
-template<class T>
-typename Vector<T>::iterator Vector<T>::end() noexcept { return data_ + size_; }
+template<class T, class Allocator, class Policy>
+typename Vector<T, Allocator, Policy>::iterator Vector<T, Allocator, Policy>::end() noexcept { return data_ + size_; }
 
 /**
  * @brief Returns const iterator to end
@@ -394,58 +696,339 @@ typename Vector<T>::iterator Vector<T>::end() noexcept { return data_ + size_; }
  * 
  * @return Const iterator to the element following the last element
  */
-template<class T>
-typename Vector<T>::const_iterator Vector<T>::end() const noexcept { return data_ + size_; }
+template<class T, class Allocator, class Policy>
+typename Vector<T, Allocator, Policy>::const_iterator Vector<T, Allocator, Policy>::end() const noexcept { return data_ + size_; }
+
+/**
+ * @brief Returns a copy of the allocator
+ * 
+ * @details Returns the allocator used to obtain the vector's storage.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @return Copy of the associated allocator
+ */
+template<class T, class Allocator, class Policy>
+typename Vector<T, Allocator, Policy>::allocator_type Vector<T, Allocator, Policy>::get_allocator() const noexcept { return alloc_; }
 
 /**
  * @brief Increases capacity to at least new_cap
  * 
  * @details Allocates new storage if new_cap is greater than current
- * capacity. Moves existing elements to new storage using move
- * semantics. Does nothing if new_cap <= current capacity.
+ * capacity and relocates the existing elements into it. Does nothing
+ * if new_cap <= current capacity. Reserving ahead of a known number of
+ * insertions avoids every intermediate reallocation.
  * 
  * @ingroup linear_containers
  * 
  * @param[in] new_cap Minimum capacity to reserve
  */
-template<class T>
-void Vector<T>::reserve(size_type new_cap) {
-	if (new_cap > capacity_) {
-		pointer new_data = new T[new_cap];
-		for (size_type i = 0; i < size_; ++i)
-			new_data[i] = std::move(data_[i]);
-		delete[] data_;
-		data_ = new_data;
-		capacity_ = new_cap;
+template<class T, class Allocator, class Policy>
+void Vector<T, Allocator, Policy>::reserve(size_type new_cap) {
+	if (new_cap > capacity_)
+		reallocate(new_cap);
+}
+
+/**
+ * @brief Reduces capacity to the current size
+ * 
+ * @details Reallocates so that capacity equals size. If the vector is
+ * empty, the storage is released entirely.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, class Allocator, class Policy>
+void Vector<T, Allocator, Policy>::shrink_to_fit() {
+	if (size_ == 0)
+		release();
+	else if (size_ < capacity_)
+		reallocate(size_);
+}
+
+/**
+ * @brief Changes the number of elements
+ * 
+ * @details Destroys trailing elements when count is smaller than the
+ * current size, or appends value-initialized elements when it is
+ * larger. Growth performs at most one reallocation.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] count New number of elements
+ */
+template<class T, class Allocator, class Policy>
+void Vector<T, Allocator, Policy>::resize(size_type count) {
+	if (count > capacity_)
+		reserve(Policy::grow(capacity_, count));
+	for (; size_ < count; ++size_)
+		alloc_traits::construct(alloc_, data_ + size_);
+	while (size_ > count)
+		alloc_traits::destroy(alloc_, data_ + --size_);
+}
+
+/**
+ * @brief Changes the number of elements, filling with copies of value
+ * 
+ * @details Destroys trailing elements when count is smaller than the
+ * current size, or appends copies of value when it is larger. Growth
+ * performs at most one reallocation, and value may refer to an element
+ * of this vector.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] count New number of elements
+ * @param[in] value Value to copy into the appended elements
+ */
+template<class T, class Allocator, class Policy>
+void Vector<T, Allocator, Policy>::resize(size_type count, const_reference value) {
+	if (count > capacity_) {
+		value_type copy(value);
+		reserve(Policy::grow(capacity_, count));
+		for (; size_ < count; ++size_)
+			alloc_traits::construct(alloc_, data_ + size_, copy);
+		return;
+	}
+	for (; size_ < count; ++size_)
+		alloc_traits::construct(alloc_, data_ + size_, value);
+	while (size_ > count)
+		alloc_traits::destroy(alloc_, data_ + --size_);
+}
+
+/**
+ * @brief Gives back storage after a removal when the policy asks for it
+ * 
+ * @details Queries Policy::shrink with the current size and capacity
+ * and reallocates only if a smaller capacity is returned. With the
+ * default policy this happens once size falls below a quarter of the
+ * capacity, which keeps alternating insertions and removals at a
+ * capacity boundary from reallocating every time. The policy is
+ * applied until it settles, so a bulk removal shrinks with a single
+ * reallocation.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, class Allocator, class Policy>
+void Vector<T, Allocator, Policy>::shrink_by_policy() {
+	size_type new_cap = capacity_;
+	for (size_type next; (next = Policy::shrink(size_, new_cap)) < new_cap && next >= size_; )
+		new_cap = next;
+	if (new_cap >= capacity_)
+		return;
+	if (new_cap == 0)
+		release();
+	else
+		reallocate(new_cap);
+}
+
+/**
+ * @brief Moves the elements into freshly allocated storage
+ * 
+ * @details Allocates raw storage for new_cap elements and transfers
+ * the live elements into it. On failure the new block is released and
+ * the vector is left unchanged.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @param[in] new_cap Capacity of the new storage (must be >= size)
+ */
+template<class T, class Allocator, class Policy>
+void Vector<T, Allocator, Policy>::reallocate(size_type new_cap) {
+	pointer new_data = alloc_traits::allocate(alloc_, new_cap);
+	try {
+		transfer(new_data, new_cap);
+	}
+	catch (...) {
+		alloc_traits::deallocate(alloc_, new_data, new_cap);
+		throw;
 	}
 }
 
 /**
- * @brief Reduces capacity to better fit current size
+ * @brief Transfers the live elements into new storage
  * 
- * @details If size is less than half of capacity, reallocates to halve
- * the capacity. If size is zero, deallocates all memory. Helps reduce
- * memory waste after many deletions.
+ * @details Relocates the elements into new_data and adopts it as the
+ * vector's storage. Trivially relocatable types are moved with a
+ * single memcpy; other types are move-constructed one by one. If that
+ * throws, the vector is left unchanged and the caller still owns
+ * new_data.
  * 
  * @ingroup linear_containers
+ * 
+ * @param[in] new_data Uninitialized storage for at least size elements
+ * @param[in] new_cap Capacity of new_data
  */
-template<class T>
-void Vector<T>::shrink_to_fit() {
-	if (size_ > 0) {
-		if (size_ < capacity_ / 2) {
-			pointer new_data = new T[capacity_ / 2];
-			for (size_type i = 0; i < size_; ++i)
-				new_data[i] = std::move(data_[i]);
-			delete[] data_;
+template<class T, class Allocator, class Policy>
+void Vector<T, Allocator, Policy>::transfer(pointer new_data, size_type new_cap) {
+	relocate_n(alloc_, data_, size_, new_data);
+	if (data_)
+		alloc_traits::deallocate(alloc_, data_, capacity_);
+	data_ = new_data;
+	capacity_ = new_cap;
+}
+
+/**
+ * @brief Grows the storage and constructs a new last element
+ * 
+ * @details Builds the new element in the enlarged block before the
+ * existing elements are moved, so args may safely refer to an element
+ * of this vector.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @tparam Args Types of the constructor arguments
+ * @param[in] args Arguments forwarded to the element constructor
+ */
+template<class T, class Allocator, class Policy>
+template <class... Args>
+void Vector<T, Allocator, Policy>::grow_and_construct(Args&&... args) {
+	size_type new_cap = Policy::grow(capacity_, size_ + 1);
+	pointer new_data = alloc_traits::allocate(alloc_, new_cap);
+	try {
+		alloc_traits::construct(alloc_, new_data + size_, std::forward<Args>(args)...);
+	}
+	catch (...) {
+		alloc_traits::deallocate(alloc_, new_data, new_cap);
+		throw;
+	}
+	try {
+		transfer(new_data, new_cap);
+	}
+	catch (...) {
+		alloc_traits::destroy(alloc_, new_data + size_);
+		alloc_traits::deallocate(alloc_, new_data, new_cap);
+		throw;
+	}
+	++size_;
+}
+
+/**
+ * @brief Inserts count elements from a forward range
+ * 
+ * @details Opens a gap of count elements at index and copies the range
+ * into it. When the storage is too small, the range is built directly
+ * in a new block and the old elements are relocated around it, so
+ * every element moves at most once. If T's move constructor may throw
+ * and T is not trivially relocatable, the old elements are copied into
+ * the new block instead, or moved if T cannot be copied, and a failure
+ * then leaves the vector unchanged only in the copying case. Otherwise
+ * the tail is shifted in place, with a single memmove for trivially
+ * relocatable types.
+ * 
+ * @ingroup linear_containers
+ * 
+ * @tparam ForwardIt Type of the source iterator
+ * @param[in] index Position of the gap (must be <= size)
+ * @param[in] first Start of a range holding at least count elements
+ * @param[in] count Number of elements to insert
+ */
+template<class T, class Allocator, class Policy>
+template <class ForwardIt>
+void Vector<T, Allocator, Policy>::insert_range(size_type index, ForwardIt first, size_type count) {
+	if (count == 0)
+		return;
+	if (size_ + count > capacity_) {
+		size_type new_cap = Policy::grow(capacity_, size_ + count);
+		if constexpr (is_trivially_relocatable_v<T> || std::is_nothrow_move_constructible_v<T>) {
+			pointer new_data = alloc_traits::allocate(alloc_, new_cap);
+			size_type built = 0;
+			try {
+				for (; built < count; ++built, ++first)
+					alloc_traits::construct(alloc_, new_data + index + built, *first);
+			}
+			catch (...) {
+				while (built > 0)
+					alloc_traits::destroy(alloc_, new_data + index + --built);
+				alloc_traits::deallocate(alloc_, new_data, new_cap);
+				throw;
+			}
+			relocate_n(alloc_, data_, index, new_data);
+			relocate_n(alloc_, data_ + index, size_ - index, new_data + index + count);
+			if (data_)
+				alloc_traits::deallocate(alloc_, data_, capacity_);
 			data_ = new_data;
-			capacity_ /= 2;
+			capacity_ = new_cap;
+			size_ += count;
 		}
+		else {
+			Vector rebuilt(alloc_);
+			rebuilt.reserve(new_cap);
+			for (size_type i = 0; i < index; ++i)
+				rebuilt.emplace_back(std::move_if_noexcept(data_[i]));
+			for (size_type i = 0; i < count; ++i, ++first)
+				rebuilt.emplace_back(*first);
+			for (size_type i = index; i < size_; ++i)
+				rebuilt.emplace_back(std::move_if_noexcept(data_[i]));
+			*this = std::move(rebuilt);
+		}
+		return;
+	}
+	if constexpr (is_trivially_relocatable_v<T>) {
+		relocate_overlapping(data_ + index, size_ - index, data_ + index + count);
+		size_type built = 0;
+		try {
+			for (; built < count; ++built, ++first)
+				alloc_traits::construct(alloc_, data_ + index + built, *first);
+		}
+		catch (...) {
+			while (built > 0)
+				alloc_traits::destroy(alloc_, data_ + index + --built);
+			relocate_overlapping(data_ + index + count, size_ - index, data_ + index);
+			throw;
+		}
+		size_ += count;
 	}
 	else {
-		delete[] data_;
-		data_ = nullptr;
-		capacity_ = size_;
+		size_type old_size = size_;
+		size_type after = old_size - index;
+		if (after > count) {
+			for (size_type i = 0; i < count; ++i, ++size_)
+				alloc_traits::construct(alloc_, data_ + size_, std::move(data_[old_size - count + i]));
+			std::move_backward(data_ + index, data_ + old_size - count, data_ + old_size);
+			for (size_type i = 0; i < count; ++i, ++first)
+				data_[index + i] = *first;
+		}
+		else {
+			ForwardIt mid = first;
+			std::advance(mid, after);
+			for (ForwardIt it = mid; size_ < index + count; ++it, ++size_)
+				alloc_traits::construct(alloc_, data_ + size_, *it);
+			for (size_type i = index; i < old_size; ++i, ++size_)
+				alloc_traits::construct(alloc_, data_ + size_, std::move(data_[i]));
+			std::copy(first, mid, data_ + index);
+		}
 	}
 }
 
+/**
+ * @brief Destroys every live element
+ * 
+ * @details Runs the destructor of each stored element and sets size to
+ * zero. The storage itself is kept.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, class Allocator, class Policy>
+void Vector<T, Allocator, Policy>::destroy_elements() noexcept {
+	for (size_type i = 0; i < size_; ++i)
+		alloc_traits::destroy(alloc_, data_ + i);
+	size_ = 0;
+}
+
+/**
+ * @brief Destroys all elements and frees the storage
+ * 
+ * @details Leaves the vector empty with null data pointer and zero
+ * capacity.
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, class Allocator, class Policy>
+void Vector<T, Allocator, Policy>::release() noexcept {
+	destroy_elements();
+	if (data_)
+		alloc_traits::deallocate(alloc_, data_, capacity_);
+	data_ = nullptr;
+	capacity_ = 0;
+}
+
 #endif
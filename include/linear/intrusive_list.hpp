@@ -0,0 +1,171 @@
+/**
+ * @file intrusive_list.hpp
+ * @brief Doubly linked list threading through hooks inside the elements
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef INTRUSIVE_LIST_HPP
+#define INTRUSIVE_LIST_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../memory/member_owner.hpp"
+
+/**
+ * @class IntrusiveListHook
+ * @brief Link fields an object embeds to be stored in an IntrusiveList
+ * 
+ * @details An object can be on as many lists at once as it has hooks.
+ * Copying an object gives the copy an unlinked hook, and assigning to
+ * an object leaves its hook and list membership alone. A hook must be
+ * unlinked, by erasing the object from its list or clearing the list,
+ * before the object is destroyed.
+ * 
+ * @ingroup linear_containers
+ */
+class IntrusiveListHook {
+public:
+	IntrusiveListHook() noexcept;
+	IntrusiveListHook(const IntrusiveListHook &other) noexcept;
+	IntrusiveListHook &operator=(const IntrusiveListHook &other) noexcept;
+
+	bool is_linked() const noexcept;
+
+private:
+	IntrusiveListHook	*prev_;  ///< Previous hook, or nullptr when unlinked
+	IntrusiveListHook	*next_;  ///< Next hook, or nullptr when unlinked
+
+	template<class T, IntrusiveListHook T::*Hook>
+	friend class IntrusiveList;
+};
+
+/**
+ * @class IntrusiveList
+ * @brief Doubly linked list of objects that carry their own links
+ * 
+ * @details Unlike DoubleLinkedList, which copies every element into a
+ * node it allocates, an IntrusiveList links the objects themselves
+ * through the IntrusiveListHook member Hook. Inserting, erasing and
+ * moving an object between lists never allocates or copies, cannot
+ * throw once the arguments are checked, and an object can be removed in
+ * O(1) knowing only its address. The list does not own its elements:
+ * clearing or destroying it only unlinks them, and their lifetime stays
+ * with the caller.
+ * 
+ * The list is circular around a sentinel hook that end() points to,
+ * so no operation has to special-case the first or last element.
+ * 
+ * @tparam T Type of the linked objects, a standard-layout type
+ * @tparam Hook Member of T used as this list's link
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, IntrusiveListHook T::*Hook>
+class IntrusiveList {
+public:
+	/**
+	 * @class BasicIterator
+	 * @brief Bidirectional iterator over the linked objects
+	 * 
+	 * @details Walks from hook to hook. Decrementing end() yields the
+	 * last element. The const instantiation only hands out const
+	 * references and can be constructed from a mutable iterator.
+	 * 
+	 * @tparam IsConst Whether the iterator gives read-only access
+	 */
+	template<bool IsConst>
+	class BasicIterator {
+	public:
+		using iterator_category	= std::bidirectional_iterator_tag;             ///< Iterator category tag
+		using value_type		= T;                                           ///< Type of elements
+		using difference_type	= std::ptrdiff_t;                              ///< Distance between iterators
+		using pointer			= std::conditional_t<IsConst, const T*, T*>;   ///< Pointer to element
+		using reference			= std::conditional_t<IsConst, const T&, T&>;   ///< Reference to element
+		using hook_pointer		= std::conditional_t<IsConst, const IntrusiveListHook*, IntrusiveListHook*>; ///< Pointer to hook
+
+		BasicIterator() noexcept;
+		explicit BasicIterator(hook_pointer hook) noexcept;
+		BasicIterator(const BasicIterator<false>& other) noexcept;
+		BasicIterator& operator=(const BasicIterator& other) noexcept = default;
+
+		reference operator*() const;
+		pointer operator->() const;
+		BasicIterator& operator++();
+		BasicIterator operator++(int);
+		BasicIterator& operator--();
+		BasicIterator operator--(int);
+		template<bool OtherConst>
+		bool operator!=(const BasicIterator<OtherConst>& other) const;
+		template<bool OtherConst>
+		bool operator==(const BasicIterator<OtherConst>& other) const;
+
+	private:
+		hook_pointer	current;  ///< Hook of current element, or the sentinel
+
+		friend class BasicIterator<!IsConst>;
+		friend class IntrusiveList;
+	};
+
+	using Iterator			= BasicIterator<false>; ///< Mutable iterator
+	using ConstIterator		= BasicIterator<true>;  ///< Read-only iterator
+
+	using value_type		= T;              ///< Type of linked objects
+	using size_type			= unsigned long;  ///< Type for sizes
+	using reference			= T&;             ///< Reference to element
+	using const_reference	= const T&;       ///< Const reference to element
+	using pointer			= T*;             ///< Pointer to element
+	using const_pointer		= const T*;       ///< Const pointer to element
+	using iterator			= Iterator;       ///< Iterator type
+	using const_iterator	= ConstIterator;  ///< Const iterator type
+
+	IntrusiveList() noexcept;
+	IntrusiveList(const IntrusiveList &other) = delete;
+	IntrusiveList(IntrusiveList &&other) noexcept;
+	~IntrusiveList();
+
+	IntrusiveList &operator=(const IntrusiveList &other) = delete;
+	IntrusiveList &operator=(IntrusiveList &&other) noexcept;
+
+	void clear() noexcept;
+	reference front();
+	const_reference front() const;
+	reference back();
+	const_reference back() const;
+	void add(reference value);
+	void push_front(reference value);
+	void pop_front();
+	void pop_back();
+	iterator insert(const_iterator pos, reference value);
+	iterator erase(const_iterator pos);
+	void remove(reference value);
+	void splice(const_iterator pos, IntrusiveList &other) noexcept;
+	void splice(const_iterator pos, IntrusiveList &other, const_iterator first, const_iterator last) noexcept;
+
+	size_type size() const noexcept;
+	bool empty() const noexcept;
+
+	iterator iterator_to(reference value) noexcept;
+	const_iterator iterator_to(const_reference value) const noexcept;
+	iterator begin() noexcept;
+	iterator end() noexcept;
+	const_iterator begin() const noexcept;
+	const_iterator end() const noexcept;
+
+private:
+	IntrusiveListHook	sentinel_;  ///< Links to the last and first elements
+	size_type			size_;      ///< Number of linked objects
+
+	static T *owner(const IntrusiveListHook *hook) noexcept;
+	static void link_before(IntrusiveListHook *next, IntrusiveListHook *hook) noexcept;
+	static void unlink(IntrusiveListHook *hook) noexcept;
+	void take(IntrusiveList &other) noexcept;
+};
+
+#include "internal/intrusive_list.tpp"
+
+#endif
@@ -0,0 +1,159 @@
+/**
+ * @file intrusive_slist.hpp
+ * @brief Singly linked list threading through hooks inside the elements
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef INTRUSIVE_SLIST_HPP
+#define INTRUSIVE_SLIST_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../memory/member_owner.hpp"
+
+/**
+ * @class IntrusiveSListHook
+ * @brief Link field an object embeds to be stored in an IntrusiveSList
+ * 
+ * @details One pointer wide. Copying an object gives the copy an
+ * unlinked hook, and assigning to an object leaves its hook and list
+ * membership alone. A hook must be unlinked before the object is
+ * destroyed.
+ * 
+ * @ingroup linear_containers
+ */
+class IntrusiveSListHook {
+public:
+	IntrusiveSListHook() noexcept;
+	IntrusiveSListHook(const IntrusiveSListHook &other) noexcept;
+	IntrusiveSListHook &operator=(const IntrusiveSListHook &other) noexcept;
+
+	bool is_linked() const noexcept;
+
+private:
+	IntrusiveSListHook	*next_;  ///< Next hook, or nullptr when unlinked
+
+	template<class T, IntrusiveSListHook T::*Hook>
+	friend class IntrusiveSList;
+};
+
+/**
+ * @class IntrusiveSList
+ * @brief Singly linked list of objects that carry their own link
+ * 
+ * @details The intrusive counterpart of LinkedList: objects are linked
+ * through their IntrusiveSListHook member Hook instead of being copied
+ * into allocated nodes, so linking and unlinking never allocate, copy
+ * or throw once the arguments are checked. The list does not own its
+ * elements; clearing or destroying it only unlinks them.
+ * 
+ * As in LinkedList, insertion and removal work after an iterator
+ * position, and end() doubles as the position before the first
+ * element. Appending is O(1) because the list tracks its last element.
+ * 
+ * @tparam T Type of the linked objects, a standard-layout type
+ * @tparam Hook Member of T used as this list's link
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, IntrusiveSListHook T::*Hook>
+class IntrusiveSList {
+public:
+	/**
+	 * @class BasicIterator
+	 * @brief Forward iterator over the linked objects
+	 * 
+	 * @details The const instantiation only hands out const references
+	 * and can be constructed from a mutable iterator.
+	 * 
+	 * @tparam IsConst Whether the iterator gives read-only access
+	 */
+	template<bool IsConst>
+	class BasicIterator {
+	public:
+		using iterator_category	= std::forward_iterator_tag;                   ///< Iterator category tag
+		using value_type		= T;                                           ///< Type of elements
+		using difference_type	= std::ptrdiff_t;                              ///< Distance between iterators
+		using pointer			= std::conditional_t<IsConst, const T*, T*>;   ///< Pointer to element
+		using reference			= std::conditional_t<IsConst, const T&, T&>;   ///< Reference to element
+		using hook_pointer		= std::conditional_t<IsConst, const IntrusiveSListHook*, IntrusiveSListHook*>; ///< Pointer to hook
+
+		BasicIterator() noexcept;
+		explicit BasicIterator(hook_pointer hook) noexcept;
+		BasicIterator(const BasicIterator<false>& other) noexcept;
+		BasicIterator& operator=(const BasicIterator& other) noexcept = default;
+
+		reference operator*() const;
+		pointer operator->() const;
+		BasicIterator& operator++();
+		BasicIterator operator++(int);
+		template<bool OtherConst>
+		bool operator!=(const BasicIterator<OtherConst>& other) const;
+		template<bool OtherConst>
+		bool operator==(const BasicIterator<OtherConst>& other) const;
+
+	private:
+		hook_pointer	current;  ///< Hook of current element, or the sentinel
+
+		friend class BasicIterator<!IsConst>;
+		friend class IntrusiveSList;
+	};
+
+	using Iterator			= BasicIterator<false>; ///< Mutable iterator
+	using ConstIterator		= BasicIterator<true>;  ///< Read-only iterator
+
+	using value_type		= T;              ///< Type of linked objects
+	using size_type			= unsigned long;  ///< Type for sizes
+	using reference			= T&;             ///< Reference to element
+	using const_reference	= const T&;       ///< Const reference to element
+	using pointer			= T*;             ///< Pointer to element
+	using const_pointer		= const T*;       ///< Const pointer to element
+	using iterator			= Iterator;       ///< Iterator type
+	using const_iterator	= ConstIterator;  ///< Const iterator type
+
+	IntrusiveSList() noexcept;
+	IntrusiveSList(const IntrusiveSList &other) = delete;
+	IntrusiveSList(IntrusiveSList &&other) noexcept;
+	~IntrusiveSList();
+
+	IntrusiveSList &operator=(const IntrusiveSList &other) = delete;
+	IntrusiveSList &operator=(IntrusiveSList &&other) noexcept;
+
+	void clear() noexcept;
+	reference front();
+	const_reference front() const;
+	reference back();
+	const_reference back() const;
+	void add(reference value);
+	void push_front(reference value);
+	void pop_front();
+	iterator insert_after(const_iterator pos, reference value);
+	iterator erase_after(const_iterator pos);
+	void splice_after(const_iterator pos, IntrusiveSList &other) noexcept;
+
+	size_type size() const noexcept;
+	bool empty() const noexcept;
+
+	iterator iterator_to(reference value) noexcept;
+	const_iterator iterator_to(const_reference value) const noexcept;
+	iterator begin() noexcept;
+	iterator end() noexcept;
+	const_iterator begin() const noexcept;
+	const_iterator end() const noexcept;
+
+private:
+	IntrusiveSListHook	sentinel_;  ///< Links to the first element, the last one links back
+	IntrusiveSListHook	*tail_;     ///< Last hook, or the sentinel when empty
+	size_type			size_;      ///< Number of linked objects
+
+	static T *owner(const IntrusiveSListHook *hook) noexcept;
+};
+
+#include "internal/intrusive_slist.tpp"
+
+#endif
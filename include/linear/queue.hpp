@@ -9,7 +9,14 @@
 #ifndef QUEUE_HPP
 #define QUEUE_HPP
 
+#include <cstddef>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "../memory/node_pool.hpp"
 
 /**
  * @class Queue
@@ -20,11 +27,16 @@
  * principle. Implemented using doubly linked list for efficient
  * enqueue and dequeue operations.
  * 
+ * Nodes are obtained from a node allocator, by default a PoolAllocator
+ * that carves them out of chunks and reuses freed ones, so building
+ * or cycling through the queue rarely reaches the global allocator.
+ * 
  * @tparam T Type of elements stored in the queue
+ * @tparam Allocator Allocator whose rebound copy allocates the nodes
  * 
  * @ingroup linear_containers
  */
-template<class T>
+template<class T, class Allocator = PoolAllocator<T>>
 class Queue {
 public:
 	/**
@@ -40,40 +52,71 @@ public:
 		Node		*prev; ///< Pointer to previous node in sequence
 
 		Node(const T &value);
+		Node(T &&value);
 	};
 
 	/**
-	 * @class Iterator
+	 * @class BasicIterator
 	 * @brief Bidirectional iterator for queue traversal
 	 * 
 	 * @details Provides sequential access to queue elements in both
-	 * forward and backward directions for inspection purposes.
+	 * forward and backward directions. The iterator remembers where its
+	 * queue keeps the tail, so decrementing end() yields the last
+	 * element. The const instantiation only hands out const references
+	 * and can be constructed from a mutable iterator.
+	 * 
+	 * @tparam IsConst Whether the iterator gives read-only access
 	 */
-	class Iterator {
-	private:
-		Node* current;  ///< Pointer to current node
-
+	template<bool IsConst>
+	class BasicIterator {
 	public:
-		Iterator(Node* node);
+		using iterator_category	= std::bidirectional_iterator_tag;             ///< Iterator category tag
+		using value_type		= T;                                           ///< Type of elements
+		using difference_type	= std::ptrdiff_t;                              ///< Distance between iterators
+		using pointer			= std::conditional_t<IsConst, const T*, T*>;   ///< Pointer to element
+		using reference			= std::conditional_t<IsConst, const T&, T&>;   ///< Reference to element
+		using node_pointer		= std::conditional_t<IsConst, const Node*, Node*>; ///< Pointer to node
+
+		BasicIterator() noexcept;
+		BasicIterator(node_pointer node, Node *const *tail) noexcept;
+		BasicIterator(const BasicIterator<false>& other) noexcept;
+		BasicIterator& operator=(const BasicIterator& other) noexcept = default;
+
+		reference operator*() const;
+		pointer operator->() const;
+		BasicIterator& operator++();
+		BasicIterator operator++(int);
+		BasicIterator& operator--();
+		BasicIterator operator--(int);
+		template<bool OtherConst>
+		bool operator!=(const BasicIterator<OtherConst>& other) const;
+		template<bool OtherConst>
+		bool operator==(const BasicIterator<OtherConst>& other) const;
+
+	private:
+		node_pointer	current;  ///< Pointer to current node
+		Node *const		*tail;    ///< Owner's tail pointer, used to step back from end()
 
-		T& operator*() const;
-		Iterator& operator++();
-		Iterator& operator--();
-		bool operator!=(const Iterator& other) const;
-		bool operator==(const Iterator& other) const;
+		friend class BasicIterator<!IsConst>;
+		friend class Queue;
 	};
 
+	using Iterator			= BasicIterator<false>; ///< Mutable iterator
+	using ConstIterator		= BasicIterator<true>;  ///< Read-only iterator
+
 	using value_type		= T;              ///< Type of stored elements
+	using allocator_type	= Allocator;      ///< Type of node allocator
 	using size_type			= unsigned long;  ///< Type for sizes and indices
 	using reference			= T&;             ///< Reference to element
 	using const_reference	= const T&;       ///< Const reference to element
 	using pointer			= Node*;          ///< Pointer to node
 	using const_pointer		= const Node*;    ///< Const pointer to node
 	using iterator			= Iterator;       ///< Iterator type
-	using const_iterator	= const Iterator; ///< Const iterator type
+	using const_iterator	= ConstIterator;  ///< Const iterator type
 
 	Queue() noexcept;
-	Queue(size_type count, const T &value);
+	explicit Queue(const Allocator &alloc) noexcept;
+	Queue(size_type count, const T &value, const Allocator &alloc = Allocator());
 	Queue(const Queue &other);
 	Queue(Queue &&other) noexcept;
 	template <class Container>
@@ -82,7 +125,8 @@ public:
 
 	reference operator[](size_type index);
 	Queue &operator=(const Queue &other);
-	Queue &operator=(Queue &&other);
+	Queue &operator=(Queue &&other)
+		noexcept(node_traits::propagate_on_container_move_assignment::value || node_traits::is_always_equal::value);
 
 	void clear() noexcept;
 	const_reference at(size_type index) const;
@@ -95,6 +139,7 @@ public:
 	const_pointer head() const noexcept;
 	pointer tail() noexcept;
 	const_pointer tail() const noexcept;
+	allocator_type get_allocator() const noexcept;
 
 	iterator begin() noexcept;
 	iterator end() noexcept;
@@ -102,9 +147,18 @@ public:
 	const_iterator end() const noexcept;
 
 private:
-	pointer		head_;  ///< Pointer to front node (dequeue position)
-	pointer		tail_;  ///< Pointer to back node (enqueue position)
-	size_type	size_;  ///< Number of elements in queue
+	using node_allocator	= typename std::allocator_traits<Allocator>::template rebind_alloc<Node>; ///< Allocator for nodes
+	using node_traits		= std::allocator_traits<node_allocator>;                                   ///< Node allocator interface
+
+	pointer			head_;  ///< Pointer to front node (dequeue position)
+	pointer			tail_;  ///< Pointer to back node (enqueue position)
+	size_type		size_;  ///< Number of elements in queue
+	node_allocator	alloc_; ///< Allocator owning the nodes
+
+	template <class Arg>
+	pointer create_node(Arg &&value);
+	void destroy_node(pointer node) noexcept;
+	bool shares_nodes_with(const Queue &other) const noexcept;
 };
 
 #include "internal/queue.tpp"
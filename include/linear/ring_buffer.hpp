@@ -0,0 +1,246 @@
+/**
+ * @file ring_buffer.hpp
+ * @brief Fixed-capacity circular buffer that never reallocates
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2025-01-28
+ */
+
+#ifndef RING_BUFFER_HPP
+#define RING_BUFFER_HPP
+
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../collections_config.hpp"
+
+/**
+ * @brief Capacity argument selecting a RingBuffer sized at run time
+ * 
+ * @ingroup linear_containers
+ */
+inline constexpr std::size_t dynamic_capacity = 0;
+
+/**
+ * @brief What a full RingBuffer does with a new element
+ * 
+ * @ingroup linear_containers
+ */
+enum class RingBufferMode {
+	reject,    ///< Refuse the new element and keep the contents
+	overwrite  ///< Drop the oldest element to make room
+};
+
+/**
+ * @struct RingBufferStorage
+ * @brief Inline element storage of a fixed-capacity RingBuffer
+ * 
+ * @details Raw, suitably aligned bytes for N elements. Elements are
+ * constructed and destroyed by the ring buffer itself.
+ * 
+ * @tparam T Type of elements
+ * @tparam N Number of elements
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, std::size_t N>
+struct RingBufferStorage {
+	alignas(T) unsigned char bytes[N * sizeof(T)];  ///< Raw element storage
+
+	/**
+	 * @brief Returns the start of the storage
+	 * 
+	 * @return Pointer to the first element slot
+	 */
+	T *data() noexcept { return reinterpret_cast<T *>(bytes); }
+
+	/**
+	 * @brief Returns the start of the storage
+	 * 
+	 * @return Const pointer to the first element slot
+	 */
+	const T *data() const noexcept { return reinterpret_cast<const T *>(bytes); }
+};
+
+/**
+ * @brief Specialization for run-time capacity, which needs no inline
+ * storage
+ * 
+ * @ingroup linear_containers
+ */
+template<class T>
+struct RingBufferStorage<T, dynamic_capacity> {};
+
+/**
+ * @class RingBuffer
+ * @brief Circular buffer with a capacity fixed at construction
+ * 
+ * @details Holds at most capacity() elements in FIFO order. With a
+ * compile-time N the elements live inside the object; with
+ * N == dynamic_capacity the buffer is allocated once by the
+ * constructor. Either way no push, pop or overwrite ever allocates, so
+ * the container is safe to use on paths where allocator calls are not
+ * acceptable. When full, a push is either rejected or replaces the
+ * oldest element, as chosen by the RingBufferMode given at
+ * construction.
+ * 
+ * @tparam T Type of elements stored in the buffer
+ * @tparam N Capacity, or dynamic_capacity to choose it at run time
+ * @tparam Allocator Allocator for the run-time sized buffer
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, std::size_t N = dynamic_capacity, class Allocator = std::allocator<T>>
+class RingBuffer {
+public:
+	/**
+	 * @class BasicIterator
+	 * @brief Random access iterator from oldest to newest element
+	 * 
+	 * @details Keeps a logical position like the Deque iterator, so
+	 * jumps and distances are constant time. The const instantiation
+	 * only hands out const references and can be constructed from a
+	 * mutable iterator.
+	 * 
+	 * @tparam IsConst Whether the iterator gives read-only access
+	 */
+	template<bool IsConst>
+	class BasicIterator {
+	public:
+		using iterator_category	= std::random_access_iterator_tag;            ///< Iterator category tag
+		using value_type		= T;                                           ///< Type of elements
+		using difference_type	= std::ptrdiff_t;                              ///< Distance between iterators
+		using pointer			= std::conditional_t<IsConst, const T*, T*>;   ///< Pointer to element
+		using reference			= std::conditional_t<IsConst, const T&, T&>;   ///< Reference to element
+
+		BasicIterator() noexcept;
+		BasicIterator(pointer data, size_t capacity, size_t head, size_t position) noexcept;
+		BasicIterator(const BasicIterator<false>& other) noexcept;
+
+		reference operator*() const;
+		pointer operator->() const;
+		reference operator[](difference_type offset) const;
+		BasicIterator& operator++();
+		BasicIterator operator++(int);
+		BasicIterator& operator--();
+		BasicIterator operator--(int);
+		BasicIterator& operator+=(difference_type offset);
+		BasicIterator& operator-=(difference_type offset);
+		BasicIterator operator+(difference_type offset) const;
+		BasicIterator operator-(difference_type offset) const;
+		template<bool OtherConst>
+		difference_type operator-(const BasicIterator<OtherConst>& other) const;
+		template<bool OtherConst>
+		bool operator!=(const BasicIterator<OtherConst>& other) const;
+		template<bool OtherConst>
+		bool operator==(const BasicIterator<OtherConst>& other) const;
+		template<bool OtherConst>
+		bool operator<(const BasicIterator<OtherConst>& other) const;
+		template<bool OtherConst>
+		bool operator>(const BasicIterator<OtherConst>& other) const;
+		template<bool OtherConst>
+		bool operator<=(const BasicIterator<OtherConst>& other) const;
+		template<bool OtherConst>
+		bool operator>=(const BasicIterator<OtherConst>& other) const;
+
+		/**
+		 * @brief Offset addition with the offset on the left
+		 * 
+		 * @param[in] offset Number of positions to advance
+		 * @param[in] it Iterator to advance
+		 * @return Iterator offset positions after it
+		 */
+		friend BasicIterator operator+(difference_type offset, const BasicIterator& it) {
+			return it + offset;
+		}
+
+	private:
+		pointer	data_;      ///< Pointer to buffer
+		size_t	capacity_;  ///< Buffer capacity
+		size_t	head_;      ///< Index of the oldest element
+		size_t	position_;  ///< Logical position from the oldest element
+
+		pointer address() const;
+
+		friend class BasicIterator<!IsConst>;
+	};
+
+	using Iterator			= BasicIterator<false>; ///< Mutable iterator
+	using ConstIterator		= BasicIterator<true>;  ///< Read-only iterator
+
+	using value_type		= T;              ///< Type of stored elements
+	using allocator_type	= Allocator;      ///< Type of storage allocator
+	using size_type			= unsigned long;  ///< Type for sizes and indices
+	using reference			= T&;             ///< Reference to element
+	using const_reference	= const T&;       ///< Const reference to element
+	using pointer			= T*;             ///< Pointer to element
+	using const_pointer		= const T*;       ///< Const pointer to element
+	using iterator			= Iterator;       ///< Iterator type
+	using const_iterator	= ConstIterator;  ///< Const iterator type
+
+	static constexpr bool fixed_capacity = N != dynamic_capacity; ///< Whether the elements live inline
+
+	explicit RingBuffer(RingBufferMode mode = RingBufferMode::reject) noexcept;
+	explicit RingBuffer(size_type capacity, RingBufferMode mode = RingBufferMode::reject,
+		const Allocator &alloc = Allocator());
+	RingBuffer(const RingBuffer &other);
+	RingBuffer(RingBuffer &&other) noexcept(!fixed_capacity || std::is_nothrow_move_constructible_v<T>);
+	~RingBuffer();
+
+	reference operator[](size_type index);
+	const_reference operator[](size_type index) const;
+	RingBuffer &operator=(const RingBuffer &other);
+	RingBuffer &operator=(RingBuffer &&other) noexcept(fixed_capacity ? std::is_nothrow_move_constructible_v<T>
+		: alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value);
+
+	void clear() noexcept;
+	reference at(size_type index);
+	const_reference at(size_type index) const;
+	reference front();
+	const_reference front() const;
+	reference back();
+	const_reference back() const;
+	bool push(const_reference value);
+	bool push(value_type &&value);
+	template <class... Args>
+	bool emplace(Args&&... args);
+	value_type pop();
+	bool try_pop(reference out);
+
+	size_type size() const noexcept;
+	size_type capacity() const noexcept;
+	bool empty() const noexcept;
+	bool full() const noexcept;
+	RingBufferMode mode() const noexcept;
+	iterator begin() noexcept;
+	const_iterator begin() const noexcept;
+	iterator end() noexcept;
+	const_iterator end() const noexcept;
+	allocator_type get_allocator() const noexcept;
+
+private:
+	using alloc_traits = std::allocator_traits<Allocator>; ///< Allocator interface
+
+	RingBufferStorage<T, N>	inline_;    ///< Element storage when N is fixed
+	pointer					data_;      ///< Allocated buffer when N is dynamic
+	size_type				capacity_;  ///< Maximum number of elements
+	size_type				head_;      ///< Index of the oldest element
+	size_type				size_;      ///< Number of elements
+	RingBufferMode			mode_;      ///< Behaviour when full
+	allocator_type			alloc_;     ///< Allocator owning data_
+
+	pointer buffer() noexcept;
+	const_pointer buffer() const noexcept;
+	size_type wrap(size_type slot) const noexcept;
+	void take_elements(RingBuffer &other);
+	void release() noexcept;
+};
+
+#include "internal/ring_buffer.tpp"
+
+#endif
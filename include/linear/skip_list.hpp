@@ -0,0 +1,182 @@
+/**
+ * @file skip_list.hpp
+ * @brief Ordered map built on a probabilistic skip list
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef SKIP_LIST_HPP
+#define SKIP_LIST_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../memory/node_pool.hpp"
+
+/**
+ * @class SkipList
+ * @brief Sorted key-value map with expected O(log n) search
+ * 
+ * @details Elements are kept in a singly linked list sorted by key.
+ * Each node also carries a tower of forward links whose height is drawn
+ * at random: every node is on level 0, and each further level holds
+ * about a quarter of the nodes of the level below. A search starts on
+ * the highest level and drops down whenever the next node would
+ * overshoot, so find, insert, erase and lower_bound take expected
+ * O(log n) steps, and in-order iteration just follows level 0.
+ * 
+ * The links of a node are stored right behind its element in a single
+ * block, and blocks come from one NodePool per tower height, so a
+ * node's element and links share cache lines and inserting or erasing
+ * rarely reaches the global allocator. Keys are unique. Inserting and
+ * erasing do not invalidate iterators to other elements.
+ * 
+ * @tparam K Type of keys
+ * @tparam V Type of mapped values
+ * @tparam Compare Strict weak ordering on K
+ * 
+ * @ingroup linear_containers
+ */
+template<class K, class V, class Compare = std::less<K>>
+class SkipList {
+public:
+	using key_type			= K;                      ///< Type of keys
+	using mapped_type		= V;                      ///< Type of mapped values
+	using value_type		= std::pair<const K, V>;  ///< Type of stored elements
+	using key_compare		= Compare;                ///< Key ordering
+	using size_type			= unsigned long;          ///< Type for sizes
+	using reference			= value_type&;            ///< Reference to element
+	using const_reference	= const value_type&;      ///< Const reference to element
+
+	static constexpr size_type max_level = 16;  ///< Highest possible tower
+
+	/**
+	 * @struct Node
+	 * @brief Element followed in memory by its tower of links
+	 * 
+	 * @details A node of height h occupies sizeof(Node) plus h link
+	 * pointers; tower()[i] is the next node on level i.
+	 */
+	struct Node {
+		value_type	value;   ///< Key and mapped value
+		size_type	height;  ///< Number of links in the tower
+
+		template<class... Args>
+		Node(size_type levels, Args&&... args);
+		Node **tower() noexcept;
+		Node *const *tower() const noexcept;
+	};
+
+	/**
+	 * @class BasicIterator
+	 * @brief Forward iterator visiting elements in key order
+	 * 
+	 * @details The const instantiation only hands out const references
+	 * and can be constructed from a mutable iterator.
+	 * 
+	 * @tparam IsConst Whether the iterator gives read-only access
+	 */
+	template<bool IsConst>
+	class BasicIterator {
+	public:
+		using iterator_category	= std::forward_iterator_tag;                                       ///< Iterator category tag
+		using value_type		= SkipList::value_type;                                            ///< Type of elements
+		using difference_type	= std::ptrdiff_t;                                                  ///< Distance between iterators
+		using pointer			= std::conditional_t<IsConst, const value_type*, value_type*>;     ///< Pointer to element
+		using reference			= std::conditional_t<IsConst, const value_type&, value_type&>;     ///< Reference to element
+		using node_pointer		= std::conditional_t<IsConst, const Node*, Node*>;                 ///< Pointer to node
+
+		BasicIterator() noexcept;
+		explicit BasicIterator(node_pointer node) noexcept;
+		BasicIterator(const BasicIterator<false>& other) noexcept;
+		BasicIterator& operator=(const BasicIterator& other) noexcept = default;
+
+		reference operator*() const;
+		pointer operator->() const;
+		BasicIterator& operator++();
+		BasicIterator operator++(int);
+		template<bool OtherConst>
+		bool operator!=(const BasicIterator<OtherConst>& other) const;
+		template<bool OtherConst>
+		bool operator==(const BasicIterator<OtherConst>& other) const;
+
+	private:
+		node_pointer	current;  ///< Pointer to current node, nullptr for end()
+
+		friend class BasicIterator<!IsConst>;
+		friend class SkipList;
+	};
+
+	using Iterator			= BasicIterator<false>; ///< Mutable iterator
+	using ConstIterator		= BasicIterator<true>;  ///< Read-only iterator
+	using iterator			= Iterator;             ///< Iterator type
+	using const_iterator	= ConstIterator;        ///< Const iterator type
+
+	SkipList();
+	explicit SkipList(const Compare &comp);
+	SkipList(const SkipList &other);
+	SkipList(SkipList &&other) noexcept;
+	~SkipList();
+
+	SkipList &operator=(const SkipList &other);
+	SkipList &operator=(SkipList &&other) noexcept;
+	mapped_type &operator[](const key_type &key);
+
+	void clear() noexcept;
+	mapped_type &at(const key_type &key);
+	const mapped_type &at(const key_type &key) const;
+	std::pair<iterator, bool> insert(const key_type &key, const mapped_type &value);
+	size_type erase(const key_type &key);
+	iterator erase(const_iterator pos);
+
+	iterator find(const key_type &key);
+	const_iterator find(const key_type &key) const;
+	bool contains(const key_type &key) const;
+	iterator lower_bound(const key_type &key);
+	const_iterator lower_bound(const key_type &key) const;
+	iterator upper_bound(const key_type &key);
+	const_iterator upper_bound(const key_type &key) const;
+
+	size_type size() const noexcept;
+	bool empty() const noexcept;
+	size_type level() const noexcept;
+	key_compare key_comp() const;
+
+	iterator begin() noexcept;
+	iterator end() noexcept;
+	const_iterator begin() const noexcept;
+	const_iterator end() const noexcept;
+
+private:
+	Node						*head_[max_level];   ///< Links of the head tower
+	std::unique_ptr<NodePool>	pools_[max_level];   ///< Block pool per tower height, created on first use
+	size_type					size_;               ///< Number of elements
+	size_type					level_;              ///< Number of levels in use
+	std::uint64_t				seed_;               ///< State of the height generator
+	Compare						comp_;               ///< Key ordering
+
+	Node *lower_node(const key_type &key, Node **update[]) const;
+	Node *upper_node(const key_type &key) const;
+	template<class... Args>
+	Node *create_node(size_type height, Args&&... args);
+	void destroy_node(Node *node) noexcept;
+	void link(Node *node, Node **update[]) noexcept;
+	void unlink(Node *node, Node **update[]) noexcept;
+	void append_copy(const SkipList &other);
+	void take(SkipList &other) noexcept;
+	size_type random_height() noexcept;
+	bool equal_keys(const key_type &a, const key_type &b) const;
+};
+
+#include "internal/skip_list.tpp"
+
+#endif
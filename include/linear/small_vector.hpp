@@ -0,0 +1,128 @@
+/**
+ * @file small_vector.hpp
+ * @brief Dynamic array with inline storage for a few elements
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2025-01-28
+ */
+
+#ifndef SMALL_VECTOR_HPP
+#define SMALL_VECTOR_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+#include "vector.hpp"
+
+/**
+ * @class SmallVector
+ * @brief Dynamic array that keeps up to N elements inline
+ * 
+ * @details Offers the same interface as Vector but embeds storage for
+ * N elements in the object itself, so vectors that stay small never
+ * touch the allocator. Once more than N elements are stored, the
+ * elements move to heap storage managed exactly like Vector's; they
+ * return to the inline buffer when a shrink brings the size back to N
+ * or less. Capacity therefore never drops below N. Moving a vector
+ * that is still inline relocates its elements instead of stealing a
+ * pointer.
+ * 
+ * @tparam T Type of elements stored in the vector
+ * @tparam N Number of elements stored inline (must be > 0)
+ * @tparam Allocator Allocator used once the inline buffer is outgrown
+ * @tparam Policy Growth and shrink policy (see CapacityPolicy)
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, std::size_t N, class Allocator = std::allocator<T>, class Policy = DefaultCapacityPolicy>
+class SmallVector {
+	static_assert(N > 0, "SmallVector needs at least one inline element; use Vector instead");
+
+public:
+	using value_type		= T;              ///< Type of stored elements
+	using allocator_type	= Allocator;      ///< Type of storage allocator
+	using capacity_policy	= Policy;         ///< Growth and shrink policy
+	using size_type			= unsigned long;  ///< Type for sizes and indices
+	using reference			= T&;             ///< Reference to element
+	using const_reference	= const T&;       ///< Const reference to element
+	using pointer			= T*;             ///< Pointer to element
+	using const_pointer		= const T*;       ///< Const pointer to element
+	using iterator			= T*;             ///< Iterator type
+	using const_iterator	= const T*;       ///< Const iterator type
+
+	SmallVector() noexcept;
+	explicit SmallVector(const Allocator &alloc) noexcept;
+	SmallVector(size_type count, const T &value, const Allocator &alloc = Allocator());
+	SmallVector(const SmallVector &other);
+	SmallVector(SmallVector &&other) noexcept(std::is_nothrow_move_constructible_v<T>);
+	template <class Container>
+	SmallVector(const Container& other);
+	~SmallVector();
+
+	reference operator[](size_type index);
+	const_reference operator[](size_type index) const;
+	SmallVector &operator=(const SmallVector &other);
+	SmallVector &operator=(SmallVector &&other)
+		noexcept((alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value) && std::is_nothrow_move_constructible_v<T>);
+
+	void clear() noexcept;
+	reference at(size_type index);
+	const_reference at(size_type index) const;
+	void add(const_reference value);
+	void add(value_type &&value);
+	template <class... Args>
+	reference emplace_back(Args&&... args);
+	template <class InputIt>
+	void append(InputIt first, InputIt last);
+	pointer insert(size_type index, const_reference value);
+	template <class InputIt>
+	pointer insert(size_type index, InputIt first, InputIt last);
+	value_type erase(size_type index);
+	size_type erase(size_type first, size_type last);
+	template <class Predicate>
+	size_type erase_if(Predicate pred);
+
+	size_type size() const noexcept;
+	size_type capacity() const noexcept;
+	void reserve(size_type new_cap);
+	void shrink_to_fit();
+	void resize(size_type count);
+	void resize(size_type count, const_reference value);
+	bool empty() const noexcept;
+	bool is_inline() const noexcept;
+	pointer data() noexcept;
+	const_pointer data() const noexcept;
+
+	iterator begin() noexcept;
+	const_iterator begin() const noexcept;
+	iterator end() noexcept;
+	const_iterator end() const noexcept;
+	allocator_type get_allocator() const noexcept;
+
+private:
+	using alloc_traits = std::allocator_traits<Allocator>; ///< Allocator interface
+
+	pointer			data_;      ///< Pointer to raw element storage
+	size_type		size_;      ///< Number of elements currently stored
+	size_type		capacity_;  ///< Current capacity (at least N)
+	allocator_type	alloc_;     ///< Allocator owning the heap storage
+	alignas(T) unsigned char inline_[N * sizeof(T)]; ///< Inline element storage
+
+	void shrink_by_policy();
+	void reallocate(size_type new_cap);
+	void transfer(pointer new_data, size_type new_cap);
+	template <class... Args>
+	void grow_and_construct(Args&&... args);
+	template <class ForwardIt>
+	void insert_range(size_type index, ForwardIt first, size_type count);
+	void destroy_elements() noexcept;
+	void release() noexcept;
+	void steal(SmallVector &other) noexcept(std::is_nothrow_move_constructible_v<T>);
+	pointer allocate_storage(size_type count);
+	void deallocate_storage(pointer block, size_type count) noexcept;
+	pointer inline_data() noexcept;
+};
+
+#include "internal/small_vector.tpp"
+
+#endif
@@ -10,6 +10,13 @@
 #define STACK_HPP
 
 #include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "../collections_config.hpp"
+#include "../memory/capacity_policy.hpp"
+#include "../memory/relocation.hpp"
 
 /**
  * @class Stack
@@ -18,16 +25,21 @@
  * @details Implements a stack data structure where elements are added
  * and removed from the same end (top). Follows Last-In-First-Out
  * principle. Implemented using dynamic array for efficient memory
- * usage and cache locality.
+ * usage and cache locality. Only live elements are constructed in the
+ * underlying raw storage.
  * 
  * @tparam T Type of elements stored in the stack
+ * @tparam Allocator Allocator used to obtain raw element storage
+ * @tparam Policy Growth and shrink policy (see CapacityPolicy)
  * 
  * @ingroup linear_containers
  */
-template<class T>
+template<class T, class Allocator = std::allocator<T>, class Policy = DefaultCapacityPolicy>
 class Stack {
 public:
 	using value_type		= T;              ///< Type of stored elements
+	using allocator_type	= Allocator;      ///< Type of storage allocator
+	using capacity_policy	= Policy;         ///< Growth and shrink policy
 	using size_type			= unsigned long;  ///< Type for sizes and indices
 	using reference			= T&;             ///< Reference to element
 	using const_reference	= const T&;       ///< Const reference to element
@@ -37,7 +49,8 @@ public:
 	using const_iterator	= const T*;       ///< Const iterator type
 
 	Stack() noexcept;
-	Stack(size_type count, const T &value);
+	explicit Stack(const Allocator &alloc) noexcept;
+	Stack(size_type count, const T &value, const Allocator &alloc = Allocator());
 	Stack(const Stack &other);
 	Stack(Stack &&other) noexcept;
 	template <class Container>
@@ -45,16 +58,20 @@ public:
 	~Stack();
 
 	reference operator[](size_type index);
+	const_reference operator[](size_type index) const;
 	Stack &operator=(const Stack &other);
-	Stack &operator=(Stack &&other) noexcept;
+	Stack &operator=(Stack &&other) noexcept(alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value);
 
 	void clear() noexcept;
+	reference at(size_type index);
 	const_reference at(size_type index) const;
 	void push(const_reference value);
 	value_type pop();
 
 	size_type size() const noexcept;
 	size_type capacity() const noexcept;
+	void reserve(size_type new_cap);
+	void shrink_to_fit();
 	bool empty() const noexcept;
 	pointer data() noexcept;
 	const_pointer data() const noexcept;
@@ -63,14 +80,23 @@ public:
 	const_iterator begin() const noexcept;
 	iterator end() noexcept;
 	const_iterator end() const noexcept;
+	allocator_type get_allocator() const noexcept;
 
 private:
-	pointer		data_;      ///< Pointer to dynamically allocated array
-	size_type	size_;      ///< Number of elements currently stored
-	size_type	capacity_;  ///< Current allocated capacity
+	using alloc_traits = std::allocator_traits<Allocator>; ///< Allocator interface
 
-	void reserve(size_type new_cap);
-	void shrink_to_fit();
+	pointer			data_;      ///< Pointer to raw element storage
+	size_type		size_;      ///< Number of elements currently stored
+	size_type		capacity_;  ///< Current allocated capacity
+	allocator_type	alloc_;     ///< Allocator owning the storage
+
+	void shrink_by_policy();
+	void reallocate(size_type new_cap);
+	void transfer(pointer new_data, size_type new_cap);
+	template <class... Args>
+	void grow_and_construct(Args&&... args);
+	void destroy_elements() noexcept;
+	void release() noexcept;
 };
 
 #include "internal/stack.tpp"
@@ -0,0 +1,177 @@
+/**
+ * @file unrolled_list.hpp
+ * @brief Linked list storing several elements per node
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef UNROLLED_LIST_HPP
+#define UNROLLED_LIST_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "../memory/node_pool.hpp"
+#include "../memory/relocation.hpp"
+
+/**
+ * @class UnrolledList
+ * @brief Singly linked list of small arrays
+ * 
+ * @details Offers the interface of LinkedList, but every node holds up
+ * to K elements in an inline array instead of a single one. Scans and
+ * index lookups skip whole nodes and then read contiguous elements, so
+ * they touch about n / K nodes instead of n, and the per-element cost
+ * of the link shrinks by a factor of K.
+ * 
+ * Appending fills the last node before starting a new one. Inserting
+ * into a full node splits it, moving its upper half to a new node, so
+ * an insertion moves at most K elements. Erasing shifts the rest of
+ * the node down; a node that drops below half full absorbs its
+ * successor when both fit into one node, and empty nodes are freed.
+ * Inserting or erasing invalidates iterators and references to
+ * elements of the affected nodes.
+ * 
+ * @tparam T Type of elements stored in the list
+ * @tparam K Number of elements per node (must be > 0)
+ * @tparam Allocator Allocator whose rebound copy allocates the nodes
+ * 
+ * @ingroup linear_containers
+ */
+template<class T, std::size_t K = 16, class Allocator = PoolAllocator<T>>
+class UnrolledList {
+	static_assert(K > 0, "UnrolledList needs at least one element per node");
+
+public:
+	/**
+	 * @struct Node
+	 * @brief Node holding up to K elements
+	 * 
+	 * @details The first count slots hold live elements, the rest is
+	 * uninitialized storage.
+	 */
+	struct Node {
+		Node			*next;                            ///< Pointer to next node in sequence
+		std::size_t		count;                            ///< Number of live elements
+		alignas(T) unsigned char storage[K * sizeof(T)];  ///< Element slots
+
+		Node() noexcept;
+		T *items() noexcept;
+		const T *items() const noexcept;
+	};
+
+	/**
+	 * @class BasicIterator
+	 * @brief Forward iterator over the elements of an unrolled list
+	 * 
+	 * @details Walks the slots of a node and then moves on to the next
+	 * node. The const instantiation only hands out const references and
+	 * can be constructed from a mutable iterator.
+	 * 
+	 * @tparam IsConst Whether the iterator gives read-only access
+	 */
+	template<bool IsConst>
+	class BasicIterator {
+	public:
+		using iterator_category	= std::forward_iterator_tag;                   ///< Iterator category tag
+		using value_type		= T;                                           ///< Type of elements
+		using difference_type	= std::ptrdiff_t;                              ///< Distance between iterators
+		using pointer			= std::conditional_t<IsConst, const T*, T*>;   ///< Pointer to element
+		using reference			= std::conditional_t<IsConst, const T&, T&>;   ///< Reference to element
+		using node_pointer		= std::conditional_t<IsConst, const Node*, Node*>; ///< Pointer to node
+
+		BasicIterator() noexcept;
+		BasicIterator(node_pointer node, std::size_t slot) noexcept;
+		BasicIterator(const BasicIterator<false>& other) noexcept;
+		BasicIterator& operator=(const BasicIterator& other) noexcept = default;
+
+		reference operator*() const;
+		pointer operator->() const;
+		BasicIterator& operator++();
+		BasicIterator operator++(int);
+		template<bool OtherConst>
+		bool operator!=(const BasicIterator<OtherConst>& other) const;
+		template<bool OtherConst>
+		bool operator==(const BasicIterator<OtherConst>& other) const;
+
+	private:
+		node_pointer	current;  ///< Pointer to current node
+		std::size_t		slot;     ///< Index of the element within the node
+
+		friend class BasicIterator<!IsConst>;
+		friend class UnrolledList;
+	};
+
+	using Iterator			= BasicIterator<false>; ///< Mutable iterator
+	using ConstIterator		= BasicIterator<true>;  ///< Read-only iterator
+
+	using value_type		= T;              ///< Type of stored elements
+	using allocator_type	= Allocator;      ///< Type of node allocator
+	using size_type			= unsigned long;  ///< Type for sizes and indices
+	using reference			= T&;             ///< Reference to element
+	using const_reference	= const T&;       ///< Const reference to element
+	using pointer			= T*;             ///< Pointer to element
+	using const_pointer		= const T*;       ///< Const pointer to element
+	using iterator			= Iterator;       ///< Iterator type
+	using const_iterator	= ConstIterator;  ///< Const iterator type
+
+	static constexpr size_type node_capacity = K; ///< Elements per node
+
+	UnrolledList() noexcept;
+	explicit UnrolledList(const Allocator &alloc) noexcept;
+	UnrolledList(size_type count, const T &value, const Allocator &alloc = Allocator());
+	UnrolledList(const UnrolledList &other);
+	UnrolledList(UnrolledList &&other) noexcept;
+	template <class Container>
+	UnrolledList(const Container& other);
+	~UnrolledList();
+
+	reference operator[](size_type index);
+	UnrolledList &operator=(const UnrolledList &other);
+	UnrolledList &operator=(UnrolledList &&other)
+		noexcept(node_traits::propagate_on_container_move_assignment::value || node_traits::is_always_equal::value);
+
+	void clear() noexcept;
+	const_reference at(size_type index) const;
+	void add(const_reference value);
+	iterator insert(size_type index, const_reference value);
+	value_type erase(size_type index);
+
+	size_type size() const noexcept;
+	bool empty() const noexcept;
+	size_type node_count() const noexcept;
+	allocator_type get_allocator() const noexcept;
+
+	iterator begin() noexcept;
+	iterator end() noexcept;
+	const_iterator begin() const noexcept;
+	const_iterator end() const noexcept;
+
+private:
+	using node_allocator	= typename std::allocator_traits<Allocator>::template rebind_alloc<Node>; ///< Allocator for nodes
+	using node_traits		= std::allocator_traits<node_allocator>;                                   ///< Node allocator interface
+
+	Node			*head_;   ///< First node
+	Node			*tail_;   ///< Last node
+	size_type		size_;    ///< Number of elements in list
+	size_type		nodes_;   ///< Number of nodes in list
+	node_allocator	alloc_;   ///< Allocator owning the nodes
+
+	template <class Arg>
+	void append(Arg &&value);
+	Node *create_node();
+	void destroy_node(Node *node) noexcept;
+	Node *locate(size_type &index, Node **prev) const noexcept;
+	void split(Node *node);
+	void insert_at(Node *node, size_type slot, value_type &&value);
+	void remove_at(Node *node, size_type slot);
+	void rebalance(Node *node, Node *prev) noexcept;
+};
+
+#include "internal/unrolled_list.tpp"
+
+#endif
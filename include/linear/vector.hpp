@@ -9,7 +9,18 @@
 #ifndef VECTOR_HPP
 #define VECTOR_HPP
 
+#include <algorithm>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../collections_config.hpp"
+#include "../memory/capacity_policy.hpp"
+#include "../memory/relocation.hpp"
 
 /**
  * @defgroup linear_containers Linear Container Module
@@ -36,6 +47,31 @@
  * algorithm compatibility.
  */
 
+/**
+ * @struct is_forward_iterator
+ * @brief Detects iterators that can be traversed more than once
+ * 
+ * @details True when It declares an iterator_category derived from
+ * std::forward_iterator_tag. Range operations use it to measure a
+ * range up front and allocate once; other iterators are buffered
+ * first.
+ * 
+ * @tparam It Iterator type being queried
+ * 
+ * @ingroup linear_containers
+ */
+template<class It, class = void>
+struct is_forward_iterator : std::false_type {};
+
+/**
+ * @brief Specialization for iterators exposing an iterator category
+ * 
+ * @ingroup linear_containers
+ */
+template<class It>
+struct is_forward_iterator<It, std::void_t<typename std::iterator_traits<It>::iterator_category>>
+	: std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<It>::iterator_category> {};
+
 /**
  * @class Vector
  * @brief Dynamic array with automatic capacity management
@@ -44,15 +80,22 @@
  * elements are added. Provides random access to elements in constant
  * time and efficient addition at the end. Memory is allocated
  * dynamically and grows exponentially to amortize allocation costs.
+ * Storage is obtained uninitialized from the allocator and only live
+ * elements are ever constructed or destroyed, so spare capacity costs
+ * no constructor calls.
  * 
  * @tparam T Type of elements stored in the vector
+ * @tparam Allocator Allocator used to obtain raw element storage
+ * @tparam Policy Growth and shrink policy (see CapacityPolicy)
  * 
  * @ingroup linear_containers
  */
-template<class T>
+template<class T, class Allocator = std::allocator<T>, class Policy = DefaultCapacityPolicy>
 class Vector {
 public:
 	using value_type		= T;              ///< Type of stored elements
+	using allocator_type	= Allocator;      ///< Type of storage allocator
+	using capacity_policy	= Policy;         ///< Growth and shrink policy
 	using size_type			= unsigned long;  ///< Type for sizes and indices
 	using reference			= T&;             ///< Reference to element
 	using const_reference	= const T&;       ///< Const reference to element
@@ -62,7 +105,8 @@ public:
 	using const_iterator	= const T*;       ///< Const iterator type
 
 	Vector() noexcept;
-	Vector(size_type count, const T &value);
+	explicit Vector(const Allocator &alloc) noexcept;
+	Vector(size_type count, const T &value, const Allocator &alloc = Allocator());
 	Vector(const Vector &other);
 	Vector(Vector &&other) noexcept;
 	template <class Container>
@@ -70,17 +114,33 @@ public:
 	~Vector();
 
 	reference operator[](size_type index);
+	const_reference operator[](size_type index) const;
 	Vector &operator=(const Vector &other);
-	Vector &operator=(Vector &&other) noexcept;
+	Vector &operator=(Vector &&other) noexcept(alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value);
 
 	void clear() noexcept;
+	reference at(size_type index);
 	const_reference at(size_type index) const;
 	void add(const_reference value);
+	void add(value_type &&value);
+	template <class... Args>
+	reference emplace_back(Args&&... args);
+	template <class InputIt>
+	void append(InputIt first, InputIt last);
 	pointer insert(size_type index, const_reference value);
+	template <class InputIt>
+	pointer insert(size_type index, InputIt first, InputIt last);
 	value_type erase(size_type index);
+	size_type erase(size_type first, size_type last);
+	template <class Predicate>
+	size_type erase_if(Predicate pred);
 
 	size_type size() const noexcept;
 	size_type capacity() const noexcept;
+	void reserve(size_type new_cap);
+	void shrink_to_fit();
+	void resize(size_type count);
+	void resize(size_type count, const_reference value);
 	bool empty() const noexcept;
 	pointer data() noexcept;
 	const_pointer data() const noexcept;
@@ -89,14 +149,25 @@ public:
 	const_iterator begin() const noexcept;
 	iterator end() noexcept;
 	const_iterator end() const noexcept;
+	allocator_type get_allocator() const noexcept;
 
 private:
-	pointer		data_;      ///< Pointer to dynamically allocated array
-	size_type	size_;      ///< Number of elements currently stored
-	size_type	capacity_;  ///< Current allocated capacity
+	using alloc_traits = std::allocator_traits<Allocator>; ///< Allocator interface
 
-	void reserve(size_type new_cap);
-	void shrink_to_fit();
+	pointer			data_;      ///< Pointer to raw element storage
+	size_type		size_;      ///< Number of elements currently stored
+	size_type		capacity_;  ///< Current allocated capacity
+	allocator_type	alloc_;     ///< Allocator owning the storage
+
+	void shrink_by_policy();
+	void reallocate(size_type new_cap);
+	void transfer(pointer new_data, size_type new_cap);
+	template <class... Args>
+	void grow_and_construct(Args&&... args);
+	template <class ForwardIt>
+	void insert_range(size_type index, ForwardIt first, size_type count);
+	void destroy_elements() noexcept;
+	void release() noexcept;
 };
 
 #include "internal/vector.tpp"
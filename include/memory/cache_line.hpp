@@ -0,0 +1,27 @@
+/**
+ * @file cache_line.hpp
+ * @brief Cache line size used to keep shared data apart
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef CACHE_LINE_HPP
+#define CACHE_LINE_HPP
+
+#include <cstddef>
+
+/**
+ * @brief Assumed size of a cache line in bytes
+ * 
+ * @details Concurrent containers align data written by different
+ * threads to this boundary so the threads do not invalidate each
+ * other's cache lines (false sharing). 64 bytes matches current x86-64
+ * and most ARM cores; std::hardware_destructive_interference_size is
+ * not used because its value may differ between translation units.
+ * 
+ * @ingroup memory_utilities
+ */
+inline constexpr std::size_t cache_line_size = 64;
+
+#endif
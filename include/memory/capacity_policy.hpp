@@ -0,0 +1,143 @@
+/**
+ * @file capacity_policy.hpp
+ * @brief Growth and shrink policies for array-based containers
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef CAPACITY_POLICY_HPP
+#define CAPACITY_POLICY_HPP
+
+#include <type_traits>
+
+/**
+ * @struct CapacityPolicy
+ * @brief Geometric growth with hysteresis-based shrinking
+ * 
+ * @details Decides how much storage an array-based container asks for
+ * when it runs out of room and when it gives storage back after
+ * removals. Capacity grows by a factor of GrowNum / GrowDen. It is
+ * halved only once size drops below 1 / ShrinkDivisor of the
+ * capacity, so a container that oscillates around a growth boundary
+ * does not reallocate on every operation. ShrinkDivisor must be at
+ * least two, so the halved capacity still holds every element; zero
+ * disables automatic shrinking entirely.
+ * 
+ * Custom policies only need to provide the same two static functions.
+ * 
+ * @tparam GrowNum Numerator of the growth factor
+ * @tparam GrowDen Denominator of the growth factor
+ * @tparam ShrinkDivisor Occupancy divisor that triggers shrinking
+ * 
+ * @ingroup memory_utilities
+ */
+template<unsigned long GrowNum = 2, unsigned long GrowDen = 1, unsigned long ShrinkDivisor = 4>
+struct CapacityPolicy {
+	static_assert(GrowDen > 0 && GrowNum > GrowDen, "Growth factor must be greater than one");
+	static_assert(ShrinkDivisor == 0 || ShrinkDivisor >= 2, "Halving must leave room for every element");
+
+	using size_type = unsigned long;  ///< Type for sizes and capacities
+
+	static size_type grow(size_type capacity, size_type required) noexcept;
+	static size_type shrink(size_type size, size_type capacity) noexcept;
+};
+
+/**
+ * @brief Default policy: doubles on growth, halves below quarter use
+ * 
+ * @ingroup memory_utilities
+ */
+using DefaultCapacityPolicy = CapacityPolicy<2, 1, 4>;
+
+/**
+ * @brief Doubles on growth and never shrinks automatically
+ * 
+ * @ingroup memory_utilities
+ */
+using NeverShrinkPolicy = CapacityPolicy<2, 1, 0>;
+
+/**
+ * @brief Grows by 1.5x for tighter memory use, halves below quarter use
+ * 
+ * @ingroup memory_utilities
+ */
+using CompactCapacityPolicy = CapacityPolicy<3, 2, 4>;
+
+/**
+ * @struct PowerOfTwoCapacityPolicy
+ * @brief Keeps capacity at a power of two
+ * 
+ * @details Doubles on growth, rounding up to the next power of two,
+ * and halves once size drops below 1 / ShrinkDivisor of the capacity.
+ * Circular buffers using this policy can wrap indices with a mask
+ * instead of a division; it advertises this through the power_of_two
+ * flag (see has_power_of_two_capacity).
+ * 
+ * @tparam ShrinkDivisor Occupancy divisor that triggers shrinking, or
+ * zero to never shrink automatically
+ * 
+ * @ingroup memory_utilities
+ */
+template<unsigned long ShrinkDivisor = 4>
+struct PowerOfTwoCapacityPolicy {
+	static_assert(ShrinkDivisor == 0 || ShrinkDivisor >= 2, "Halving must leave room for every element");
+
+	using size_type = unsigned long;  ///< Type for sizes and capacities
+
+	static constexpr bool power_of_two = true;  ///< Every capacity returned is a power of two
+
+	static size_type grow(size_type capacity, size_type required) noexcept;
+	static size_type shrink(size_type size, size_type capacity) noexcept;
+};
+
+/**
+ * @brief Smallest power of two not less than value
+ * 
+ * @ingroup memory_utilities
+ * 
+ * @param[in] value Lower bound (values below one give one)
+ * @return Power of two >= value
+ */
+constexpr unsigned long next_power_of_two(unsigned long value) noexcept {
+	unsigned long result = 1;
+	while (result < value)
+		result <<= 1;
+	return result;
+}
+
+/**
+ * @struct has_power_of_two_capacity
+ * @brief Trait telling whether a policy only produces powers of two
+ * 
+ * @details False unless the policy declares a static constexpr
+ * power_of_two member set to true, so custom policies without the flag
+ * keep working unchanged.
+ * 
+ * @tparam Policy Capacity policy to inspect
+ * 
+ * @ingroup memory_utilities
+ */
+template<class Policy, class = void>
+struct has_power_of_two_capacity : std::false_type {};
+
+/**
+ * @brief Specialization for policies declaring the power_of_two flag
+ * 
+ * @ingroup memory_utilities
+ */
+template<class Policy>
+struct has_power_of_two_capacity<Policy, std::void_t<decltype(Policy::power_of_two)>>
+	: std::bool_constant<Policy::power_of_two> {};
+
+/**
+ * @brief Convenience variable for has_power_of_two_capacity
+ * 
+ * @ingroup memory_utilities
+ */
+template<class Policy>
+inline constexpr bool has_power_of_two_capacity_v = has_power_of_two_capacity<Policy>::value;
+
+#include "internal/capacity_policy.tpp"
+
+#endif
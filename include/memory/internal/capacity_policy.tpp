@@ -0,0 +1,97 @@
+/**
+ * @file capacity_policy.tpp
+ * @brief Implementation of CapacityPolicy template methods
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef CAPACITY_POLICY_TPP
+#define CAPACITY_POLICY_TPP
+
+#include "../capacity_policy.hpp"
+
+/**
+ * @brief Computes the capacity to allocate when storage runs out
+ * 
+ * @details Scales the current capacity by the growth factor and
+ * returns at least required, so a single call always makes room for
+ * the pending insertion.
+ * 
+ * @ingroup memory_utilities
+ * 
+ * @param[in] capacity Current capacity
+ * @param[in] required Minimum number of elements that must fit
+ * @return New capacity, never smaller than required
+ */
+template<unsigned long GrowNum, unsigned long GrowDen, unsigned long ShrinkDivisor>
+typename CapacityPolicy<GrowNum, GrowDen, ShrinkDivisor>::size_type
+CapacityPolicy<GrowNum, GrowDen, ShrinkDivisor>::grow(size_type capacity, size_type required) noexcept {
+	size_type scaled = capacity / GrowDen * GrowNum + capacity % GrowDen * GrowNum / GrowDen;
+	if (scaled <= capacity)
+		scaled = capacity + 1;
+	return scaled < required ? required : scaled;
+}
+
+/**
+ * @brief Computes the capacity to keep after an element is removed
+ * 
+ * @details Returns half the capacity once size falls below
+ * 1 / ShrinkDivisor of it, and the unchanged capacity otherwise. The
+ * result is never smaller than size.
+ * 
+ * @ingroup memory_utilities
+ * 
+ * @param[in] size Current number of elements
+ * @param[in] capacity Current capacity
+ * @return Capacity the container should have
+ */
+template<unsigned long GrowNum, unsigned long GrowDen, unsigned long ShrinkDivisor>
+typename CapacityPolicy<GrowNum, GrowDen, ShrinkDivisor>::size_type
+CapacityPolicy<GrowNum, GrowDen, ShrinkDivisor>::shrink(size_type size, size_type capacity) noexcept {
+	if constexpr (ShrinkDivisor == 0)
+		return capacity;
+	else
+		return size < capacity / ShrinkDivisor ? capacity / 2 : capacity;
+}
+
+/**
+ * @brief Computes the power-of-two capacity to allocate
+ * 
+ * @details Doubles the current capacity and rounds up to the next
+ * power of two that holds required elements.
+ * 
+ * @ingroup memory_utilities
+ * 
+ * @param[in] capacity Current capacity (zero or a power of two)
+ * @param[in] required Minimum number of elements that must fit
+ * @return New capacity, a power of two never smaller than required
+ */
+template<unsigned long ShrinkDivisor>
+typename PowerOfTwoCapacityPolicy<ShrinkDivisor>::size_type
+PowerOfTwoCapacityPolicy<ShrinkDivisor>::grow(size_type capacity, size_type required) noexcept {
+	return next_power_of_two(capacity * 2 < required ? required : capacity * 2);
+}
+
+/**
+ * @brief Computes the capacity to keep after an element is removed
+ * 
+ * @details Halving a power of two keeps it a power of two, so this
+ * behaves like CapacityPolicy::shrink.
+ * 
+ * @ingroup memory_utilities
+ * 
+ * @param[in] size Current number of elements
+ * @param[in] capacity Current capacity
+ * @return Capacity the container should have
+ */
+template<unsigned long ShrinkDivisor>
+typename PowerOfTwoCapacityPolicy<ShrinkDivisor>::size_type
+PowerOfTwoCapacityPolicy<ShrinkDivisor>::shrink(size_type size, size_type capacity) noexcept {
+	if constexpr (ShrinkDivisor == 0)
+		return capacity;
+	else
+		return size < capacity / ShrinkDivisor ? capacity / 2 : capacity;
+}
+
+#endif
@@ -0,0 +1,43 @@
+/**
+ * @file member_owner.tpp
+ * @brief Implementation of member_owner
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef MEMBER_OWNER_TPP
+#define MEMBER_OWNER_TPP
+
+#include "../member_owner.hpp"
+
+/**
+ * @brief Finds the object that embeds a member
+ * 
+ * @details Subtracts the offset of Member within T from the member's
+ * address. The offset is measured once, on static storage of the size
+ * and alignment of T, by forming the member's address there without
+ * reading it. Only standard-layout types are accepted, since only for
+ * them the language fixes one offset shared by every object; this is
+ * what offsetof relies on, which cannot take a member pointer.
+ * 
+ * Used by the intrusive containers to get from a hook to its element.
+ * 
+ * @ingroup memory_utilities
+ * 
+ * @tparam T Type of the owning object
+ * @tparam M Type of the member
+ * @tparam Member Pointer to the member within T
+ * @param[in] member Member of a live T
+ * @return Object whose Member is member
+ */
+template<class T, class M, M T::*Member>
+T *member_owner(const M *member) noexcept {
+	static_assert(std::is_standard_layout<T>::value, "The owner must be a standard-layout type");
+	alignas(T) static unsigned char probe[sizeof(T)];
+	static const std::ptrdiff_t offset =
+		reinterpret_cast<unsigned char *>(&(reinterpret_cast<T *>(probe)->*Member)) - probe;
+	return reinterpret_cast<T *>(reinterpret_cast<unsigned char *>(const_cast<M *>(member)) - offset);
+}
+
+#endif
@@ -0,0 +1,358 @@
+/**
+ * @file node_pool.tpp
+ * @brief Implementation of NodePool and PoolAllocator
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef NODE_POOL_TPP
+#define NODE_POOL_TPP
+
+#include "../node_pool.hpp"
+
+/**
+ * @brief Constructs an empty pool
+ * 
+ * @details No chunk is allocated until the first block is needed.
+ * Blocks are at least large enough to hold the free list link.
+ * 
+ * @ingroup memory_utilities
+ * 
+ * @param[in] block_size Size of the objects the blocks hold
+ * @param[in] block_align Alignment of those objects
+ * @param[in] first_chunk Number of blocks in the first chunk
+ */
+inline NodePool::NodePool(size_type block_size, size_type block_align, size_type first_chunk) noexcept
+	: NodePool(first_chunk) {
+	set_block(block_size, block_align);
+}
+
+/**
+ * @brief Constructs an empty pool without a block size
+ * 
+ * @details The blocks are sized by the first call to size_for(); until
+ * then no object fits and allocate() must not be called.
+ * 
+ * @ingroup memory_utilities
+ * 
+ * @param[in] first_chunk Number of blocks in the first chunk
+ */
+inline NodePool::NodePool(size_type first_chunk) noexcept
+	: block_size_(0), block_align_(alignof(FreeBlock)), next_blocks_(first_chunk ? first_chunk : 1), capacity_(0),
+	free_(nullptr), cursor_(nullptr), end_(nullptr), chunks_(nullptr) {}
+
+/**
+ * @brief Destructor
+ * 
+ * @details Gives every chunk back to the global allocator. Objects
+ * still living in blocks are not destroyed.
+ * 
+ * @ingroup memory_utilities
+ */
+inline NodePool::~NodePool() {
+	while (chunks_) {
+		Chunk *next = chunks_->next;
+		::operator delete(static_cast<void *>(chunks_), chunk_align());
+		chunks_ = next;
+	}
+}
+
+/**
+ * @brief Obtains one block
+ * 
+ * @details Pops the free list, or carves the next block of the newest
+ * chunk, allocating a new chunk when that one is used up.
+ * 
+ * @ingroup memory_utilities
+ * 
+ * @return Uninitialized block of the configured size and alignment
+ * 
+ * @throws std::bad_alloc if a new chunk cannot be allocated
+ */
+inline void *NodePool::allocate() {
+	if (free_) {
+		FreeBlock *block = free_;
+		free_ = block->next;
+		return block;
+	}
+	if (cursor_ == end_)
+		add_chunk();
+	void *block = cursor_;
+	cursor_ += block_size_;
+	++capacity_;
+	return block;
+}
+
+/**
+ * @brief Returns a block to the free list
+ * 
+ * @ingroup memory_utilities
+ * 
+ * @param[in] block Block obtained from allocate() on this pool, holding
+ * no live object
+ */
+inline void NodePool::deallocate(void *block) noexcept {
+	FreeBlock *freed = ::new (block) FreeBlock;
+	freed->next = free_;
+	free_ = freed;
+}
+
+/**
+ * @brief Checks whether an object fits in a block
+ * 
+ * @ingroup memory_utilities
+ * 
+ * @param[in] size Size of the object
+ * @param[in] align Alignment of the object
+ * @return true if blocks are large and aligned enough
+ */
+inline bool NodePool::fits(size_type size, size_type align) const noexcept {
+	return size <= block_size_ && align <= block_align_;
+}
+
+/**
+ * @brief Sizes the blocks for an object type if not sized yet
+ * 
+ * @ingroup memory_utilities
+ * 
+ * @param[in] size Size of the object
+ * @param[in] align Alignment of the object
+ * @return true if blocks are large and aligned enough for the object
+ */
+inline bool NodePool::size_for(size_type size, size_type align) noexcept {
+	if (block_size_ == 0)
+		set_block(size, align);
+	return fits(size, align);
+}
+
+/**
+ * @brief Returns the number of blocks carved so far
+ * 
+ * @details Counts blocks in use as well as those on the free list, so
+ * it only grows when more blocks are in use at once than ever before.
+ * 
+ * @ingroup memory_utilities
+ * 
+ * @return Number of distinct blocks handed out
+ */
+inline NodePool::size_type NodePool::capacity() const noexcept { return capacity_; }
+
+/**
+ * @brief Sets the size and alignment of the blocks
+ * 
+ * @details Blocks are at least large enough to hold the free list link
+ * and their size is a multiple of their alignment.
+ * 
+ * @ingroup memory_utilities
+ * 
+ * @param[in] size Size of the objects the blocks hold
+ * @param[in] align Alignment of those objects
+ */
+inline void NodePool::set_block(size_type size, size_type align) noexcept {
+	block_align_ = align < alignof(FreeBlock) ? alignof(FreeBlock) : align;
+	size_type bytes = size < sizeof(FreeBlock) ? sizeof(FreeBlock) : size;
+	block_size_ = (bytes + block_align_ - 1) / block_align_ * block_align_;
+}
+
+/**
+ * @brief Allocates the next chunk
+ * 
+ * @details Doubles the chunk size for the following call, up to
+ * max_chunk_blocks.
+ * 
+ * @ingroup memory_utilities
+ * 
+ * @throws std::bad_alloc if the allocation fails
+ */
+inline void NodePool::add_chunk() {
+	size_type bytes = header_size() + next_blocks_ * block_size_;
+	Chunk *chunk = ::new (::operator new(bytes, chunk_align())) Chunk{chunks_, bytes};
+	chunks_ = chunk;
+	cursor_ = reinterpret_cast<unsigned char *>(chunk) + header_size();
+	end_ = reinterpret_cast<unsigned char *>(chunk) + bytes;
+	if (next_blocks_ < max_chunk_blocks)
+		next_blocks_ *= 2;
+}
+
+/**
+ * @brief Size of the chunk header, padded to the block alignment
+ * 
+ * @ingroup memory_utilities
+ * 
+ * @return Offset of the first block within a chunk
+ */
+inline NodePool::size_type NodePool::header_size() const noexcept {
+	return (sizeof(Chunk) + block_align_ - 1) / block_align_ * block_align_;
+}
+
+/**
+ * @brief Alignment requested for chunks
+ * 
+ * @ingroup memory_utilities
+ * 
+ * @return Alignment suiting both the header and the blocks
+ */
+inline std::align_val_t NodePool::chunk_align() const noexcept {
+	return std::align_val_t(block_align_ < alignof(Chunk) ? alignof(Chunk) : block_align_);
+}
+
+/**
+ * @brief Returns the pool for this block size
+ * 
+ * @details Constructed in static storage on first use and never
+ * destroyed.
+ * 
+ * @ingroup memory_utilities
+ * 
+ * @return Pool shared by the default allocators of this block size
+ */
+template<std::size_t Size, std::size_t Align, std::size_t ChunkNodes>
+SharedNodePool<Size, Align, ChunkNodes> &SharedNodePool<Size, Align, ChunkNodes>::instance() noexcept {
+	alignas(SharedNodePool) static unsigned char storage[sizeof(SharedNodePool)];
+	static SharedNodePool *shared = ::new (static_cast<void *>(storage)) SharedNodePool();
+	return *shared;
+}
+
+/**
+ * @brief Constructs an allocator using the given pool
+ * 
+ * @details The pool is shared with every copy of this allocator and
+ * is used without locking.
+ * 
+ * @ingroup memory_utilities
+ * 
+ * @param[in] pool Pool to serve single objects from, null for the
+ * shared pool
+ */
+template<class T, std::size_t ChunkNodes>
+PoolAllocator<T, ChunkNodes>::PoolAllocator(std::shared_ptr<NodePool> pool) noexcept : pool_(std::move(pool)) {}
+
+/**
+ * @brief Converting constructor
+ * 
+ * @details Shares the pool of other, as required for allocators
+ * rebound to the node type of a container.
+ * 
+ * @ingroup memory_utilities
+ * 
+ * @tparam U Object type of the other allocator
+ * @param[in] other Allocator whose pool to share
+ */
+template<class T, std::size_t ChunkNodes>
+template<class U>
+PoolAllocator<T, ChunkNodes>::PoolAllocator(const PoolAllocator<U, ChunkNodes> &other) noexcept : pool_(other.pool_) {}
+
+/**
+ * @brief Allocates storage for count objects
+ * 
+ * @details A single object comes from the shared pool for T, or from
+ * the own pool, whose blocks are sized for T if this is the first such
+ * request; arrays and objects the own pool was sized too small for use
+ * aligned operator new.
+ * 
+ * @ingroup memory_utilities
+ * 
+ * @param[in] count Number of objects
+ * @return Uninitialized storage
+ * 
+ * @throws std::bad_alloc if the allocation fails
+ */
+template<class T, std::size_t ChunkNodes>
+T *PoolAllocator<T, ChunkNodes>::allocate(size_type count) {
+	if (count == 1 && !pool_) {
+		std::lock_guard<std::mutex> lock(shared().mutex);
+		return static_cast<T *>(shared().pool.allocate());
+	}
+	if (count == 1 && pool_->size_for(sizeof(T), alignof(T)))
+		return static_cast<T *>(pool_->allocate());
+	return static_cast<T *>(::operator new(count * sizeof(T), std::align_val_t(alignof(T))));
+}
+
+/**
+ * @brief Releases storage obtained from allocate()
+ * 
+ * @details Pool blocks go back onto the pool's free list.
+ * 
+ * @ingroup memory_utilities
+ * 
+ * @param[in] object Storage to release
+ * @param[in] count Number of objects passed to allocate()
+ */
+template<class T, std::size_t ChunkNodes>
+void PoolAllocator<T, ChunkNodes>::deallocate(T *object, size_type count) noexcept {
+	if (count == 1 && !pool_) {
+		std::lock_guard<std::mutex> lock(shared().mutex);
+		shared().pool.deallocate(object);
+	}
+	else if (pooled(count))
+		pool_->deallocate(object);
+	else
+		::operator delete(static_cast<void *>(object), std::align_val_t(alignof(T)));
+}
+
+/**
+ * @brief Allocator for a copied container
+ * 
+ * @details A default allocator is returned as is. An allocator with
+ * an own pool returns one with a new pool, so that the copy does not
+ * share this one.
+ * 
+ * @ingroup memory_utilities
+ * 
+ * @return Allocator for the copy
+ * 
+ * @throws std::bad_alloc if a new pool cannot be created
+ */
+template<class T, std::size_t ChunkNodes>
+PoolAllocator<T, ChunkNodes> PoolAllocator<T, ChunkNodes>::select_on_container_copy_construction() const {
+	if (!pool_)
+		return *this;
+	return PoolAllocator(std::make_shared<NodePool>(ChunkNodes));
+}
+
+/**
+ * @brief Returns the number of blocks the pool has carved
+ * 
+ * @details For a default allocator this counts the blocks of every
+ * container using the shared pool.
+ * 
+ * @ingroup memory_utilities
+ * 
+ * @return Distinct nodes handed out so far
+ */
+template<class T, std::size_t ChunkNodes>
+typename PoolAllocator<T, ChunkNodes>::size_type PoolAllocator<T, ChunkNodes>::capacity() const noexcept {
+	if (!pool_) {
+		std::lock_guard<std::mutex> lock(shared().mutex);
+		return shared().pool.capacity();
+	}
+	return pool_->capacity();
+}
+
+/**
+ * @brief Checks whether a request is served by the pool
+ * 
+ * @ingroup memory_utilities
+ * 
+ * @param[in] count Number of objects requested
+ * @return true for a single object that fits the own pool's blocks
+ */
+template<class T, std::size_t ChunkNodes>
+bool PoolAllocator<T, ChunkNodes>::pooled(size_type count) const noexcept {
+	return count == 1 && pool_->fits(sizeof(T), alignof(T));
+}
+
+/**
+ * @brief Returns the shared pool for objects of type T
+ * 
+ * @ingroup memory_utilities
+ * 
+ * @return Pool used by default allocators
+ */
+template<class T, std::size_t ChunkNodes>
+SharedNodePool<sizeof(T), alignof(T), ChunkNodes> &PoolAllocator<T, ChunkNodes>::shared() noexcept {
+	return SharedNodePool<sizeof(T), alignof(T), ChunkNodes>::instance();
+}
+
+#endif
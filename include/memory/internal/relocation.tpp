@@ -0,0 +1,80 @@
+/**
+ * @file relocation.tpp
+ * @brief Implementation of element relocation helpers
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef RELOCATION_TPP
+#define RELOCATION_TPP
+
+#include "../relocation.hpp"
+
+/**
+ * @brief Relocates count elements into uninitialized storage
+ * 
+ * @details Moves the objects in [first, first + count) into the
+ * uninitialized range starting at dest and ends the lifetime of the
+ * originals. Trivially relocatable types are transferred with a single
+ * memcpy. Other types are move-constructed (or copied when their move
+ * constructor may throw) and then destroyed; if a construction throws,
+ * the objects already built in dest are destroyed and the source range
+ * is left untouched. The two ranges must not overlap.
+ * 
+ * @ingroup memory_utilities
+ * 
+ * @tparam Allocator Allocator used to construct and destroy elements
+ * @tparam T Element type
+ * @param[in] alloc Allocator owning both ranges
+ * @param[in] first Start of the source range
+ * @param[in] count Number of elements to relocate
+ * @param[out] dest Start of the uninitialized destination range
+ */
+template<class Allocator, class T>
+void relocate_n(Allocator &alloc, T *first, std::size_t count, T *dest) {
+	if constexpr (is_trivially_relocatable_v<T>) {
+		(void)alloc;
+		if (count > 0)
+			std::memcpy(static_cast<void *>(dest), static_cast<const void *>(first), count * sizeof(T));
+	}
+	else {
+		using alloc_traits = std::allocator_traits<Allocator>;
+		std::size_t i = 0;
+		try {
+			for (; i < count; ++i)
+				alloc_traits::construct(alloc, dest + i, std::move_if_noexcept(first[i]));
+		}
+		catch (...) {
+			while (i > 0)
+				alloc_traits::destroy(alloc, dest + --i);
+			throw;
+		}
+		for (i = 0; i < count; ++i)
+			alloc_traits::destroy(alloc, first + i);
+	}
+}
+
+/**
+ * @brief Relocates trivially relocatable elements within one buffer
+ * 
+ * @details Moves the bytes of [first, first + count) to dest with a
+ * single memmove, so the ranges may overlap. This is how array
+ * containers open or close a gap in their storage without touching
+ * each element. Only available for trivially relocatable types.
+ * 
+ * @ingroup memory_utilities
+ * 
+ * @tparam T Element type
+ * @param[in] first Start of the source range
+ * @param[in] count Number of elements to relocate
+ * @param[out] dest Start of the destination range
+ */
+template<class T>
+void relocate_overlapping(T *first, std::size_t count, T *dest) noexcept {
+	static_assert(is_trivially_relocatable_v<T>, "relocate_overlapping requires a trivially relocatable type");
+	if (count > 0)
+		std::memmove(static_cast<void *>(dest), static_cast<const void *>(first), count * sizeof(T));
+}
+
+#endif
@@ -0,0 +1,20 @@
+/**
+ * @file member_owner.hpp
+ * @brief Recovers an object from a pointer to one of its members
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef MEMBER_OWNER_HPP
+#define MEMBER_OWNER_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+template<class T, class M, M T::*Member>
+T *member_owner(const M *member) noexcept;
+
+#include "internal/member_owner.tpp"
+
+#endif
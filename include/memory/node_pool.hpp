@@ -0,0 +1,214 @@
+/**
+ * @file node_pool.hpp
+ * @brief Free-list pool and allocator for node-based containers
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef NODE_POOL_HPP
+#define NODE_POOL_HPP
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+
+/**
+ * @class NodePool
+ * @brief Hands out fixed-size blocks carved from larger chunks
+ * 
+ * @details Blocks are taken from chunks obtained with aligned operator
+ * new. The first chunk holds first_chunk blocks and each following one
+ * twice as many, up to max_chunk_blocks, so n blocks cost about log2(n)
+ * calls into the global allocator while at most one partly used chunk
+ * is wasted. Freed blocks go onto an intrusive free list and are reused
+ * before any new block is carved, and neighbouring nodes of a list
+ * built in one go end up next to each other in memory. Chunks are only
+ * given back when the pool is destroyed.
+ * 
+ * A pool constructed without a block size takes the size and
+ * alignment of the first object type passed to size_for().
+ * 
+ * Not thread-safe; SharedNodePool pairs a pool with a mutex, and
+ * ConcurrentNodePool is a lock-free pool for concurrent containers.
+ * 
+ * @ingroup memory_utilities
+ */
+class NodePool {
+public:
+	using size_type = unsigned long;  ///< Type for sizes and counts
+
+	static constexpr size_type max_chunk_blocks = 4096; ///< Largest number of blocks per chunk
+
+	NodePool(size_type block_size, size_type block_align, size_type first_chunk) noexcept;
+	explicit NodePool(size_type first_chunk) noexcept;
+	NodePool(const NodePool &other) = delete;
+	NodePool &operator=(const NodePool &other) = delete;
+	~NodePool();
+
+	void *allocate();
+	void deallocate(void *block) noexcept;
+	bool fits(size_type size, size_type align) const noexcept;
+	bool size_for(size_type size, size_type align) noexcept;
+
+	size_type capacity() const noexcept;
+
+private:
+	/**
+	 * @struct Chunk
+	 * @brief Header at the start of every chunk
+	 */
+	struct Chunk {
+		Chunk		*next;   ///< Previously allocated chunk
+		size_type	bytes;   ///< Size of the chunk including this header
+	};
+
+	/**
+	 * @struct FreeBlock
+	 * @brief Link stored in a block while it is on the free list
+	 */
+	struct FreeBlock {
+		FreeBlock	*next;  ///< Next free block
+	};
+
+	size_type		block_size_;   ///< Bytes per block, a multiple of block_align_, or zero until sized
+	size_type		block_align_;  ///< Alignment of every block
+	size_type		next_blocks_;  ///< Blocks in the next chunk
+	size_type		capacity_;     ///< Blocks carved so far
+	FreeBlock		*free_;        ///< Head of the free list
+	unsigned char	*cursor_;      ///< Next uncarved block of the newest chunk
+	unsigned char	*end_;         ///< End of the newest chunk
+	Chunk			*chunks_;      ///< Newest chunk, linked to the older ones
+
+	void set_block(size_type size, size_type align) noexcept;
+	void add_chunk();
+	size_type header_size() const noexcept;
+	std::align_val_t chunk_align() const noexcept;
+};
+
+/**
+ * @struct SharedNodePool
+ * @brief Process-wide NodePool for one block size, guarded by a mutex
+ * 
+ * @details Backs every default-constructed PoolAllocator whose objects
+ * have this size and alignment, so default containers of one node
+ * type share their nodes' pool. The pool lives in static storage and
+ * is never destroyed, so containers destroyed during static
+ * destruction can still give their nodes back; its chunks are kept
+ * for reuse until the process exits.
+ * 
+ * @tparam Size Size of the blocks
+ * @tparam Align Alignment of the blocks
+ * @tparam ChunkNodes Number of blocks in the pool's first chunk
+ * 
+ * @ingroup memory_utilities
+ */
+template<std::size_t Size, std::size_t Align, std::size_t ChunkNodes>
+struct SharedNodePool {
+	std::mutex	mutex;                         ///< Serializes access to pool
+	NodePool	pool{Size, Align, ChunkNodes};  ///< Blocks shared by the default allocators
+
+	static SharedNodePool &instance() noexcept;
+};
+
+/**
+ * @class PoolAllocator
+ * @brief Allocator serving single nodes from a NodePool
+ * 
+ * @details The default node allocator of the node-based containers.
+ * Requests for a single object come from a pool; any other request
+ * goes straight to aligned operator new.
+ * 
+ * A default-constructed allocator allocates nothing itself and uses
+ * the SharedNodePool for the size of the objects it serves. All
+ * default allocators therefore compare equal, and default containers
+ * can relink nodes between each other. The shared pool is locked on
+ * every allocation, so default containers may live in different
+ * threads.
+ * 
+ * An allocator constructed from a NodePool uses that pool instead,
+ * without locking, and shares it with its copies and rebound copies.
+ * The pool's blocks are sized by the first single-object request,
+ * normally for the container's node type. A container's copy gets a
+ * fresh pool of its own, while moving or swapping containers carries
+ * the pool along with the nodes.
+ * 
+ * @tparam T Type of objects to allocate
+ * @tparam ChunkNodes Number of blocks in the pool's first chunk
+ * 
+ * @ingroup memory_utilities
+ */
+template<class T, std::size_t ChunkNodes = 64>
+class PoolAllocator {
+public:
+	using value_type								= T;                ///< Type of allocated objects
+	using size_type									= unsigned long;    ///< Type for counts
+	using difference_type							= std::ptrdiff_t;   ///< Type for pointer differences
+	using propagate_on_container_copy_assignment	= std::false_type;  ///< Copies keep their own pool
+	using propagate_on_container_move_assignment	= std::true_type;   ///< Moved nodes bring their pool
+	using propagate_on_container_swap				= std::true_type;   ///< Swapped nodes bring their pool
+	using is_always_equal							= std::false_type;  ///< Own pools are shared only by copies
+
+	/**
+	 * @struct rebind
+	 * @brief Same allocator for another object type
+	 * 
+	 * @tparam U Type of objects the rebound allocator allocates
+	 */
+	template<class U>
+	struct rebind {
+		using other = PoolAllocator<U, ChunkNodes>;  ///< Rebound allocator type
+	};
+
+	PoolAllocator() noexcept = default;
+	explicit PoolAllocator(std::shared_ptr<NodePool> pool) noexcept;
+	PoolAllocator(const PoolAllocator &other) noexcept = default;
+	template<class U>
+	PoolAllocator(const PoolAllocator<U, ChunkNodes> &other) noexcept;
+
+	PoolAllocator &operator=(const PoolAllocator &other) noexcept = default;
+
+	T *allocate(size_type count);
+	void deallocate(T *object, size_type count) noexcept;
+	PoolAllocator select_on_container_copy_construction() const;
+	size_type capacity() const noexcept;
+
+	/**
+	 * @brief Equality comparison
+	 * 
+	 * @param[in] lhs First allocator
+	 * @param[in] rhs Second allocator
+	 * @return true if memory from one can be freed through the other
+	 */
+	template<class U>
+	friend bool operator==(const PoolAllocator &lhs, const PoolAllocator<U, ChunkNodes> &rhs) noexcept {
+		return lhs.pool_ == PoolAllocator(rhs).pool_;
+	}
+
+	/**
+	 * @brief Inequality comparison
+	 * 
+	 * @param[in] lhs First allocator
+	 * @param[in] rhs Second allocator
+	 * @return true if the allocators use different pools
+	 */
+	template<class U>
+	friend bool operator!=(const PoolAllocator &lhs, const PoolAllocator<U, ChunkNodes> &rhs) noexcept {
+		return !(lhs == rhs);
+	}
+
+private:
+	std::shared_ptr<NodePool> pool_;  ///< Own pool shared with copies, null for the shared pool
+
+	bool pooled(size_type count) const noexcept;
+	static SharedNodePool<sizeof(T), alignof(T), ChunkNodes> &shared() noexcept;
+
+	template<class U, std::size_t OtherChunkNodes>
+	friend class PoolAllocator;
+};
+
+#include "internal/node_pool.tpp"
+
+#endif
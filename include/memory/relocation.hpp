@@ -0,0 +1,67 @@
+/**
+ * @file relocation.hpp
+ * @brief Trait and helpers for relocating elements between buffers
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef RELOCATION_HPP
+#define RELOCATION_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @defgroup memory_utilities Memory Module
+ * @brief Low-level storage helpers shared by the containers
+ * 
+ * @details This module groups the building blocks containers use to
+ * manage raw storage: element relocation, capacity policies and node
+ * pools. None of them are needed to use the containers, but user
+ * types can opt into the faster paths they provide.
+ */
+
+/**
+ * @struct is_trivially_relocatable
+ * @brief Marks types that can be moved to a new address with memcpy
+ * 
+ * @details A type is trivially relocatable when moving an object to
+ * new storage and destroying the original is equivalent to copying
+ * its bytes. All trivially copyable types qualify. Other types (for
+ * example ones holding an owning pointer) may opt in by specializing
+ * this trait:
+ * 
+ * @code
+ * template<>
+ * struct is_trivially_relocatable<MyType> : std::true_type {};
+ * @endcode
+ * 
+ * Types that store pointers into themselves must never opt in.
+ * 
+ * @tparam T Type being queried
+ * 
+ * @ingroup memory_utilities
+ */
+template<class T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+/**
+ * @brief Convenience variable for is_trivially_relocatable
+ * 
+ * @ingroup memory_utilities
+ */
+template<class T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+template<class Allocator, class T>
+void relocate_n(Allocator &alloc, T *first, std::size_t count, T *dest);
+template<class T>
+void relocate_overlapping(T *first, std::size_t count, T *dest) noexcept;
+
+#include "internal/relocation.tpp"
+
+#endif
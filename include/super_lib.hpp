@@ -60,14 +60,39 @@
 #ifndef SUPER_LIB_HPP
 #define SUPER_LIB_HPP
 
+#include "collections_config.hpp"
+
 #include "standard_functions/check.hpp"
 #include "standard_functions/conversion.hpp"
 
+#include "memory/cache_line.hpp"
+#include "memory/capacity_policy.hpp"
+#include "memory/member_owner.hpp"
+#include "memory/node_pool.hpp"
+#include "memory/relocation.hpp"
+
+#include "linear/block_deque.hpp"
 #include "linear/deque.hpp"
+#include "linear/intrusive_list.hpp"
+#include "linear/intrusive_slist.hpp"
 #include "linear/double_linked_list.hpp"
 #include "linear/linked_list.hpp"
 #include "linear/queue.hpp"
+#include "linear/ring_buffer.hpp"
+#include "linear/skip_list.hpp"
+#include "linear/small_vector.hpp"
 #include "linear/stack.hpp"
+#include "linear/unrolled_list.hpp"
 #include "linear/vector.hpp"
 
+#include "concurrent/concurrent_node_pool.hpp"
+#include "concurrent/concurrent_skip_list.hpp"
+#include "concurrent/concurrent_stack.hpp"
+#include "concurrent/mpmc_queue.hpp"
+#include "concurrent/mpsc_queue.hpp"
+#include "concurrent/spsc_queue.hpp"
+#include "concurrent/work_stealing_deque.hpp"
+
+#include "tree/binary_tree.hpp"
+
 #endif
@@ -1,26 +1,212 @@
+/**
+ * @file binary_tree.hpp
+ * @brief Ordered set built on a red-black binary search tree
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
 #ifndef BINARY_TREE_HPP
 #define BINARY_TREE_HPP
 
-#include <iostream>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../memory/node_pool.hpp"
+
+/**
+ * @defgroup tree_structures Tree Module
+ * @brief Hierarchical container data structures
+ * 
+ * @details This module provides node-based trees that keep their
+ * elements ordered. Lookups, insertions and erasures take O(log n) in
+ * the worst case, and iterators visit the elements in sorted order.
+ */
 
-template<class T>
+/**
+ * @class BinaryTree
+ * @brief Sorted set of unique elements in a red-black tree
+ * 
+ * @details Every node is red or black; the root is black, a red node
+ * has no red child, and every path from a node down to a missing child
+ * passes the same number of black nodes. Together these keep the
+ * height below 2 log2(n + 1), so insert, erase, find, lower_bound and
+ * upper_bound take O(log n) in the worst case. Insertion restores the
+ * rules with at most two rotations and erasure with at most three.
+ * 
+ * Iterators walk the tree in order through parent links and are
+ * bidirectional. Elements are read-only through them, as changing one
+ * in place could break the order. Inserting and erasing do not
+ * invalidate iterators to other elements.
+ * 
+ * If Compare defines is_transparent, find, contains, lower_bound,
+ * upper_bound and erase also accept any key Compare can order against
+ * the elements. A tree of key-value pairs with a comparator on the key
+ * then serves as a map, looked up by key alone.
+ * 
+ * Nodes are obtained from a node allocator, by default a PoolAllocator
+ * that carves them out of chunks and reuses freed ones.
+ * 
+ * @tparam T Type of elements stored in the tree
+ * @tparam Compare Strict weak ordering on T
+ * @tparam Allocator Allocator whose rebound copy allocates the nodes
+ * 
+ * @ingroup tree_structures
+ */
+template<class T, class Compare = std::less<T>, class Allocator = PoolAllocator<T>>
 class BinaryTree {
+public:
+	/**
+	 * @struct Node
+	 * @brief Node structure for tree elements
+	 * 
+	 * @details Each node holds an element, links to its children and
+	 * its parent, and its color.
+	 */
 	struct Node {
-		T			data;
-		Node		*left;
-		Node		*right;
+		T			data;    ///< Data value stored in node
+		Node		*left;   ///< Subtree of smaller elements, or nullptr
+		Node		*right;  ///< Subtree of larger elements, or nullptr
+		Node		*parent; ///< Parent node, or nullptr for the root
+		bool		red;     ///< Color of the node
 
 		Node(const T &value);
+		Node(T &&value);
+	};
+
+	/**
+	 * @class Iterator
+	 * @brief Bidirectional iterator visiting elements in sorted order
+	 * 
+	 * @details Only hands out const references. The end iterator
+	 * remembers its tree, so it can be decremented to the largest
+	 * element.
+	 */
+	class Iterator {
+	public:
+		using iterator_category	= std::bidirectional_iterator_tag;  ///< Iterator category tag
+		using value_type		= T;                                ///< Type of elements
+		using difference_type	= std::ptrdiff_t;                   ///< Distance between iterators
+		using pointer			= const T*;                         ///< Pointer to element
+		using reference			= const T&;                         ///< Reference to element
+
+		Iterator() noexcept;
+		Iterator(const Node *node, const BinaryTree *tree) noexcept;
+
+		reference operator*() const;
+		pointer operator->() const;
+		Iterator& operator++();
+		Iterator operator++(int);
+		Iterator& operator--();
+		Iterator operator--(int);
+		bool operator!=(const Iterator& other) const;
+		bool operator==(const Iterator& other) const;
+
+	private:
+		const Node			*current;  ///< Pointer to current node, nullptr for end()
+		const BinaryTree	*tree;     ///< Tree being iterated
+
+		friend class BinaryTree;
 	};
 
-	using value_type		= T;
-	using size_type			= unsigned long;
-	using reference			= T&;
-	using const_reference	= const T&;
-	using pointer			= Node*;
-	using const_pointer		= const Node*;
-	using iterator			= Node*;
-	using const_iterator	= const Node*;
+	using ConstIterator		= Iterator;       ///< Read-only iterator
+
+	using value_type		= T;              ///< Type of stored elements
+	using key_compare		= Compare;        ///< Element ordering
+	using allocator_type	= Allocator;      ///< Type of node allocator
+	using size_type			= unsigned long;  ///< Type for sizes
+	using reference			= T&;             ///< Reference to element
+	using const_reference	= const T&;       ///< Const reference to element
+	using pointer			= Node*;          ///< Pointer to node
+	using const_pointer		= const Node*;    ///< Const pointer to node
+	using iterator			= Iterator;       ///< Iterator type
+	using const_iterator	= ConstIterator;  ///< Const iterator type
+
+	BinaryTree();
+	explicit BinaryTree(const Compare &comp, const Allocator &alloc = Allocator());
+	BinaryTree(const BinaryTree &other);
+	BinaryTree(BinaryTree &&other) noexcept;
+	template <class Container>
+	BinaryTree(const Container& other);
+	~BinaryTree();
+
+	BinaryTree &operator=(const BinaryTree &other);
+	BinaryTree &operator=(BinaryTree &&other)
+		noexcept(node_traits::propagate_on_container_move_assignment::value || node_traits::is_always_equal::value);
+
+	void clear() noexcept;
+	std::pair<iterator, bool> insert(const_reference value);
+	std::pair<iterator, bool> insert(value_type &&value);
+	size_type erase(const_reference value);
+	iterator erase(const_iterator pos);
+	template <class K, class C = Compare, class = typename C::is_transparent,
+		class = std::enable_if_t<!std::is_convertible<const K &, const_iterator>::value>>
+	size_type erase(const K &key);
+	const_reference front() const;
+	const_reference back() const;
+
+	const_iterator find(const_reference value) const;
+	bool contains(const_reference value) const;
+	const_iterator lower_bound(const_reference value) const;
+	const_iterator upper_bound(const_reference value) const;
+	template <class K, class C = Compare, class = typename C::is_transparent>
+	const_iterator find(const K &key) const;
+	template <class K, class C = Compare, class = typename C::is_transparent>
+	bool contains(const K &key) const;
+	template <class K, class C = Compare, class = typename C::is_transparent>
+	const_iterator lower_bound(const K &key) const;
+	template <class K, class C = Compare, class = typename C::is_transparent>
+	const_iterator upper_bound(const K &key) const;
+
+	size_type size() const noexcept;
+	bool empty() const noexcept;
+	size_type height() const noexcept;
+	const_pointer root() const noexcept;
+	key_compare key_comp() const;
+	allocator_type get_allocator() const noexcept;
+
+	const_iterator begin() const noexcept;
+	const_iterator end() const noexcept;
+
+private:
+	using node_allocator	= typename std::allocator_traits<Allocator>::template rebind_alloc<Node>; ///< Allocator for nodes
+	using node_traits		= std::allocator_traits<node_allocator>;                                   ///< Node allocator interface
+
+	pointer				root_;      ///< Root node, or nullptr when empty
+	pointer				leftmost_;  ///< Smallest element, or nullptr when empty
+	size_type			size_;      ///< Number of elements in tree
+	Compare				comp_;      ///< Element ordering
+	node_allocator		alloc_;     ///< Allocator owning the nodes
+
+	template <class Arg>
+	std::pair<iterator, bool> insert_unique(Arg &&value);
+	template <class Arg>
+	pointer create_node(Arg &&value);
+	void destroy_node(pointer node) noexcept;
+	void destroy_subtree(pointer node) noexcept;
+	pointer clone(const_pointer node, pointer parent);
+	void take(BinaryTree &other) noexcept;
+	template <class K>
+	const_pointer lower_node(const K &key) const;
+	template <class K>
+	const_pointer upper_node(const K &key) const;
+	void rotate_left(pointer node) noexcept;
+	void rotate_right(pointer node) noexcept;
+	void replace_child(pointer parent, pointer old_child, pointer new_child) noexcept;
+	void fix_insert(pointer node) noexcept;
+	void unlink(pointer node) noexcept;
+	void fix_erase(pointer node, pointer parent) noexcept;
+	static size_type subtree_height(const_pointer node) noexcept;
+	static const_pointer minimum(const_pointer node) noexcept;
+	static const_pointer maximum(const_pointer node) noexcept;
+	static bool is_red(const_pointer node) noexcept;
 };
 
+#include "internal/binary_tree.tpp"
+
 #endif
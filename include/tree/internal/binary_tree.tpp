@@ -0,0 +1,1202 @@
+/**
+ * @file binary_tree.tpp
+ * @brief Implementation of BinaryTree template class methods
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ */
+
+#ifndef BINARY_TREE_TPP
+#define BINARY_TREE_TPP
+
+#include "../binary_tree.hpp"
+
+/**
+ * @brief Node constructor
+ * 
+ * @details Copies value into a new red node without links.
+ * 
+ * @ingroup tree_structures
+ * 
+ * @param[in] value Value to store in the node
+ */
+template<class T, class Compare, class Allocator>
+BinaryTree<T, Compare, Allocator>::Node::Node(const T &value) : data(value), left(nullptr), right(nullptr), parent(nullptr), red(true) {}
+
+/**
+ * @brief Node move constructor
+ * 
+ * @details Moves value into a new red node without links.
+ * 
+ * @ingroup tree_structures
+ * 
+ * @param[in] value Value to move into the node
+ */
+template<class T, class Compare, class Allocator>
+BinaryTree<T, Compare, Allocator>::Node::Node(T &&value) : data(std::move(value)), left(nullptr), right(nullptr), parent(nullptr), red(true) {}
+
+/**
+ * @brief Default iterator constructor
+ * 
+ * @details Constructs an iterator that belongs to no tree.
+ * 
+ * @ingroup tree_structures
+ */
+template<class T, class Compare, class Allocator>
+BinaryTree<T, Compare, Allocator>::Iterator::Iterator() noexcept : current(nullptr), tree(nullptr) {}
+
+/**
+ * @brief Iterator constructor
+ * 
+ * @ingroup tree_structures
+ * 
+ * @param[in] node Node to reference, nullptr for end()
+ * @param[in] tree Tree the node belongs to
+ */
+template<class T, class Compare, class Allocator>
+BinaryTree<T, Compare, Allocator>::Iterator::Iterator(const Node *node, const BinaryTree *tree) noexcept : current(node), tree(tree) {}
+
+/**
+ * @brief Dereference operator
+ * 
+ * @ingroup tree_structures
+ * 
+ * @return Const reference to the current element
+ */
+template<class T, class Compare, class Allocator>
+typename BinaryTree<T, Compare, Allocator>::Iterator::reference BinaryTree<T, Compare, Allocator>::Iterator::operator*() const {
+	return current->data;
+}
+
+/**
+ * @brief Arrow operator
+ * 
+ * @ingroup tree_structures
+ * 
+ * @return Pointer to the current element
+ */
+template<class T, class Compare, class Allocator>
+typename BinaryTree<T, Compare, Allocator>::Iterator::pointer BinaryTree<T, Compare, Allocator>::Iterator::operator->() const {
+	return &current->data;
+}
+
+/**
+ * @brief Pre-increment operator
+ * 
+ * @details Moves to the smallest element of the right subtree, or
+ * else climbs until coming up from a left child. Takes O(1) amortized
+ * over a full traversal.
+ * 
+ * @ingroup tree_structures
+ * 
+ * @return Reference to this iterator after moving to the next element
+ */
+template<class T, class Compare, class Allocator>
+typename BinaryTree<T, Compare, Allocator>::Iterator &BinaryTree<T, Compare, Allocator>::Iterator::operator++() {
+	if (current->right)
+		current = minimum(current->right);
+	else {
+		const Node *child = current;
+		current = current->parent;
+		while (current && child == current->right) {
+			child = current;
+			current = current->parent;
+		}
+	}
+	return *this;
+}
+
+/**
+ * @brief Post-increment operator
+ * 
+ * @ingroup tree_structures
+ * 
+ * @return Copy of the iterator before it moved
+ */
+template<class T, class Compare, class Allocator>
+typename BinaryTree<T, Compare, Allocator>::Iterator BinaryTree<T, Compare, Allocator>::Iterator::operator++(int) {
+	Iterator temp = *this;
+	++(*this);
+	return temp;
+}
+
+/**
+ * @brief Pre-decrement operator
+ * 
+ * @details Decrementing end() moves to the largest element.
+ * 
+ * @ingroup tree_structures
+ * 
+ * @return Reference to this iterator after moving to the previous element
+ */
+template<class T, class Compare, class Allocator>
+typename BinaryTree<T, Compare, Allocator>::Iterator &BinaryTree<T, Compare, Allocator>::Iterator::operator--() {
+	if (!current)
+		current = maximum(tree->root_);
+	else if (current->left)
+		current = maximum(current->left);
+	else {
+		const Node *child = current;
+		current = current->parent;
+		while (current && child == current->left) {
+			child = current;
+			current = current->parent;
+		}
+	}
+	return *this;
+}
+
+/**
+ * @brief Post-decrement operator
+ * 
+ * @ingroup tree_structures
+ * 
+ * @return Copy of the iterator before it moved
+ */
+template<class T, class Compare, class Allocator>
+typename BinaryTree<T, Compare, Allocator>::Iterator BinaryTree<T, Compare, Allocator>::Iterator::operator--(int) {
+	Iterator temp = *this;
+	--(*this);
+	return temp;
+}
+
+/**
+ * @brief Inequality comparison operator
+ * 
+ * @ingroup tree_structures
+ * 
+ * @param[in] other Iterator to compare with
+ * @return true if iterators point to different nodes
+ */
+template<class T, class Compare, class Allocator>
+bool BinaryTree<T, Compare, Allocator>::Iterator::operator!=(const Iterator& other) const {
+	return current != other.current;
+}
+
+/**
+ * @brief Equality comparison operator
+ * 
+ * @ingroup tree_structures
+ * 
+ * @param[in] other Iterator to compare with
+ * @return true if iterators point to the same node
+ */
+template<class T, class Compare, class Allocator>
+bool BinaryTree<T, Compare, Allocator>::Iterator::operator==(const Iterator& other) const {
+	return current == other.current;
+}
+
+/**
+ * @brief Default constructor
+ * 
+ * @details Creates an empty tree.
+ * 
+ * @ingroup tree_structures
+ */
+template<class T, class Compare, class Allocator>
+BinaryTree<T, Compare, Allocator>::BinaryTree() : BinaryTree(Compare()) {}
+
+/**
+ * @brief Constructs an empty tree with the given ordering and allocator
+ * 
+ * @ingroup tree_structures
+ * 
+ * @param[in] comp Element ordering
+ * @param[in] alloc Allocator to rebind for the nodes
+ */
+template<class T, class Compare, class Allocator>
+BinaryTree<T, Compare, Allocator>::BinaryTree(const Compare &comp, const Allocator &alloc)
+	: root_(nullptr), leftmost_(nullptr), size_(0), comp_(comp), alloc_(alloc) {}
+
+/**
+ * @brief Copy constructor
+ * 
+ * @details Clones the shape and colors of other node by node, so no
+ * comparisons or rebalancing are needed. Takes O(n).
+ * 
+ * @ingroup tree_structures
+ * 
+ * @param[in] other Tree to copy from
+ */
+template<class T, class Compare, class Allocator>
+BinaryTree<T, Compare, Allocator>::BinaryTree(const BinaryTree &other)
+	: root_(nullptr), leftmost_(nullptr), size_(0), comp_(other.comp_),
+	alloc_(node_traits::select_on_container_copy_construction(other.alloc_)) {
+	root_ = clone(other.root_, nullptr);
+	leftmost_ = const_cast<pointer>(minimum(root_));
+	size_ = other.size_;
+}
+
+/**
+ * @brief Move constructor
+ * 
+ * @details Takes over the nodes and allocator of other, leaving other
+ * empty.
+ * 
+ * @ingroup tree_structures
+ * 
+ * @param[in,out] other Tree to move from
+ */
+template<class T, class Compare, class Allocator>
+BinaryTree<T, Compare, Allocator>::BinaryTree(BinaryTree &&other) noexcept
+	: root_(nullptr), leftmost_(nullptr), size_(0), comp_(other.comp_), alloc_(std::move(other.alloc_)) {
+	take(other);
+}
+
+/**
+ * @brief Constructs tree from another container
+ * 
+ * @details Inserts the elements of any container that supports
+ * range-based for loop; duplicates are kept once.
+ * 
+ * @ingroup tree_structures
+ * 
+ * @tparam Container Type of source container
+ * @param[in] other Container to copy elements from
+ */
+template<class T, class Compare, class Allocator>
+template <class Container>
+BinaryTree<T, Compare, Allocator>::BinaryTree(const Container& other) : BinaryTree() {
+	for (const auto& item : other)
+		insert(item);
+}
+
+/**
+ * @brief Destructor
+ * 
+ * @details Destroys all elements and gives their nodes back.
+ * 
+ * @ingroup tree_structures
+ */
+template<class T, class Compare, class Allocator>
+BinaryTree<T, Compare, Allocator>::~BinaryTree() {
+	clear();
+}
+
+/**
+ * @brief Copy assignment operator
+ * 
+ * @details Clones other before destroying the current elements, so
+ * this tree is left unchanged if copying throws.
+ * 
+ * @ingroup tree_structures
+ * 
+ * @param[in] other Tree to copy from
+ * @return Reference to this tree
+ */
+template<class T, class Compare, class Allocator>
+BinaryTree<T, Compare, Allocator> &BinaryTree<T, Compare, Allocator>::operator=(const BinaryTree &other) {
+	if (this != &other) {
+		pointer copy = clone(other.root_, nullptr);
+		clear();
+		root_ = copy;
+		leftmost_ = const_cast<pointer>(minimum(root_));
+		size_ = other.size_;
+		comp_ = other.comp_;
+	}
+	return *this;
+}
+
+/**
+ * @brief Move assignment operator
+ * 
+ * @details Destroys the current elements and takes over the nodes of
+ * other, leaving other empty. When the allocator does not propagate
+ * and the two allocators differ, the elements are moved into new
+ * nodes one by one instead; only then can the assignment throw.
+ * 
+ * @ingroup tree_structures
+ * 
+ * @param[in,out] other Tree to move from
+ * @return Reference to this tree
+ */
+template<class T, class Compare, class Allocator>
+BinaryTree<T, Compare, Allocator> &BinaryTree<T, Compare, Allocator>::operator=(BinaryTree &&other)
+	noexcept(node_traits::propagate_on_container_move_assignment::value || node_traits::is_always_equal::value) {
+	if (this != &other) {
+		clear();
+		comp_ = other.comp_;
+		if constexpr (node_traits::propagate_on_container_move_assignment::value) {
+			alloc_ = std::move(other.alloc_);
+			take(other);
+		}
+		else if (alloc_ == other.alloc_)
+			take(other);
+		else {
+			for (const_iterator it = other.begin(); it != other.end(); ++it)
+				insert(std::move(const_cast<pointer>(it.current)->data));
+			other.clear();
+		}
+	}
+	return *this;
+}
+
+/**
+ * @brief Removes all elements from tree
+ * 
+ * @ingroup tree_structures
+ */
+template<class T, class Compare, class Allocator>
+void BinaryTree<T, Compare, Allocator>::clear() noexcept {
+	destroy_subtree(root_);
+	root_ = nullptr;
+	leftmost_ = nullptr;
+	size_ = 0;
+}
+
+/**
+ * @brief Inserts a copy of value
+ * 
+ * @details Does nothing if an equivalent element is already present.
+ * 
+ * @ingroup tree_structures
+ * 
+ * @param[in] value Value to insert
+ * @return Iterator to the element with value's key, and true if it
+ * was inserted
+ */
+template<class T, class Compare, class Allocator>
+std::pair<typename BinaryTree<T, Compare, Allocator>::iterator, bool> BinaryTree<T, Compare, Allocator>::insert(const_reference value) {
+	return insert_unique(value);
+}
+
+/**
+ * @brief Inserts value by moving it
+ * 
+ * @details Does nothing, and leaves value untouched, if an equivalent
+ * element is already present.
+ * 
+ * @ingroup tree_structures
+ * 
+ * @param[in] value Value to move into the tree
+ * @return Iterator to the element with value's key, and true if it
+ * was inserted
+ */
+template<class T, class Compare, class Allocator>
+std::pair<typename BinaryTree<T, Compare, Allocator>::iterator, bool> BinaryTree<T, Compare, Allocator>::insert(value_type &&value) {
+	return insert_unique(std::move(value));
+}
+
+/**
+ * @brief Removes the element equivalent to value
+ * 
+ * @ingroup tree_structures
+ * 
+ * @param[in] value Value to remove
+ * @return Number of elements removed, 0 or 1
+ */
+template<class T, class Compare, class Allocator>
+typename BinaryTree<T, Compare, Allocator>::size_type BinaryTree<T, Compare, Allocator>::erase(const_reference value) {
+	const_iterator pos = find(value);
+	if (pos == end())
+		return 0;
+	erase(pos);
+	return 1;
+}
+
+/**
+ * @brief Removes the element equivalent to key
+ * 
+ * @details Only available if Compare is transparent. Keys that convert
+ * to an iterator select erase(const_iterator) instead.
+ * 
+ * @ingroup tree_structures
+ * 
+ * @tparam K Type of the key
+ * @param[in] key Key of the element to remove
+ * @return Number of elements removed, 0 or 1
+ */
+template<class T, class Compare, class Allocator>
+template<class K, class C, class, class>
+typename BinaryTree<T, Compare, Allocator>::size_type BinaryTree<T, Compare, Allocator>::erase(const K &key) {
+	const_iterator pos = find(key);
+	if (pos == end())
+		return 0;
+	erase(pos);
+	return 1;
+}
+
+/**
+ * @brief Removes the element at pos
+ * 
+ * @details Only iterators to the removed element are invalidated.
+ * 
+ * @ingroup tree_structures
+ * 
+ * @param[in] pos Iterator to the element to remove
+ * @return Iterator to the element after the removed one
+ * 
+ * @throws std::out_of_range If pos is end()
+ */
+template<class T, class Compare, class Allocator>
+typename BinaryTree<T, Compare, Allocator>::iterator BinaryTree<T, Compare, Allocator>::erase(const_iterator pos) {
+	pointer node = const_cast<pointer>(pos.current);
+	if (!node) throw std::out_of_range("erase position is end()");
+	iterator next = std::next(pos);
+	unlink(node);
+	destroy_node(node);
+	size_--;
+	return next;
+}
+
+/**
+ * @brief Returns the smallest element
+ * 
+ * @ingroup tree_structures
+ * 
+ * @return Const reference to the first element in order
+ * 
+ * @throws std::out_of_range If the tree is empty
+ */
+template<class T, class Compare, class Allocator>
+typename BinaryTree<T, Compare, Allocator>::const_reference BinaryTree<T, Compare, Allocator>::front() const {
+	if (!root_)
+		throw std::out_of_range("Tree is empty");
+	return leftmost_->data;
+}
+
+/**
+ * @brief Returns the largest element
+ * 
+ * @ingroup tree_structures
+ * 
+ * @return Const reference to the last element in order
+ * 
+ * @throws std::out_of_range If the tree is empty
+ */
+template<class T, class Compare, class Allocator>
+typename BinaryTree<T, Compare, Allocator>::const_reference BinaryTree<T, Compare, Allocator>::back() const {
+	if (!root_)
+		throw std::out_of_range("Tree is empty");
+	return maximum(root_)->data;
+}
+
+/**
+ * @brief Finds the element equivalent to value
+ * 
+ * @ingroup tree_structures
+ * 
+ * @param[in] value Value to look up
+ * @return Iterator to the element, or end() if not present
+ */
+template<class T, class Compare, class Allocator>
+typename BinaryTree<T, Compare, Allocator>::const_iterator BinaryTree<T, Compare, Allocator>::find(const_reference value) const {
+	const_pointer node = lower_node(value);
+	if (node && !comp_(value, node->data))
+		return const_iterator(node, this);
+	return end();
+}
+
+/**
+ * @brief Checks whether an element equivalent to value is present
+ * 
+ * @ingroup tree_structures
+ * 
+ * @param[in] value Value to look up
+ * @return true if the tree contains value
+ */
+template<class T, class Compare, class Allocator>
+bool BinaryTree<T, Compare, Allocator>::contains(const_reference value) const {
+	return find(value) != end();
+}
+
+/**
+ * @brief Finds the first element not ordered before value
+ * 
+ * @ingroup tree_structures
+ * 
+ * @param[in] value Value to compare against
+ * @return Iterator to the first element >= value, or end()
+ */
+template<class T, class Compare, class Allocator>
+typename BinaryTree<T, Compare, Allocator>::const_iterator BinaryTree<T, Compare, Allocator>::lower_bound(const_reference value) const {
+	return const_iterator(lower_node(value), this);
+}
+
+/**
+ * @brief Finds the first element ordered after value
+ * 
+ * @ingroup tree_structures
+ * 
+ * @param[in] value Value to compare against
+ * @return Iterator to the first element > value, or end()
+ */
+template<class T, class Compare, class Allocator>
+typename BinaryTree<T, Compare, Allocator>::const_iterator BinaryTree<T, Compare, Allocator>::upper_bound(const_reference value) const {
+	return const_iterator(upper_node(value), this);
+}
+
+/**
+ * @brief Finds the element equivalent to key
+ * 
+ * @details Only available if Compare is transparent.
+ * 
+ * @ingroup tree_structures
+ * 
+ * @tparam K Type of the key
+ * @param[in] key Key to look up
+ * @return Iterator to the element, or end() if not present
+ */
+template<class T, class Compare, class Allocator>
+template<class K, class C, class>
+typename BinaryTree<T, Compare, Allocator>::const_iterator BinaryTree<T, Compare, Allocator>::find(const K &key) const {
+	const_pointer node = lower_node(key);
+	if (node && !comp_(key, node->data))
+		return const_iterator(node, this);
+	return end();
+}
+
+/**
+ * @brief Checks whether an element equivalent to key is present
+ * 
+ * @details Only available if Compare is transparent.
+ * 
+ * @ingroup tree_structures
+ * 
+ * @tparam K Type of the key
+ * @param[in] key Key to look up
+ * @return true if the tree contains an element with key
+ */
+template<class T, class Compare, class Allocator>
+template<class K, class C, class>
+bool BinaryTree<T, Compare, Allocator>::contains(const K &key) const {
+	return find(key) != end();
+}
+
+/**
+ * @brief Finds the first element not ordered before key
+ * 
+ * @details Only available if Compare is transparent.
+ * 
+ * @ingroup tree_structures
+ * 
+ * @tparam K Type of the key
+ * @param[in] key Key to compare against
+ * @return Iterator to the first element >= key, or end()
+ */
+template<class T, class Compare, class Allocator>
+template<class K, class C, class>
+typename BinaryTree<T, Compare, Allocator>::const_iterator BinaryTree<T, Compare, Allocator>::lower_bound(const K &key) const {
+	return const_iterator(lower_node(key), this);
+}
+
+/**
+ * @brief Finds the first element ordered after key
+ * 
+ * @details Only available if Compare is transparent.
+ * 
+ * @ingroup tree_structures
+ * 
+ * @tparam K Type of the key
+ * @param[in] key Key to compare against
+ * @return Iterator to the first element > key, or end()
+ */
+template<class T, class Compare, class Allocator>
+template<class K, class C, class>
+typename BinaryTree<T, Compare, Allocator>::const_iterator BinaryTree<T, Compare, Allocator>::upper_bound(const K &key) const {
+	return const_iterator(upper_node(key), this);
+}
+
+/**
+ * @brief Returns number of elements in tree
+ * 
+ * @ingroup tree_structures
+ * 
+ * @return Current number of elements
+ */
+template<class T, class Compare, class Allocator>
+typename BinaryTree<T, Compare, Allocator>::size_type BinaryTree<T, Compare, Allocator>::size() const noexcept {
+	return size_;
+}
+
+/**
+ * @brief Checks if tree is empty
+ * 
+ * @ingroup tree_structures
+ * 
+ * @return true if tree contains no elements, false otherwise
+ */
+template<class T, class Compare, class Allocator>
+bool BinaryTree<T, Compare, Allocator>::empty() const noexcept {
+	return size_ == 0;
+}
+
+/**
+ * @brief Returns the number of nodes on the longest root-to-leaf path
+ * 
+ * @details Visits every node, so it takes O(n). The red-black rules
+ * keep the result at most 2 log2(n + 1).
+ * 
+ * @ingroup tree_structures
+ * 
+ * @return Height of the tree, 0 when empty
+ */
+template<class T, class Compare, class Allocator>
+typename BinaryTree<T, Compare, Allocator>::size_type BinaryTree<T, Compare, Allocator>::height() const noexcept {
+	return subtree_height(root_);
+}
+
+/**
+ * @brief Returns the root node
+ * 
+ * @details Gives read-only access to the node structure, e.g. to
+ * check the red-black rules.
+ * 
+ * @ingroup tree_structures
+ * 
+ * @return Const pointer to the root, or nullptr when empty
+ */
+template<class T, class Compare, class Allocator>
+typename BinaryTree<T, Compare, Allocator>::const_pointer BinaryTree<T, Compare, Allocator>::root() const noexcept {
+	return root_;
+}
+
+/**
+ * @brief Returns the element ordering
+ * 
+ * @ingroup tree_structures
+ * 
+ * @return Copy of the comparison object
+ */
+template<class T, class Compare, class Allocator>
+typename BinaryTree<T, Compare, Allocator>::key_compare BinaryTree<T, Compare, Allocator>::key_comp() const {
+	return comp_;
+}
+
+/**
+ * @brief Returns the allocator
+ * 
+ * @ingroup tree_structures
+ * 
+ * @return Copy of the allocator, rebound to the element type
+ */
+template<class T, class Compare, class Allocator>
+typename BinaryTree<T, Compare, Allocator>::allocator_type BinaryTree<T, Compare, Allocator>::get_allocator() const noexcept {
+	return allocator_type(alloc_);
+}
+
+/**
+ * @brief Returns iterator to the smallest element
+ * 
+ * @ingroup tree_structures
+ * 
+ * @return Iterator pointing to the first element in order
+ */
+template<class T, class Compare, class Allocator>
+typename BinaryTree<T, Compare, Allocator>::const_iterator BinaryTree<T, Compare, Allocator>::begin() const noexcept {
+	return const_iterator(leftmost_, this);
+}
+
+/**
+ * @brief Returns iterator past the largest element
+ * 
+ * @ingroup tree_structures
+ * 
+ * @return Iterator pointing past the last element
+ */
+template<class T, class Compare, class Allocator>
+typename BinaryTree<T, Compare, Allocator>::const_iterator BinaryTree<T, Compare, Allocator>::end() const noexcept {
+	return const_iterator(nullptr, this);
+}
+
+/**
+ * @brief Inserts value unless an equivalent element is present
+ * 
+ * @details Descends to the missing child where value belongs, links
+ * a new red node there and restores the red-black rules.
+ * 
+ * @ingroup tree_structures
+ * 
+ * @tparam Arg Type of the value, T or a reference to T
+ * @param[in] value Value to copy or move into the tree
+ * @return Iterator to the element with value's key, and true if it
+ * was inserted
+ */
+template<class T, class Compare, class Allocator>
+template <class Arg>
+std::pair<typename BinaryTree<T, Compare, Allocator>::iterator, bool> BinaryTree<T, Compare, Allocator>::insert_unique(Arg &&value) {
+	pointer parent = nullptr;
+	pointer *link = &root_;
+	while (*link) {
+		parent = *link;
+		if (comp_(value, parent->data))
+			link = &parent->left;
+		else if (comp_(parent->data, value))
+			link = &parent->right;
+		else
+			return std::make_pair(iterator(parent, this), false);
+	}
+	pointer node = create_node(std::forward<Arg>(value));
+	node->parent = parent;
+	*link = node;
+	if (!leftmost_ || link == &leftmost_->left)
+		leftmost_ = node;
+	size_++;
+	fix_insert(node);
+	return std::make_pair(iterator(node, this), true);
+}
+
+/**
+ * @brief Allocates and constructs a node
+ * 
+ * @ingroup tree_structures
+ * 
+ * @tparam Arg Type of the value, T or a reference to T
+ * @param[in] value Value to copy or move into the node
+ * @return Pointer to the new, unlinked node
+ * 
+ * @throws Anything thrown by the allocator or the constructor of T; no
+ * memory is leaked in that case
+ */
+template<class T, class Compare, class Allocator>
+template <class Arg>
+typename BinaryTree<T, Compare, Allocator>::pointer BinaryTree<T, Compare, Allocator>::create_node(Arg &&value) {
+	pointer node = node_traits::allocate(alloc_, 1);
+	try {
+		node_traits::construct(alloc_, node, std::forward<Arg>(value));
+	}
+	catch (...) {
+		node_traits::deallocate(alloc_, node, 1);
+		throw;
+	}
+	return node;
+}
+
+/**
+ * @brief Destroys a node and gives its memory back to the allocator
+ * 
+ * @ingroup tree_structures
+ * 
+ * @param[in] node Unlinked node obtained from create_node()
+ */
+template<class T, class Compare, class Allocator>
+void BinaryTree<T, Compare, Allocator>::destroy_node(pointer node) noexcept {
+	node_traits::destroy(alloc_, node);
+	node_traits::deallocate(alloc_, node, 1);
+}
+
+/**
+ * @brief Destroys every node of a subtree
+ * 
+ * @details Recurses only as deep as the subtree is high.
+ * 
+ * @ingroup tree_structures
+ * 
+ * @param[in] node Root of the subtree, or nullptr
+ */
+template<class T, class Compare, class Allocator>
+void BinaryTree<T, Compare, Allocator>::destroy_subtree(pointer node) noexcept {
+	while (node) {
+		destroy_subtree(node->right);
+		pointer left = node->left;
+		destroy_node(node);
+		node = left;
+	}
+}
+
+/**
+ * @brief Copies a subtree with its shape and colors
+ * 
+ * @ingroup tree_structures
+ * 
+ * @param[in] node Root of the subtree to copy, or nullptr
+ * @param[in] parent Parent for the copied root
+ * @return Root of the copy, or nullptr
+ * 
+ * @throws Anything thrown by create_node(); the nodes copied so far
+ * are destroyed in that case
+ */
+template<class T, class Compare, class Allocator>
+typename BinaryTree<T, Compare, Allocator>::pointer BinaryTree<T, Compare, Allocator>::clone(const_pointer node, pointer parent) {
+	if (!node)
+		return nullptr;
+	pointer copy = create_node(node->data);
+	copy->red = node->red;
+	copy->parent = parent;
+	try {
+		copy->left = clone(node->left, copy);
+		copy->right = clone(node->right, copy);
+	}
+	catch (...) {
+		destroy_subtree(copy);
+		throw;
+	}
+	return copy;
+}
+
+/**
+ * @brief Takes over the nodes of other
+ * 
+ * @details Leaves other empty. This tree must be empty and able to
+ * free other's nodes with its own allocator.
+ * 
+ * @ingroup tree_structures
+ * 
+ * @param[in,out] other Tree to take the nodes from
+ */
+template<class T, class Compare, class Allocator>
+void BinaryTree<T, Compare, Allocator>::take(BinaryTree &other) noexcept {
+	root_ = other.root_;
+	leftmost_ = other.leftmost_;
+	size_ = other.size_;
+	other.root_ = nullptr;
+	other.leftmost_ = nullptr;
+	other.size_ = 0;
+}
+
+/**
+ * @brief Finds the first node not ordered before key
+ * 
+ * @ingroup tree_structures
+ * 
+ * @tparam K Type of the key, T unless Compare is transparent
+ * @param[in] key Key to compare against
+ * @return First node >= key, or nullptr
+ */
+template<class T, class Compare, class Allocator>
+template<class K>
+typename BinaryTree<T, Compare, Allocator>::const_pointer BinaryTree<T, Compare, Allocator>::lower_node(const K &key) const {
+	const_pointer node = root_;
+	const_pointer result = nullptr;
+	while (node) {
+		if (!comp_(node->data, key)) {
+			result = node;
+			node = node->left;
+		}
+		else
+			node = node->right;
+	}
+	return result;
+}
+
+/**
+ * @brief Finds the first node ordered after key
+ * 
+ * @ingroup tree_structures
+ * 
+ * @tparam K Type of the key, T unless Compare is transparent
+ * @param[in] key Key to compare against
+ * @return First node > key, or nullptr
+ */
+template<class T, class Compare, class Allocator>
+template<class K>
+typename BinaryTree<T, Compare, Allocator>::const_pointer BinaryTree<T, Compare, Allocator>::upper_node(const K &key) const {
+	const_pointer node = root_;
+	const_pointer result = nullptr;
+	while (node) {
+		if (comp_(key, node->data)) {
+			result = node;
+			node = node->left;
+		}
+		else
+			node = node->right;
+	}
+	return result;
+}
+
+/**
+ * @brief Rotates a node down to the left
+ * 
+ * @details The right child of node takes its place, and node becomes
+ * that child's left child. In-order sequence is unchanged.
+ * 
+ * @ingroup tree_structures
+ * 
+ * @param[in] node Node with a right child
+ */
+template<class T, class Compare, class Allocator>
+void BinaryTree<T, Compare, Allocator>::rotate_left(pointer node) noexcept {
+	pointer child = node->right;
+	node->right = child->left;
+	if (child->left)
+		child->left->parent = node;
+	child->parent = node->parent;
+	replace_child(node->parent, node, child);
+	child->left = node;
+	node->parent = child;
+}
+
+/**
+ * @brief Rotates a node down to the right
+ * 
+ * @details The left child of node takes its place, and node becomes
+ * that child's right child. In-order sequence is unchanged.
+ * 
+ * @ingroup tree_structures
+ * 
+ * @param[in] node Node with a left child
+ */
+template<class T, class Compare, class Allocator>
+void BinaryTree<T, Compare, Allocator>::rotate_right(pointer node) noexcept {
+	pointer child = node->left;
+	node->left = child->right;
+	if (child->right)
+		child->right->parent = node;
+	child->parent = node->parent;
+	replace_child(node->parent, node, child);
+	child->right = node;
+	node->parent = child;
+}
+
+/**
+ * @brief Points the link to old_child at new_child
+ * 
+ * @details Does not update new_child's parent.
+ * 
+ * @ingroup tree_structures
+ * 
+ * @param[in] parent Parent of old_child, nullptr if it is the root
+ * @param[in] old_child Child being replaced
+ * @param[in] new_child Replacement, or nullptr
+ */
+template<class T, class Compare, class Allocator>
+void BinaryTree<T, Compare, Allocator>::replace_child(pointer parent, pointer old_child, pointer new_child) noexcept {
+	if (!parent)
+		root_ = new_child;
+	else if (parent->left == old_child)
+		parent->left = new_child;
+	else
+		parent->right = new_child;
+}
+
+/**
+ * @brief Restores the red-black rules after linking a red node
+ * 
+ * @details While node and its parent are both red, a red uncle is
+ * fixed by recoloring and moving the problem two levels up; a black
+ * uncle by one or two rotations, which ends the repair.
+ * 
+ * @ingroup tree_structures
+ * 
+ * @param[in] node Newly linked red node
+ */
+template<class T, class Compare, class Allocator>
+void BinaryTree<T, Compare, Allocator>::fix_insert(pointer node) noexcept {
+	while (is_red(node->parent)) {
+		pointer parent = node->parent;
+		pointer grandparent = parent->parent;
+		if (parent == grandparent->left) {
+			pointer uncle = grandparent->right;
+			if (is_red(uncle)) {
+				parent->red = false;
+				uncle->red = false;
+				grandparent->red = true;
+				node = grandparent;
+				continue;
+			}
+			if (node == parent->right) {
+				rotate_left(parent);
+				node = parent;
+				parent = node->parent;
+			}
+			parent->red = false;
+			grandparent->red = true;
+			rotate_right(grandparent);
+		}
+		else {
+			pointer uncle = grandparent->left;
+			if (is_red(uncle)) {
+				parent->red = false;
+				uncle->red = false;
+				grandparent->red = true;
+				node = grandparent;
+				continue;
+			}
+			if (node == parent->left) {
+				rotate_right(parent);
+				node = parent;
+				parent = node->parent;
+			}
+			parent->red = false;
+			grandparent->red = true;
+			rotate_left(grandparent);
+		}
+	}
+	root_->red = false;
+}
+
+/**
+ * @brief Unlinks a node and restores the red-black rules
+ * 
+ * @details A node with two children is replaced by its in-order
+ * successor, which takes over its color. If a black node left its
+ * position, the child that moved up carries an extra black that
+ * fix_erase() pushes up or away.
+ * 
+ * @ingroup tree_structures
+ * 
+ * @param[in] node Linked node to remove
+ */
+template<class T, class Compare, class Allocator>
+void BinaryTree<T, Compare, Allocator>::unlink(pointer node) noexcept {
+	if (node == leftmost_)
+		leftmost_ = node->right ? const_cast<pointer>(minimum(node->right)) : node->parent;
+	bool removed_red = node->red;
+	pointer child;
+	pointer parent;
+	if (!node->left || !node->right) {
+		child = node->left ? node->left : node->right;
+		parent = node->parent;
+		replace_child(parent, node, child);
+		if (child)
+			child->parent = parent;
+	}
+	else {
+		pointer successor = const_cast<pointer>(minimum(node->right));
+		removed_red = successor->red;
+		child = successor->right;
+		if (successor->parent == node)
+			parent = successor;
+		else {
+			parent = successor->parent;
+			parent->left = child;
+			if (child)
+				child->parent = parent;
+			successor->right = node->right;
+			successor->right->parent = successor;
+		}
+		replace_child(node->parent, node, successor);
+		successor->parent = node->parent;
+		successor->left = node->left;
+		successor->left->parent = successor;
+		successor->red = node->red;
+	}
+	if (!removed_red)
+		fix_erase(child, parent);
+}
+
+/**
+ * @brief Restores the red-black rules after removing a black node
+ * 
+ * @details node carries an extra black. A red sibling is first rotated
+ * up so the sibling is black; then a sibling with two black children
+ * is recolored red and the extra black moves to the parent, while a
+ * sibling with a red child absorbs it with one or two rotations.
+ * 
+ * @ingroup tree_structures
+ * 
+ * @param[in] node Node that took the removed node's place, or nullptr
+ * @param[in] parent Parent of that position, or nullptr at the root
+ */
+template<class T, class Compare, class Allocator>
+void BinaryTree<T, Compare, Allocator>::fix_erase(pointer node, pointer parent) noexcept {
+	while (node != root_ && !is_red(node)) {
+		if (node == parent->left) {
+			pointer sibling = parent->right;
+			if (sibling->red) {
+				sibling->red = false;
+				parent->red = true;
+				rotate_left(parent);
+				sibling = parent->right;
+			}
+			if (!is_red(sibling->left) && !is_red(sibling->right)) {
+				sibling->red = true;
+				node = parent;
+				parent = node->parent;
+				continue;
+			}
+			if (!is_red(sibling->right)) {
+				sibling->left->red = false;
+				sibling->red = true;
+				rotate_right(sibling);
+				sibling = parent->right;
+			}
+			sibling->red = parent->red;
+			parent->red = false;
+			sibling->right->red = false;
+			rotate_left(parent);
+		}
+		else {
+			pointer sibling = parent->left;
+			if (sibling->red) {
+				sibling->red = false;
+				parent->red = true;
+				rotate_right(parent);
+				sibling = parent->left;
+			}
+			if (!is_red(sibling->left) && !is_red(sibling->right)) {
+				sibling->red = true;
+				node = parent;
+				parent = node->parent;
+				continue;
+			}
+			if (!is_red(sibling->left)) {
+				sibling->right->red = false;
+				sibling->red = true;
+				rotate_left(sibling);
+				sibling = parent->left;
+			}
+			sibling->red = parent->red;
+			parent->red = false;
+			sibling->left->red = false;
+			rotate_right(parent);
+		}
+		node = root_;
+	}
+	if (node)
+		node->red = false;
+}
+
+/**
+ * @brief Returns the height of a subtree
+ * 
+ * @ingroup tree_structures
+ * 
+ * @param[in] node Root of the subtree, or nullptr
+ * @return Number of nodes on the longest downward path
+ */
+template<class T, class Compare, class Allocator>
+typename BinaryTree<T, Compare, Allocator>::size_type BinaryTree<T, Compare, Allocator>::subtree_height(const_pointer node) noexcept {
+	if (!node)
+		return 0;
+	size_type left = subtree_height(node->left);
+	size_type right = subtree_height(node->right);
+	return 1 + (left > right ? left : right);
+}
+
+/**
+ * @brief Returns the smallest node of a subtree
+ * 
+ * @ingroup tree_structures
+ * 
+ * @param[in] node Root of the subtree, or nullptr
+ * @return Leftmost node, or nullptr
+ */
+template<class T, class Compare, class Allocator>
+typename BinaryTree<T, Compare, Allocator>::const_pointer BinaryTree<T, Compare, Allocator>::minimum(const_pointer node) noexcept {
+	if (node)
+		while (node->left)
+			node = node->left;
+	return node;
+}
+
+/**
+ * @brief Returns the largest node of a subtree
+ * 
+ * @ingroup tree_structures
+ * 
+ * @param[in] node Root of the subtree, or nullptr
+ * @return Rightmost node, or nullptr
+ */
+template<class T, class Compare, class Allocator>
+typename BinaryTree<T, Compare, Allocator>::const_pointer BinaryTree<T, Compare, Allocator>::maximum(const_pointer node) noexcept {
+	if (node)
+		while (node->right)
+			node = node->right;
+	return node;
+}
+
+/**
+ * @brief Checks the color of a possibly missing node
+ * 
+ * @ingroup tree_structures
+ * 
+ * @param[in] node Node to check, or nullptr
+ * @return true if node exists and is red; missing nodes count as black
+ */
+template<class T, class Compare, class Allocator>
+bool BinaryTree<T, Compare, Allocator>::is_red(const_pointer node) noexcept {
+	return node && node->red;
+}
+
+#endif
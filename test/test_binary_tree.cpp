@@ -0,0 +1,378 @@
+/**
+ * @file test_binary_tree.cpp
+ * @brief Unit tests for BinaryTree container
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ * 
+ * @details This file contains unit tests for the BinaryTree class,
+ * covering insertion, lookup, erasure, bounds and ordered iteration,
+ * lookups by key through a transparent comparator,
+ * copy and move semantics, and a randomized comparison against
+ * std::set that checks the red-black rules after every change.
+ */
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <cassert>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "test_colors.hpp"
+#include "super_lib.hpp"
+
+/**
+ * @brief Collects the elements of a tree into a std::vector
+ * 
+ * @ingroup testing
+ * 
+ * @tparam Tree Type of tree
+ * @param[in] tree Tree to read
+ * @return Elements in iteration order
+ */
+template<class Tree>
+std::vector<typename Tree::value_type> elements(const Tree &tree) {
+	return std::vector<typename Tree::value_type>(tree.begin(), tree.end());
+}
+
+/**
+ * @brief Checks the links and red-black rules of a subtree
+ * 
+ * @details Verifies parent links, ordering against the bounds, that no
+ * red node has a red child, and that all paths down have the same
+ * number of black nodes.
+ * 
+ * @ingroup testing
+ * 
+ * @tparam Node Type of tree node
+ * @param[in] node Root of the subtree, or nullptr
+ * @param[in] lower Element every node must exceed, or nullptr
+ * @param[in] upper Element every node must precede, or nullptr
+ * @param[out] count Incremented once per node
+ * @return Number of black nodes on every path down, -1 if the rules
+ * are broken
+ */
+template<class Node>
+int black_height(const Node *node, const int *lower, const int *upper, unsigned long &count) {
+	if (!node)
+		return 0;
+	++count;
+	if ((lower && !(*lower < node->data)) || (upper && !(node->data < *upper)))
+		return -1;
+	if ((node->left && node->left->parent != node) || (node->right && node->right->parent != node))
+		return -1;
+	if (node->red && ((node->left && node->left->red) || (node->right && node->right->red)))
+		return -1;
+	int left = black_height(node->left, lower, &node->data, count);
+	int right = black_height(node->right, &node->data, upper, count);
+	if (left < 0 || left != right)
+		return -1;
+	return left + (node->red ? 0 : 1);
+}
+
+/**
+ * @brief Checks that a tree is a valid red-black tree of its size
+ * 
+ * @ingroup testing
+ * 
+ * @param[in] tree Tree to check
+ * @return true if all rules hold
+ */
+bool valid(const BinaryTree<int> &tree) {
+	unsigned long count = 0;
+	if (tree.root() && (tree.root()->red || tree.root()->parent))
+		return false;
+	return black_height(tree.root(), nullptr, nullptr, count) >= 0 && count == tree.size();
+}
+
+/**
+ * @brief Tests BinaryTree insertion and lookup
+ * 
+ * @details Verifies that insert keeps elements unique and sorted, that
+ * find and contains reach the right elements, that front and back
+ * throw on an empty tree, and that a custom ordering is honored.
+ * 
+ * @ingroup testing
+ */
+void test_binary_tree_insert_find() {
+	TEST_GROUP("BinaryTree insert and find");
+	
+	BinaryTree<int> tree;
+	assert(tree.empty() && tree.begin() == tree.end() && tree.height() == 0 && !tree.root());
+	bool threw = false;
+	try {
+		tree.front();
+	}
+	catch (const std::out_of_range &) {
+		threw = true;
+	}
+	assert(threw);
+	assert(tree.insert(5).second && tree.insert(1).second && tree.insert(3).second);
+	std::pair<BinaryTree<int>::iterator, bool> again = tree.insert(3);
+	assert(!again.second && *again.first == 3 && tree.size() == 3);
+	assert((elements(tree) == std::vector<int>{1, 3, 5}) && valid(tree));
+	assert(*tree.find(5) == 5 && tree.find(4) == tree.end());
+	assert(tree.contains(1) && !tree.contains(0));
+	assert(tree.front() == 1 && tree.back() == 5);
+	
+	for (int i = 0; i < 1000; ++i)
+		tree.insert(i);
+	assert(tree.size() == 1000 && valid(tree) && tree.height() <= 20);
+	
+	BinaryTree<std::string, std::greater<std::string>> words;
+	std::string movable = "pear";
+	words.insert(std::move(movable));
+	words.insert("apple");
+	words.insert(std::string("zucchini"));
+	assert((elements(words) == std::vector<std::string>{"zucchini", "pear", "apple"}));
+	assert(words.front() == "zucchini" && words.back() == "apple");
+	
+	TEST_PASS("BinaryTree insert and find");
+}
+
+/**
+ * @brief Tests BinaryTree erasure
+ * 
+ * @details Verifies erase by value and by iterator, including the
+ * smallest element, the root and missing values, that erasing end()
+ * throws, and that the tree stays balanced while it is emptied.
+ * 
+ * @ingroup testing
+ */
+void test_binary_tree_erase() {
+	TEST_GROUP("BinaryTree erase");
+	
+	BinaryTree<int> tree;
+	for (int i = 0; i < 10; ++i)
+		tree.insert(i);
+	assert(tree.erase(0) == 1 && tree.erase(0) == 0 && tree.front() == 1);
+	int root = tree.root()->data;
+	assert(tree.erase(root) == 1 && !tree.contains(root) && valid(tree) && tree.size() == 8);
+	BinaryTree<int>::iterator next = tree.erase(tree.begin());
+	assert(*next == 2 && tree.front() == 2);
+	assert(tree.erase(std::prev(tree.end())) == tree.end() && tree.back() == 8);
+	std::vector<int> expected;
+	for (int i = 2; i <= 8; ++i)
+		if (i != root)
+			expected.push_back(i);
+	assert(elements(tree) == expected && valid(tree));
+	bool thrown = false;
+	try {
+		tree.erase(tree.end());
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown && elements(tree) == expected);
+	
+	for (int i = 0; i < 2000; ++i)
+		tree.insert(i);
+	for (int i = 0; i < 2000; i += 2)
+		assert(tree.erase(i) == 1);
+	assert(tree.size() == 1000 && valid(tree) && tree.height() <= 20);
+	for (BinaryTree<int>::iterator it = tree.begin(); it != tree.end();)
+		it = tree.erase(it);
+	assert(tree.empty() && !tree.root() && tree.begin() == tree.end());
+	tree.insert(7);
+	assert(tree.front() == 7 && tree.back() == 7 && valid(tree));
+	
+	TEST_PASS("BinaryTree erase");
+}
+
+/**
+ * @brief Tests BinaryTree bounds and iteration
+ * 
+ * @details Verifies lower_bound and upper_bound inside, between and
+ * beyond the stored elements, and forward and backward traversal.
+ * 
+ * @ingroup testing
+ */
+void test_binary_tree_bounds() {
+	TEST_GROUP("BinaryTree bounds and iteration");
+	
+	BinaryTree<int> tree;
+	for (int i = 0; i < 100; ++i)
+		tree.insert(i * 10);
+	assert(*tree.lower_bound(250) == 250 && *tree.upper_bound(250) == 260);
+	assert(*tree.lower_bound(251) == 260 && *tree.upper_bound(251) == 260);
+	assert(*tree.lower_bound(-5) == 0 && tree.lower_bound(991) == tree.end());
+	assert(tree.upper_bound(990) == tree.end());
+	std::vector<int> range(tree.lower_bound(100), tree.lower_bound(150));
+	assert((range == std::vector<int>{100, 110, 120, 130, 140}));
+	
+	std::vector<int> backwards;
+	for (BinaryTree<int>::const_iterator it = tree.end(); it != tree.begin();)
+		backwards.push_back(*--it);
+	assert(backwards.size() == 100 && backwards.front() == 990 && backwards.back() == 0);
+	BinaryTree<int>::const_iterator it = tree.find(500);
+	assert(*it++ == 500 && *it == 510 && *it-- == 510 && *it == 500);
+	assert(std::distance(tree.begin(), tree.end()) == 100);
+	
+	TEST_PASS("BinaryTree bounds and iteration");
+}
+
+/**
+ * @struct KeyLess
+ * @brief Transparent ordering of key-value pairs by their key
+ * 
+ * @ingroup testing
+ */
+struct KeyLess {
+	using is_transparent = void;  ///< Enables lookups by key alone
+
+	using Entry = std::pair<std::string, int>;  ///< Element of the map
+
+	bool operator()(const Entry &lhs, const Entry &rhs) const { return lhs.first < rhs.first; }
+	bool operator()(const Entry &lhs, const std::string &rhs) const { return lhs.first < rhs; }
+	bool operator()(const std::string &lhs, const Entry &rhs) const { return lhs < rhs.first; }
+};
+
+/**
+ * @brief Tests BinaryTree lookups through a transparent comparator
+ * 
+ * @details Uses a tree of key-value pairs ordered by key as a map and
+ * verifies find, contains, lower_bound, upper_bound and erase by key
+ * alone, and that erase with an iterator still removes that element.
+ * 
+ * @ingroup testing
+ */
+void test_binary_tree_transparent() {
+	TEST_GROUP("BinaryTree transparent lookup");
+	
+	BinaryTree<KeyLess::Entry, KeyLess> map;
+	const char *names[] = {"delta", "alpha", "echo", "charlie", "bravo"};
+	for (int i = 0; i < 5; ++i)
+		assert(map.insert({names[i], i}).second);
+	assert(!map.insert({"alpha", 9}).second && map.size() == 5);
+	
+	assert(map.find(std::string("charlie"))->second == 3 && map.find(std::string("foxtrot")) == map.end());
+	assert(map.contains(std::string("echo")) && !map.contains(std::string("beta")));
+	assert(map.lower_bound(std::string("c"))->first == "charlie");
+	assert(map.upper_bound(std::string("charlie"))->first == "delta");
+	assert(map.upper_bound(std::string("echo")) == map.end());
+	assert(map.find(KeyLess::Entry("bravo", -1))->second == 4);
+	
+	assert(map.erase(std::string("alpha")) == 1 && map.erase(std::string("alpha")) == 0);
+	assert(map.erase(map.find(std::string("delta")))->first == "echo");
+	std::vector<KeyLess::Entry> expected{{"bravo", 4}, {"charlie", 3}, {"echo", 2}};
+	assert(elements(map) == expected);
+	
+	TEST_PASS("BinaryTree transparent lookup");
+}
+
+/**
+ * @brief Tests BinaryTree copy and move semantics
+ * 
+ * @details Verifies that copies are independent and keep the shape of
+ * the source, that moves leave the source empty and usable, and that
+ * a tree can be built from another container.
+ * 
+ * @ingroup testing
+ */
+void test_binary_tree_copy_move() {
+	TEST_GROUP("BinaryTree copy and move");
+	
+	static_assert(std::is_nothrow_move_assignable<BinaryTree<int>>::value, "PoolAllocator propagates on move");
+	static_assert(std::is_nothrow_move_assignable<BinaryTree<int, std::less<int>, std::allocator<int>>>::value,
+		"std::allocator is always equal");
+	BinaryTree<int> tree;
+	for (int i = 0; i < 50; ++i)
+		tree.insert(i * 3 % 50);
+	BinaryTree<int> copy(tree);
+	assert(elements(copy) == elements(tree) && valid(copy) && copy.height() == tree.height());
+	copy.erase(10);
+	assert(tree.contains(10) && !copy.contains(10));
+	
+	BinaryTree<int> assigned;
+	assigned.insert(-1);
+	assigned = tree;
+	assert(elements(assigned) == elements(tree) && assigned.front() == 0);
+	BinaryTree<int> &self = assigned;
+	assigned = self;
+	assert(assigned.size() == 50);
+	
+	BinaryTree<int> moved(std::move(copy));
+	assert(moved.size() == 49 && copy.empty() && valid(moved));
+	copy.insert(1);
+	assert(copy.size() == 1 && copy.front() == 1);
+	assigned = std::move(moved);
+	assert(assigned.size() == 49 && moved.empty() && !assigned.contains(10));
+	
+	std::vector<int> source = {4, 2, 4, 8, 6, 2};
+	BinaryTree<int> from_vector(source);
+	assert((elements(from_vector) == std::vector<int>{2, 4, 6, 8}) && valid(from_vector));
+	
+	TEST_PASS("BinaryTree copy and move");
+}
+
+/**
+ * @brief Compares BinaryTree with std::set under random operations
+ * 
+ * @details Runs random inserts, erases and lookups on both containers
+ * and checks that results and contents match, and that the red-black
+ * rules hold after every change.
+ * 
+ * @ingroup testing
+ */
+void test_binary_tree_randomized() {
+	TEST_GROUP("BinaryTree randomized against std::set");
+	
+	std::mt19937 rng(7);
+	std::uniform_int_distribution<int> value(0, 499);
+	std::uniform_int_distribution<int> operation(0, 2);
+	BinaryTree<int> tree;
+	std::set<int> reference;
+	for (int i = 0; i < 20000; ++i) {
+		int v = value(rng);
+		switch (operation(rng)) {
+		case 0: {
+			bool inserted = tree.insert(v).second;
+			bool expected = reference.insert(v).second;
+			assert(inserted == expected);
+			break;
+		}
+		case 1: {
+			BinaryTree<int>::size_type erased = tree.erase(v);
+			std::set<int>::size_type expected = reference.erase(v);
+			assert(erased == expected);
+			break;
+		}
+		default: {
+			BinaryTree<int>::const_iterator found = tree.lower_bound(v);
+			std::set<int>::const_iterator expected = reference.lower_bound(v);
+			assert((found == tree.end()) == (expected == reference.end()));
+			assert(found == tree.end() || *found == *expected);
+			break;
+		}
+		}
+		assert(valid(tree));
+	}
+	assert(tree.size() == reference.size() && valid(tree));
+	assert(std::equal(tree.begin(), tree.end(), reference.begin()));
+	
+	TEST_PASS("BinaryTree randomized against std::set");
+}
+
+int main() {
+	TEST_HEADER("BinaryTree");
+	
+	try {
+		test_binary_tree_insert_find();
+		test_binary_tree_erase();
+		test_binary_tree_bounds();
+		test_binary_tree_transparent();
+		test_binary_tree_copy_move();
+		test_binary_tree_randomized();
+	
+		TEST_SUCCESS("BinaryTree");
+		return 0;
+	} catch (const std::exception& e) {
+		TEST_FAIL(e.what());
+		return 1;
+	}
+}
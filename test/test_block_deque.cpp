@@ -0,0 +1,364 @@
+/**
+ * @file test_block_deque.cpp
+ * @brief Unit tests for BlockDeque container class
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2025-01-28
+ * 
+ * @details This file contains unit tests for the BlockDeque class,
+ * covering construction, operations at both ends, reference stability,
+ * block reuse, copy and move semantics, random access iteration and
+ * element lifetime.
+ */
+
+#include <iostream>
+#include <cassert>
+#include <stdexcept>
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include "test_colors.hpp"
+#include "test_fixtures.hpp"
+#include "super_lib.hpp"
+
+/**
+ * @brief Helper type too large for the 4 KiB block target
+ * 
+ * @ingroup testing
+ */
+struct Large {
+	char bytes[3000];  ///< Payload
+};
+
+/**
+ * @brief Tests BlockDeque constructors
+ * 
+ * @details Verifies default, fill and container constructors, and the
+ * default block size.
+ * 
+ * @ingroup testing
+ */
+void test_block_deque_constructor() {
+	TEST_GROUP("BlockDeque constructors");
+	
+	BlockDeque<int> d1;
+	assert(d1.size() == 0 && d1.empty());
+	assert(d1.block_count() == 0);
+	assert(BlockDeque<int>::block_size == 1024);
+	assert(BlockDeque<Large>::block_size == 16);
+	
+	BlockDeque<int, 4> d2(10, 7);
+	assert(d2.size() == 10 && d2.block_count() == 3);
+	for (size_t i = 0; i < d2.size(); ++i)
+		assert(d2[i] == 7);
+	
+	Vector<int> source;
+	for (int i = 0; i < 5; ++i)
+		source.add(i);
+	BlockDeque<int, 4> d3(source);
+	assert(d3.size() == 5 && d3[0] == 0 && d3[4] == 4);
+	
+	TEST_PASS("BlockDeque constructors");
+}
+
+/**
+ * @brief Tests BlockDeque operations at both ends
+ * 
+ * @details Mixes pushes and pops at the front and back across many
+ * block boundaries and checks the order, bounds checking and errors on
+ * an empty deque.
+ * 
+ * @ingroup testing
+ */
+void test_block_deque_operations() {
+	TEST_GROUP("BlockDeque operations");
+	
+	BlockDeque<int, 4> d;
+	for (int i = 0; i < 50; ++i) {
+		d.push_back(i);
+		d.push_front(-i - 1);
+	}
+	assert(d.size() == 100);
+	for (int i = 0; i < 100; ++i)
+		assert(d[i] == i - 50);
+	assert(d.emplace_front(-51) == -51);
+	assert(d.emplace_back(50) == 50);
+	
+	assert(d.pop_front() == -51);
+	assert(d.pop_back() == 50);
+	for (int i = 0; i < 30; ++i)
+		assert(d.pop_front() == i - 50);
+	for (int i = 0; i < 30; ++i)
+		assert(d.pop_back() == 49 - i);
+	assert(d.size() == 40 && d.at(0) == -20 && d.at(39) == 19);
+	
+	d.at(0) = 100;
+	const BlockDeque<int, 4> &cd = d;
+	assert(cd[0] == 100 && cd.at(39) == 19);
+	
+	bool thrown = false;
+	try {
+		d.at(40);
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+	
+	d.clear();
+	assert(d.empty() && d.block_count() == 0);
+	thrown = false;
+	try {
+		d.pop_front();
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+	thrown = false;
+	try {
+		d.pop_back();
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+	
+	d.push_front(1);
+	assert(d.size() == 1 && d[0] == 1);
+	
+	TEST_PASS("BlockDeque operations");
+}
+
+/**
+ * @brief Tests that elements never move
+ * 
+ * @details Takes the address of elements pushed early and checks they
+ * remain valid while thousands of elements are added at both ends and
+ * others are removed.
+ * 
+ * @ingroup testing
+ */
+void test_block_deque_reference_stability() {
+	TEST_GROUP("BlockDeque reference stability");
+	
+	BlockDeque<int, 8> d;
+	int &first = d.emplace_back(1);
+	int &second = d.emplace_front(2);
+	int *middle = &d.emplace_back(3);
+	for (int i = 0; i < 5000; ++i) {
+		d.push_back(i);
+		d.push_front(i);
+	}
+	assert(first == 1 && second == 2 && *middle == 3);
+	assert(&d[5000] == &second && &d[5001] == &first && &d[5002] == middle);
+	
+	for (int i = 0; i < 4000; ++i) {
+		d.pop_front();
+		d.pop_back();
+	}
+	assert(first == 1 && second == 2 && *middle == 3);
+	assert(&d[1000] == &second);
+	
+	TEST_PASS("BlockDeque reference stability");
+}
+
+/**
+ * @brief Tests block accounting and reuse
+ * 
+ * @details Checks that emptied blocks are given back, and that pushes
+ * and pops alternating at a block boundary reuse the spare block
+ * instead of allocating.
+ * 
+ * @ingroup testing
+ */
+void test_block_deque_blocks() {
+	TEST_GROUP("BlockDeque block reuse");
+	
+	BlockDeque<int, 4> d;
+	for (int i = 0; i < 8; ++i)
+		d.push_back(i);
+	assert(d.block_count() == 2);
+	d.push_back(8);
+	assert(d.block_count() == 3);
+	int *block_start = &d[8];
+	d.pop_back();
+	assert(d.block_count() == 2);
+	d.push_back(8);
+	assert(&d[8] == block_start);
+	
+	for (int i = 0; i < 4; ++i)
+		d.pop_front();
+	assert(d.block_count() == 2 && d[0] == 4);
+	d.push_front(3);
+	assert(d.block_count() == 3 && d[0] == 3);
+	
+	d.shrink_to_fit();
+	assert(d.size() == 6 && d[5] == 8);
+	
+	TEST_PASS("BlockDeque block reuse");
+}
+
+/**
+ * @brief Tests BlockDeque copy and move semantics
+ * 
+ * @details Verifies deep copies, and that moves take over the blocks so
+ * element addresses survive.
+ * 
+ * @ingroup testing
+ */
+void test_block_deque_copy_move() {
+	TEST_GROUP("BlockDeque copy and move");
+	
+	BlockDeque<int, 4> original;
+	for (int i = 0; i < 10; ++i)
+		original.push_front(i);
+	
+	BlockDeque<int, 4> copy(original);
+	assert(copy.size() == 10 && copy[0] == 9 && copy[9] == 0);
+	copy[0] = 99;
+	assert(original[0] == 9);
+	
+	int *address = &original[3];
+	BlockDeque<int, 4> moved(std::move(original));
+	assert(moved.size() == 10 && &moved[3] == address);
+	assert(original.empty() && original.block_count() == 0);
+	original.push_back(1);
+	assert(original.size() == 1);
+	
+	original = copy;
+	assert(original.size() == 10 && original[0] == 99);
+	copy = std::move(moved);
+	assert(copy.size() == 10 && &copy[3] == address);
+	assert(moved.empty());
+	
+	TEST_PASS("BlockDeque copy and move");
+}
+
+/**
+ * @brief Tests BlockDeque random access iterators
+ * 
+ * @details Checks the iterator category and const conversion, and runs
+ * standard algorithms that need random access over several blocks.
+ * 
+ * @ingroup testing
+ */
+void test_block_deque_iterators() {
+	TEST_GROUP("BlockDeque iterators");
+	
+	using Deq = BlockDeque<int, 4>;
+	static_assert(std::is_same_v<std::iterator_traits<Deq::iterator>::iterator_category,
+		std::random_access_iterator_tag>);
+	static_assert(std::is_same_v<decltype(*std::declval<Deq::const_iterator>()), const int&>);
+	
+	Deq d;
+	for (int i = 0; i < 10; ++i)
+		d.push_back(10 - i);
+	for (int i = 0; i < 7; ++i)
+		d.push_front(20 + i);
+	std::sort(d.begin(), d.end());
+	for (size_t i = 1; i < d.size(); ++i)
+		assert(d[i - 1] <= d[i]);
+	
+	const Deq &cd = d;
+	Deq::const_iterator it = d.begin();
+	assert(it == cd.begin() && cd.end() - it == 17);
+	assert(*std::lower_bound(cd.begin(), cd.end(), 20) == 20);
+	assert(it[16] == 26 && *(2 + it) == 3);
+	
+	int sum = 0;
+	for (int x : d)
+		sum += x;
+	assert(sum == 55 + 20 * 7 + 21);
+	
+	TEST_PASS("BlockDeque iterators");
+}
+
+/**
+ * @brief Tests BlockDeque element lifetime management
+ * 
+ * @details Verifies that emptying blocks from either end destroys
+ * exactly their elements while the elements of other blocks stay put,
+ * and that copies, moves and destruction construct and destroy exactly
+ * the live elements.
+ * 
+ * @ingroup testing
+ */
+void test_block_deque_element_lifetime() {
+	TEST_GROUP("BlockDeque element lifetime");
+	
+	{
+		BlockDeque<Tracked, 4> d;
+		for (int i = 0; i < 9; ++i)
+			d.emplace_back(i);
+		for (int i = 0; i < 9; ++i)
+			d.emplace_front(i);
+		assert(Tracked::live == 18);
+		const Tracked *middle = &d[9];
+		for (int i = 0; i < 6; ++i) {
+			d.pop_back();
+			d.pop_front();
+		}
+		assert(Tracked::live == 6 && &d[3] == middle && middle->value == 0);
+		for (int i = 0; i < 5; ++i) {
+			d.emplace_back(i);
+			d.emplace_front(i);
+		}
+		assert(Tracked::live == 16 && &d[8] == middle);
+		
+		BlockDeque<Tracked, 4> copy(d);
+		assert(Tracked::live == 32);
+		copy.clear();
+		assert(Tracked::live == 16);
+		BlockDeque<Tracked, 4> moved(std::move(d));
+		assert(Tracked::live == 16);
+		copy = moved;
+		assert(Tracked::live == 32);
+	}
+	assert(Tracked::live == 0);
+	
+	TEST_PASS("BlockDeque element lifetime");
+}
+
+/**
+ * @brief Tests BlockDeque move assignment between allocators
+ * 
+ * @details Verifies that the blocks are taken over from an equal
+ * allocator, keeping element addresses, and that the elements are
+ * moved for a different one.
+ * 
+ * @ingroup testing
+ */
+void test_block_deque_move_allocator() {
+	TEST_GROUP("BlockDeque move assignment between allocators");
+	
+	static_assert(std::is_nothrow_move_assignable<BlockDeque<int>>::value, "std::allocator never needs a fallback");
+	check_move_allocator<BlockDeque<Tracked, 4, TaggedAllocator<Tracked>>>(
+		[](auto &d) {
+			for (int i = 0; i < 10; ++i)
+				d.push_back(Tracked(i));
+			d.push_front(Tracked(0));
+		},
+		[](const auto &d) { return &d[5]; });
+	
+	TEST_PASS("BlockDeque move assignment between allocators");
+}
+
+int main() {
+	TEST_HEADER("BlockDeque");
+	
+	try {
+		test_block_deque_constructor();
+		test_block_deque_operations();
+		test_block_deque_reference_stability();
+		test_block_deque_blocks();
+		test_block_deque_copy_move();
+		test_block_deque_iterators();
+		test_block_deque_element_lifetime();
+		test_block_deque_move_allocator();
+		
+		TEST_SUCCESS("BlockDeque");
+		return 0;
+	} catch (const std::exception& e) {
+		TEST_FAIL(e.what());
+		return 1;
+	}
+}
@@ -0,0 +1,258 @@
+/**
+ * @file test_concurrent_skip_list.cpp
+ * @brief Unit tests for ConcurrentSkipList concurrent container class
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ * 
+ * @details This file contains unit tests for the ConcurrentSkipList
+ * class, covering single-threaded map semantics, range scans, element
+ * lifetime under epoch-based reclamation, and many threads inserting,
+ * erasing, looking up and scanning the same keys at once.
+ */
+
+#include <iostream>
+#include <atomic>
+#include <cassert>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "test_colors.hpp"
+#include "test_fixtures.hpp"
+#include "super_lib.hpp"
+
+/**
+ * @brief Tests ConcurrentSkipList on a single thread
+ * 
+ * @details Verifies insertion of unique keys, lookups, erasure,
+ * size tracking and a custom ordering.
+ * 
+ * @ingroup testing
+ */
+void test_concurrent_skip_list_basic() {
+	TEST_GROUP("ConcurrentSkipList basic operations");
+	
+	ConcurrentSkipList<int, std::string> map;
+	std::string out = "none";
+	assert(map.empty() && map.size() == 0 && !map.find(1, out) && out == "none");
+	assert(map.insert(5, "five") && map.insert(1, "one") && map.insert(3, "three"));
+	assert(!map.insert(3, "other") && map.size() == 3 && !map.empty());
+	assert(map.find(3, out) && out == "three");
+	assert(map.contains(1) && !map.contains(2));
+	assert(map.erase(3) && !map.erase(3) && !map.contains(3) && map.size() == 2);
+	assert(map.insert(3, "again") && map.find(3, out) && out == "again");
+	assert(map.erase(1) && map.erase(3) && map.erase(5) && map.empty());
+	
+	ConcurrentSkipList<int, int, std::greater<int>> descending;
+	for (int i = 0; i < 1000; ++i)
+		assert(descending.insert(i, i * 2));
+	int value = 0;
+	assert(descending.find(500, value) && value == 1000);
+	for (int i = 0; i < 1000; i += 2)
+		assert(descending.erase(i));
+	assert(descending.size() == 500 && !descending.contains(0) && descending.contains(999));
+	
+	TEST_PASS("ConcurrentSkipList basic operations");
+}
+
+/**
+ * @brief Tests ConcurrentSkipList::scan
+ * 
+ * @details Verifies that scans visit exactly the keys of a half-open
+ * range in order, including empty ranges and ranges past the ends.
+ * 
+ * @ingroup testing
+ */
+void test_concurrent_skip_list_scan() {
+	TEST_GROUP("ConcurrentSkipList range scans");
+	
+	ConcurrentSkipList<int, int> map;
+	for (int i = 0; i < 100; ++i)
+		map.insert(i * 10, i);
+	std::vector<int> keys;
+	auto collect = [&keys](const std::pair<const int, int> &entry) { keys.push_back(entry.first); };
+	assert(map.scan(100, 150, collect) == 5);
+	assert((keys == std::vector<int>{100, 110, 120, 130, 140}));
+	keys.clear();
+	assert(map.scan(-50, 25, collect) == 3 && (keys == std::vector<int>{0, 10, 20}));
+	assert(map.scan(985, 2000, collect) == 1 && keys.back() == 990);
+	assert(map.scan(41, 49, collect) == 0 && map.scan(50, 50, collect) == 0);
+	int sum = 0;
+	assert(map.scan(0, 1000, [&sum](const std::pair<const int, int> &entry) { sum += entry.second; }) == 100);
+	assert(sum == 4950);
+	map.erase(120);
+	keys.clear();
+	assert(map.scan(100, 150, collect) == 4 && (keys == std::vector<int>{100, 110, 130, 140}));
+	
+	TEST_PASS("ConcurrentSkipList range scans");
+}
+
+/**
+ * @brief Tests ConcurrentSkipList element lifetime
+ * 
+ * @details Verifies that erased elements are destroyed once their
+ * epoch has passed, while lookups keep working, and that the
+ * destructor destroys linked and retired elements alike.
+ * 
+ * @ingroup testing
+ */
+void test_concurrent_skip_list_lifetime() {
+	TEST_GROUP("ConcurrentSkipList element lifetime");
+	
+	{
+		ConcurrentSkipList<int, Tracked> map;
+		for (int round = 0; round < 20; ++round) {
+			for (int i = 0; i < 500; ++i)
+				map.insert(i, Tracked(i));
+			for (int i = 0; i < 500; ++i)
+				assert(map.erase(i));
+		}
+		assert(map.empty() && Tracked::live < 2000);
+		for (int i = 0; i < 100; ++i)
+			map.insert(i, Tracked(i));
+		Tracked out;
+		assert(map.find(42, out) && out.value == 42);
+		for (int i = 0; i < 50; ++i)
+			map.erase(i);
+	}
+	assert(Tracked::live == 0);
+	
+	TEST_PASS("ConcurrentSkipList element lifetime");
+}
+
+/**
+ * @brief Tests ConcurrentSkipList with many writing threads
+ * 
+ * @details Threads insert and erase keys from one small range at
+ * random, so nodes with the same key are linked, marked and unlinked
+ * around each other all the time, and count their successes per key.
+ * Afterwards every key must be present exactly when it was inserted
+ * once more than it was erased.
+ * 
+ * @ingroup testing
+ */
+void test_concurrent_skip_list_contention() {
+	TEST_GROUP("ConcurrentSkipList contended insert and erase");
+	
+	const int thread_count = 4;
+	const int key_count = 64;
+	const int per_thread = 50000;
+	ConcurrentSkipList<int, int> map;
+	std::vector<std::atomic<int>> balance(key_count);
+	for (auto &count : balance)
+		count.store(0);
+	std::vector<std::thread> threads;
+	for (int t = 0; t < thread_count; ++t) {
+		threads.emplace_back([&map, &balance, t, key_count, per_thread]() {
+			unsigned state = 12345u + static_cast<unsigned>(t) * 7919u;
+			for (int i = 0; i < per_thread; ++i) {
+				state = state * 1103515245u + 12345u;
+				int key = static_cast<int>((state >> 16) % key_count);
+				if ((state >> 8) & 1) {
+					if (map.insert(key, key * 3))
+						++balance[key];
+				}
+				else if (map.erase(key))
+					--balance[key];
+				int value;
+				if (map.find(key ^ 1, value))
+					assert(value == (key ^ 1) * 3);
+			}
+		});
+	}
+	for (auto &thread : threads)
+		thread.join();
+	
+	unsigned long present = 0;
+	for (int key = 0; key < key_count; ++key) {
+		int count = balance[key].load();
+		assert(count == 0 || count == 1);
+		assert(map.contains(key) == (count == 1));
+		present += count;
+	}
+	assert(map.size() == present);
+	assert(map.scan(0, key_count, [](const std::pair<const int, int> &) {}) == present);
+	
+	TEST_PASS("ConcurrentSkipList contended insert and erase");
+}
+
+/**
+ * @brief Tests ConcurrentSkipList readers alongside writers
+ * 
+ * @details Even keys are inserted up front and never touched again,
+ * while writer threads keep inserting and erasing odd keys. Reader
+ * threads scan and look up at the same time; every scan must see all
+ * even keys in increasing order, and every lookup must find them.
+ * 
+ * @ingroup testing
+ */
+void test_concurrent_skip_list_readers() {
+	TEST_GROUP("ConcurrentSkipList readers and writers");
+	
+	const int key_count = 2000;
+	ConcurrentSkipList<int, int> map;
+	for (int key = 0; key < key_count; key += 2)
+		map.insert(key, -key);
+	std::atomic<bool> done(false);
+	std::vector<std::thread> writers;
+	for (int t = 0; t < 2; ++t) {
+		writers.emplace_back([&map, t, key_count]() {
+			for (int round = 0; round < 20; ++round) {
+				for (int key = 1 + t * 2; key < key_count; key += 4)
+					map.insert(key, -key);
+				for (int key = 1 + t * 2; key < key_count; key += 4)
+					map.erase(key);
+			}
+		});
+	}
+	std::vector<std::thread> readers;
+	std::atomic<int> scans(0);
+	for (int t = 0; t < 2; ++t) {
+		readers.emplace_back([&map, &done, &scans, key_count]() {
+			do {
+				int previous = -1;
+				int evens = 0;
+				map.scan(0, key_count, [&previous, &evens](const std::pair<const int, int> &entry) {
+					assert(entry.first > previous && entry.second == -entry.first);
+					previous = entry.first;
+					if (entry.first % 2 == 0)
+						++evens;
+				});
+				assert(evens == key_count / 2);
+				int value;
+				for (int key = 0; key < key_count; key += 50)
+					assert(map.find(key, value) && value == -key);
+				++scans;
+			} while (!done.load());
+		});
+	}
+	for (auto &thread : writers)
+		thread.join();
+	done.store(true);
+	for (auto &thread : readers)
+		thread.join();
+	assert(scans.load() > 0 && map.size() == key_count / 2);
+	
+	TEST_PASS("ConcurrentSkipList readers and writers");
+}
+
+int main() {
+	TEST_HEADER("ConcurrentSkipList");
+	
+	try {
+		test_concurrent_skip_list_basic();
+		test_concurrent_skip_list_scan();
+		test_concurrent_skip_list_lifetime();
+		test_concurrent_skip_list_contention();
+		test_concurrent_skip_list_readers();
+	
+		TEST_SUCCESS("ConcurrentSkipList");
+		return 0;
+	} catch (const std::exception& e) {
+		TEST_FAIL(e.what());
+		return 1;
+	}
+}
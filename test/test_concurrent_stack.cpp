@@ -0,0 +1,191 @@
+/**
+ * @file test_concurrent_stack.cpp
+ * @brief Unit tests for ConcurrentStack concurrent container class
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ * 
+ * @details This file contains unit tests for the ConcurrentStack
+ * class, covering single-threaded LIFO semantics, pop_all, node
+ * recycling, element lifetime and many threads pushing and popping the
+ * same nodes at once.
+ */
+
+#include <iostream>
+#include <atomic>
+#include <cassert>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "test_colors.hpp"
+#include "test_fixtures.hpp"
+#include "super_lib.hpp"
+
+/**
+ * @brief Tests ConcurrentStack on a single thread
+ * 
+ * @details Verifies LIFO order, move and emplace insertion, and that
+ * pops fail when the stack is empty.
+ * 
+ * @ingroup testing
+ */
+void test_concurrent_stack_basic() {
+	TEST_GROUP("ConcurrentStack basic operations");
+	
+	ConcurrentStack<int> s;
+	int out = -1;
+	assert(s.empty() && !s.try_pop(out) && out == -1);
+	for (int i = 0; i < 100; ++i)
+		s.push(i);
+	assert(!s.empty());
+	for (int i = 99; i >= 0; --i)
+		assert(s.try_pop(out) && out == i);
+	assert(s.empty() && !s.try_pop(out));
+	
+	ConcurrentStack<std::string> words;
+	std::string word = "moved";
+	words.push(std::move(word));
+	assert(word.empty());
+	words.emplace(3, 'x');
+	std::string got;
+	assert(words.try_pop(got) && got == "xxx");
+	assert(words.try_pop(got) && got == "moved");
+	
+	TEST_PASS("ConcurrentStack basic operations");
+}
+
+/**
+ * @brief Tests ConcurrentStack::pop_all
+ * 
+ * @details Verifies that every element is handed over in LIFO order,
+ * that the stack is usable afterwards and that an empty stack yields
+ * nothing.
+ * 
+ * @ingroup testing
+ */
+void test_concurrent_stack_pop_all() {
+	TEST_GROUP("ConcurrentStack pop_all");
+	
+	ConcurrentStack<std::string> s;
+	assert(s.pop_all([](std::string &&) { assert(false); }) == 0);
+	for (int i = 0; i < 5; ++i)
+		s.push(std::string(1, static_cast<char>('a' + i)));
+	std::string order;
+	assert(s.pop_all([&order](std::string &&value) { order += value; }) == 5);
+	assert(order == "edcba" && s.empty());
+	s.push("again");
+	std::string got;
+	assert(s.try_pop(got) && got == "again");
+	
+	TEST_PASS("ConcurrentStack pop_all");
+}
+
+/**
+ * @brief Tests ConcurrentStack node recycling and element lifetime
+ * 
+ * @details Verifies that nodes are reused, that popped elements are
+ * destroyed, and that the destructor and a throwing pop_all visitor
+ * destroy the remaining elements.
+ * 
+ * @ingroup testing
+ */
+void test_concurrent_stack_recycling() {
+	TEST_GROUP("ConcurrentStack node recycling");
+	
+	{
+		ConcurrentStack<Tracked> s;
+		s.reserve(64);
+		for (int round = 0; round < 100; ++round) {
+			for (int i = 0; i < 50; ++i)
+				s.emplace(i);
+			Tracked out;
+			for (int i = 0; i < 25; ++i)
+				assert(s.try_pop(out));
+			assert(s.pop_all([](Tracked &&) {}) == 25);
+		}
+		assert(s.node_capacity() == 64 && Tracked::live == 0);
+		
+		for (int i = 0; i < 10; ++i)
+			s.emplace(i);
+		bool thrown = false;
+		try {
+			s.pop_all([](Tracked &&value) {
+				if (value.value == 6)
+					throw std::runtime_error("visitor");
+			});
+		}
+		catch (const std::runtime_error &) {
+			thrown = true;
+		}
+		assert(thrown && s.empty() && Tracked::live == 0);
+		s.emplace(1);
+		s.emplace(2);
+	}
+	assert(Tracked::live == 0);
+	
+	TEST_PASS("ConcurrentStack node recycling");
+}
+
+/**
+ * @brief Tests ConcurrentStack with many threads
+ * 
+ * @details Each thread repeatedly pushes its own values and pops
+ * whatever is on top, so the same few nodes are recycled between
+ * threads all the time, which is where ABA would corrupt the stack.
+ * A final pop_all collects the rest. Every value must come out exactly
+ * once.
+ * 
+ * @ingroup testing
+ */
+void test_concurrent_stack_threads() {
+	TEST_GROUP("ConcurrentStack concurrent push and pop");
+	
+	const int thread_count = 4;
+	const int per_thread = 40000;
+	ConcurrentStack<int> s;
+	std::vector<std::vector<int>> popped(thread_count);
+	std::vector<std::thread> threads;
+	for (int t = 0; t < thread_count; ++t) {
+		threads.emplace_back([&s, &popped, t, per_thread]() {
+			int value;
+			for (int i = 0; i < per_thread; ++i) {
+				s.push(t * per_thread + i);
+				if (i % 3 != 2 && s.try_pop(value))
+					popped[t].push_back(value);
+				if (i % 128 == 0)
+					std::this_thread::yield();
+			}
+		});
+	}
+	for (auto &thread : threads)
+		thread.join();
+	
+	std::vector<int> seen(thread_count * per_thread, 0);
+	for (const auto &values : popped)
+		for (int value : values)
+			++seen[value];
+	s.pop_all([&seen](int &&value) { ++seen[value]; });
+	for (int count : seen)
+		assert(count == 1);
+	assert(s.empty());
+	
+	TEST_PASS("ConcurrentStack concurrent push and pop");
+}
+
+int main() {
+	TEST_HEADER("ConcurrentStack");
+	
+	try {
+		test_concurrent_stack_basic();
+		test_concurrent_stack_pop_all();
+		test_concurrent_stack_recycling();
+		test_concurrent_stack_threads();
+		
+		TEST_SUCCESS("ConcurrentStack");
+		return 0;
+	} catch (const std::exception& e) {
+		TEST_FAIL(e.what());
+		return 1;
+	}
+}
@@ -12,10 +12,16 @@
  * @date 2024
  */
 
+#include <algorithm>
 #include <iostream>
+#include <iterator>
+#include <type_traits>
 #include <cassert>
+#include <string>
 #include <stdexcept>
+#include <utility>
 #include "test_colors.hpp"
+#include "test_fixtures.hpp"
 #include "super_lib.hpp"
 
 /**
@@ -71,11 +77,13 @@ void test_deque_operators() {
 	d1[1] = 10;
 	assert(d1[1] == 10);
 	
+#if COLLECTIONS_BOUNDS_CHECK
 	try {
 		d1[10];
 		assert(false && "Should throw exception");
 	} catch (const std::out_of_range&) {
 	}
+#endif
 	
 	Deque<int> d2;
 	d2 = d1;
@@ -206,6 +214,16 @@ void test_deque_at() {
 	} catch (const std::out_of_range&) {
 	}
 	
+	d.at(1) = 25;
+	const auto &cref = d;
+	assert(cref[1] == 25);
+	assert(cref.at(1) == 25);
+	try {
+		d.at(3) = 0;
+		assert(false && "Should throw exception");
+	} catch (const std::out_of_range&) {
+	}
+	
 	TEST_PASS("Deque at");
 }
 
@@ -627,6 +645,253 @@ void test_deque_iterator_edge_cases() {
 	TEST_PASS("Deque iterator edge cases");
 }
 
+/**
+ * @brief Tests Deque capacity policy
+ * 
+ * @details Verifies that push/pop cycles around a capacity boundary
+ * keep the same buffer, and that reserve() and shrink_to_fit() keep
+ * element order when the buffer is wrapped.
+ * 
+ * @ingroup testing
+ */
+void test_deque_capacity_policy() {
+	TEST_GROUP("Deque capacity policy");
+	
+	Deque<int> d;
+	for (int i = 0; i < 17; ++i)
+		d.push_back(i);
+	assert(d.capacity() == 32);
+	int *buffer = d.data();
+	for (int i = 0; i < 100; ++i) {
+		d.pop_front();
+		d.push_back(i + 17);
+	}
+	assert(d.data() == buffer);
+	
+	d.reserve(64);
+	assert(d.capacity() == 64);
+	for (size_t i = 0; i < d.size(); ++i)
+		assert(d[i] == static_cast<int>(i + 100));
+	
+	for (int i = 0; i < 5; ++i)
+		d.push_front(99 - i);
+	d.shrink_to_fit();
+	assert(d.capacity() == d.size());
+	for (size_t i = 0; i < d.size(); ++i)
+		assert(d[i] == static_cast<int>(i + 95));
+	
+	TEST_PASS("Deque capacity policy");
+}
+
+/**
+ * @brief Tests Deque random access iterators
+ * 
+ * @details Verifies iterator traits, const_iterator read-only access
+ * and conversion, iterator arithmetic across the wrap point of the
+ * circular buffer, and that std::sort and std::lower_bound work on a
+ * wrapped deque.
+ * 
+ * @ingroup testing
+ */
+void test_deque_random_access_iterators() {
+	TEST_GROUP("Deque random access iterators");
+	
+	using It = Deque<int>::iterator;
+	using CIt = Deque<int>::const_iterator;
+	static_assert(std::is_same_v<std::iterator_traits<It>::iterator_category, std::random_access_iterator_tag>);
+	static_assert(std::is_same_v<std::iterator_traits<CIt>::reference, const int&>);
+	static_assert(std::is_convertible_v<It, CIt>);
+	static_assert(!std::is_convertible_v<CIt, It>);
+	
+	Deque<int> d;
+	d.reserve(8);
+	for (int i = 0; i < 4; ++i)
+		d.push_back(i * 10);
+	for (int i = 1; i <= 3; ++i)
+		d.push_front(i * 7);
+	assert(d.head() > d.tail());
+	
+	It first = d.begin();
+	It last = d.end();
+	assert(last - first == 7);
+	assert(first[0] == 21 && first[3] == 0 && first[6] == 30);
+	assert(*(first + 4) == 10 && *(last - 1) == 30);
+	assert(*(2 + first) == 7);
+	It it = first;
+	it += 5;
+	assert(*it == 20);
+	it -= 2;
+	assert(*it-- == 0 && *it == 7);
+	assert(first < it && it <= it && last > it && last >= it);
+	
+	std::sort(d.begin(), d.end());
+	int sorted[] = {0, 7, 10, 14, 20, 21, 30};
+	for (size_t i = 0; i < d.size(); ++i)
+		assert(d[i] == sorted[i]);
+	
+	const Deque<int> &cd = d;
+	CIt found = std::lower_bound(cd.begin(), cd.end(), 15);
+	assert(*found == 20 && found - cd.begin() == 4);
+	CIt converted = d.begin();
+	assert(converted == cd.begin() && d.begin() == converted);
+	assert(std::distance(cd.begin(), cd.end()) == 7);
+	std::reverse(d.begin(), d.end());
+	assert(d[0] == 30 && d[6] == 0);
+	
+	TEST_PASS("Deque random access iterators");
+}
+
+/**
+ * @brief Tests Deque power-of-two capacity mode
+ * 
+ * @details Verifies that with PowerOfTwoCapacityPolicy every capacity
+ * is a power of two, including after constructors, reserve() and
+ * shrink_to_fit(), and that masked indexing and iteration keep element
+ * order across the wrap point.
+ * 
+ * @ingroup testing
+ */
+void test_deque_power_of_two_capacity() {
+	TEST_GROUP("Deque power-of-two capacity");
+	
+	using Pow2Deque = Deque<int, std::allocator<int>, PowerOfTwoCapacityPolicy<>>;
+	static_assert(Pow2Deque::power_of_two_capacity);
+	static_assert(!Deque<int>::power_of_two_capacity);
+	
+	Pow2Deque filled(5, 1);
+	assert(filled.size() == 5 && filled.capacity() == 8);
+	filled.push_back(2);
+	assert(filled[5] == 2 && filled.capacity() == 8);
+	
+	Pow2Deque d;
+	for (int i = 0; i < 20; ++i) {
+		d.push_back(i);
+		size_t cap = d.capacity();
+		assert((cap & (cap - 1)) == 0);
+	}
+	assert(d.capacity() == 32);
+	for (int i = 0; i < 10; ++i)
+		d.pop_front();
+	for (int i = 0; i < 20; ++i)
+		d.push_back(i + 20);
+	assert(d.capacity() == 32 && d.head() > d.tail());
+	for (size_t i = 0; i < d.size(); ++i)
+		assert(d[i] == static_cast<int>(i + 10) && d.at(i) == d[i]);
+	int expected = 10;
+	for (int x : d)
+		assert(x == expected++);
+	assert(*(d.begin() + 25) == 35);
+	
+	d.reserve(33);
+	assert(d.capacity() == 64 && d[0] == 10);
+	d.shrink_to_fit();
+	assert(d.capacity() == 32 && d[29] == 39);
+	while (d.size() > 3)
+		d.pop_back();
+	size_t cap = d.capacity();
+	assert(cap >= 3 && (cap & (cap - 1)) == 0);
+	assert(d[0] == 10 && d[2] == 12);
+	
+	Pow2Deque copy(d);
+	assert(copy.capacity() == d.capacity() && copy[2] == 12);
+	Vector<int> source;
+	for (int i = 0; i < 3; ++i)
+		source.add(i);
+	Pow2Deque from_vector(source);
+	assert(from_vector.capacity() == 4);
+	from_vector.push_front(-1);
+	from_vector.push_back(3);
+	assert(from_vector.capacity() == 8 && from_vector[0] == -1 && from_vector[4] == 3);
+	
+	TEST_PASS("Deque power-of-two capacity");
+}
+
+/**
+ * @brief Tests Deque segment views and batch operations
+ * 
+ * @details Verifies that as_spans() reports one run for unwrapped data
+ * and two runs once the buffer wraps, and that push_back_n() and
+ * pop_front_n() move whole batches in order for trivially copyable and
+ * non-trivial types.
+ * 
+ * @ingroup testing
+ */
+void test_deque_spans_and_batches() {
+	TEST_GROUP("Deque spans and batches");
+	
+	Deque<int> d;
+	Deque<int>::spans empty = d.as_spans();
+	assert(empty.first_size == 0 && empty.second_size == 0);
+	
+	int batch[] = {0, 1, 2, 3, 4, 5, 6, 7};
+	d.push_back_n(batch, 8);
+	assert(d.size() == 8 && d.capacity() == 8);
+	Deque<int>::spans one = d.as_spans();
+	assert(one.first == d.data() && one.first_size == 8 && one.second_size == 0);
+	
+	int out[8] = {};
+	assert(d.pop_front_n(out, 5) == 5);
+	assert(out[0] == 0 && out[4] == 4 && d.size() == 3 && d[0] == 5);
+	d.push_back_n(batch, 4);
+	assert(d.size() == 7 && d.head() > d.tail());
+	
+	const Deque<int> &cd = d;
+	Deque<int>::const_spans two = cd.as_spans();
+	assert(two.first_size == 3 && two.second_size == 4);
+	assert(two.first[0] == 5 && two.first[2] == 7);
+	assert(two.second == cd.data() && two.second[0] == 0 && two.second[3] == 3);
+	
+	assert(d.pop_front_n(out, 8) == 7);
+	int expected[] = {5, 6, 7, 0, 1, 2, 3};
+	for (int i = 0; i < 7; ++i)
+		assert(out[i] == expected[i]);
+	assert(d.empty() && d.pop_front_n(out, 1) == 0);
+	
+	d.push_back(-1);
+	d.push_back_n(batch, 8);
+	assert(d.size() == 9 && d[0] == -1 && d[8] == 7);
+	
+	Deque<std::string> words;
+	std::string input[] = {"alpha", "beta", "gamma"};
+	words.push_back_n(input, 3);
+	words.push_front("zero");
+	words.push_back_n(input, 2);
+	assert(words.size() == 6 && words[0] == "zero" && words[5] == "beta");
+	std::string taken[4];
+	assert(words.pop_front_n(taken, 4) == 4);
+	assert(taken[0] == "zero" && taken[3] == "gamma");
+	assert(words.size() == 2 && words[0] == "alpha");
+	
+	TEST_PASS("Deque spans and batches");
+}
+
+/**
+ * @brief Tests Deque move assignment between allocators
+ * 
+ * @details Verifies that the buffer is taken over from an equal
+ * allocator and that the elements of a wrapped buffer are moved in
+ * order for a different one.
+ * 
+ * @ingroup testing
+ */
+void test_deque_move_allocator() {
+	TEST_GROUP("Deque move assignment between allocators");
+	
+	static_assert(std::is_nothrow_move_assignable<Deque<int>>::value, "std::allocator never needs a fallback");
+	check_move_allocator<Deque<Tracked, TaggedAllocator<Tracked>>>(
+		[](auto &d) {
+			for (int i = 0; i < 6; ++i)
+				d.push_back(Tracked(i));
+			d.pop_front();
+			d.pop_front();
+			d.push_back(Tracked(6));
+			d.push_front(Tracked(1));
+		},
+		[](const auto &d) { return d.data(); });
+	
+	TEST_PASS("Deque move assignment between allocators");
+}
+
 int main() {
 	TEST_HEADER("Deque");
 	
@@ -647,6 +912,11 @@ int main() {
 		test_deque_iterators();
 		test_deque_circular_buffer_iteration();
 		test_deque_iterator_edge_cases();
+		test_deque_capacity_policy();
+		test_deque_random_access_iterators();
+		test_deque_power_of_two_capacity();
+		test_deque_spans_and_batches();
+		test_deque_move_allocator();
 		
 		TEST_SUCCESS("Deque");
 		return 0;
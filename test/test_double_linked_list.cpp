@@ -12,10 +12,19 @@
  * @date 2024
  */
 
+#include <algorithm>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <type_traits>
 #include <cassert>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 #include <stdexcept>
 #include "test_colors.hpp"
+#include "test_fixtures.hpp"
 #include "super_lib.hpp"
 
 /**
@@ -523,6 +532,392 @@ void test_double_linked_list_from_other_collections() {
 	TEST_PASS("DoubleLinkedList from other collections");
 }
 
+/**
+ * @brief Tests DoubleLinkedList iterator traits and const iteration
+ * 
+ * @details Verifies the bidirectional iterator category, stepping back
+ * from end(), that const_iterator only gives const access and converts
+ * from iterator, and that standard algorithms work on the container.
+ * 
+ * @ingroup testing
+ */
+void test_double_linked_list_iterator_traits() {
+	TEST_GROUP("DoubleLinkedList iterator traits");
+	
+	using It = DoubleLinkedList<int>::iterator;
+	using CIt = DoubleLinkedList<int>::const_iterator;
+	static_assert(std::is_same_v<std::iterator_traits<It>::iterator_category, std::bidirectional_iterator_tag>);
+	static_assert(std::is_same_v<std::iterator_traits<CIt>::reference, const int&>);
+	static_assert(std::is_convertible_v<It, CIt>);
+	static_assert(!std::is_convertible_v<CIt, It>);
+	
+	DoubleLinkedList<int> c;
+	for (int i = 1; i <= 5; ++i)
+		c.add(i);
+	
+	It last = c.end();
+	--last;
+	assert(*last == 5);
+	assert(*--last == 4);
+	assert(*last-- == 4 && *last == 3);
+	
+	std::reverse(c.begin(), c.end());
+	assert(c[0] == 5 && c[4] == 1);
+	
+	const DoubleLinkedList<int> &cc = c;
+	CIt cit = c.end();
+	assert(cit == cc.end() && c.end() == cit);
+	assert(*std::prev(cit) == 1);
+	assert(std::distance(cc.begin(), cc.end()) == 5);
+	assert(*std::max_element(cc.begin(), cc.end()) == 5);
+	
+	DoubleLinkedList<int> empty;
+	assert(empty.begin() == empty.end());
+	
+	TEST_PASS("DoubleLinkedList iterator traits");
+}
+
+/**
+ * @brief Tests DoubleLinkedList node allocation
+ * 
+ * @details Verifies that nodes freed at the tail and through iterators
+ * are reused for insertions at the head, that default lists share one
+ * pool without allocating when constructed, and that std::allocator
+ * can be plugged in instead of a pool.
+ * 
+ * @ingroup testing
+ */
+void test_double_linked_list_node_allocator() {
+	TEST_GROUP("DoubleLinkedList node allocator");
+	
+	DoubleLinkedList<int> list(PoolAllocator<int>(std::make_shared<NodePool>(64)));
+	for (int i = 0; i < 64; ++i)
+		list.add(i);
+	for (int round = 0; round < 20; ++round) {
+		for (int i = 0; i < 16; ++i)
+			list.erase(list.size() - 1);
+		for (auto it = list.begin(); it != list.end();)
+			it = *it % 4 == 0 ? list.erase(it) : std::next(it);
+		while (list.size() < 64)
+			list.insert(0, round);
+	}
+	assert(list.get_allocator().capacity() == 64 && list.size() == 64);
+	assert(list[0] == 19 && list[63] % 4 != 0);
+	
+	static_assert(std::is_nothrow_default_constructible<DoubleLinkedList<int>>::value, "default lists do not allocate");
+	assert(DoubleLinkedList<int>().get_allocator() == DoubleLinkedList<int>().get_allocator());
+	
+	DoubleLinkedList<int, std::allocator<int>> plain(3, 9, std::allocator<int>());
+	plain.add(4);
+	assert(plain.size() == 4 && plain[3] == 4);
+	
+	TEST_PASS("DoubleLinkedList node allocator");
+}
+
+/**
+ * @brief Tests DoubleLinkedList move assignment between allocators
+ * 
+ * @details Verifies that the nodes are relinked from an equal
+ * allocator and that the elements are moved into new nodes for a
+ * different one.
+ * 
+ * @ingroup testing
+ */
+void test_double_linked_list_move_allocator() {
+	TEST_GROUP("DoubleLinkedList move assignment between allocators");
+	
+	static_assert(std::is_nothrow_move_assignable<DoubleLinkedList<int>>::value, "PoolAllocator propagates on move");
+	check_move_allocator<DoubleLinkedList<Tracked, TaggedAllocator<Tracked>>>(
+		[](auto &l) {
+			for (int i = 0; i < 5; ++i)
+				l.add(Tracked(i));
+		},
+		[](const auto &l) { return l.head(); });
+	
+	TEST_PASS("DoubleLinkedList move assignment between allocators");
+}
+
+/**
+ * @brief Collects the elements of a list into a std::vector
+ * 
+ * @ingroup testing
+ * 
+ * @tparam List Type of list
+ * @param[in] list List to read
+ * @return Elements in iteration order
+ */
+template<class List>
+std::vector<typename List::value_type> contents(const List &list) {
+	return std::vector<typename List::value_type>(list.begin(), list.end());
+}
+
+/**
+ * @brief Tests DoubleLinkedList iterator-based insert and erase
+ * 
+ * @details Verifies insert_after in the middle, at the back and,
+ * through end(), at the front, and that erase returns the following
+ * element while keeping both directions linked.
+ * 
+ * @ingroup testing
+ */
+void test_double_linked_list_insert_erase_iterator() {
+	TEST_GROUP("DoubleLinkedList iterator insert and erase");
+	
+	DoubleLinkedList<int> list;
+	auto it = list.insert_after(list.end(), 2);
+	assert(list.size() == 1 && list.head() == list.tail());
+	it = list.insert_after(it, 4);
+	assert(list.tail()->data == 4);
+	list.insert_after(list.begin(), 3);
+	list.insert_after(list.end(), 1);
+	assert((contents(list) == std::vector<int>{1, 2, 3, 4}));
+	assert(*--list.end() == 4 && list.tail()->prev->data == 3);
+	
+	it = list.erase(std::next(list.begin()));
+	assert(*it == 3 && list.head()->next->prev == list.head());
+	it = list.erase(std::next(it));
+	assert(it == list.end() && list.tail()->data == 3 && list.tail()->next == nullptr);
+	it = list.erase(list.begin());
+	assert(*it == 3 && list.head()->prev == nullptr && list.size() == 1);
+	
+	bool thrown = false;
+	try {
+		list.erase(list.end());
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+	list.erase(list.begin());
+	assert(list.empty() && list.head() == nullptr && list.tail() == nullptr);
+	list.add(9);
+	assert(list.head() == list.tail() && list[0] == 9);
+	
+	TEST_PASS("DoubleLinkedList iterator insert and erase");
+}
+
+/**
+ * @brief Tests DoubleLinkedList splice
+ * 
+ * @details Verifies that default lists and lists sharing a pool
+ * exchange nodes without reallocating them, that lists with separate
+ * pools still end up with the right elements, and splicing within one
+ * list.
+ * 
+ * @ingroup testing
+ */
+void test_double_linked_list_splice() {
+	TEST_GROUP("DoubleLinkedList splice");
+	
+	DoubleLinkedList<int> a;
+	DoubleLinkedList<int> b;
+	for (int i = 0; i < 4; ++i) {
+		a.add(i);
+		b.add(10 + i);
+	}
+	const int *moved = &b[1];
+	a.splice(std::next(a.begin()), b, std::next(b.begin()), std::next(b.begin(), 3));
+	assert((contents(a) == std::vector<int>{0, 11, 12, 1, 2, 3}));
+	assert((contents(b) == std::vector<int>{10, 13}));
+	assert(&a[1] == moved && a.size() == 6 && b.size() == 2);
+	
+	a.splice(a.begin(), b);
+	assert((contents(a) == std::vector<int>{10, 13, 0, 11, 12, 1, 2, 3}));
+	assert(b.empty() && b.head() == nullptr && b.tail() == nullptr);
+	b.splice(b.end(), a, std::next(a.begin()), a.end());
+	assert((contents(a) == std::vector<int>{10}) && a.tail() == a.head());
+	assert(b.size() == 7 && b.tail()->data == 3 && b.head()->prev == nullptr);
+	
+	b.splice(b.end(), b, b.begin(), std::next(b.begin(), 2));
+	assert((contents(b) == std::vector<int>{11, 12, 1, 2, 3, 13, 0}));
+	assert(b.tail()->data == 0 && b.size() == 7);
+	std::vector<int> backwards(std::make_reverse_iterator(b.end()), std::make_reverse_iterator(b.begin()));
+	assert((backwards == std::vector<int>{0, 13, 3, 2, 1, 12, 11}));
+	
+	DoubleLinkedList<int> sorted;
+	DoubleLinkedList<int> extra;
+	sorted.add(1);
+	sorted.add(3);
+	extra.add(2);
+	moved = &extra[0];
+	sorted.merge(extra);
+	assert((contents(sorted) == std::vector<int>{1, 2, 3}) && &sorted[1] == moved && extra.empty());
+	
+	DoubleLinkedList<std::string> pooled(PoolAllocator<std::string>(std::make_shared<NodePool>(64)));
+	DoubleLinkedList<std::string> other(PoolAllocator<std::string>(std::make_shared<NodePool>(64)));
+	pooled.add("a");
+	pooled.add("d");
+	other.add("b");
+	other.add("c");
+	assert(pooled.get_allocator() != other.get_allocator());
+	pooled.splice(std::next(pooled.begin()), other);
+	assert((contents(pooled) == std::vector<std::string>{"a", "b", "c", "d"}));
+	assert(other.empty() && pooled.size() == 4);
+	other.add("e");
+	assert(other.size() == 1 && other[0] == "e");
+	
+	PoolAllocator<std::string> shared(std::make_shared<NodePool>(64));
+	DoubleLinkedList<std::string> left(shared);
+	DoubleLinkedList<std::string> right(shared);
+	left.add("a");
+	left.add("d");
+	right.add("b");
+	right.add("c");
+	const std::string *kept = &right[0];
+	left.splice(std::next(left.begin()), right);
+	assert((contents(left) == std::vector<std::string>{"a", "b", "c", "d"}));
+	assert(&left[1] == kept && right.empty());
+	right.add("e");
+	kept = &right[0];
+	left.merge(right);
+	assert(&left[4] == kept && left.size() == 5 && right.empty());
+	assert(shared.capacity() == 5);
+	
+	TEST_PASS("DoubleLinkedList splice");
+}
+
+/**
+ * @brief Tests DoubleLinkedList merge and sort
+ * 
+ * @details Verifies that merge interleaves two sorted lists stably,
+ * that sort matches std::stable_sort on random and presorted input,
+ * that prev links are consistent afterwards and that custom
+ * comparators work.
+ * 
+ * @ingroup testing
+ */
+void test_double_linked_list_merge_sort() {
+	TEST_GROUP("DoubleLinkedList merge and sort");
+	
+	using Pair = std::pair<int, int>;
+	auto by_key = [](const Pair &x, const Pair &y) { return x.first < y.first; };
+	DoubleLinkedList<Pair> left;
+	DoubleLinkedList<Pair> right;
+	for (int i = 0; i < 5; ++i) {
+		left.add(Pair(i * 2, 0));
+		right.add(Pair(i * 3, 1));
+	}
+	left.merge(right, by_key);
+	assert(right.empty() && left.size() == 10);
+	std::vector<Pair> merged = contents(left);
+	assert(std::is_sorted(merged.begin(), merged.end(), by_key));
+	assert(merged[0] == Pair(0, 0) && merged[1] == Pair(0, 1));
+	assert(left.tail()->data == Pair(12, 1));
+	
+	DoubleLinkedList<int, std::allocator<int>> numbers;
+	std::vector<int> expected;
+	unsigned seed = 7;
+	for (int i = 0; i < 1000; ++i) {
+		seed = seed * 1103515245 + 12345;
+		numbers.add(static_cast<int>(seed >> 16) % 100);
+		expected.push_back(numbers.tail()->data);
+	}
+	const int *first_address = &numbers[0];
+	int first_value = numbers[0];
+	numbers.sort();
+	std::stable_sort(expected.begin(), expected.end());
+	assert(contents(numbers) == expected);
+	std::vector<int> backwards(std::make_reverse_iterator(numbers.end()), std::make_reverse_iterator(numbers.begin()));
+	assert(std::equal(backwards.begin(), backwards.end(), expected.rbegin()));
+	assert(numbers.head()->prev == nullptr && numbers.tail()->next == nullptr && numbers.size() == 1000);
+	assert(*std::find_if(numbers.begin(), numbers.end(), [&](const int &x) { return &x == first_address; }) == first_value);
+	
+	numbers.sort(std::greater<int>());
+	std::reverse(expected.begin(), expected.end());
+	assert(contents(numbers) == expected);
+	numbers.sort(std::greater<int>());
+	assert(contents(numbers) == expected);
+	
+	DoubleLinkedList<Pair> pairs;
+	for (int i = 0; i < 50; ++i)
+		pairs.add(Pair((i * 7) % 5, i));
+	pairs.sort(by_key);
+	std::vector<Pair> sorted = contents(pairs);
+	for (unsigned long i = 1; i < sorted.size(); ++i)
+		assert(sorted[i - 1].first < sorted[i].first || (sorted[i - 1].first == sorted[i].first && sorted[i - 1].second < sorted[i].second));
+	
+	DoubleLinkedList<int> empty;
+	empty.sort();
+	DoubleLinkedList<int> single(1, 5);
+	single.sort();
+	single.merge(empty);
+	assert(single.size() == 1 && empty.empty());
+	empty.merge(single);
+	assert(empty.size() == 1 && empty.tail()->data == 5 && single.empty());
+	
+	TEST_PASS("DoubleLinkedList merge and sort");
+}
+
+/**
+ * @brief Tests DoubleLinkedList index access through the cached cursor
+ * 
+ * @details Verifies that index loops, index-based insert and erase and
+ * iterator-based operations interleaved with index access always see
+ * the right elements, and that a long ascending loop finishes quickly.
+ * 
+ * @ingroup testing
+ */
+void test_double_linked_list_cursor() {
+	TEST_GROUP("DoubleLinkedList cached cursor");
+	
+	DoubleLinkedList<int> list;
+	std::vector<int> expected;
+	for (int i = 0; i < 20000; ++i) {
+		list.add(i);
+		expected.push_back(i);
+	}
+	long long sum = 0;
+	for (unsigned long i = 0; i < list.size(); ++i)
+		sum += list[i];
+	assert(sum == 19999LL * 20000 / 2);
+	
+	auto check = [&]() {
+		assert(list.size() == expected.size());
+		for (unsigned long i = 0; i < expected.size(); i += 97)
+			assert(list[i] == expected[i] && list.at(i) == expected[i]);
+		assert(contents(list) == expected);
+	};
+	assert(list[500] == 500);
+	list.insert(0, -5);
+	expected.insert(expected.begin(), -5);
+	assert(list[501] == 500);
+	list.insert(300, -7);
+	expected.insert(expected.begin() + 300, -7);
+	check();
+	assert(list[1000] == expected[1000]);
+	list.erase(0);
+	expected.erase(expected.begin());
+	assert(list[999] == expected[999]);
+	assert(list.erase(999) == expected[999]);
+	expected.erase(expected.begin() + 999);
+	check();
+	for (unsigned long i = 10; i < 2000; i += 2) {
+		list.insert(i, static_cast<int>(i));
+		expected.insert(expected.begin() + i, static_cast<int>(i));
+	}
+	check();
+	list.insert_after(list.begin(), -1);
+	expected.insert(expected.begin() + 1, -1);
+	check();
+	list.erase(std::next(list.begin()));
+	expected.erase(expected.begin() + 1);
+	check();
+	for (unsigned long i = expected.size(); i-- > 0;)
+		assert(list[i] == expected[i]);
+	list.sort(std::greater<int>());
+	std::sort(expected.begin(), expected.end(), std::greater<int>());
+	check();
+	
+	DoubleLinkedList<int> moved(std::move(list));
+	assert(moved[10] == expected[10] && list.empty());
+	list.add(1);
+	assert(list[0] == 1 && list.at(0) == 1);
+	moved.clear();
+	moved.add(2);
+	assert(moved[0] == 2);
+	
+	TEST_PASS("DoubleLinkedList cached cursor");
+}
+
 int main() {
 	TEST_HEADER("DoubleLinkedList");
 	
@@ -540,6 +935,13 @@ int main() {
 		test_double_linked_list_access_optimization();
 		test_double_linked_list_iterators();
 		test_double_linked_list_from_other_collections();
+		test_double_linked_list_iterator_traits();
+		test_double_linked_list_node_allocator();
+		test_double_linked_list_move_allocator();
+		test_double_linked_list_insert_erase_iterator();
+		test_double_linked_list_splice();
+		test_double_linked_list_merge_sort();
+		test_double_linked_list_cursor();
 		
 		TEST_SUCCESS("DoubleLinkedList");
 		return 0;
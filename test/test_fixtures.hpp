@@ -0,0 +1,143 @@
+/**
+ * @file test_fixtures.hpp
+ * @brief Element types and checks shared by the container test suites
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ * 
+ * @details Include this header in test files that need to observe how
+ * a container constructs and destroys its elements, or how it moves
+ * them between allocators.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Helper type counting its live instances
+ * 
+ * @details Lifetime tests check Tracked::live against the number of
+ * elements a container should hold, and that it drops back to zero
+ * once the container is gone. The counter is atomic so concurrent
+ * containers can be checked as well. The copy and move constructors
+ * are user-provided, so containers take their element-wise paths
+ * rather than memcpy. Constructing from a negative value throws, for
+ * tests of failed insertions.
+ * 
+ * @ingroup test_utilities
+ */
+struct Tracked {
+	static inline std::atomic<int> live{0};  ///< Number of currently alive instances
+	int value;                               ///< Stored value
+
+	Tracked(int v = 0) : value(v) {
+		if (v < 0)
+			throw std::runtime_error("negative value");
+		++live;
+	}
+	Tracked(const Tracked &other) noexcept : value(other.value) { ++live; }
+	Tracked(Tracked &&other) noexcept : value(other.value) { ++live; }
+	Tracked &operator=(const Tracked &other) noexcept = default;
+	Tracked &operator=(Tracked &&other) noexcept = default;
+	~Tracked() { --live; }
+};
+
+/**
+ * @brief Number of blocks freed through an allocator that did not
+ * allocate them
+ * 
+ * @ingroup test_utilities
+ */
+inline int foreign_deallocations = 0;
+
+/**
+ * @brief Allocator whose instances compare equal only to copies with
+ * the same tag
+ * 
+ * @details Does not propagate on move assignment, so containers moved
+ * between differently tagged allocators must move their elements
+ * instead of adopting the storage. Every block records the tag that
+ * allocated it, and freeing it through another tag counts as a foreign
+ * deallocation.
+ * 
+ * @tparam T Type of objects to allocate
+ * 
+ * @ingroup test_utilities
+ */
+template<class T>
+struct TaggedAllocator {
+	using value_type								= T;                ///< Type of allocated objects
+	using propagate_on_container_move_assignment	= std::false_type;  ///< Storage stays with its allocator
+	using is_always_equal							= std::false_type;  ///< Equality depends on the tag
+
+	int tag;  ///< Identity of the allocator
+
+	TaggedAllocator(int id = 0) noexcept : tag(id) {}
+	template<class U>
+	TaggedAllocator(const TaggedAllocator<U> &other) noexcept : tag(other.tag) {}
+
+	T *allocate(std::size_t count) {
+		char *block = static_cast<char *>(::operator new(sizeof(std::max_align_t) + count * sizeof(T)));
+		*reinterpret_cast<int *>(block) = tag;
+		return reinterpret_cast<T *>(block + sizeof(std::max_align_t));
+	}
+	void deallocate(T *object, std::size_t) noexcept {
+		char *block = reinterpret_cast<char *>(object) - sizeof(std::max_align_t);
+		if (*reinterpret_cast<int *>(block) != tag)
+			++foreign_deallocations;
+		::operator delete(block);
+	}
+	template<class U>
+	bool operator==(const TaggedAllocator<U> &other) const noexcept { return tag == other.tag; }
+	template<class U>
+	bool operator!=(const TaggedAllocator<U> &other) const noexcept { return tag != other.tag; }
+};
+
+/**
+ * @brief Checks move assignment between differently tagged allocators
+ * 
+ * @details Moves a container into one with another tag, which must
+ * move the elements into its own storage and leave the source empty
+ * but usable, then into one with the same tag, which must take over
+ * the storage. Nothing may leak or be freed through the wrong tag.
+ * 
+ * @tparam Container Container of Tracked using TaggedAllocator
+ * @param[in] fill Inserts the elements into a container
+ * @param[in] storage Returns an address that moves with the storage
+ * 
+ * @ingroup test_utilities
+ */
+template<class Container, class Fill, class Storage>
+void check_move_allocator(Fill fill, Storage storage) {
+	static_assert(!std::is_nothrow_move_assignable<Container>::value, "unequal allocators fall back to moving elements");
+	{
+		Container first(TaggedAllocator<Tracked>(1));
+		Container second(TaggedAllocator<Tracked>(2));
+		Container same(TaggedAllocator<Tracked>(2));
+		fill(first);
+		std::vector<int> expected;
+		for (std::size_t i = 0; i < first.size(); ++i)
+			expected.push_back(first[i].value);
+		fill(second);
+		second = std::move(first);
+		assert(second.size() == expected.size() && first.empty());
+		for (std::size_t i = 0; i < expected.size(); ++i)
+			assert(second[i].value == expected[i]);
+		assert(second.get_allocator().tag == 2 && Tracked::live == static_cast<int>(expected.size()));
+		
+		const void *adopted = storage(second);
+		fill(same);
+		same = std::move(second);
+		assert(storage(same) == adopted && same.size() == expected.size() && second.empty());
+		fill(first);
+	}
+	assert(Tracked::live == 0 && foreign_deallocations == 0);
+}
@@ -0,0 +1,278 @@
+/**
+ * @file test_intrusive_list.cpp
+ * @brief Unit tests for IntrusiveList container
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ * 
+ * @details This file contains unit tests for the IntrusiveList class,
+ * covering linking and unlinking, iterators, membership in several
+ * lists at once, splicing and moves.
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <cassert>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "test_colors.hpp"
+#include "super_lib.hpp"
+
+/**
+ * @brief Object that can sit on two intrusive lists at once
+ * 
+ * @ingroup testing
+ */
+struct Connection {
+	int					id;       ///< Identifier
+	IntrusiveListHook	by_age;   ///< Link for the age list
+	IntrusiveListHook	by_state; ///< Link for the state list
+
+	Connection(int value) : id(value) {}
+};
+
+using AgeList = IntrusiveList<Connection, &Connection::by_age>;     ///< List through by_age
+using StateList = IntrusiveList<Connection, &Connection::by_state>; ///< List through by_state
+
+/**
+ * @brief Collects the ids of a list into a std::vector
+ * 
+ * @ingroup testing
+ * 
+ * @tparam List Type of list
+ * @param[in] list List to read
+ * @return Ids in iteration order
+ */
+template<class List>
+std::vector<int> ids(const List &list) {
+	std::vector<int> result;
+	for (const Connection &c : list)
+		result.push_back(c.id);
+	return result;
+}
+
+/**
+ * @brief Tests IntrusiveList linking and unlinking
+ * 
+ * @details Verifies add, push_front, insert, erase, pop_front, pop_back
+ * and remove, that hooks report their state, that linking an object
+ * twice or removing an unlinked one throws and that front and back
+ * throw on an empty list.
+ * 
+ * @ingroup testing
+ */
+void test_intrusive_list_link_unlink() {
+	TEST_GROUP("IntrusiveList link and unlink");
+	
+	std::vector<Connection> objects;
+	for (int i = 0; i < 5; ++i)
+		objects.emplace_back(i);
+	AgeList list;
+	assert(list.empty() && list.begin() == list.end());
+	list.add(objects[1]);
+	list.add(objects[3]);
+	list.push_front(objects[0]);
+	auto it = list.insert(list.iterator_to(objects[3]), objects[2]);
+	assert(&*it == &objects[2]);
+	list.insert(list.end(), objects[4]);
+	assert((ids(list) == std::vector<int>{0, 1, 2, 3, 4}));
+	assert(list.size() == 5 && list.front().id == 0 && list.back().id == 4);
+	assert(objects[2].by_age.is_linked() && !objects[2].by_state.is_linked());
+	
+	bool thrown = false;
+	try {
+		list.add(objects[2]);
+	} catch (const std::invalid_argument&) {
+		thrown = true;
+	}
+	assert(thrown && list.size() == 5);
+	
+	list.remove(objects[2]);
+	assert(!objects[2].by_age.is_linked());
+	thrown = false;
+	try {
+		list.remove(objects[2]);
+	} catch (const std::invalid_argument&) {
+		thrown = true;
+	}
+	assert(thrown && list.size() == 4);
+	it = list.erase(list.iterator_to(objects[1]));
+	assert(it->id == 3);
+	list.pop_front();
+	list.pop_back();
+	assert((ids(list) == std::vector<int>{3}) && list.front().id == list.back().id);
+	list.add(objects[2]);
+	assert((ids(list) == std::vector<int>{3, 2}));
+	
+	list.clear();
+	assert(list.empty());
+	for (const Connection &c : objects)
+		assert(!c.by_age.is_linked());
+	thrown = false;
+	try {
+		list.front();
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+	thrown = false;
+	try {
+		list.erase(list.end());
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+	
+	TEST_PASS("IntrusiveList link and unlink");
+}
+
+/**
+ * @brief Tests IntrusiveList iterators
+ * 
+ * @details Verifies bidirectional traversal, stepping back from end(),
+ * const iteration, the iterator category and use with standard
+ * algorithms.
+ * 
+ * @ingroup testing
+ */
+void test_intrusive_list_iterators() {
+	TEST_GROUP("IntrusiveList iterators");
+	
+	static_assert(std::is_same_v<std::iterator_traits<AgeList::iterator>::iterator_category, std::bidirectional_iterator_tag>);
+	static_assert(std::is_same_v<std::iterator_traits<AgeList::const_iterator>::reference, const Connection&>);
+	static_assert(std::is_convertible_v<AgeList::iterator, AgeList::const_iterator>);
+	static_assert(!std::is_convertible_v<AgeList::const_iterator, AgeList::iterator>);
+	
+	std::vector<Connection> objects;
+	for (int i = 0; i < 6; ++i)
+		objects.emplace_back(i);
+	AgeList list;
+	for (Connection &c : objects)
+		list.add(c);
+	assert(std::distance(list.begin(), list.end()) == 6);
+	assert((--list.end())->id == 5);
+	std::vector<int> backwards;
+	for (auto it = list.end(); it != list.begin();)
+		backwards.push_back((--it)->id);
+	assert((backwards == std::vector<int>{5, 4, 3, 2, 1, 0}));
+	
+	auto found = std::find_if(list.begin(), list.end(), [](const Connection &c) { return c.id == 4; });
+	assert(&*found == &objects[4]);
+	found->id = 40;
+	const AgeList &clist = list;
+	AgeList::const_iterator cit = list.begin();
+	assert(cit == clist.begin() && clist.iterator_to(objects[4])->id == 40);
+	assert(std::count_if(clist.begin(), clist.end(), [](const Connection &c) { return c.id % 2 == 0; }) == 3);
+	list.clear();
+	
+	TEST_PASS("IntrusiveList iterators");
+}
+
+/**
+ * @brief Tests objects linked into several lists
+ * 
+ * @details Verifies that the two hooks of an object are independent,
+ * that unlinking from one list leaves the other intact and that
+ * copying a linked object yields an unlinked copy.
+ * 
+ * @ingroup testing
+ */
+void test_intrusive_list_multiple_hooks() {
+	TEST_GROUP("IntrusiveList multiple hooks");
+	
+	std::vector<Connection> objects;
+	for (int i = 0; i < 6; ++i)
+		objects.emplace_back(i);
+	AgeList ages;
+	StateList idle;
+	for (Connection &c : objects) {
+		ages.add(c);
+		if (c.id % 2 == 0)
+			idle.push_front(c);
+	}
+	assert((ids(ages) == std::vector<int>{0, 1, 2, 3, 4, 5}));
+	assert((ids(idle) == std::vector<int>{4, 2, 0}));
+	
+	idle.remove(objects[2]);
+	ages.remove(objects[4]);
+	assert((ids(ages) == std::vector<int>{0, 1, 2, 3, 5}));
+	assert((ids(idle) == std::vector<int>{4, 0}));
+	assert(objects[4].by_state.is_linked() && !objects[4].by_age.is_linked());
+	
+	Connection copy(objects[0]);
+	assert(!copy.by_age.is_linked() && !copy.by_state.is_linked());
+	objects[0] = Connection(99);
+	assert(objects[0].by_age.is_linked() && ages.front().id == 99);
+	ages.clear();
+	idle.clear();
+	
+	TEST_PASS("IntrusiveList multiple hooks");
+}
+
+/**
+ * @brief Tests IntrusiveList splice and move semantics
+ * 
+ * @details Verifies splicing whole lists and ranges, within one list
+ * and between lists, with sizes kept right, and that moving a list
+ * carries its elements along.
+ * 
+ * @ingroup testing
+ */
+void test_intrusive_list_splice_move() {
+	TEST_GROUP("IntrusiveList splice and move");
+	
+	std::vector<Connection> objects;
+	for (int i = 0; i < 8; ++i)
+		objects.emplace_back(i);
+	AgeList a;
+	AgeList b;
+	for (int i = 0; i < 4; ++i) {
+		a.add(objects[i]);
+		b.add(objects[i + 4]);
+	}
+	a.splice(std::next(a.begin()), b, std::next(b.begin()), std::prev(b.end()));
+	assert((ids(a) == std::vector<int>{0, 5, 6, 1, 2, 3}) && a.size() == 6);
+	assert((ids(b) == std::vector<int>{4, 7}) && b.size() == 2);
+	a.splice(a.begin(), b);
+	assert((ids(a) == std::vector<int>{4, 7, 0, 5, 6, 1, 2, 3}) && b.empty());
+	a.splice(a.end(), a, a.begin(), std::next(a.begin(), 2));
+	assert((ids(a) == std::vector<int>{0, 5, 6, 1, 2, 3, 4, 7}) && a.size() == 8);
+	b.splice(b.end(), a, a.begin(), a.end());
+	assert(a.empty() && b.size() == 8 && b.back().id == 7);
+	
+	AgeList moved(std::move(b));
+	assert(b.empty() && b.begin() == b.end() && moved.size() == 8);
+	assert((ids(moved) == std::vector<int>{0, 5, 6, 1, 2, 3, 4, 7}));
+	assert((--moved.end())->id == 7);
+	moved.remove(objects[0]);
+	a.add(objects[0]);
+	a = std::move(moved);
+	assert(a.size() == 7 && moved.empty() && a.front().id == 5);
+	assert(!objects[0].by_age.is_linked());
+	b.add(objects[0]);
+	assert(b.size() == 1);
+	a.clear();
+	b.clear();
+	
+	TEST_PASS("IntrusiveList splice and move");
+}
+
+int main() {
+	TEST_HEADER("IntrusiveList");
+	
+	try {
+		test_intrusive_list_link_unlink();
+		test_intrusive_list_iterators();
+		test_intrusive_list_multiple_hooks();
+		test_intrusive_list_splice_move();
+	
+		TEST_SUCCESS("IntrusiveList");
+		return 0;
+	} catch (const std::exception& e) {
+		TEST_FAIL(e.what());
+		return 1;
+	}
+}
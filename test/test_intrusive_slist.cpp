@@ -0,0 +1,232 @@
+/**
+ * @file test_intrusive_slist.cpp
+ * @brief Unit tests for IntrusiveSList container
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ * 
+ * @details This file contains unit tests for the IntrusiveSList class,
+ * covering linking and unlinking after positions, iterators,
+ * membership in several lists at once, splicing and moves.
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <cassert>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "test_colors.hpp"
+#include "super_lib.hpp"
+
+/**
+ * @brief Object that can sit on two intrusive lists at once
+ * 
+ * @ingroup testing
+ */
+struct Timer {
+	int					deadline;  ///< Expiry time
+	IntrusiveSListHook	pending;   ///< Link for the pending list
+	IntrusiveSListHook	expired;   ///< Link for the expired list
+
+	Timer(int value) : deadline(value) {}
+};
+
+using PendingList = IntrusiveSList<Timer, &Timer::pending>;  ///< List through pending
+using ExpiredList = IntrusiveSList<Timer, &Timer::expired>;  ///< List through expired
+
+/**
+ * @brief Collects the deadlines of a list into a std::vector
+ * 
+ * @ingroup testing
+ * 
+ * @tparam List Type of list
+ * @param[in] list List to read
+ * @return Deadlines in iteration order
+ */
+template<class List>
+std::vector<int> deadlines(const List &list) {
+	std::vector<int> result;
+	for (const Timer &t : list)
+		result.push_back(t.deadline);
+	return result;
+}
+
+/**
+ * @brief Tests IntrusiveSList linking and unlinking
+ * 
+ * @details Verifies add, push_front, insert_after and erase_after in
+ * the middle, at the back and, through end(), at the front, with the
+ * last element tracked throughout, and that misuse throws.
+ * 
+ * @ingroup testing
+ */
+void test_intrusive_slist_link_unlink() {
+	TEST_GROUP("IntrusiveSList link and unlink");
+	
+	std::vector<Timer> timers;
+	for (int i = 0; i < 5; ++i)
+		timers.emplace_back(i);
+	PendingList list;
+	assert(list.empty() && list.begin() == list.end());
+	list.add(timers[1]);
+	list.push_front(timers[0]);
+	auto it = list.insert_after(list.iterator_to(timers[1]), timers[3]);
+	assert(&*it == &timers[3] && list.back().deadline == 3);
+	list.insert_after(list.iterator_to(timers[1]), timers[2]);
+	list.add(timers[4]);
+	assert((deadlines(list) == std::vector<int>{0, 1, 2, 3, 4}));
+	assert(list.size() == 5 && list.front().deadline == 0 && list.back().deadline == 4);
+	
+	bool thrown = false;
+	try {
+		list.push_front(timers[3]);
+	} catch (const std::invalid_argument&) {
+		thrown = true;
+	}
+	assert(thrown && list.size() == 5);
+	
+	it = list.erase_after(list.iterator_to(timers[1]));
+	assert(it->deadline == 3 && !timers[2].pending.is_linked());
+	it = list.erase_after(it);
+	assert(it == list.end() && list.back().deadline == 3);
+	list.add(timers[2]);
+	assert(list.back().deadline == 2);
+	list.pop_front();
+	assert((deadlines(list) == std::vector<int>{1, 3, 2}));
+	
+	thrown = false;
+	try {
+		list.erase_after(list.iterator_to(timers[2]));
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+	while (!list.empty())
+		list.pop_front();
+	thrown = false;
+	try {
+		list.back();
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+	list.add(timers[0]);
+	assert(list.front().deadline == 0 && list.back().deadline == 0);
+	list.clear();
+	for (const Timer &t : timers)
+		assert(!t.pending.is_linked());
+	
+	TEST_PASS("IntrusiveSList link and unlink");
+}
+
+/**
+ * @brief Tests IntrusiveSList iterators and multiple hooks
+ * 
+ * @details Verifies the iterator category, const iteration, standard
+ * algorithms, and that an object's two hooks are independent.
+ * 
+ * @ingroup testing
+ */
+void test_intrusive_slist_iterators_hooks() {
+	TEST_GROUP("IntrusiveSList iterators and hooks");
+	
+	static_assert(std::is_same_v<std::iterator_traits<PendingList::iterator>::iterator_category, std::forward_iterator_tag>);
+	static_assert(std::is_same_v<std::iterator_traits<PendingList::const_iterator>::reference, const Timer&>);
+	static_assert(std::is_convertible_v<PendingList::iterator, PendingList::const_iterator>);
+	static_assert(!std::is_convertible_v<PendingList::const_iterator, PendingList::iterator>);
+	
+	std::vector<Timer> timers;
+	for (int i = 0; i < 6; ++i)
+		timers.emplace_back(i * 10);
+	PendingList pending;
+	ExpiredList expired;
+	for (Timer &t : timers) {
+		pending.add(t);
+		if (t.deadline < 30)
+			expired.push_front(t);
+	}
+	assert(std::distance(pending.begin(), pending.end()) == 6);
+	assert((deadlines(expired) == std::vector<int>{20, 10, 0}));
+	const PendingList &cpending = pending;
+	assert(std::count_if(cpending.begin(), cpending.end(), [](const Timer &t) { return t.deadline >= 30; }) == 3);
+	auto found = std::find_if(pending.begin(), pending.end(), [](const Timer &t) { return t.deadline == 20; });
+	assert(&*found == &timers[2] && cpending.iterator_to(timers[2]) == found);
+	
+	expired.pop_front();
+	assert(timers[2].pending.is_linked() && !timers[2].expired.is_linked());
+	Timer copy(timers[1]);
+	assert(!copy.pending.is_linked() && !copy.expired.is_linked());
+	pending.clear();
+	expired.clear();
+	
+	TEST_PASS("IntrusiveSList iterators and hooks");
+}
+
+/**
+ * @brief Tests IntrusiveSList splice and move semantics
+ * 
+ * @details Verifies that splice_after relinks a whole list in the
+ * middle, at the front and at the back, and that moving a list carries
+ * its elements along.
+ * 
+ * @ingroup testing
+ */
+void test_intrusive_slist_splice_move() {
+	TEST_GROUP("IntrusiveSList splice and move");
+	
+	std::vector<Timer> timers;
+	for (int i = 0; i < 8; ++i)
+		timers.emplace_back(i);
+	PendingList a;
+	PendingList b;
+	a.add(timers[0]);
+	a.add(timers[3]);
+	b.add(timers[1]);
+	b.add(timers[2]);
+	a.splice_after(a.begin(), b);
+	assert((deadlines(a) == std::vector<int>{0, 1, 2, 3}) && a.size() == 4 && b.empty());
+	b.add(timers[4]);
+	b.add(timers[5]);
+	a.splice_after(a.iterator_to(timers[3]), b);
+	assert(a.back().deadline == 5 && a.size() == 6);
+	b.add(timers[6]);
+	a.splice_after(a.end(), b);
+	assert((deadlines(a) == std::vector<int>{6, 0, 1, 2, 3, 4, 5}));
+	a.splice_after(a.end(), b);
+	assert(a.size() == 7 && b.empty());
+	
+	PendingList moved(std::move(a));
+	assert(a.empty() && a.begin() == a.end() && moved.size() == 7);
+	moved.add(timers[7]);
+	assert(moved.back().deadline == 7);
+	moved.pop_front();
+	a.add(timers[6]);
+	a = std::move(moved);
+	assert(a.size() == 7 && moved.empty() && a.front().deadline == 0);
+	assert(!timers[6].pending.is_linked());
+	moved.add(timers[6]);
+	assert(moved.size() == 1);
+	a.clear();
+	moved.clear();
+	
+	TEST_PASS("IntrusiveSList splice and move");
+}
+
+int main() {
+	TEST_HEADER("IntrusiveSList");
+	
+	try {
+		test_intrusive_slist_link_unlink();
+		test_intrusive_slist_iterators_hooks();
+		test_intrusive_slist_splice_move();
+	
+		TEST_SUCCESS("IntrusiveSList");
+		return 0;
+	} catch (const std::exception& e) {
+		TEST_FAIL(e.what());
+		return 1;
+	}
+}
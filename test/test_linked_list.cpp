@@ -11,10 +11,19 @@
  * @date 2024
  */
 
+#include <algorithm>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <type_traits>
 #include <cassert>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 #include <stdexcept>
 #include "test_colors.hpp"
+#include "test_fixtures.hpp"
 #include "super_lib.hpp"
 
 /**
@@ -495,6 +504,463 @@ void test_linked_list_from_other_collections() {
 	TEST_PASS("LinkedList from other collections");
 }
 
+/**
+ * @brief Tests LinkedList iterator traits and const iteration
+ * 
+ * @details Verifies the forward iterator category, that const_iterator
+ * only gives const access and converts from iterator, and that
+ * standard algorithms work on the list.
+ * 
+ * @ingroup testing
+ */
+void test_linked_list_iterator_traits() {
+	TEST_GROUP("LinkedList iterator traits");
+	
+	using It = LinkedList<int>::iterator;
+	using CIt = LinkedList<int>::const_iterator;
+	static_assert(std::is_same_v<std::iterator_traits<It>::iterator_category, std::forward_iterator_tag>);
+	static_assert(std::is_same_v<std::iterator_traits<CIt>::reference, const int&>);
+	static_assert(std::is_convertible_v<It, CIt>);
+	static_assert(!std::is_convertible_v<CIt, It>);
+	
+	LinkedList<int> list;
+	for (int i = 0; i < 6; ++i)
+		list.add(i * 3);
+	
+	It found = std::find(list.begin(), list.end(), 9);
+	assert(found != list.end() && *found == 9);
+	*found = 10;
+	assert(list[3] == 10);
+	assert(std::distance(list.begin(), list.end()) == 6);
+	
+	const LinkedList<int> &clist = list;
+	CIt cit = list.begin();
+	assert(cit == clist.begin() && list.begin() == cit);
+	assert(*cit++ == 0 && *cit == 3);
+	assert(std::count_if(clist.begin(), clist.end(), [](int x) { return x % 2 == 0; }) == 4);
+	
+	LinkedList<std::pair<int, int>> pairs;
+	pairs.add(std::make_pair(1, 2));
+	assert(pairs.begin()->second == 2);
+	
+	TEST_PASS("LinkedList iterator traits");
+}
+
+int allocations = 0;    ///< allocate() calls made by any CountingAllocator
+int deallocations = 0;  ///< deallocate() calls made by any CountingAllocator
+
+/**
+ * @brief Allocator that counts the allocations it performs
+ * 
+ * @details Used to verify that lists obtain their nodes through the
+ * allocator they are given. The counters are shared by every
+ * instantiation, since lists allocate through a rebound copy.
+ * 
+ * @ingroup testing
+ */
+template<class T>
+struct CountingAllocator {
+	using value_type = T;  ///< Type of allocated objects
+
+	CountingAllocator() = default;
+	template<class U>
+	CountingAllocator(const CountingAllocator<U> &) {}
+
+	T *allocate(std::size_t count) {
+		++allocations;
+		return std::allocator<T>().allocate(count);
+	}
+	void deallocate(T *p, std::size_t count) {
+		++deallocations;
+		std::allocator<T>().deallocate(p, count);
+	}
+	template<class U>
+	bool operator==(const CountingAllocator<U> &) const { return true; }
+	template<class U>
+	bool operator!=(const CountingAllocator<U> &) const { return false; }
+};
+
+
+/**
+ * @brief Tests LinkedList node allocation
+ * 
+ * @details Verifies that a custom allocator sees one allocation per
+ * node, that a pool reuses freed nodes instead of carving new ones,
+ * that copies get their own pool and that moves keep theirs, that
+ * lists built from copies of one allocator share its pool, and that
+ * default lists share the pool for their node size without allocating
+ * when constructed.
+ * 
+ * @ingroup testing
+ */
+void test_linked_list_node_allocator() {
+	TEST_GROUP("LinkedList node allocator");
+	
+	{
+		LinkedList<int, CountingAllocator<int>> list;
+		for (int i = 0; i < 10; ++i)
+			list.add(i);
+		list.insert(5, 100);
+		assert(list.erase(0) == 0);
+		assert(allocations == 11);
+		assert(deallocations == 1);
+	}
+	assert(deallocations == 11);
+	
+	LinkedList<int> list(PoolAllocator<int>(std::make_shared<NodePool>(64)));
+	assert(list.get_allocator().capacity() == 0);
+	for (int i = 0; i < 100; ++i)
+		list.add(i);
+	assert(list.get_allocator().capacity() == 100);
+	for (int round = 0; round < 10; ++round) {
+		for (int i = 0; i < 50; ++i)
+			list.erase(0);
+		for (int i = 0; i < 50; ++i)
+			list.add(i);
+	}
+	list.clear();
+	for (int i = 0; i < 100; ++i)
+		list.insert(0, i);
+	assert(list.get_allocator().capacity() == 100);
+	assert(list.size() == 100 && list[0] == 99 && list[99] == 0);
+	
+	LinkedList<int> copy(list);
+	assert(copy.get_allocator() != list.get_allocator());
+	assert(copy.size() == 100 && copy[0] == 99);
+	LinkedList<int> moved(std::move(copy));
+	assert(moved.size() == 100 && moved.get_allocator().capacity() == 100);
+	assert(copy.empty());
+	copy.add(7);
+	assert(copy.size() == 1 && copy[0] == 7);
+	moved = std::move(list);
+	assert(moved.size() == 100 && moved[99] == 0);
+	
+	LinkedList<std::string> words(3, std::string(40, 'x'), PoolAllocator<std::string>(std::make_shared<NodePool>(64)));
+	words.erase(1);
+	words.add("pooled");
+	assert(words.get_allocator().capacity() == 3 && words.at(2) == "pooled");
+	
+	PoolAllocator<int> shared(std::make_shared<NodePool>(64));
+	PoolAllocator<int> shared_copy(shared);
+	assert(shared == shared_copy && shared != PoolAllocator<int>());
+	LinkedList<int> first(shared), second(shared_copy);
+	assert(first.get_allocator() == second.get_allocator());
+	first.add(1);
+	second.add(2);
+	assert(shared.capacity() == 2 && shared_copy.capacity() == 2);
+	
+	static_assert(std::is_nothrow_default_constructible<LinkedList<int>>::value, "default lists do not allocate");
+	LinkedList<int> defaulted, other_defaulted;
+	assert(defaulted.get_allocator() == other_defaulted.get_allocator());
+	defaulted.add(1);
+	LinkedList<int> defaulted_copy(defaulted);
+	assert(defaulted_copy.get_allocator() == other_defaulted.get_allocator());
+	
+	TEST_PASS("LinkedList node allocator");
+}
+
+/**
+ * @brief Tests LinkedList move assignment between allocators
+ * 
+ * @details Verifies that the nodes are relinked from an equal
+ * allocator and that the elements are moved into new nodes for a
+ * different one.
+ * 
+ * @ingroup testing
+ */
+void test_linked_list_move_allocator() {
+	TEST_GROUP("LinkedList move assignment between allocators");
+	
+	static_assert(std::is_nothrow_move_assignable<LinkedList<int>>::value, "PoolAllocator propagates on move");
+	check_move_allocator<LinkedList<Tracked, TaggedAllocator<Tracked>>>(
+		[](auto &l) {
+			for (int i = 0; i < 5; ++i)
+				l.add(Tracked(i));
+		},
+		[](const auto &l) { return l.head(); });
+	
+	TEST_PASS("LinkedList move assignment between allocators");
+}
+
+/**
+ * @brief Collects the elements of a list into a std::vector
+ * 
+ * @ingroup testing
+ * 
+ * @tparam List Type of list
+ * @param[in] list List to read
+ * @return Elements in iteration order
+ */
+template<class List>
+std::vector<typename List::value_type> contents(const List &list) {
+	return std::vector<typename List::value_type>(list.begin(), list.end());
+}
+
+/**
+ * @brief Tests LinkedList iterator-based insert and erase
+ * 
+ * @details Verifies insert_after and erase_after in the middle, at the
+ * back and, through end(), at the front, with head and tail kept up to
+ * date.
+ * 
+ * @ingroup testing
+ */
+void test_linked_list_insert_erase_after() {
+	TEST_GROUP("LinkedList insert_after and erase_after");
+	
+	LinkedList<int> list;
+	auto it = list.insert_after(list.end(), 2);
+	assert(list.size() == 1 && list.head() == list.tail());
+	it = list.insert_after(it, 4);
+	assert(list.tail()->data == 4);
+	list.insert_after(list.begin(), 3);
+	list.insert_after(list.end(), 1);
+	assert((contents(list) == std::vector<int>{1, 2, 3, 4}));
+	
+	it = list.erase_after(list.begin());
+	assert(*it == 3);
+	it = list.erase_after(it);
+	assert(it == list.end() && list.tail()->data == 3);
+	it = list.erase_after(list.end());
+	assert(*it == 3 && list.head()->data == 3 && list.size() == 1);
+	
+	bool thrown = false;
+	try {
+		list.erase_after(list.begin());
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+	list.erase_after(list.end());
+	assert(list.empty() && list.head() == nullptr && list.tail() == nullptr);
+	list.add(9);
+	assert(list.head() == list.tail() && list[0] == 9);
+	
+	TEST_PASS("LinkedList insert_after and erase_after");
+}
+
+/**
+ * @brief Tests LinkedList splice_after
+ * 
+ * @details Verifies that default lists and lists sharing a pool
+ * exchange nodes without reallocating them, that lists with separate
+ * pools still end up with the right elements, and splicing within one
+ * list.
+ * 
+ * @ingroup testing
+ */
+void test_linked_list_splice() {
+	TEST_GROUP("LinkedList splice_after");
+	
+	LinkedList<int> a;
+	LinkedList<int> b;
+	for (int i = 0; i < 4; ++i) {
+		a.add(i);
+		b.add(10 + i);
+	}
+	const int *moved = &b[1];
+	auto first = b.begin();
+	auto last = b.begin();
+	std::advance(last, 3);
+	a.splice_after(a.begin(), b, first, last);
+	assert((contents(a) == std::vector<int>{0, 11, 12, 1, 2, 3}));
+	assert((contents(b) == std::vector<int>{10, 13}));
+	assert(&a[1] == moved && a.size() == 6 && b.size() == 2);
+	
+	a.splice_after(a.end(), b);
+	assert((contents(a) == std::vector<int>{10, 13, 0, 11, 12, 1, 2, 3}));
+	assert(b.empty() && b.head() == nullptr && b.tail() == nullptr);
+	b.splice_after(b.end(), a, a.begin(), a.end());
+	assert((contents(a) == std::vector<int>{10}) && a.tail() == a.head());
+	assert(b.size() == 7 && b.tail()->data == 3);
+	
+	auto pos = b.begin();
+	std::advance(pos, 6);
+	b.splice_after(pos, b, b.end(), std::next(b.begin(), 2));
+	assert((contents(b) == std::vector<int>{11, 12, 1, 2, 3, 13, 0}));
+	assert(b.tail()->data == 0 && b.size() == 7);
+	
+	LinkedList<int> sorted;
+	LinkedList<int> extra;
+	sorted.add(1);
+	sorted.add(3);
+	extra.add(2);
+	moved = &extra[0];
+	sorted.merge(extra);
+	assert((contents(sorted) == std::vector<int>{1, 2, 3}) && &sorted[1] == moved && extra.empty());
+	
+	LinkedList<std::string> pooled(PoolAllocator<std::string>(std::make_shared<NodePool>(64)));
+	LinkedList<std::string> other(PoolAllocator<std::string>(std::make_shared<NodePool>(64)));
+	pooled.add("a");
+	pooled.add("d");
+	other.add("b");
+	other.add("c");
+	assert(pooled.get_allocator() != other.get_allocator());
+	pooled.splice_after(pooled.begin(), other);
+	assert((contents(pooled) == std::vector<std::string>{"a", "b", "c", "d"}));
+	assert(other.empty() && pooled.size() == 4);
+	other.add("e");
+	assert(other.size() == 1 && other[0] == "e");
+	
+	PoolAllocator<std::string> shared(std::make_shared<NodePool>(64));
+	LinkedList<std::string> left(shared);
+	LinkedList<std::string> right(shared);
+	left.add("a");
+	left.add("d");
+	right.add("b");
+	right.add("c");
+	const std::string *kept = &right[0];
+	left.splice_after(left.begin(), right);
+	assert((contents(left) == std::vector<std::string>{"a", "b", "c", "d"}));
+	assert(&left[1] == kept && right.empty());
+	right.add("e");
+	kept = &right[0];
+	left.merge(right);
+	assert(&left[4] == kept && left.size() == 5 && right.empty());
+	assert(shared.capacity() == 5);
+	
+	TEST_PASS("LinkedList splice_after");
+}
+
+/**
+ * @brief Tests LinkedList merge and sort
+ * 
+ * @details Verifies that merge interleaves two sorted lists stably,
+ * that sort matches std::stable_sort on random and presorted input,
+ * that sorting keeps element addresses and that custom comparators
+ * work.
+ * 
+ * @ingroup testing
+ */
+void test_linked_list_merge_sort() {
+	TEST_GROUP("LinkedList merge and sort");
+	
+	using Pair = std::pair<int, int>;
+	auto by_key = [](const Pair &x, const Pair &y) { return x.first < y.first; };
+	LinkedList<Pair> left;
+	LinkedList<Pair> right;
+	for (int i = 0; i < 5; ++i) {
+		left.add(Pair(i * 2, 0));
+		right.add(Pair(i * 3, 1));
+	}
+	left.merge(right, by_key);
+	assert(right.empty() && left.size() == 10);
+	std::vector<Pair> merged = contents(left);
+	assert(std::is_sorted(merged.begin(), merged.end(), by_key));
+	assert(merged[0] == Pair(0, 0) && merged[1] == Pair(0, 1));
+	assert(left.tail()->data == Pair(12, 1));
+	
+	LinkedList<int, std::allocator<int>> numbers;
+	std::vector<int> expected;
+	unsigned seed = 7;
+	for (int i = 0; i < 1000; ++i) {
+		seed = seed * 1103515245 + 12345;
+		numbers.add(static_cast<int>(seed >> 16) % 100);
+		expected.push_back(numbers.tail()->data);
+	}
+	const int *first_address = &numbers[0];
+	int first_value = numbers[0];
+	numbers.sort();
+	std::stable_sort(expected.begin(), expected.end());
+	assert(contents(numbers) == expected);
+	assert(numbers.tail()->data == expected.back() && numbers.size() == 1000);
+	assert(*std::find_if(numbers.begin(), numbers.end(), [&](const int &x) { return &x == first_address; }) == first_value);
+	
+	numbers.sort(std::greater<int>());
+	std::reverse(expected.begin(), expected.end());
+	assert(contents(numbers) == expected);
+	numbers.sort(std::greater<int>());
+	assert(contents(numbers) == expected);
+	
+	LinkedList<Pair> pairs;
+	for (int i = 0; i < 50; ++i)
+		pairs.add(Pair((i * 7) % 5, i));
+	pairs.sort(by_key);
+	std::vector<Pair> sorted = contents(pairs);
+	for (unsigned long i = 1; i < sorted.size(); ++i)
+		assert(sorted[i - 1].first < sorted[i].first || (sorted[i - 1].first == sorted[i].first && sorted[i - 1].second < sorted[i].second));
+	
+	LinkedList<int> empty;
+	empty.sort();
+	LinkedList<int> single(1, 5);
+	single.sort();
+	single.merge(empty);
+	assert(single.size() == 1 && empty.empty());
+	empty.merge(single);
+	assert(empty.size() == 1 && empty.tail()->data == 5 && single.empty());
+	
+	TEST_PASS("LinkedList merge and sort");
+}
+
+/**
+ * @brief Tests LinkedList index access through the cached cursor
+ * 
+ * @details Verifies that index loops, index-based insert and erase and
+ * iterator-based operations interleaved with index access always see
+ * the right elements, and that a long ascending loop finishes quickly.
+ * 
+ * @ingroup testing
+ */
+void test_linked_list_cursor() {
+	TEST_GROUP("LinkedList cached cursor");
+	
+	LinkedList<int> list;
+	std::vector<int> expected;
+	for (int i = 0; i < 20000; ++i) {
+		list.add(i);
+		expected.push_back(i);
+	}
+	long long sum = 0;
+	for (unsigned long i = 0; i < list.size(); ++i)
+		sum += list[i];
+	assert(sum == 19999LL * 20000 / 2);
+	
+	auto check = [&]() {
+		assert(list.size() == expected.size());
+		for (unsigned long i = 0; i < expected.size(); i += 97)
+			assert(list[i] == expected[i] && list.at(i) == expected[i]);
+		assert(contents(list) == expected);
+	};
+	assert(list[500] == 500);
+	list.insert(0, -5);
+	expected.insert(expected.begin(), -5);
+	assert(list[501] == 500);
+	list.insert(300, -7);
+	expected.insert(expected.begin() + 300, -7);
+	check();
+	assert(list[1000] == expected[1000]);
+	list.erase(0);
+	expected.erase(expected.begin());
+	assert(list[999] == expected[999]);
+	assert(list.erase(999) == expected[999]);
+	expected.erase(expected.begin() + 999);
+	check();
+	for (unsigned long i = 10; i < 2000; i += 2) {
+		list.insert(i, static_cast<int>(i));
+		expected.insert(expected.begin() + i, static_cast<int>(i));
+	}
+	check();
+	list.insert_after(list.begin(), -1);
+	expected.insert(expected.begin() + 1, -1);
+	check();
+	list.erase_after(list.begin());
+	expected.erase(expected.begin() + 1);
+	check();
+	list.sort(std::greater<int>());
+	std::sort(expected.begin(), expected.end(), std::greater<int>());
+	check();
+	
+	LinkedList<int> moved(std::move(list));
+	assert(moved[10] == expected[10] && list.empty());
+	list.add(1);
+	assert(list[0] == 1 && list.at(0) == 1);
+	moved.clear();
+	moved.add(2);
+	assert(moved[0] == 2);
+	
+	TEST_PASS("LinkedList cached cursor");
+}
+
 int main() {
 	TEST_HEADER("LinkedList");
 	
@@ -512,6 +978,13 @@ int main() {
 		test_linked_list_alternating_ops();
 		test_linked_list_iterators();
 		test_linked_list_from_other_collections();
+		test_linked_list_iterator_traits();
+		test_linked_list_node_allocator();
+		test_linked_list_move_allocator();
+		test_linked_list_insert_erase_after();
+		test_linked_list_splice();
+		test_linked_list_merge_sort();
+		test_linked_list_cursor();
 		
 		TEST_SUCCESS("LinkedList");
 		return 0;
@@ -0,0 +1,222 @@
+/**
+ * @file test_mpmc_queue.cpp
+ * @brief Unit tests for MpmcQueue concurrent container class
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ * 
+ * @details This file contains unit tests for the MpmcQueue class,
+ * covering single-threaded FIFO semantics, batch operations, element
+ * lifetime and several producers and consumers running at once.
+ */
+
+#include <iostream>
+#include <cassert>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "test_colors.hpp"
+#include "test_fixtures.hpp"
+#include "super_lib.hpp"
+
+/**
+ * @brief Tests MpmcQueue on a single thread
+ * 
+ * @details Verifies capacity rounding, FIFO order across several laps
+ * of the ring, and that operations fail when full or empty.
+ * 
+ * @ingroup testing
+ */
+void test_mpmc_queue_basic() {
+	TEST_GROUP("MpmcQueue basic operations");
+	
+	MpmcQueue<int> q(3);
+	assert(q.capacity() == 4 && q.empty());
+	assert(MpmcQueue<int>(1).capacity() == 2);
+	int out = -1;
+	assert(!q.try_dequeue(out) && out == -1);
+	
+	for (int lap = 0; lap < 5; ++lap) {
+		for (int i = 0; i < 4; ++i)
+			assert(q.try_enqueue(lap * 10 + i));
+		assert(!q.try_enqueue(99) && q.size() == 4);
+		for (int i = 0; i < 4; ++i)
+			assert(q.try_dequeue(out) && out == lap * 10 + i);
+		assert(q.empty());
+	}
+	
+	MpmcQueue<std::string> words(4);
+	std::string word = "moved";
+	assert(words.try_enqueue(std::move(word)) && word.empty());
+	assert(words.try_emplace(3, 'x'));
+	words.enqueue(std::string("blocking"));
+	std::string got;
+	words.dequeue(got);
+	assert(got == "moved");
+	assert(words.try_dequeue(got) && got == "xxx");
+	words.dequeue(got);
+	assert(got == "blocking");
+	
+	TEST_PASS("MpmcQueue basic operations");
+}
+
+/**
+ * @brief Tests MpmcQueue batch operations
+ * 
+ * @details Verifies that batches claim as many positions as are ready
+ * and keep FIFO order across the wrap point.
+ * 
+ * @ingroup testing
+ */
+void test_mpmc_queue_batches() {
+	TEST_GROUP("MpmcQueue batch operations");
+	
+	MpmcQueue<int> q(8);
+	int values[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+	int out[10] = {};
+	assert(q.try_enqueue_n(values, 6) == 6);
+	assert(q.try_dequeue_n(out, 4) == 4 && out[3] == 3);
+	assert(q.try_enqueue_n(values, 10) == 6);
+	assert(q.try_enqueue_n(values, 1) == 0);
+	assert(q.try_dequeue_n(out, 10) == 8);
+	int expected[] = {4, 5, 0, 1, 2, 3, 4, 5};
+	for (int i = 0; i < 8; ++i)
+		assert(out[i] == expected[i]);
+	assert(q.try_dequeue_n(out, 3) == 0);
+	
+	MpmcQueue<std::string> words(4);
+	std::string input[] = {"a", "b", "c"};
+	assert(words.try_enqueue_n(input, 3) == 3);
+	std::string taken[3];
+	assert(words.try_dequeue_n(taken, 3) == 3 && taken[2] == "c");
+	
+	TEST_PASS("MpmcQueue batch operations");
+}
+
+/**
+ * @brief Tests MpmcQueue element lifetime management
+ * 
+ * @details Cycles every slot through several sequence numbers with
+ * batch enqueues and dequeues, and verifies that a rejected enqueue
+ * leaves no element behind, that dequeues destroy what they take, and
+ * that the destructor finds the queued elements by their sequence
+ * numbers after the positions have wrapped.
+ * 
+ * @ingroup testing
+ */
+void test_mpmc_queue_element_lifetime() {
+	TEST_GROUP("MpmcQueue element lifetime");
+	
+	{
+		MpmcQueue<Tracked> q(4);
+		Tracked items[4] = {0, 1, 2, 3};
+		Tracked out[4];
+		for (int round = 0; round < 5; ++round) {
+			assert(q.try_enqueue_n(items, 4) == 4 && Tracked::live == 12);
+			assert(!q.try_emplace(9) && Tracked::live == 12);
+			assert(q.try_dequeue_n(out, 3) == 3 && out[2].value == 2);
+			assert(q.try_dequeue(out[3]) && out[3].value == 3);
+			assert(Tracked::live == 8);
+		}
+		q.try_emplace(5);
+		q.try_emplace(6);
+		assert(Tracked::live == 10);
+	}
+	assert(Tracked::live == 0);
+	
+	TEST_PASS("MpmcQueue element lifetime");
+}
+
+/**
+ * @brief Tests MpmcQueue with several producers and consumers
+ * 
+ * @details Four producers push disjoint ranges, partly in batches,
+ * through a small queue while four consumers drain it. Every value
+ * must arrive exactly once, and the values of each producer must
+ * arrive in the order it sent them to any one consumer.
+ * 
+ * @ingroup testing
+ */
+void test_mpmc_queue_threads() {
+	TEST_GROUP("MpmcQueue producers and consumers");
+	
+	const int producers = 4;
+	const int consumers = 4;
+	const long per_producer = 50000;
+	MpmcQueue<long> q(256);
+	std::vector<std::thread> threads;
+	for (int p = 0; p < producers; ++p) {
+		threads.emplace_back([&q, p, per_producer]() {
+			long base = p * per_producer;
+			long next = 0;
+			long batch[8];
+			while (next < per_producer) {
+				if (next % 3 == 0 && per_producer - next >= 8) {
+					for (int i = 0; i < 8; ++i)
+						batch[i] = base + next + i;
+					unsigned long pushed = q.try_enqueue_n(batch, 8);
+					if (pushed == 0)
+						std::this_thread::yield();
+					next += pushed;
+				}
+				else
+					q.enqueue(base + next++);
+			}
+		});
+	}
+	
+	std::vector<std::vector<char>> seen(consumers, std::vector<char>(producers * per_producer, 0));
+	std::vector<char> ordered(consumers, 1);
+	std::atomic<long> received(0);
+	for (int c = 0; c < consumers; ++c) {
+		threads.emplace_back([&, c]() {
+			std::vector<long> last(producers, -1);
+			long batch[16];
+			while (received.load() < producers * per_producer) {
+				unsigned long got = q.try_dequeue_n(batch, 16);
+				if (got == 0)
+					std::this_thread::yield();
+				for (unsigned long i = 0; i < got; ++i) {
+					long producer = batch[i] / per_producer;
+					if (batch[i] <= last[producer])
+						ordered[c] = 0;
+					last[producer] = batch[i];
+					seen[c][batch[i]] = 1;
+				}
+				received += got;
+			}
+		});
+	}
+	for (auto &thread : threads)
+		thread.join();
+	
+	for (int c = 0; c < consumers; ++c)
+		assert(ordered[c]);
+	for (long v = 0; v < producers * per_producer; ++v) {
+		int count = 0;
+		for (int c = 0; c < consumers; ++c)
+			count += seen[c][v];
+		assert(count == 1);
+	}
+	assert(q.empty());
+	
+	TEST_PASS("MpmcQueue producers and consumers");
+}
+
+int main() {
+	TEST_HEADER("MpmcQueue");
+	
+	try {
+		test_mpmc_queue_basic();
+		test_mpmc_queue_batches();
+		test_mpmc_queue_element_lifetime();
+		test_mpmc_queue_threads();
+		
+		TEST_SUCCESS("MpmcQueue");
+		return 0;
+	} catch (const std::exception& e) {
+		TEST_FAIL(e.what());
+		return 1;
+	}
+}
@@ -0,0 +1,207 @@
+/**
+ * @file test_mpsc_queue.cpp
+ * @brief Unit tests for MpscQueue concurrent container class
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ * 
+ * @details This file contains unit tests for the MpscQueue class,
+ * covering single-threaded FIFO semantics, node recycling, element
+ * lifetime and several producers feeding one consumer.
+ */
+
+#include <iostream>
+#include <cassert>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "test_colors.hpp"
+#include "test_fixtures.hpp"
+#include "super_lib.hpp"
+
+/**
+ * @brief Tests MpscQueue on a single thread
+ * 
+ * @details Verifies FIFO order, move and emplace insertion, and batch
+ * dequeues.
+ * 
+ * @ingroup testing
+ */
+void test_mpsc_queue_basic() {
+	TEST_GROUP("MpscQueue basic operations");
+	
+	MpscQueue<int> q;
+	int out = -1;
+	assert(q.empty() && !q.try_dequeue(out) && out == -1);
+	
+	for (int i = 0; i < 100; ++i)
+		q.enqueue(i);
+	assert(!q.empty());
+	for (int i = 0; i < 40; ++i)
+		assert(q.try_dequeue(out) && out == i);
+	int batch[100] = {};
+	assert(q.try_dequeue_n(batch, 100) == 60);
+	assert(batch[0] == 40 && batch[59] == 99);
+	assert(q.empty() && q.try_dequeue_n(batch, 5) == 0);
+	
+	MpscQueue<std::string> words;
+	std::string word = "moved";
+	words.enqueue(std::move(word));
+	assert(word.empty());
+	words.emplace(3, 'x');
+	std::string got;
+	assert(words.try_dequeue(got) && got == "moved");
+	assert(words.try_dequeue(got) && got == "xxx");
+	assert(!words.try_dequeue(got));
+	
+	TEST_PASS("MpscQueue basic operations");
+}
+
+/**
+ * @brief Tests that MpscQueue reuses its nodes
+ * 
+ * @details Verifies that reserve() obtains nodes up front and that
+ * repeated enqueue/dequeue cycles never obtain more nodes than the
+ * largest number queued at once.
+ * 
+ * @ingroup testing
+ */
+void test_mpsc_queue_node_recycling() {
+	TEST_GROUP("MpscQueue node recycling");
+	
+	MpscQueue<int> q;
+	q.reserve(200);
+	assert(q.node_capacity() == 200);
+	int out;
+	for (int round = 0; round < 1000; ++round) {
+		for (int i = 0; i < 150; ++i)
+			q.enqueue(i);
+		for (int i = 0; i < 150; ++i)
+			assert(q.try_dequeue(out) && out == i);
+	}
+	assert(q.node_capacity() == 200);
+	
+	MpscQueue<int> growing;
+	for (int i = 0; i < 5000; ++i)
+		growing.enqueue(i);
+	unsigned long nodes = growing.node_capacity();
+	assert(nodes == 5001);
+	for (int i = 0; i < 5000; ++i)
+		assert(growing.try_dequeue(out) && out == i);
+	for (int i = 0; i < 5000; ++i)
+		growing.enqueue(i);
+	assert(growing.node_capacity() == nodes);
+	
+	TEST_PASS("MpscQueue node recycling");
+}
+
+/**
+ * @brief Tests MpscQueue element lifetime management
+ * 
+ * @details Verifies that dequeued elements are destroyed, that the
+ * destructor destroys the elements still queued and that a throwing
+ * constructor leaves the queue unchanged.
+ * 
+ * @ingroup testing
+ */
+void test_mpsc_queue_element_lifetime() {
+	TEST_GROUP("MpscQueue element lifetime");
+	
+	{
+		MpscQueue<Tracked> q;
+		for (int i = 0; i < 3; ++i)
+			q.emplace(i);
+		assert(Tracked::live == 3);
+		bool thrown = false;
+		try {
+			q.emplace(-1);
+		}
+		catch (const std::runtime_error &) {
+			thrown = true;
+		}
+		assert(thrown && Tracked::live == 3);
+		Tracked out;
+		assert(q.try_dequeue(out) && out.value == 0);
+		assert(Tracked::live == 3);
+		assert(q.try_dequeue(out) && out.value == 1);
+		assert(q.try_dequeue(out) && out.value == 2);
+		assert(!q.try_dequeue(out));
+		q.emplace(7);
+		q.emplace(8);
+	}
+	assert(Tracked::live == 0);
+	
+	TEST_PASS("MpscQueue element lifetime");
+}
+
+/**
+ * @brief Tests MpscQueue with several producers and one consumer
+ * 
+ * @details Four producers push disjoint ranges while the consumer
+ * drains the queue in batches. Every value must arrive exactly once
+ * and the values of each producer in the order it sent them.
+ * 
+ * @ingroup testing
+ */
+void test_mpsc_queue_threads() {
+	TEST_GROUP("MpscQueue producers and consumer");
+	
+	const int producers = 4;
+	const long per_producer = 50000;
+	MpscQueue<long> q;
+	std::vector<std::thread> threads;
+	for (int p = 0; p < producers; ++p) {
+		threads.emplace_back([&q, p, per_producer]() {
+			for (long i = 0; i < per_producer; ++i) {
+				q.enqueue(p * per_producer + i);
+				if (i % 64 == 0)
+					std::this_thread::yield();
+			}
+		});
+	}
+	
+	std::vector<char> seen(producers * per_producer, 0);
+	std::vector<long> last(producers, -1);
+	bool ordered = true;
+	long received = 0;
+	long batch[32];
+	while (received < producers * per_producer) {
+		unsigned long got = q.try_dequeue_n(batch, 32);
+		if (got == 0)
+			std::this_thread::yield();
+		for (unsigned long i = 0; i < got; ++i) {
+			long producer = batch[i] / per_producer;
+			if (batch[i] <= last[producer])
+				ordered = false;
+			last[producer] = batch[i];
+			++seen[batch[i]];
+		}
+		received += got;
+	}
+	for (auto &thread : threads)
+		thread.join();
+	
+	assert(ordered && q.empty());
+	for (long v = 0; v < producers * per_producer; ++v)
+		assert(seen[v] == 1);
+	
+	TEST_PASS("MpscQueue producers and consumer");
+}
+
+int main() {
+	TEST_HEADER("MpscQueue");
+	
+	try {
+		test_mpsc_queue_basic();
+		test_mpsc_queue_node_recycling();
+		test_mpsc_queue_element_lifetime();
+		test_mpsc_queue_threads();
+		
+		TEST_SUCCESS("MpscQueue");
+		return 0;
+	} catch (const std::exception& e) {
+		TEST_FAIL(e.what());
+		return 1;
+	}
+}
@@ -11,10 +11,16 @@
  * @date 2024
  */
 
+#include <algorithm>
 #include <iostream>
+#include <iterator>
+#include <type_traits>
 #include <cassert>
+#include <memory>
+#include <utility>
 #include <stdexcept>
 #include "test_colors.hpp"
+#include "test_fixtures.hpp"
 #include "super_lib.hpp"
 
 /**
@@ -468,6 +474,118 @@ void test_queue_from_other_collections() {
 	TEST_PASS("Queue from other collections");
 }
 
+/**
+ * @brief Tests Queue iterator traits and const iteration
+ * 
+ * @details Verifies the bidirectional iterator category, stepping back
+ * from end(), that const_iterator only gives const access and converts
+ * from iterator, and that standard algorithms work on the container.
+ * 
+ * @ingroup testing
+ */
+void test_queue_iterator_traits() {
+	TEST_GROUP("Queue iterator traits");
+	
+	using It = Queue<int>::iterator;
+	using CIt = Queue<int>::const_iterator;
+	static_assert(std::is_same_v<std::iterator_traits<It>::iterator_category, std::bidirectional_iterator_tag>);
+	static_assert(std::is_same_v<std::iterator_traits<CIt>::reference, const int&>);
+	static_assert(std::is_convertible_v<It, CIt>);
+	static_assert(!std::is_convertible_v<CIt, It>);
+	
+	Queue<int> c;
+	for (int i = 1; i <= 5; ++i)
+		c.enqueue(i);
+	
+	It last = c.end();
+	--last;
+	assert(*last == 5);
+	assert(*--last == 4);
+	assert(*last-- == 4 && *last == 3);
+	
+	std::reverse(c.begin(), c.end());
+	assert(c[0] == 5 && c[4] == 1);
+	
+	const Queue<int> &cc = c;
+	CIt cit = c.end();
+	assert(cit == cc.end() && c.end() == cit);
+	assert(*std::prev(cit) == 1);
+	assert(std::distance(cc.begin(), cc.end()) == 5);
+	assert(*std::max_element(cc.begin(), cc.end()) == 5);
+	
+	Queue<int> empty;
+	assert(empty.begin() == empty.end());
+	
+	TEST_PASS("Queue iterator traits");
+}
+
+/**
+ * @brief Tests Queue node allocation
+ * 
+ * @details Verifies that a pool reuses freed nodes instead of carving
+ * new ones, that copies get their own pool, that moves keep theirs,
+ * that default queues share one pool without allocating when
+ * constructed, and that std::allocator can be plugged in instead.
+ * 
+ * @ingroup testing
+ */
+void test_queue_node_allocator() {
+	TEST_GROUP("Queue node allocator");
+	
+	Queue<int> queue(PoolAllocator<int>(std::make_shared<NodePool>(64)));
+	assert(queue.get_allocator().capacity() == 0);
+	for (int i = 0; i < 64; ++i)
+		queue.enqueue(i);
+	for (int round = 0; round < 20; ++round) {
+		for (int i = 0; i < 32; ++i)
+			queue.dequeue();
+		for (int i = 0; i < 32; ++i)
+			queue.enqueue(i);
+	}
+	assert(queue.get_allocator().capacity() == 64 && queue.size() == 64);
+	
+	Queue<int> copy(queue);
+	assert(copy.get_allocator() != queue.get_allocator() && copy.size() == 64);
+	Queue<int> moved(std::move(copy));
+	assert(copy.empty() && moved.size() == 64 && moved.get_allocator().capacity() == 64);
+	copy.enqueue(5);
+	assert(copy.size() == 1 && copy[0] == 5);
+	moved = std::move(queue);
+	assert(moved.size() == 64 && queue.empty());
+	
+	static_assert(std::is_nothrow_default_constructible<Queue<int>>::value, "default queues do not allocate");
+	assert(Queue<int>().get_allocator() == Queue<int>().get_allocator());
+	
+	Queue<int, std::allocator<int>> plain(3, 9, std::allocator<int>());
+	plain.enqueue(4);
+	assert(plain.size() == 4 && plain[3] == 4);
+	
+	TEST_PASS("Queue node allocator");
+}
+
+/**
+ * @brief Tests Queue move assignment between allocators
+ * 
+ * @details Verifies that the nodes are relinked from an equal
+ * allocator and that the elements are moved into new nodes for a
+ * different one.
+ * 
+ * @ingroup testing
+ */
+void test_queue_move_allocator() {
+	TEST_GROUP("Queue move assignment between allocators");
+	
+	static_assert(std::is_nothrow_move_assignable<Queue<int>>::value, "PoolAllocator propagates on move");
+	check_move_allocator<Queue<Tracked, TaggedAllocator<Tracked>>>(
+		[](auto &q) {
+			for (int i = 0; i < 5; ++i)
+				q.enqueue(Tracked(i));
+		},
+		[](const auto &q) { return q.head(); });
+	
+	TEST_PASS("Queue move assignment between allocators");
+}
+
 int main() {
 	TEST_HEADER("Queue");
 	
@@ -484,6 +602,9 @@ int main() {
 		test_queue_pointer_integrity();
 		test_queue_iterators();
 		test_queue_from_other_collections();
+		test_queue_iterator_traits();
+		test_queue_node_allocator();
+		test_queue_move_allocator();
 		
 		TEST_SUCCESS("Queue");
 		return 0;
@@ -0,0 +1,297 @@
+/**
+ * @file test_ring_buffer.cpp
+ * @brief Unit tests for RingBuffer container class
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2025-01-28
+ * 
+ * @details This file contains unit tests for the RingBuffer class,
+ * covering the fixed and run-time capacity variants, reject and
+ * overwrite modes, wrap-around access, iteration, copy and move
+ * semantics and element lifetime.
+ */
+
+#include <iostream>
+#include <cassert>
+#include <stdexcept>
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include "test_colors.hpp"
+#include "test_fixtures.hpp"
+#include "super_lib.hpp"
+
+/**
+ * @brief Tests RingBuffer constructors
+ * 
+ * @details Verifies capacity, mode and storage placement of the fixed
+ * and run-time sized variants.
+ * 
+ * @ingroup testing
+ */
+void test_ring_buffer_constructor() {
+	TEST_GROUP("RingBuffer constructors");
+	
+	RingBuffer<int, 8> fixed;
+	assert(fixed.size() == 0 && fixed.capacity() == 8);
+	assert(fixed.empty() && !fixed.full());
+	assert(fixed.mode() == RingBufferMode::reject);
+	static_assert(RingBuffer<int, 8>::fixed_capacity);
+	static_assert(sizeof(RingBuffer<int, 8>) >= 8 * sizeof(int));
+	
+	RingBuffer<int> dynamic(5, RingBufferMode::overwrite);
+	assert(dynamic.capacity() == 5 && dynamic.empty());
+	assert(dynamic.mode() == RingBufferMode::overwrite);
+	static_assert(!RingBuffer<int>::fixed_capacity);
+	
+	TEST_PASS("RingBuffer constructors");
+}
+
+/**
+ * @brief Tests reject mode
+ * 
+ * @details Fills the buffer, checks that further pushes are refused
+ * without changing the contents, and that FIFO order holds across the
+ * wrap point.
+ * 
+ * @ingroup testing
+ */
+void test_ring_buffer_reject() {
+	TEST_GROUP("RingBuffer reject mode");
+	
+	RingBuffer<int, 4> r;
+	for (int i = 0; i < 4; ++i)
+		assert(r.push(i));
+	assert(r.full());
+	assert(!r.push(4));
+	assert(!r.emplace(5));
+	assert(r.size() == 4 && r.front() == 0 && r.back() == 3);
+	
+	assert(r.pop() == 0);
+	assert(r.pop() == 1);
+	assert(r.push(4) && r.push(5));
+	for (int i = 0; i < 4; ++i)
+		assert(r[i] == i + 2 && r.at(i) == i + 2);
+	
+	int out = -1;
+	assert(r.try_pop(out) && out == 2);
+	r.clear();
+	assert(r.empty() && !r.try_pop(out) && out == 2);
+	
+	bool thrown = false;
+	try {
+		r.pop();
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+	thrown = false;
+	try {
+		r.front();
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+	thrown = false;
+	try {
+		r.at(0);
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+	
+	TEST_PASS("RingBuffer reject mode");
+}
+
+/**
+ * @brief Tests overwrite mode
+ * 
+ * @details Pushes past capacity and checks that the oldest elements
+ * are replaced, including when the new value refers to an element of
+ * the buffer itself.
+ * 
+ * @ingroup testing
+ */
+void test_ring_buffer_overwrite() {
+	TEST_GROUP("RingBuffer overwrite mode");
+	
+	RingBuffer<int> r(3, RingBufferMode::overwrite);
+	assert(r.emplace(0));
+	for (int i = 1; i < 10; ++i)
+		assert(r.push(i));
+	assert(r.size() == 3 && r.full());
+	assert(r[0] == 7 && r[1] == 8 && r[2] == 9);
+	
+	r.push(r.front());
+	assert(r[0] == 8 && r[2] == 7);
+	
+	RingBuffer<std::string, 2> words(RingBufferMode::overwrite);
+	words.push("one");
+	words.push("two");
+	words.push("three");
+	assert(words.front() == "two" && words.back() == "three");
+	assert(words.pop() == "two");
+	
+	RingBuffer<int> none(0, RingBufferMode::overwrite);
+	assert(!none.push(1) && none.empty());
+	
+	TEST_PASS("RingBuffer overwrite mode");
+}
+
+/**
+ * @brief Tests RingBuffer iterators
+ * 
+ * @details Verifies that iteration runs from oldest to newest across
+ * the wrap point and that random access algorithms work.
+ * 
+ * @ingroup testing
+ */
+void test_ring_buffer_iterators() {
+	TEST_GROUP("RingBuffer iterators");
+	
+	using Ring = RingBuffer<int, 5>;
+	static_assert(std::is_same_v<std::iterator_traits<Ring::iterator>::iterator_category,
+		std::random_access_iterator_tag>);
+	static_assert(std::is_convertible_v<Ring::iterator, Ring::const_iterator>);
+	
+	Ring r(RingBufferMode::overwrite);
+	for (int i = 0; i < 8; ++i)
+		r.push(i);
+	int expected = 3;
+	for (int x : r)
+		assert(x == expected++);
+	assert(r.end() - r.begin() == 5 && r.begin()[4] == 7);
+	
+	std::reverse(r.begin(), r.end());
+	assert(r.front() == 7 && r.back() == 3);
+	std::sort(r.begin(), r.end());
+	const Ring &cr = r;
+	assert(std::is_sorted(cr.begin(), cr.end()));
+	assert(*std::lower_bound(cr.begin(), cr.end(), 5) == 5);
+	
+	TEST_PASS("RingBuffer iterators");
+}
+
+/**
+ * @brief Tests RingBuffer copy and move semantics
+ * 
+ * @details Verifies deep copies of both variants, that moving a
+ * run-time sized buffer takes over its storage, and that assignment
+ * adopts the capacity and mode of the source. A buffer whose
+ * allocator does not propagate takes over storage only from an equal
+ * allocator and otherwise moves the elements into its own.
+ * 
+ * @ingroup testing
+ */
+void test_ring_buffer_copy_move() {
+	TEST_GROUP("RingBuffer copy and move");
+	
+	RingBuffer<int, 4> fixed(RingBufferMode::overwrite);
+	for (int i = 0; i < 6; ++i)
+		fixed.push(i);
+	RingBuffer<int, 4> fixed_copy(fixed);
+	assert(fixed_copy.size() == 4 && fixed_copy[0] == 2 && fixed_copy[3] == 5);
+	assert(fixed_copy.mode() == RingBufferMode::overwrite);
+	fixed_copy[0] = 99;
+	assert(fixed[0] == 2);
+	RingBuffer<int, 4> fixed_moved(std::move(fixed));
+	assert(fixed_moved.size() == 4 && fixed_moved[3] == 5);
+	assert(fixed.empty() && fixed.capacity() == 4);
+	fixed = fixed_copy;
+	assert(fixed[0] == 99);
+	
+	RingBuffer<int> dynamic(3);
+	dynamic.push(1);
+	dynamic.push(2);
+	const int *storage = &dynamic.front();
+	RingBuffer<int> stolen(std::move(dynamic));
+	assert(&stolen.front() == storage && stolen.size() == 2);
+	assert(dynamic.capacity() == 0 && !dynamic.push(3));
+	
+	RingBuffer<int> other(10, RingBufferMode::overwrite);
+	other.push(7);
+	stolen = other;
+	assert(stolen.capacity() == 10 && stolen.size() == 1 && stolen[0] == 7);
+	assert(stolen.mode() == RingBufferMode::overwrite);
+	dynamic = std::move(stolen);
+	assert(dynamic.capacity() == 10 && dynamic[0] == 7);
+	
+	static_assert(std::is_nothrow_move_assignable<RingBuffer<int>>::value, "std::allocator never needs a fallback");
+	static_assert(!std::is_nothrow_move_assignable<RingBuffer<int, dynamic_capacity, TaggedAllocator<int>>>::value,
+		"unequal allocators fall back to moving elements");
+	{
+		RingBuffer<Tracked, dynamic_capacity, TaggedAllocator<Tracked>> first(4, RingBufferMode::overwrite, TaggedAllocator<Tracked>(1));
+		RingBuffer<Tracked, dynamic_capacity, TaggedAllocator<Tracked>> second(2, RingBufferMode::reject, TaggedAllocator<Tracked>(2));
+		RingBuffer<Tracked, dynamic_capacity, TaggedAllocator<Tracked>> same(1, RingBufferMode::reject, TaggedAllocator<Tracked>(2));
+		for (int i = 0; i < 6; ++i)
+			first.emplace(i);
+		second.emplace(9);
+		second = std::move(first);
+		assert(second.get_allocator().tag == 2 && second.capacity() == 4);
+		assert(second.size() == 4 && second[0].value == 2 && second[3].value == 5);
+		assert(second.mode() == RingBufferMode::overwrite && first.empty() && Tracked::live == 4);
+		
+		const Tracked *storage = &second.front();
+		same.emplace(7);
+		same = std::move(second);
+		assert(&same.front() == storage && same.size() == 4 && second.capacity() == 0);
+		assert(first.capacity() == 4 && first.push(Tracked(8)));
+	}
+	assert(Tracked::live == 0 && foreign_deallocations == 0);
+	
+	TEST_PASS("RingBuffer copy and move");
+}
+
+/**
+ * @brief Tests RingBuffer element lifetime management
+ * 
+ * @details Verifies that pushes, overwrites, pops, copies and
+ * destruction construct and destroy exactly the live elements.
+ * 
+ * @ingroup testing
+ */
+void test_ring_buffer_element_lifetime() {
+	TEST_GROUP("RingBuffer element lifetime");
+	
+	{
+		RingBuffer<Tracked, 3> fixed(RingBufferMode::overwrite);
+		RingBuffer<Tracked> dynamic(3);
+		for (int i = 0; i < 5; ++i) {
+			fixed.emplace(i);
+			dynamic.emplace(i);
+		}
+		assert(Tracked::live == 6);
+		assert(fixed.front().value == 2 && dynamic.back().value == 2);
+		fixed.pop();
+		assert(Tracked::live == 5);
+		
+		RingBuffer<Tracked, 3> copy(fixed);
+		RingBuffer<Tracked> dynamic_copy(dynamic);
+		assert(Tracked::live == 10);
+		copy.clear();
+		assert(Tracked::live == 8);
+	}
+	assert(Tracked::live == 0);
+	
+	TEST_PASS("RingBuffer element lifetime");
+}
+
+int main() {
+	TEST_HEADER("RingBuffer");
+	
+	try {
+		test_ring_buffer_constructor();
+		test_ring_buffer_reject();
+		test_ring_buffer_overwrite();
+		test_ring_buffer_iterators();
+		test_ring_buffer_copy_move();
+		test_ring_buffer_element_lifetime();
+		
+		TEST_SUCCESS("RingBuffer");
+		return 0;
+	} catch (const std::exception& e) {
+		TEST_FAIL(e.what());
+		return 1;
+	}
+}
@@ -0,0 +1,280 @@
+/**
+ * @file test_skip_list.cpp
+ * @brief Unit tests for SkipList container
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ * 
+ * @details This file contains unit tests for the SkipList class,
+ * covering insertion, lookup, erasure, ordered range iteration, copy
+ * and move semantics, and a randomized comparison against std::map.
+ */
+
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <cassert>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "test_colors.hpp"
+#include "super_lib.hpp"
+
+/**
+ * @brief Collects the keys of a map into a std::vector
+ * 
+ * @ingroup testing
+ * 
+ * @tparam Map Type of map
+ * @param[in] map Map to read
+ * @return Keys in iteration order
+ */
+template<class Map>
+std::vector<typename Map::key_type> keys(const Map &map) {
+	std::vector<typename Map::key_type> result;
+	for (const auto &entry : map)
+		result.push_back(entry.first);
+	return result;
+}
+
+/**
+ * @brief Tests SkipList insertion and lookup
+ * 
+ * @details Verifies that insert keeps keys unique and sorted, that find,
+ * contains, at and operator[] reach the right values, and that at throws
+ * for missing keys.
+ * 
+ * @ingroup testing
+ */
+void test_skip_list_insert_find() {
+	TEST_GROUP("SkipList insert and find");
+	
+	SkipList<int, std::string> map;
+	assert(map.empty() && map.begin() == map.end() && map.level() == 0);
+	assert(map.insert(5, "five").second);
+	assert(map.insert(1, "one").second);
+	assert(map.insert(3, "three").second);
+	auto result = map.insert(3, "other");
+	assert(!result.second && result.first->second == "three");
+	assert(map.size() == 3 && map.level() >= 1);
+	assert((keys(map) == std::vector<int>{1, 3, 5}));
+	
+	assert(map.find(5)->second == "five" && map.find(4) == map.end());
+	assert(map.contains(1) && !map.contains(2));
+	map.at(1) = "uno";
+	const SkipList<int, std::string> &cmap = map;
+	assert(cmap.at(1) == "uno" && cmap.find(3)->second == "three");
+	map[7] = "seven";
+	assert(map[7] == "seven" && map[0].empty() && map.size() == 5);
+	
+	bool thrown = false;
+	try {
+		cmap.at(42);
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+	
+	SkipList<int, int, std::greater<int>> descending;
+	for (int i = 0; i < 5; ++i)
+		descending.insert(i, i * i);
+	assert((keys(descending) == std::vector<int>{4, 3, 2, 1, 0}));
+	
+	TEST_PASS("SkipList insert and find");
+}
+
+/**
+ * @brief Tests SkipList erasure
+ * 
+ * @details Verifies erasing by key and by iterator, including the first
+ * and last elements, that levels shrink as the map empties, and that
+ * erasing end() throws.
+ * 
+ * @ingroup testing
+ */
+void test_skip_list_erase() {
+	TEST_GROUP("SkipList erase");
+	
+	SkipList<int, int> map;
+	for (int i = 0; i < 100; ++i)
+		map.insert(i, -i);
+	assert(map.erase(0) == 1 && map.erase(0) == 0);
+	assert(map.erase(99) == 1 && map.size() == 98);
+	auto it = map.erase(map.find(50));
+	assert(it->first == 51 && !map.contains(50));
+	for (it = map.begin(); it != map.end();) {
+		if (it->first % 2)
+			it = map.erase(it);
+		else
+			++it;
+	}
+	assert(map.size() == 48 && map.begin()->first == 2);
+	for (const auto &entry : map)
+		assert(entry.first % 2 == 0 && entry.second == -entry.first);
+	
+	bool thrown = false;
+	try {
+		map.erase(map.end());
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+	
+	while (!map.empty())
+		map.erase(map.begin());
+	assert(map.level() == 0 && map.begin() == map.end());
+	map.insert(1, 1);
+	assert(map.size() == 1 && map.begin()->second == 1);
+	
+	TEST_PASS("SkipList erase");
+}
+
+/**
+ * @brief Tests SkipList bounds and range iteration
+ * 
+ * @details Verifies lower_bound and upper_bound on present, missing,
+ * smaller and larger keys, and that they delimit half-open key ranges.
+ * 
+ * @ingroup testing
+ */
+void test_skip_list_range() {
+	TEST_GROUP("SkipList bounds and ranges");
+	
+	static_assert(std::is_same_v<std::iterator_traits<SkipList<int, int>::iterator>::iterator_category, std::forward_iterator_tag>);
+	static_assert(std::is_convertible_v<SkipList<int, int>::iterator, SkipList<int, int>::const_iterator>);
+	static_assert(!std::is_convertible_v<SkipList<int, int>::const_iterator, SkipList<int, int>::iterator>);
+	
+	SkipList<int, int> map;
+	for (int i = 0; i < 50; ++i)
+		map.insert(i * 10, i);
+	assert(map.lower_bound(30)->first == 30 && map.upper_bound(30)->first == 40);
+	assert(map.lower_bound(31)->first == 40 && map.upper_bound(31)->first == 40);
+	assert(map.lower_bound(-5) == map.begin() && map.upper_bound(-5) == map.begin());
+	assert(map.lower_bound(491) == map.end() && map.upper_bound(490) == map.end());
+	
+	std::vector<int> range;
+	for (auto it = map.lower_bound(100); it != map.lower_bound(150); ++it)
+		range.push_back(it->first);
+	assert((range == std::vector<int>{100, 110, 120, 130, 140}));
+	
+	const SkipList<int, int> &cmap = map;
+	int sum = 0;
+	for (auto it = cmap.upper_bound(450); it != cmap.end(); ++it)
+		sum += it->second;
+	assert(sum == 46 + 47 + 48 + 49);
+	for (auto it = map.lower_bound(200); it != map.upper_bound(220); ++it)
+		it->second = 0;
+	assert(map.at(200) == 0 && map.at(220) == 0 && map.at(230) == 23);
+	
+	TEST_PASS("SkipList bounds and ranges");
+}
+
+/**
+ * @brief Tests SkipList copy and move semantics
+ * 
+ * @details Verifies that copies are independent and that moves leave
+ * the source empty but usable.
+ * 
+ * @ingroup testing
+ */
+void test_skip_list_copy_move() {
+	TEST_GROUP("SkipList copy and move");
+	
+	SkipList<std::string, int> map;
+	for (int i = 0; i < 200; ++i)
+		map.insert(std::to_string(i), i);
+	SkipList<std::string, int> copy(map);
+	assert(copy.size() == 200 && keys(copy) == keys(map) && copy.level() == map.level());
+	copy["0"] = 100;
+	copy.erase("1");
+	assert(map.at("0") == 0 && map.contains("1"));
+	
+	copy = map;
+	assert(copy.size() == 200 && copy.at("0") == 0);
+	copy = copy;
+	assert(copy.size() == 200);
+	
+	SkipList<std::string, int> moved(std::move(copy));
+	assert(copy.empty() && copy.begin() == copy.end() && moved.size() == 200);
+	copy.insert("x", 1);
+	assert(copy.size() == 1 && copy.at("x") == 1);
+	copy = std::move(moved);
+	assert(copy.size() == 200 && moved.empty() && !copy.contains("x"));
+	assert(copy.find("150")->second == 150);
+	
+	TEST_PASS("SkipList copy and move");
+}
+
+/**
+ * @brief Tests SkipList against std::map
+ * 
+ * @details Applies the same random inserts, erasures and lookups to
+ * both maps and checks that contents and bounds always agree.
+ * 
+ * @ingroup testing
+ */
+void test_skip_list_randomized() {
+	TEST_GROUP("SkipList randomized");
+	
+	std::mt19937 gen(12345);
+	std::uniform_int_distribution<int> key(0, 999);
+	std::uniform_int_distribution<int> op(0, 3);
+	SkipList<int, int> map;
+	std::map<int, int> expected;
+	for (int step = 0; step < 20000; ++step) {
+		int k = key(gen);
+		switch (op(gen)) {
+		case 0:
+		case 1: {
+			bool inserted = map.insert(k, step).second;
+			bool expected_inserted = expected.emplace(k, step).second;
+			assert(inserted == expected_inserted);
+			break;
+		}
+		case 2: {
+			SkipList<int, int>::size_type erased = map.erase(k);
+			std::size_t expected_erased = expected.erase(k);
+			assert(erased == expected_erased);
+			break;
+		}
+		default: {
+			auto lower = map.lower_bound(k);
+			auto expected_lower = expected.lower_bound(k);
+			assert((lower == map.end()) == (expected_lower == expected.end()));
+			if (lower != map.end())
+				assert(lower->first == expected_lower->first && lower->second == expected_lower->second);
+			auto upper = map.upper_bound(k);
+			auto expected_upper = expected.upper_bound(k);
+			assert((upper == map.end()) == (expected_upper == expected.end()));
+			if (upper != map.end())
+				assert(upper->first == expected_upper->first);
+		}
+		}
+		assert(map.size() == expected.size());
+	}
+	assert(keys(map) == keys(expected));
+	
+	TEST_PASS("SkipList randomized");
+}
+
+int main() {
+	TEST_HEADER("SkipList");
+	
+	try {
+		test_skip_list_insert_find();
+		test_skip_list_erase();
+		test_skip_list_range();
+		test_skip_list_copy_move();
+		test_skip_list_randomized();
+	
+		TEST_SUCCESS("SkipList");
+		return 0;
+	} catch (const std::exception& e) {
+		TEST_FAIL(e.what());
+		return 1;
+	}
+}
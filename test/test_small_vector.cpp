@@ -0,0 +1,281 @@
+/**
+ * @file test_small_vector.cpp
+ * @brief Unit tests for SmallVector container class
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2025-01-28
+ * 
+ * @details This file contains unit tests for the SmallVector class,
+ * covering inline storage, spilling to and returning from the heap,
+ * copy and move semantics for both storage modes, range operations and
+ * element lifetime.
+ */
+
+#include <iostream>
+#include <cassert>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "test_colors.hpp"
+#include "test_fixtures.hpp"
+#include "super_lib.hpp"
+
+/**
+ * @brief Tests SmallVector constructors and inline storage
+ * 
+ * @details Verifies that small vectors start on the inline buffer with
+ * capacity N and that constructors only allocate for more than N
+ * elements.
+ * 
+ * @ingroup testing
+ */
+void test_small_vector_constructor() {
+	TEST_GROUP("SmallVector constructors");
+	
+	SmallVector<int, 8> v1;
+	assert(v1.size() == 0);
+	assert(v1.capacity() == 8);
+	assert(v1.is_inline());
+	
+	SmallVector<int, 8> v2(5, 42);
+	assert(v2.size() == 5 && v2.is_inline());
+	for (size_t i = 0; i < v2.size(); ++i)
+		assert(v2[i] == 42);
+	
+	SmallVector<int, 4> v3(10, 7);
+	assert(v3.size() == 10 && v3.capacity() == 10);
+	assert(!v3.is_inline());
+	
+	Vector<int> source;
+	for (int i = 0; i < 3; ++i)
+		source.add(i);
+	SmallVector<int, 4> v4(source);
+	assert(v4.size() == 3 && v4.is_inline() && v4[2] == 2);
+	
+	TEST_PASS("SmallVector constructors");
+}
+
+/**
+ * @brief Tests spilling to the heap and returning inline
+ * 
+ * @details Fills past N, checks that growth follows the capacity
+ * policy, and that removals and shrink_to_fit() bring the elements back
+ * into the inline buffer.
+ * 
+ * @ingroup testing
+ */
+void test_small_vector_spill() {
+	TEST_GROUP("SmallVector heap spill");
+	
+	SmallVector<int, 4> v;
+	const int *inline_storage = v.data();
+	for (int i = 0; i < 4; ++i)
+		v.add(i);
+	assert(v.is_inline() && v.data() == inline_storage);
+	v.add(4);
+	assert(!v.is_inline());
+	assert(v.capacity() == 8);
+	for (int i = 0; i < 5; ++i)
+		assert(v[i] == i);
+	
+	for (int i = 5; i < 32; ++i)
+		v.add(i);
+	assert(v.capacity() == 32);
+	v.erase(1, 29);
+	assert(v.size() == 4 && v.capacity() == 16);
+	assert(v[0] == 0 && v[1] == 29 && v[3] == 31);
+	v.erase(1, 4);
+	assert(v.size() == 1);
+	assert(v.is_inline() && v.capacity() == 4 && v[0] == 0);
+	
+	v.reserve(20);
+	assert(!v.is_inline() && v.capacity() == 20);
+	v.add(1);
+	v.shrink_to_fit();
+	assert(v.is_inline() && v.capacity() == 4 && v[1] == 1);
+	
+	v.clear();
+	assert(v.size() == 0 && v.is_inline());
+	
+	TEST_PASS("SmallVector heap spill");
+}
+
+/**
+ * @brief Tests SmallVector copy and move semantics
+ * 
+ * @details Verifies deep copies and moves for vectors living inline
+ * and on the heap, including that moving a heap vector steals its
+ * storage while moving an inline one relocates the elements.
+ * 
+ * @ingroup testing
+ */
+void test_small_vector_copy_move() {
+	TEST_GROUP("SmallVector copy and move");
+	
+	SmallVector<int, 4> small;
+	for (int i = 0; i < 3; ++i)
+		small.add(i * 10);
+	SmallVector<int, 4> copy(small);
+	assert(copy.size() == 3 && copy.is_inline());
+	copy[0] = 99;
+	assert(small[0] == 0);
+	
+	SmallVector<int, 4> moved(std::move(small));
+	assert(moved.size() == 3 && moved.is_inline() && moved[2] == 20);
+	assert(small.size() == 0 && small.is_inline());
+	
+	SmallVector<int, 4> big;
+	for (int i = 0; i < 10; ++i)
+		big.add(i);
+	const int *heap_storage = big.data();
+	SmallVector<int, 4> stolen(std::move(big));
+	assert(stolen.data() == heap_storage && stolen.size() == 10);
+	assert(big.size() == 0 && big.is_inline() && big.capacity() == 4);
+	
+	big = stolen;
+	assert(big.size() == 10 && big[9] == 9 && big.data() != stolen.data());
+	moved = std::move(stolen);
+	assert(moved.data() == heap_storage && moved.size() == 10);
+	assert(stolen.is_inline() && stolen.size() == 0);
+	stolen = std::move(copy);
+	assert(stolen.size() == 3 && stolen[0] == 99 && stolen.is_inline());
+	
+	TEST_PASS("SmallVector copy and move");
+}
+
+/**
+ * @brief Tests SmallVector element operations
+ * 
+ * @details Verifies insert, erase, range operations, resize and
+ * emplace_back across the inline/heap boundary, plus bounds checking.
+ * 
+ * @ingroup testing
+ */
+void test_small_vector_operations() {
+	TEST_GROUP("SmallVector operations");
+	
+	SmallVector<int, 4> v;
+	int values[] = {1, 2, 3};
+	v.append(values, values + 3);
+	v.insert(1, 9);
+	assert(v.size() == 4 && v.is_inline());
+	assert(v[0] == 1 && v[1] == 9 && v[2] == 2);
+	v.insert(0, v.begin(), v.end());
+	assert(v.size() == 8 && !v.is_inline());
+	int expected[] = {1, 9, 2, 3, 1, 9, 2, 3};
+	for (size_t i = 0; i < v.size(); ++i)
+		assert(v[i] == expected[i]);
+	assert(v.erase_if([](const int &x) { return x == 9; }) == 2);
+	assert(v.erase(0) == 1);
+	assert(v.size() == 5);
+	
+	v.resize(2);
+	assert(v.size() == 2);
+	v.resize(6, 5);
+	assert(v.size() == 6 && v[5] == 5);
+	assert(v.emplace_back(11) == 11);
+	
+	bool thrown = false;
+	try {
+		v.at(7);
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+	v.at(6) = 12;
+	assert(v[6] == 12);
+	
+	int sum = 0;
+	for (int x : v)
+		sum += x;
+	assert(sum == 2 + 3 + 5 * 4 + 12);
+	
+	TEST_PASS("SmallVector operations");
+}
+
+/**
+ * @brief Tests SmallVector element lifetime management
+ * 
+ * @details Verifies that spilling, returning inline, moves and
+ * destruction construct and destroy exactly the live elements.
+ * 
+ * @ingroup testing
+ */
+void test_small_vector_element_lifetime() {
+	TEST_GROUP("SmallVector element lifetime");
+	
+	{
+		SmallVector<Tracked, 3> v;
+		assert(Tracked::live == 0);
+		for (int i = 0; i < 3; ++i)
+			v.add(Tracked(i));
+		assert(Tracked::live == 3);
+		v.add(Tracked(3));
+		assert(Tracked::live == 4);
+		
+		SmallVector<Tracked, 3> other(v);
+		assert(Tracked::live == 8);
+		other.erase(0, 3);
+		other.shrink_to_fit();
+		assert(Tracked::live == 5 && other.is_inline());
+		SmallVector<Tracked, 3> moved(std::move(other));
+		assert(Tracked::live == 5 && moved[0].value == 3);
+		
+		v = moved;
+		assert(Tracked::live == 2);
+	}
+	assert(Tracked::live == 0);
+	
+	TEST_PASS("SmallVector element lifetime");
+}
+
+/**
+ * @brief Tests SmallVector move assignment between allocators
+ * 
+ * @details Verifies that a heap buffer is taken over from an equal
+ * allocator and moved element-wise for a different one, and that
+ * elements held inline are moved into the inline storage.
+ * 
+ * @ingroup testing
+ */
+void test_small_vector_move_allocator() {
+	TEST_GROUP("SmallVector move assignment between allocators");
+	
+	using Tagged = SmallVector<Tracked, 2, TaggedAllocator<Tracked>>;
+	static_assert(std::is_nothrow_move_assignable<SmallVector<int, 2>>::value, "std::allocator never needs a fallback");
+	check_move_allocator<Tagged>(
+		[](auto &v) {
+			for (int i = 0; i < 5; ++i)
+				v.add(Tracked(i));
+		},
+		[](const auto &v) { return v.data(); });
+	{
+		Tagged small(TaggedAllocator<Tracked>(1));
+		Tagged target(TaggedAllocator<Tracked>(2));
+		small.add(Tracked(8));
+		target = std::move(small);
+		assert(target.is_inline() && target.size() == 1 && target[0].value == 8 && small.empty());
+	}
+	assert(Tracked::live == 0 && foreign_deallocations == 0);
+	
+	TEST_PASS("SmallVector move assignment between allocators");
+}
+
+int main() {
+	TEST_HEADER("SmallVector");
+	
+	try {
+		test_small_vector_constructor();
+		test_small_vector_spill();
+		test_small_vector_copy_move();
+		test_small_vector_operations();
+		test_small_vector_element_lifetime();
+		test_small_vector_move_allocator();
+		
+		TEST_SUCCESS("SmallVector");
+		return 0;
+	} catch (const std::exception& e) {
+		TEST_FAIL(e.what());
+		return 1;
+	}
+}
@@ -0,0 +1,242 @@
+/**
+ * @file test_spsc_queue.cpp
+ * @brief Unit tests for SpscQueue concurrent container class
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ * 
+ * @details This file contains unit tests for the SpscQueue class,
+ * covering capacity rounding, single-threaded push and pop semantics,
+ * batch operations, element lifetime and a producer/consumer run on two
+ * threads.
+ */
+
+#include <iostream>
+#include <cassert>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include "test_colors.hpp"
+#include "test_fixtures.hpp"
+#include "super_lib.hpp"
+
+/**
+ * @brief Tests SpscQueue push and pop on one thread
+ * 
+ * @details Verifies capacity rounding, FIFO order across the wrap
+ * point, and that pushes fail when full and pops when empty.
+ * 
+ * @ingroup testing
+ */
+void test_spsc_queue_basic() {
+	TEST_GROUP("SpscQueue basic operations");
+	
+	SpscQueue<int> q(5);
+	assert(q.capacity() == 8 && q.empty());
+	int out = -1;
+	assert(!q.try_pop(out) && out == -1);
+	
+	for (int i = 0; i < 8; ++i)
+		assert(q.try_push(i));
+	assert(!q.try_push(8) && q.size() == 8);
+	for (int i = 0; i < 3; ++i)
+		assert(q.try_pop(out) && out == i);
+	for (int i = 8; i < 11; ++i)
+		assert(q.try_emplace(i));
+	for (int i = 3; i < 11; ++i)
+		assert(q.try_pop(out) && out == i);
+	assert(q.empty());
+	
+	SpscQueue<std::string> words(2);
+	std::string word = "moved";
+	assert(words.try_push(std::move(word)) && word.empty());
+	std::string got;
+	assert(words.try_pop(got) && got == "moved");
+	
+	TEST_PASS("SpscQueue basic operations");
+}
+
+/**
+ * @brief Tests SpscQueue batch operations
+ * 
+ * @details Verifies that try_push_n() and try_pop_n() take as many
+ * elements as fit or are available, in order, across the wrap point.
+ * 
+ * @ingroup testing
+ */
+void test_spsc_queue_batches() {
+	TEST_GROUP("SpscQueue batch operations");
+	
+	SpscQueue<int> q(8);
+	int values[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+	int out[10] = {};
+	assert(q.try_push_n(values, 6) == 6);
+	assert(q.try_pop_n(out, 4) == 4 && out[3] == 3);
+	assert(q.try_push_n(values, 10) == 6);
+	assert(q.size() == 8);
+	assert(q.try_pop_n(out, 10) == 8);
+	int expected[] = {4, 5, 0, 1, 2, 3, 4, 5};
+	for (int i = 0; i < 8; ++i)
+		assert(out[i] == expected[i]);
+	assert(q.try_pop_n(out, 1) == 0);
+	
+	TEST_PASS("SpscQueue batch operations");
+}
+
+/**
+ * @brief Tests SpscQueue element lifetime management
+ * 
+ * @details Runs the head and tail around the buffer several times and
+ * verifies that batch pops destroy the slots they empty, that a full
+ * queue constructs nothing, and that the destructor destroys the
+ * elements still queued across the wrap point.
+ * 
+ * @ingroup testing
+ */
+void test_spsc_queue_element_lifetime() {
+	TEST_GROUP("SpscQueue element lifetime");
+	
+	{
+		SpscQueue<Tracked> q(4);
+		Tracked batch[3];
+		for (int round = 0; round < 5; ++round) {
+			for (int i = 0; i < 3; ++i)
+				assert(q.try_emplace(round * 3 + i));
+			assert(Tracked::live == 6);
+			assert(q.try_pop_n(batch, 3) == 3 && batch[2].value == round * 3 + 2);
+			assert(Tracked::live == 3);
+		}
+		for (int i = 0; i < 4; ++i)
+			assert(q.try_emplace(100 + i));
+		assert(!q.try_emplace(104) && Tracked::live == 7);
+		Tracked out;
+		assert(q.try_pop(out) && out.value == 100 && Tracked::live == 7);
+	}
+	assert(Tracked::live == 0);
+	
+	TEST_PASS("SpscQueue element lifetime");
+}
+
+/**
+ * @brief Tracked element whose move assignment can be made to throw
+ * 
+ * @ingroup testing
+ */
+struct Fragile : Tracked {
+	static inline int throw_on = -1;  ///< Value whose move assignment throws
+
+	using Tracked::Tracked;
+	Fragile(const Fragile &other) = default;
+	Fragile(Fragile &&other) = default;
+	Fragile &operator=(Fragile &&other) {
+		if (other.value == throw_on)
+			throw std::runtime_error("move assignment failed");
+		value = other.value;
+		return *this;
+	}
+};
+
+/**
+ * @brief Tests SpscQueue batch pops that throw part way
+ * 
+ * @details Verifies that when a move assignment throws inside
+ * try_pop_n(), the slots already emptied are released, the element
+ * that threw stays at the front, and the queue keeps working.
+ * 
+ * @ingroup testing
+ */
+void test_spsc_queue_pop_n_throws() {
+	TEST_GROUP("SpscQueue batch pop exception safety");
+	
+	{
+		SpscQueue<Fragile> q(4);
+		Fragile batch[4];
+		assert(q.try_emplace(0) && q.try_pop_n(batch, 1) == 1);
+		for (int i = 1; i <= 4; ++i)
+			assert(q.try_emplace(i));
+		Fragile::throw_on = 3;
+		bool threw = false;
+		try {
+			q.try_pop_n(batch, 4);
+		}
+		catch (const std::runtime_error &) {
+			threw = true;
+		}
+		assert(threw && q.size() == 2 && Tracked::live == 6);
+		assert(batch[0].value == 1 && batch[1].value == 2);
+		assert(q.try_emplace(5) && q.try_emplace(6) && !q.try_emplace(7));
+		Fragile::throw_on = -1;
+		assert(q.try_pop_n(batch, 4) == 4 && batch[0].value == 3 && batch[3].value == 6);
+		assert(q.empty() && Tracked::live == 4);
+	}
+	assert(Tracked::live == 0);
+	
+	TEST_PASS("SpscQueue batch pop exception safety");
+}
+
+/**
+ * @brief Tests SpscQueue with a producer and a consumer thread
+ * 
+ * @details Streams 200000 values through a small queue, half of
+ * them in batches, and checks that the consumer sees every value
+ * exactly once and in order.
+ * 
+ * @ingroup testing
+ */
+void test_spsc_queue_threads() {
+	TEST_GROUP("SpscQueue producer and consumer threads");
+	
+	const long total = 200000;
+	SpscQueue<long> q(1024);
+	std::thread producer([&q, total]() {
+		long batch[16];
+		long next = 0;
+		while (next < total) {
+			if (next % 2 == 0 && total - next >= 16) {
+				for (int i = 0; i < 16; ++i)
+					batch[i] = next + i;
+				unsigned long pushed = q.try_push_n(batch, 16);
+				if (pushed == 0)
+					std::this_thread::yield();
+				next += pushed;
+			}
+			else if (q.try_push(next))
+				++next;
+			else
+				std::this_thread::yield();
+		}
+	});
+	
+	long expected = 0;
+	long batch[32];
+	bool ordered = true;
+	while (expected < total) {
+		unsigned long got = q.try_pop_n(batch, 32);
+		if (got == 0)
+			std::this_thread::yield();
+		for (unsigned long i = 0; i < got; ++i)
+			ordered = ordered && batch[i] == expected++;
+	}
+	producer.join();
+	assert(ordered && q.empty());
+	
+	TEST_PASS("SpscQueue producer and consumer threads");
+}
+
+int main() {
+	TEST_HEADER("SpscQueue");
+	
+	try {
+		test_spsc_queue_basic();
+		test_spsc_queue_batches();
+		test_spsc_queue_element_lifetime();
+		test_spsc_queue_pop_n_throws();
+		test_spsc_queue_threads();
+		
+		TEST_SUCCESS("SpscQueue");
+		return 0;
+	} catch (const std::exception& e) {
+		TEST_FAIL(e.what());
+		return 1;
+	}
+}
@@ -14,7 +14,10 @@
 #include <iostream>
 #include <cassert>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include "test_colors.hpp"
+#include "test_fixtures.hpp"
 #include "super_lib.hpp"
 
 /**
@@ -70,11 +73,13 @@ void test_stack_operators() {
 	s1[1] = 10;
 	assert(s1[1] == 10);
 	
+#if COLLECTIONS_BOUNDS_CHECK
 	try {
 		s1[10];
 		assert(false && "Should throw exception");
 	} catch (const std::out_of_range&) {
 	}
+#endif
 	
 	Stack<int> s2;
 	s2 = s1;
@@ -179,6 +184,16 @@ void test_stack_at() {
 	} catch (const std::out_of_range&) {
 	}
 	
+	s.at(1) = 25;
+	const auto &cref = s;
+	assert(cref[1] == 25);
+	assert(cref.at(1) == 25);
+	try {
+		s.at(3) = 0;
+		assert(false && "Should throw exception");
+	} catch (const std::out_of_range&) {
+	}
+	
 	TEST_PASS("Stack at");
 }
 
@@ -405,6 +420,59 @@ void test_stack_from_other_collections() {
 	TEST_PASS("Stack from other collections");
 }
 
+/**
+ * @brief Tests Stack capacity policy
+ * 
+ * @details Verifies that push/pop cycles around a capacity boundary
+ * keep the same storage, and that reserve() and shrink_to_fit() are
+ * honored.
+ * 
+ * @ingroup testing
+ */
+void test_stack_capacity_policy() {
+	TEST_GROUP("Stack capacity policy");
+	
+	Stack<int> s;
+	for (int i = 0; i < 17; ++i)
+		s.push(i);
+	assert(s.capacity() == 32);
+	int *storage = s.data();
+	for (int i = 0; i < 100; ++i) {
+		s.pop();
+		s.push(i);
+	}
+	assert(s.data() == storage);
+	
+	s.reserve(50);
+	assert(s.capacity() == 50);
+	s.shrink_to_fit();
+	assert(s.capacity() == s.size());
+	
+	TEST_PASS("Stack capacity policy");
+}
+
+/**
+ * @brief Tests Stack move assignment between allocators
+ * 
+ * @details Verifies that the buffer is taken over from an equal
+ * allocator and that the elements are moved for a different one.
+ * 
+ * @ingroup testing
+ */
+void test_stack_move_allocator() {
+	TEST_GROUP("Stack move assignment between allocators");
+	
+	static_assert(std::is_nothrow_move_assignable<Stack<int>>::value, "std::allocator never needs a fallback");
+	check_move_allocator<Stack<Tracked, TaggedAllocator<Tracked>>>(
+		[](auto &s) {
+			for (int i = 0; i < 5; ++i)
+				s.push(Tracked(i));
+		},
+		[](const auto &s) { return s.data(); });
+	
+	TEST_PASS("Stack move assignment between allocators");
+}
+
 int main() {
 	TEST_HEADER("Stack");
 	
@@ -420,6 +488,8 @@ int main() {
 		test_stack_lifo_behavior();
 		test_stack_capacity_management();
 		test_stack_from_other_collections();
+		test_stack_capacity_policy();
+		test_stack_move_allocator();
 		
 		TEST_SUCCESS("Stack");
 		return 0;
@@ -0,0 +1,346 @@
+/**
+ * @file test_unrolled_list.cpp
+ * @brief Unit tests for UnrolledList container
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ * 
+ * @details This file contains unit tests for the UnrolledList class,
+ * covering element access, node splitting and merging on insert and
+ * erase, iterators, copy and move semantics, and element lifetime.
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <cassert>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "test_colors.hpp"
+#include "test_fixtures.hpp"
+#include "super_lib.hpp"
+
+/**
+ * @brief Tests UnrolledList add and element access
+ * 
+ * @details Verifies that appends fill nodes completely, that operator[]
+ * and at() reach elements in every node and that out-of-range indices
+ * throw.
+ * 
+ * @ingroup testing
+ */
+void test_unrolled_list_add_access() {
+	TEST_GROUP("UnrolledList add and access");
+	
+	UnrolledList<int, 4> list;
+	assert(list.empty() && list.node_count() == 0);
+	for (int i = 0; i < 10; ++i)
+		list.add(i * 10);
+	assert(list.size() == 10 && list.node_count() == 3);
+	for (int i = 0; i < 10; ++i)
+		assert(list[i] == i * 10 && list.at(i) == i * 10);
+	list[7] = 7;
+	assert(list.at(7) == 7);
+	
+	bool thrown = false;
+	try {
+		list.at(10);
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+	
+	UnrolledList<std::string, 3> words(7, "abc");
+	assert(words.size() == 7 && words.node_count() == 3 && words[6] == "abc");
+	
+	TEST_PASS("UnrolledList add and access");
+}
+
+/**
+ * @brief Tests UnrolledList insertion
+ * 
+ * @details Verifies insertion at the front, the middle and the end,
+ * splitting of full nodes, and that the returned iterator points at
+ * the inserted element. Results are compared against std::vector.
+ * 
+ * @ingroup testing
+ */
+void test_unrolled_list_insert() {
+	TEST_GROUP("UnrolledList insert");
+	
+	UnrolledList<int, 4> list;
+	std::vector<int> expected;
+	for (int i = 0; i < 8; ++i) {
+		list.add(i);
+		expected.push_back(i);
+	}
+	assert(list.node_count() == 2);
+	
+	auto it = list.insert(1, 100);
+	expected.insert(expected.begin() + 1, 100);
+	assert(*it == 100 && list.node_count() == 3);
+	it = list.insert(0, 200);
+	expected.insert(expected.begin(), 200);
+	assert(*it == 200);
+	it = list.insert(list.size(), 300);
+	expected.push_back(300);
+	assert(*it == 300 && ++it == list.end());
+	for (int i = 0; i < 40; ++i) {
+		unsigned long index = (i * 7) % (list.size() + 1);
+		list.insert(index, i);
+		expected.insert(expected.begin() + index, i);
+	}
+	assert(list.size() == expected.size());
+	assert(std::equal(list.begin(), list.end(), expected.begin()));
+	assert(list.node_count() <= 2 * list.size() / 4 + 1);
+	
+	list.insert(3, list[5]);
+	expected.insert(expected.begin() + 3, expected[5]);
+	assert(std::equal(list.begin(), list.end(), expected.begin()));
+	
+	bool thrown = false;
+	try {
+		list.insert(list.size() + 1, 0);
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+	
+	TEST_PASS("UnrolledList insert");
+}
+
+/**
+ * @brief Tests UnrolledList erasure
+ * 
+ * @details Verifies that erase returns the removed element, that empty
+ * nodes are freed, that sparse nodes merge with their successor and
+ * that erasing everything leaves a reusable empty list.
+ * 
+ * @ingroup testing
+ */
+void test_unrolled_list_erase() {
+	TEST_GROUP("UnrolledList erase");
+	
+	UnrolledList<int, 4> list;
+	std::vector<int> expected;
+	for (int i = 0; i < 12; ++i) {
+		list.add(i);
+		expected.push_back(i);
+	}
+	assert(list.erase(0) == 0);
+	assert(list.erase(0) == 1);
+	assert(list.erase(0) == 2);
+	assert(list.node_count() == 3 && list[0] == 3);
+	assert(list.erase(0) == 3);
+	expected.erase(expected.begin(), expected.begin() + 4);
+	assert(list.node_count() == 2 && list[0] == 4);
+	assert(std::equal(list.begin(), list.end(), expected.begin()));
+	
+	while (list.size() > 1) {
+		unsigned long index = list.size() / 2;
+		assert(list.erase(index) == expected[index]);
+		expected.erase(expected.begin() + index);
+		assert(std::equal(list.begin(), list.end(), expected.begin()));
+	}
+	assert(list.node_count() == 1);
+	assert(list.erase(0) == expected[0]);
+	assert(list.empty() && list.node_count() == 0 && list.begin() == list.end());
+	
+	for (int i = 0; i < 6; ++i)
+		list.add(i);
+	assert(list.node_count() == 2);
+	list.erase(0);
+	list.erase(0);
+	list.erase(0);
+	assert(list.node_count() == 1 && list.size() == 3);
+	assert(list[0] == 3 && list[1] == 4 && list[2] == 5);
+	list.add(6);
+	list.add(7);
+	assert(list.node_count() == 2 && list[4] == 7);
+	
+	bool thrown = false;
+	try {
+		list.erase(5);
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+	
+	TEST_PASS("UnrolledList erase");
+}
+
+/**
+ * @brief Tests UnrolledList iterators
+ * 
+ * @details Verifies forward traversal across node boundaries, const
+ * iteration, the iterator category and use with standard algorithms.
+ * 
+ * @ingroup testing
+ */
+void test_unrolled_list_iterators() {
+	TEST_GROUP("UnrolledList iterators");
+	
+	using It = UnrolledList<int, 3>::iterator;
+	using CIt = UnrolledList<int, 3>::const_iterator;
+	static_assert(std::is_same_v<std::iterator_traits<It>::iterator_category, std::forward_iterator_tag>);
+	static_assert(std::is_same_v<std::iterator_traits<CIt>::reference, const int&>);
+	static_assert(std::is_convertible_v<It, CIt>);
+	static_assert(!std::is_convertible_v<CIt, It>);
+	
+	UnrolledList<int, 3> list;
+	assert(list.begin() == list.end());
+	for (int i = 0; i < 10; ++i)
+		list.add(i);
+	int expected = 0;
+	for (int value : list)
+		assert(value == expected++);
+	assert(expected == 10);
+	assert(std::distance(list.begin(), list.end()) == 10);
+	
+	It found = std::find(list.begin(), list.end(), 7);
+	assert(found != list.end() && *found == 7);
+	*found = 70;
+	assert(list[7] == 70);
+	
+	const UnrolledList<int, 3> &clist = list;
+	CIt cit = list.begin();
+	assert(cit == clist.begin());
+	assert(*cit++ == 0 && *cit == 1);
+	assert(std::count_if(clist.begin(), clist.end(), [](int x) { return x % 2 == 0; }) == 6);
+	
+	UnrolledList<std::pair<int, int>, 2> pairs;
+	pairs.add(std::make_pair(1, 2));
+	assert(pairs.begin()->second == 2);
+	
+	TEST_PASS("UnrolledList iterators");
+}
+
+/**
+ * @brief Tests UnrolledList copy and move semantics
+ * 
+ * @details Verifies deep copies, construction from other containers,
+ * and that moved-from lists are empty and reusable.
+ * 
+ * @ingroup testing
+ */
+void test_unrolled_list_copy_move() {
+	TEST_GROUP("UnrolledList copy and move");
+	
+	UnrolledList<std::string, 4> list;
+	for (int i = 0; i < 9; ++i)
+		list.add(std::to_string(i));
+	list.erase(2);
+	assert(list.node_count() == 3);
+	
+	UnrolledList<std::string, 4> copy(list);
+	assert(copy.size() == 8 && copy.node_count() == 2);
+	assert(std::equal(copy.begin(), copy.end(), list.begin()));
+	copy[0] = "changed";
+	assert(list[0] == "0");
+	
+	UnrolledList<std::string, 4> moved(std::move(copy));
+	assert(copy.empty() && moved.size() == 8 && moved[0] == "changed");
+	copy.add("again");
+	assert(copy.size() == 1);
+	
+	copy = list;
+	assert(copy.size() == 8 && copy[7] == "8");
+	moved = std::move(copy);
+	assert(moved.size() == 8 && copy.empty());
+	
+	Vector<int> vec;
+	for (int i = 0; i < 5; ++i)
+		vec.add(i);
+	UnrolledList<int, 2> from_vec(vec);
+	assert(from_vec.size() == 5 && from_vec[4] == 4 && from_vec.node_count() == 3);
+	
+	TEST_PASS("UnrolledList copy and move");
+}
+
+/**
+ * @brief Tests UnrolledList element lifetime
+ * 
+ * @details Verifies that splits, shifts, merges and clear construct
+ * and destroy exactly the elements the list holds.
+ * 
+ * @ingroup testing
+ */
+void test_unrolled_list_lifetime() {
+	TEST_GROUP("UnrolledList element lifetime");
+	
+	{
+		UnrolledList<Tracked, 4> list;
+		for (int i = 0; i < 16; ++i)
+			list.add(Tracked(i));
+		assert(Tracked::live == 16);
+		for (int i = 0; i < 10; ++i)
+			list.insert(i * 2 + 1, Tracked(100 + i));
+		assert(Tracked::live == 26);
+		for (int i = 0; i < 12; ++i)
+			list.erase(i % list.size());
+		assert(Tracked::live == 14 && list.size() == 14);
+		list.clear();
+		assert(Tracked::live == 0 && list.node_count() == 0);
+		for (int i = 0; i < 5; ++i)
+			list.add(Tracked(i));
+	}
+	assert(Tracked::live == 0);
+	
+	TEST_PASS("UnrolledList element lifetime");
+}
+
+/**
+ * @brief Tests UnrolledList move assignment between allocators
+ * 
+ * @details Verifies that the nodes are taken over from an equal
+ * allocator, keeping element addresses, and that the elements are
+ * moved into full nodes for a different one.
+ * 
+ * @ingroup testing
+ */
+void test_unrolled_list_move_allocator() {
+	TEST_GROUP("UnrolledList move assignment between allocators");
+	
+	using Tagged = UnrolledList<Tracked, 4, TaggedAllocator<Tracked>>;
+	static_assert(std::is_nothrow_move_assignable<UnrolledList<int>>::value, "PoolAllocator propagates on move");
+	check_move_allocator<Tagged>(
+		[](auto &l) {
+			for (int i = 0; i < 10; ++i)
+				l.add(Tracked(i));
+		},
+		[](auto &l) { return &l[5]; });
+	{
+		Tagged first(TaggedAllocator<Tracked>(1));
+		Tagged second(TaggedAllocator<Tracked>(2));
+		for (int i = 0; i < 10; ++i)
+			first.add(Tracked(i));
+		second = std::move(first);
+		assert(second.size() == 10 && second.node_count() == 3);
+	}
+	assert(Tracked::live == 0 && foreign_deallocations == 0);
+	
+	TEST_PASS("UnrolledList move assignment between allocators");
+}
+
+int main() {
+	TEST_HEADER("UnrolledList");
+	
+	try {
+		test_unrolled_list_add_access();
+		test_unrolled_list_insert();
+		test_unrolled_list_erase();
+		test_unrolled_list_iterators();
+		test_unrolled_list_copy_move();
+		test_unrolled_list_lifetime();
+		test_unrolled_list_move_allocator();
+	
+		TEST_SUCCESS("UnrolledList");
+		return 0;
+	} catch (const std::exception& e) {
+		TEST_FAIL(e.what());
+		return 1;
+	}
+}
@@ -13,7 +13,10 @@
 #include <iostream>
 #include <cassert>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include "test_colors.hpp"
+#include "test_fixtures.hpp"
 #include "super_lib.hpp"
 
 /**
@@ -68,11 +71,13 @@ void test_vector_operators() {
 	v1[1] = 10;
 	assert(v1[1] == 10);
 	
+#if COLLECTIONS_BOUNDS_CHECK
 	try {
 		v1[10];
 		assert(false && "Should throw exception");
 	} catch (const std::out_of_range&) {
 	}
+#endif
 	
 	Vector<int> v2;
 	v2 = v1;
@@ -219,6 +224,16 @@ void test_vector_at() {
 	} catch (const std::out_of_range&) {
 	}
 	
+	v.at(1) = 25;
+	const auto &cref = v;
+	assert(cref[1] == 25);
+	assert(cref.at(1) == 25);
+	try {
+		v.at(3) = 0;
+		assert(false && "Should throw exception");
+	} catch (const std::out_of_range&) {
+	}
+	
 	TEST_PASS("Vector at");
 }
 
@@ -425,6 +440,28 @@ void test_vector_move_semantics() {
 	TEST_PASS("Vector move semantics");
 }
 
+/**
+ * @brief Tests Vector move assignment between allocators
+ * 
+ * @details Verifies that the buffer is taken over from an equal
+ * allocator and that the elements are moved for a different one.
+ * 
+ * @ingroup testing
+ */
+void test_vector_move_allocator() {
+	TEST_GROUP("Vector move assignment between allocators");
+	
+	static_assert(std::is_nothrow_move_assignable<Vector<int>>::value, "std::allocator never needs a fallback");
+	check_move_allocator<Vector<Tracked, TaggedAllocator<Tracked>>>(
+		[](auto &v) {
+			for (int i = 0; i < 5; ++i)
+				v.add(Tracked(i));
+		},
+		[](const auto &v) { return v.data(); });
+	
+	TEST_PASS("Vector move assignment between allocators");
+}
+
 /**
  * @brief Tests Vector construction from other collection types
  * 
@@ -480,6 +517,399 @@ void test_vector_from_other_collections() {
 	TEST_PASS("Vector from other collections");
 }
 
+/**
+ * @brief Tests Vector element lifetime management
+ * 
+ * @details Verifies that spare capacity holds no constructed objects
+ * and that growth, copy, erase and clear construct or destroy only
+ * live elements.
+ * 
+ * @ingroup testing
+ */
+void test_vector_element_lifetime() {
+	TEST_GROUP("Vector element lifetime");
+	
+	{
+		Vector<Tracked> v;
+		for (int i = 0; i < 5; ++i)
+			v.add(Tracked(i));
+		assert(v.capacity() == 8);
+		assert(Tracked::live == 5);
+		
+		Vector<Tracked> copy(v);
+		assert(Tracked::live == 10);
+		
+		v.erase(0);
+		assert(Tracked::live == 9);
+		assert(v[0].value == 1);
+		
+		v.insert(2, v[0]);
+		assert(Tracked::live == 10);
+		assert(v[2].value == 1);
+		
+		v.clear();
+		assert(Tracked::live == 5);
+	}
+	assert(Tracked::live == 0);
+	
+	TEST_PASS("Vector element lifetime");
+}
+
+/**
+ * @brief Element type that owns heap memory and opts into relocation
+ * 
+ * @details Counts how often its move constructor runs so tests can
+ * verify that growth relocates it bitwise instead.
+ * 
+ * @ingroup testing
+ */
+struct Relocatable {
+	static int moves;  ///< Number of move constructions performed
+	int *value;        ///< Owned heap value
+
+	Relocatable(int v) : value(new int(v)) {}
+	Relocatable(const Relocatable &other) : value(new int(*other.value)) {}
+	Relocatable(Relocatable &&other) noexcept : value(other.value) { other.value = nullptr; ++moves; }
+	Relocatable &operator=(const Relocatable &other) { *value = *other.value; return *this; }
+	~Relocatable() { delete value; }
+};
+
+int Relocatable::moves = 0;
+
+template<>
+struct is_trivially_relocatable<Relocatable> : std::true_type {};
+
+/**
+ * @brief Tests Vector growth for trivially relocatable types
+ * 
+ * @details Verifies that types opting into is_trivially_relocatable
+ * keep their values across many reallocations without any move
+ * constructor calls beyond the one per add().
+ * 
+ * @ingroup testing
+ */
+void test_vector_trivial_relocation() {
+	TEST_GROUP("Vector trivial relocation");
+	
+	static_assert(is_trivially_relocatable_v<int>, "int must be relocatable");
+	static_assert(!is_trivially_relocatable_v<Tracked>, "Tracked must not be relocatable");
+	
+	Vector<Relocatable> v;
+	Relocatable::moves = 0;
+	for (int i = 0; i < 1000; ++i)
+		v.add(Relocatable(i));
+	assert(Relocatable::moves == 1000);
+	for (int i = 0; i < 1000; ++i)
+		assert(*v[i].value == i);
+	
+	TEST_PASS("Vector trivial relocation");
+}
+
+/**
+ * @brief Tests Vector capacity policies
+ * 
+ * @details Verifies that alternating insertions and removals at a
+ * growth boundary do not reallocate, that reserve() and
+ * shrink_to_fit() are honored, and that alternative policies change
+ * the growth factor and shrink behavior.
+ * 
+ * @ingroup testing
+ */
+void test_vector_capacity_policy() {
+	TEST_GROUP("Vector capacity policy");
+	
+	Vector<int> v;
+	for (int i = 0; i < 9; ++i)
+		v.add(i);
+	assert(v.capacity() == 16);
+	int *storage = v.data();
+	for (int i = 0; i < 100; ++i) {
+		v.erase(v.size() - 1);
+		v.add(i);
+	}
+	assert(v.data() == storage);
+	assert(v.capacity() == 16);
+	
+	while (v.size() > 3)
+		v.erase(0);
+	assert(v.capacity() == 8);
+	
+	v.reserve(100);
+	assert(v.capacity() == 100);
+	assert(v[2] == 99);
+	v.shrink_to_fit();
+	assert(v.capacity() == 3);
+	v.clear();
+	assert(v.capacity() == 3);
+	v.shrink_to_fit();
+	assert(v.capacity() == 0);
+	
+	Vector<int, std::allocator<int>, NeverShrinkPolicy> never;
+	for (int i = 0; i < 64; ++i)
+		never.add(i);
+	while (!never.empty())
+		never.erase(0);
+	assert(never.capacity() == 64);
+	
+	Vector<int, std::allocator<int>, CompactCapacityPolicy> compact;
+	size_t expected[] = {1, 2, 3, 4, 6, 6, 9};
+	for (int i = 0; i < 7; ++i) {
+		compact.add(i);
+		assert(compact.capacity() == expected[i]);
+	}
+	
+	TEST_PASS("Vector capacity policy");
+}
+
+/**
+ * @brief Tests Vector resize, emplace_back and move insertion
+ * 
+ * @details Verifies that resize() grows with value-initialized or
+ * copied elements and shrinks by destroying the tail, that
+ * emplace_back() constructs in place, and that add() moves rvalues.
+ * 
+ * @ingroup testing
+ */
+void test_vector_resize_emplace() {
+	TEST_GROUP("Vector resize and emplace");
+	
+	Vector<int> v;
+	v.resize(5);
+	assert(v.size() == 5);
+	for (size_t i = 0; i < v.size(); ++i)
+		assert(v[i] == 0);
+	v.resize(8, 7);
+	assert(v.size() == 8);
+	assert(v[4] == 0 && v[5] == 7 && v[7] == 7);
+	v.resize(2);
+	assert(v.size() == 2);
+	v.resize(40, v[0]);
+	assert(v.size() == 40 && v[39] == 0);
+	
+	Vector<std::pair<int, int>> pairs;
+	pairs.reserve(4);
+	std::pair<int, int> *storage = pairs.data();
+	for (int i = 0; i < 4; ++i)
+		assert(pairs.emplace_back(i, i * 2).second == i * 2);
+	assert(pairs.data() == storage);
+	assert(pairs[3].first == 3);
+	
+	Vector<Vector<int>> nested;
+	Vector<int> inner(3, 1);
+	nested.add(std::move(inner));
+	assert(inner.size() == 0);
+	assert(nested[0].size() == 3);
+	
+	{
+		Vector<Tracked> tracked;
+		tracked.resize(3, Tracked(4));
+		assert(Tracked::live == 3);
+		tracked.emplace_back(tracked[0]);
+		assert(Tracked::live == 4);
+		assert(tracked[3].value == 4);
+		tracked.resize(1, Tracked(0));
+		assert(Tracked::live == 1);
+	}
+	assert(Tracked::live == 0);
+	
+	TEST_PASS("Vector resize and emplace");
+}
+
+/**
+ * @brief Element type whose move constructor may throw
+ * 
+ * @details Counts copy and move constructions, and throws from the
+ * copy constructor once copies_left reaches zero.
+ * 
+ * @ingroup testing
+ */
+struct ThrowingMove {
+	static int copies;       ///< Number of copy constructions performed
+	static int moves;        ///< Number of move constructions performed
+	static int copies_left;  ///< Copies allowed before one throws, -1 for no limit
+	int value;               ///< Stored value
+
+	ThrowingMove(int v) : value(v) {}
+	ThrowingMove(const ThrowingMove &other) : value(other.value) {
+		if (copies_left == 0)
+			throw std::runtime_error("copy failed");
+		if (copies_left > 0)
+			--copies_left;
+		++copies;
+	}
+	ThrowingMove(ThrowingMove &&other) noexcept(false) : value(other.value) { ++moves; }
+	ThrowingMove &operator=(const ThrowingMove &other) = default;
+};
+
+int ThrowingMove::copies = 0;
+int ThrowingMove::moves = 0;
+int ThrowingMove::copies_left = -1;
+
+/**
+ * @brief Move-only element type whose move constructor may throw
+ * 
+ * @ingroup testing
+ */
+struct MoveOnlyThrowing {
+	int value;  ///< Stored value
+
+	MoveOnlyThrowing(int v) : value(v) {}
+	MoveOnlyThrowing(const MoveOnlyThrowing &other) = delete;
+	MoveOnlyThrowing(MoveOnlyThrowing &&other) noexcept(false) : value(other.value) {}
+	MoveOnlyThrowing &operator=(MoveOnlyThrowing &&other) = default;
+};
+
+/**
+ * @brief Tests Vector range insertion for types with a throwing move
+ * 
+ * @details Verifies that growing insertions copy the old elements of
+ * a copyable type instead of moving them, so a failing copy leaves the
+ * vector unchanged, and that move-only types are moved.
+ * 
+ * @ingroup testing
+ */
+void test_vector_throwing_move_insert() {
+	TEST_GROUP("Vector insert with throwing move");
+	
+	static_assert(!std::is_nothrow_move_constructible<ThrowingMove>::value, "move must be allowed to throw");
+	
+	Vector<ThrowingMove> v;
+	v.reserve(4);
+	for (int i = 0; i < 4; ++i)
+		v.add(ThrowingMove(i));
+	ThrowingMove extra[] = {ThrowingMove(10), ThrowingMove(11)};
+	ThrowingMove::copies = 0;
+	ThrowingMove::moves = 0;
+	v.insert(2, extra, extra + 2);
+	assert(ThrowingMove::moves == 0 && ThrowingMove::copies == 6);
+	int expected[] = {0, 1, 10, 11, 2, 3};
+	assert(v.size() == 6);
+	for (size_t i = 0; i < v.size(); ++i)
+		assert(v[i].value == expected[i]);
+	
+	v.shrink_to_fit();
+	ThrowingMove *storage = v.data();
+	ThrowingMove::copies_left = 3;
+	bool thrown = false;
+	try {
+		v.insert(1, extra, extra + 2);
+	} catch (const std::runtime_error&) {
+		thrown = true;
+	}
+	ThrowingMove::copies_left = -1;
+	assert(thrown && v.data() == storage && v.size() == 6);
+	for (size_t i = 0; i < v.size(); ++i)
+		assert(v[i].value == expected[i]);
+	
+	Vector<MoveOnlyThrowing> moved;
+	for (int i = 0; i < 3; ++i)
+		moved.add(MoveOnlyThrowing(i));
+	moved.shrink_to_fit();
+	MoveOnlyThrowing more[] = {MoveOnlyThrowing(7), MoveOnlyThrowing(8)};
+	moved.insert(1, std::make_move_iterator(more), std::make_move_iterator(more + 2));
+	int order[] = {0, 7, 8, 1, 2};
+	assert(moved.size() == 5);
+	for (size_t i = 0; i < moved.size(); ++i)
+		assert(moved[i].value == order[i]);
+	
+	TEST_PASS("Vector insert with throwing move");
+}
+
+/**
+ * @brief Tests Vector range operations
+ * 
+ * @details Verifies range insert and append from pointers, other
+ * containers and the vector itself, index range erase and erase_if,
+ * including element lifetime for non-trivial types.
+ * 
+ * @ingroup testing
+ */
+void test_vector_range_operations() {
+	TEST_GROUP("Vector range operations");
+	
+	Vector<int> v;
+	int values[] = {1, 2, 3, 4, 5};
+	v.append(values, values + 5);
+	assert(v.size() == 5 && v[4] == 5);
+	
+	int middle[] = {10, 11, 12};
+	v.reserve(16);
+	int *storage = v.data();
+	assert(v.insert(2, middle, middle + 3) == v.data() + 2);
+	assert(v.data() == storage);
+	int expected[] = {1, 2, 10, 11, 12, 3, 4, 5};
+	assert(v.size() == 8);
+	for (size_t i = 0; i < v.size(); ++i)
+		assert(v[i] == expected[i]);
+	
+	v.insert(v.size(), v.begin(), v.begin() + 3);
+	assert(v.size() == 11);
+	assert(v[8] == 1 && v[9] == 2 && v[10] == 10);
+	
+	LinkedList<int> ll;
+	for (int i = 0; i < 4; ++i)
+		ll.add(100 + i);
+	v.insert(0, ll.begin(), ll.end());
+	assert(v.size() == 15 && v[0] == 100 && v[3] == 103 && v[4] == 1);
+	
+	assert(v.erase(0, 4) == 4);
+	assert(v.size() == 11 && v[0] == 1);
+	assert(v.erase(3, 3) == 0);
+	assert(v.erase_if([](const int &x) { return x >= 10; }) == 4);
+	int remaining[] = {1, 2, 3, 4, 5, 1, 2};
+	assert(v.size() == 7);
+	for (size_t i = 0; i < v.size(); ++i)
+		assert(v[i] == remaining[i]);
+	
+	bool thrown = false;
+	try {
+		v.erase(5, 8);
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+	thrown = false;
+	try {
+		v.insert(8, values, values + 1);
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+	
+	Vector<int> big;
+	for (int i = 0; i < 64; ++i)
+		big.add(i);
+	big.erase(2, 63);
+	assert(big.size() == 3 && big[2] == 63);
+	assert(big.capacity() == 8);
+	
+	{
+		Vector<Tracked> tracked;
+		for (int i = 0; i < 6; ++i)
+			tracked.add(Tracked(i));
+		Tracked extra[] = {Tracked(20), Tracked(21)};
+		assert(Tracked::live == 8);
+		tracked.insert(1, extra, extra + 2);
+		assert(Tracked::live == 10);
+		tracked.insert(6, extra, extra + 2);
+		assert(Tracked::live == 12);
+		tracked.insert(0, tracked.begin() + 1, tracked.begin() + 4);
+		assert(Tracked::live == 15);
+		int order[] = {20, 21, 1, 0, 20, 21, 1, 2, 3, 20, 21, 4, 5};
+		assert(tracked.size() == 13);
+		for (size_t i = 0; i < tracked.size(); ++i)
+			assert(tracked[i].value == order[i]);
+		tracked.erase(2, 9);
+		assert(Tracked::live == 8);
+		tracked.erase_if([](const Tracked &t) { return t.value == 21; });
+		assert(Tracked::live == 6);
+		assert(tracked.size() == 4 && tracked[1].value == 20 && tracked[3].value == 5);
+	}
+	assert(Tracked::live == 0);
+	
+	TEST_PASS("Vector range operations");
+}
+
 int main() {
 	TEST_HEADER("Vector");
 	
@@ -496,7 +926,14 @@ int main() {
 		test_vector_insert_positions();
 		test_vector_copy_semantics();
 		test_vector_move_semantics();
+		test_vector_move_allocator();
 		test_vector_from_other_collections();
+		test_vector_element_lifetime();
+		test_vector_trivial_relocation();
+		test_vector_capacity_policy();
+		test_vector_resize_emplace();
+		test_vector_range_operations();
+		test_vector_throwing_move_insert();
 		
 		TEST_SUCCESS("Vector");
 		return 0;
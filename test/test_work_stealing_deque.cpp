@@ -0,0 +1,153 @@
+/**
+ * @file test_work_stealing_deque.cpp
+ * @brief Unit tests for WorkStealingDeque concurrent container class
+ * 
+ * @author Lilith Estévez Boeta
+ * @date 2026-10-16
+ * 
+ * @details This file contains unit tests for the WorkStealingDeque
+ * class, covering the owner's LIFO end, stealing from the FIFO end,
+ * buffer growth and an owner racing several thieves.
+ */
+
+#include <iostream>
+#include <atomic>
+#include <cassert>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "test_colors.hpp"
+#include "super_lib.hpp"
+
+/**
+ * @brief Tests WorkStealingDeque on a single thread
+ * 
+ * @details Verifies that the owner pops newest first, that steals take
+ * the oldest element and that both fail on an empty deque.
+ * 
+ * @ingroup testing
+ */
+void test_work_stealing_deque_basic() {
+	TEST_GROUP("WorkStealingDeque basic operations");
+	
+	WorkStealingDeque<int> d(5);
+	assert(d.capacity() == 8 && d.empty());
+	int out = -1;
+	assert(!d.try_pop(out) && !d.try_steal(out) && out == -1);
+	
+	for (int i = 0; i < 6; ++i)
+		d.push(i);
+	assert(d.size() == 6);
+	assert(d.try_pop(out) && out == 5);
+	assert(d.try_steal(out) && out == 0);
+	assert(d.try_steal(out) && out == 1);
+	assert(d.try_pop(out) && out == 4);
+	assert(d.try_pop(out) && out == 3);
+	assert(d.try_pop(out) && out == 2);
+	assert(!d.try_pop(out) && !d.try_steal(out) && d.empty());
+	
+	d.push(7);
+	assert(d.try_steal(out) && out == 7);
+	assert(!d.try_pop(out));
+	
+	TEST_PASS("WorkStealingDeque basic operations");
+}
+
+/**
+ * @brief Tests WorkStealingDeque buffer growth
+ * 
+ * @details Verifies that growing while the live range wraps around the
+ * old buffer keeps every element at both ends.
+ * 
+ * @ingroup testing
+ */
+void test_work_stealing_deque_growth() {
+	TEST_GROUP("WorkStealingDeque growth");
+	
+	WorkStealingDeque<long> d(4);
+	long out;
+	for (long i = 0; i < 3; ++i)
+		d.push(i);
+	assert(d.try_steal(out) && out == 0);
+	assert(d.try_steal(out) && out == 1);
+	for (long i = 3; i < 100; ++i)
+		d.push(i);
+	assert(d.capacity() == 128 && d.size() == 98);
+	for (long i = 2; i < 50; ++i)
+		assert(d.try_steal(out) && out == i);
+	for (long i = 99; i >= 50; --i)
+		assert(d.try_pop(out) && out == i);
+	assert(d.empty());
+	
+	TEST_PASS("WorkStealingDeque growth");
+}
+
+/**
+ * @brief Tests WorkStealingDeque with an owner and several thieves
+ * 
+ * @details The owner pushes tasks, popping some of them itself, while
+ * three thieves steal concurrently; the deque starts small so it grows
+ * while being stolen from. Every task must be taken exactly once.
+ * 
+ * @ingroup testing
+ */
+void test_work_stealing_deque_threads() {
+	TEST_GROUP("WorkStealingDeque owner and thieves");
+	
+	const int thieves = 3;
+	const int tasks = 100000;
+	WorkStealingDeque<int> d(2);
+	std::vector<std::vector<int>> taken(thieves + 1);
+	std::atomic<bool> done(false);
+	std::vector<std::thread> threads;
+	for (int t = 0; t < thieves; ++t) {
+		threads.emplace_back([&, t]() {
+			int value;
+			while (!done.load() || !d.empty()) {
+				if (d.try_steal(value))
+					taken[t].push_back(value);
+				else
+					std::this_thread::yield();
+			}
+		});
+	}
+	
+	int value;
+	for (int i = 0; i < tasks; ++i) {
+		d.push(i);
+		if (i % 3 == 0 && d.try_pop(value))
+			taken[thieves].push_back(value);
+		if (i % 256 == 0)
+			std::this_thread::yield();
+	}
+	while (d.try_pop(value))
+		taken[thieves].push_back(value);
+	done.store(true);
+	for (auto &thread : threads)
+		thread.join();
+	
+	std::vector<int> seen(tasks, 0);
+	for (const auto &values : taken)
+		for (int v : values)
+			++seen[v];
+	for (int count : seen)
+		assert(count == 1);
+	
+	TEST_PASS("WorkStealingDeque owner and thieves");
+}
+
+int main() {
+	TEST_HEADER("WorkStealingDeque");
+	
+	try {
+		test_work_stealing_deque_basic();
+		test_work_stealing_deque_growth();
+		test_work_stealing_deque_threads();
+		
+		TEST_SUCCESS("WorkStealingDeque");
+		return 0;
+	} catch (const std::exception& e) {
+		TEST_FAIL(e.what());
+		return 1;
+	}
+}